@@ -38,9 +38,9 @@ DEFINE_string(solvers, "cg",
               "A comma-separated list of solvers to run. "
               "Supported values are: bicgstab, bicg, cb_gmres_keep, "
               "cb_gmres_reduce1, cb_gmres_reduce2, cb_gmres_integer, "
-              "cb_gmres_ireduce1, cb_gmres_ireduce2, cg, cgs, fcg, gmres, idr, "
-              "lower_trs, upper_trs, spd_direct, symm_direct, "
-              "near_symm_direct, direct, overhead");
+              "cb_gmres_ireduce1, cb_gmres_ireduce2, cg, cgs, chebyshev, fcg, "
+              "gmres, idr, pipe_bicgstab, pipe_cg, lower_trs, upper_trs, "
+              "spd_direct, symm_direct, near_symm_direct, direct, overhead");
 
 DEFINE_uint32(
     nrhs, 1,
@@ -186,9 +186,18 @@ std::unique_ptr<gko::LinOpFactory> generate_solver(
     } else if (description == "cgs") {
         return add_criteria_precond_finalize<gko::solver::Cgs<etype>>(
             exec, precond, max_iters);
+    } else if (description == "chebyshev") {
+        return add_criteria_precond_finalize<gko::solver::Chebyshev<etype>>(
+            exec, precond, max_iters);
     } else if (description == "fcg") {
         return add_criteria_precond_finalize<gko::solver::Fcg<etype>>(
             exec, precond, max_iters);
+    } else if (description == "pipe_bicgstab") {
+        return add_criteria_precond_finalize<gko::solver::PipeBicgstab<etype>>(
+            exec, precond, max_iters);
+    } else if (description == "pipe_cg") {
+        return add_criteria_precond_finalize<gko::solver::PipeCg<etype>>(
+            exec, precond, max_iters);
     } else if (description == "idr") {
         return add_criteria_precond_finalize(
             gko::solver::Idr<etype>::build()
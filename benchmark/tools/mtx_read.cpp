@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <chrono>
+#include <complex>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/mtx_io.hpp>
+
+
+/**
+ * Reads the coordinate entries of a general real MatrixMarket file one by one
+ * from an iostream, as a reference for the performance of gko::read_raw.
+ */
+gko::matrix_data<double, gko::int64> read_sequential(std::istream& is)
+{
+    std::string line;
+    do {
+        std::getline(is, line);
+    } while (is && (line.empty() || line.front() == '%'));
+    std::istringstream dimensions{line};
+    gko::int64 num_rows{};
+    gko::int64 num_cols{};
+    gko::int64 num_nonzeros{};
+    if (!(dimensions >> num_rows >> num_cols >> num_nonzeros)) {
+        throw GKO_STREAM_ERROR("error when reading matrix size");
+    }
+    gko::matrix_data<double, gko::int64> data(gko::dim<2>(
+        static_cast<gko::size_type>(num_rows),
+        static_cast<gko::size_type>(num_cols)));
+    data.nonzeros.reserve(num_nonzeros);
+    for (gko::int64 i = 0; i < num_nonzeros; i++) {
+        gko::int64 row{};
+        gko::int64 col{};
+        double value{};
+        if (!(is >> row >> col >> value)) {
+            throw GKO_STREAM_ERROR("error when reading matrix entry " +
+                                   std::to_string(i));
+        }
+        data.nonzeros.emplace_back(row - 1, col - 1, value);
+        is.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+    return data;
+}
+
+
+template <typename Reader>
+double measure(const char* input, int repetitions, Reader reader)
+{
+    double total{};
+    for (int i = 0; i < repetitions; i++) {
+        std::ifstream is(input);
+        const auto start = std::chrono::steady_clock::now();
+        auto data = reader(is);
+        const auto stop = std::chrono::steady_clock::now();
+        total += std::chrono::duration<double>(stop - start).count();
+    }
+    return total / repetitions;
+}
+
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || (std::string{argv[1]} == "-r" && argc < 4)) {
+        std::cerr
+            << "Usage: " << argv[0]
+            << " [-r repetitions] [input]\n"
+               "Measures the time it takes to read the input file in "
+               "MatrixMarket format with gko::read_raw.\nFor general real "
+               "matrices in coordinate format, it also measures reading the "
+               "entries sequentially from an iostream for comparison.\n";
+        return 1;
+    }
+    const bool has_repetitions = std::string{argv[1]} == "-r";
+    const auto repetitions = has_repetitions ? std::stoi(argv[2]) : 1;
+    const auto input = has_repetitions ? argv[3] : argv[1];
+    std::string header;
+    {
+        // read header, close file again
+        std::ifstream is(input);
+        std::getline(is, header);
+    }
+    try {
+        const auto is_complex = header.find("complex") != std::string::npos;
+        const auto time = measure(input, repetitions, [&](std::istream& is) {
+            if (is_complex) {
+                return gko::read_raw<std::complex<double>, gko::int64>(is)
+                    .nonzeros.size();
+            }
+            return gko::read_raw<double, gko::int64>(is).nonzeros.size();
+        });
+        std::cout << "gko::read_raw: " << time << " s\n";
+        if (header.find("coordinate real general") != std::string::npos) {
+            const auto sequential_time =
+                measure(input, repetitions, [](std::istream& is) {
+                    return read_sequential(is).nonzeros.size();
+                });
+            std::cout << "sequential: " << sequential_time << " s\n"
+                      << "speedup: " << sequential_time / time << '\n';
+        }
+    } catch (gko::Error& err) {
+        std::cerr << err.what() << '\n';
+        return 2;
+    }
+}
@@ -8,7 +8,9 @@
 
 #include <algorithm>
 #include <map>
+#include <numeric>
 #include <string>
+#include <vector>
 
 #include <gflags/gflags.h>
 
@@ -25,7 +27,7 @@ std::string available_format =
     "coo, csr, ell, ell_mixed, sellp, hybrid, hybrid0, hybrid25, hybrid33, "
     "hybrid40, "
     "hybrid60, hybrid80, hybridlimit0, hybridlimit25, hybridlimit33, "
-    "hybridminstorage"
+    "hybridminstorage, sellcs"
 #ifdef HAS_CUDA
     ", cusparse_csr, cusparse_csrex, cusparse_coo"
     ", cusparse_csrmp, cusparse_csrmm, cusparse_ell, cusparse_hybrid"
@@ -56,6 +58,12 @@ std::string format_description =
     "ell_mixed: Mixed Precision Ellpack format according to Bell and Garland:\n"
     "           Efficient Sparse Matrix-Vector Multiplication on CUDA.\n"
     "sellp: Sliced Ellpack uses a default block size of 32.\n"
+    "sellcs: SELL-C-sigma according to Kreutzer et al.: A unified sparse\n"
+    "        matrix data format for efficient general sparse matrix-vector\n"
+    "        multiplication on modern processors with wide SIMD units.\n"
+    "        Sliced Ellpack with a slice size matching a 512 bit SIMD\n"
+    "        register, rows are sorted by length within windows of\n"
+    "        --sellcs_sigma rows.\n"
     "hybrid: Hybrid uses ELL and COO to represent the matrix.\n"
     "hybrid0, hybrid25, hybrid33, hybrid40, hybrid60, hybrid80:\n"
     "    Use 0%, 25%, ... quantiles of the row length distribution\n"
@@ -120,6 +128,10 @@ DEFINE_int64(ell_imbalance_limit, 100,
              "Maximal storage overhead above which ELL benchmarks will be "
              "skipped. Negative values mean no limit.");
 
+DEFINE_int64(sellcs_sigma, 1024,
+             "Size of the windows in which the rows of SELL-C-sigma "
+             "matrices are sorted by their length");
+
 
 namespace formats {
 
@@ -155,6 +167,133 @@ std::shared_ptr<csr::strategy_type> create_gpu_strategy(
 }
 
 
+/**
+ * SELL-C-sigma matrix format: the rows are sorted by decreasing length within
+ * windows of sigma rows before they are stored in a Sellp matrix with slice
+ * size C. Rows of similar length thus end up in the same slice, which reduces
+ * the padding. The apply computes the product with the permuted matrix and
+ * scatters it back to the original row order.
+ */
+class sell_c_sigma : public gko::EnableLinOp<sell_c_sigma>,
+                     public gko::EnableCreateMethod<sell_c_sigma>,
+                     public gko::ReadableFromMatrixData<etype, itype> {
+    friend class gko::EnableCreateMethod<sell_c_sigma>;
+    friend class gko::EnablePolymorphicObject<sell_c_sigma, gko::LinOp>;
+
+public:
+    using sellp = gko::matrix::Sellp<etype, itype>;
+    using vec = gko::matrix::Dense<etype>;
+    using mat_data = gko::matrix_data<etype, itype>;
+    using device_mat_data = gko::device_matrix_data<etype, itype>;
+
+    /**
+     * The slice size C, chosen such that a slice column fills a 512 bit SIMD
+     * register.
+     */
+    static constexpr gko::size_type simd_slice_size =
+        std::max<gko::size_type>(64 / sizeof(etype), 1);
+
+    void read(const device_mat_data& data) override
+    {
+        this->read(data.copy_to_host());
+    }
+
+    void read(device_mat_data&& data) override
+    {
+        this->read(data.copy_to_host());
+    }
+
+    void read(const mat_data& data) override
+    {
+        const auto num_rows = data.size[0];
+        std::vector<gko::size_type> row_lengths(num_rows);
+        for (auto nz : data.nonzeros) {
+            row_lengths[nz.row]++;
+        }
+        // permutation[i] is the original row of permuted row i
+        std::vector<itype> permutation(num_rows);
+        std::iota(permutation.begin(), permutation.end(), itype{});
+        for (gko::size_type begin = 0; begin < num_rows; begin += sigma_) {
+            const auto end = std::min(begin + sigma_, num_rows);
+            std::stable_sort(permutation.begin() + begin,
+                             permutation.begin() + end,
+                             [&](itype a, itype b) {
+                                 return row_lengths[a] > row_lengths[b];
+                             });
+        }
+        std::vector<itype> inverse(num_rows);
+        for (gko::size_type i = 0; i < num_rows; i++) {
+            inverse[permutation[i]] = static_cast<itype>(i);
+        }
+        auto permuted = data;
+        for (auto& nz : permuted.nonzeros) {
+            nz.row = inverse[nz.row];
+        }
+        permuted.sort_row_major();
+        sellp_->read(permuted);
+        permutation_ = gko::array<itype>{this->get_executor(),
+                                         permutation.begin(),
+                                         permutation.end()};
+        this->set_size(data.size);
+    }
+
+    sell_c_sigma(const sell_c_sigma& other)
+        : sell_c_sigma(other.get_executor(), other.sellp_->get_slice_size(),
+                       other.sigma_)
+    {
+        *this = other;
+    }
+
+    sell_c_sigma& operator=(const sell_c_sigma& other)
+    {
+        if (this != &other) {
+            gko::EnableLinOp<sell_c_sigma>::operator=(other);
+            sigma_ = other.sigma_;
+            sellp_->copy_from(other.sellp_);
+            permutation_ = other.permutation_;
+        }
+        return *this;
+    }
+
+protected:
+    void apply_impl(const gko::LinOp* b, gko::LinOp* x) const override
+    {
+        auto dense_x = gko::as<vec>(x);
+        permuted_x_.init(this->get_executor(), dense_x->get_size());
+        sellp_->apply(b, permuted_x_.get());
+        permuted_x_->inverse_row_permute(&permutation_, dense_x);
+    }
+
+    void apply_impl(const gko::LinOp* alpha, const gko::LinOp* b,
+                    const gko::LinOp* beta, gko::LinOp* x) const override
+    {
+        auto dense_x = gko::as<vec>(x);
+        product_.init(this->get_executor(), dense_x->get_size());
+        this->apply_impl(b, product_.get());
+        dense_x->scale(beta);
+        dense_x->add_scaled(alpha, product_.get());
+    }
+
+    sell_c_sigma(std::shared_ptr<const gko::Executor> exec,
+                 gko::size_type slice_size = simd_slice_size,
+                 gko::size_type sigma = FLAGS_sellcs_sigma)
+        : gko::EnableLinOp<sell_c_sigma>(exec),
+          sigma_{std::max<gko::size_type>(sigma, 1)},
+          sellp_{sellp::create(exec, gko::dim<2>{}, slice_size, 1, 0)},
+          permutation_{exec}
+    {}
+
+private:
+    gko::size_type sigma_;
+    std::unique_ptr<sellp> sellp_;
+    gko::array<itype> permutation_;
+    // workspace for the permuted result of the Sellp product
+    gko::detail::DenseCache<etype> permuted_x_;
+    // workspace for the unscaled product in the advanced apply
+    gko::detail::DenseCache<etype> product_;
+};
+
+
 /**
  * Checks whether the given matrix data exceeds the ELL imbalance limit set by
  * the --ell_imbalance_limit flag
@@ -260,7 +399,8 @@ const std::map<std::string, std::function<std::unique_ptr<gko::LinOp>(
         {"hybridminstorage",
          create_matrix_type<hybrid>(
                      std::make_shared<hybrid::minimal_storage_limit>())},
-        {"sellp", create_matrix_type<gko::matrix::Sellp<etype, itype>>()}
+        {"sellp", create_matrix_type<gko::matrix::Sellp<etype, itype>>()},
+        {"sellcs", create_matrix_type<sell_c_sigma>()}
 };
 // clang-format on
 
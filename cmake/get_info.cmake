@@ -204,6 +204,12 @@ if(TARGET hwloc)
     ginkgo_print_variable(${detailed_log} "HWLOC_LIBRARIES")
     ginkgo_print_variable(${detailed_log} "HWLOC_INCLUDE_DIRS")
 endif()
+ginkgo_print_variable(${minimal_log} "GINKGO_WITH_BLAS")
+ginkgo_print_variable(${detailed_log} "GINKGO_WITH_BLAS")
+if(GINKGO_HAVE_BLAS)
+    ginkgo_print_variable(${detailed_log} "GINKGO_BLAS_INTEGER_SIZE")
+    ginkgo_print_variable(${detailed_log} "BLAS_LIBRARIES")
+endif()
 ginkgo_print_module_footer(${detailed_log} "")
 
 ginkgo_print_generic_header(${detailed_log} "  Extensions:")
@@ -5,10 +5,10 @@
 #include "core/multigrid/pgm_kernels.hpp"
 
 #include <memory>
+#include <type_traits>
 
 #include <thrust/device_ptr.h>
 #include <thrust/iterator/zip_iterator.h>
-#include <thrust/reduce.h>
 #include <thrust/sort.h>
 #include <thrust/tuple.h>
 
@@ -17,6 +17,7 @@
 
 #include "common/cuda_hip/base/thrust.hpp"
 #include "common/cuda_hip/base/types.hpp"
+#include "common/unified/base/kernel_launch.hpp"
 
 
 namespace gko {
@@ -41,45 +42,114 @@ void sort_agg(std::shared_ptr<const DefaultExecutor> exec, IndexType num,
 GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_SORT_AGG_KERNEL);
 
 
-template <typename ValueType, typename IndexType>
-void sort_row_major(std::shared_ptr<const DefaultExecutor> exec, size_type nnz,
-                    IndexType* row_idxs, IndexType* col_idxs, ValueType* vals)
+template <typename IndexType>
+void galerkin_count(std::shared_ptr<const DefaultExecutor> exec,
+                    size_type num_agg, const IndexType* agg_ptrs,
+                    const IndexType* agg_rows, const IndexType* row_ptrs,
+                    const IndexType* col_idxs, const IndexType* col_agg,
+                    size_type num_coarse_cols, IndexType* coarse_row_nnz)
 {
-    auto vals_it = as_device_type(vals);
-    auto it = thrust::make_zip_iterator(thrust::make_tuple(row_idxs, col_idxs));
-    // Because reduce_by_key is not deterministic, so we do not need
-    // stable_sort_by_key
-    // TODO: If we have deterministic reduce_by_key, it should be
-    // stable_sort_by_key
-    thrust::sort_by_key(thrust_policy(exec), it, it + nnz, vals_it);
+    // one thread per coarse row, which only counts the first occurrence of
+    // each coarse column. The rows are short for aggregation-based coarsening,
+    // so the quadratic search is cheaper than sorting.
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto agg_ptrs, auto agg_rows, auto row_ptrs,
+                      auto col_idxs, auto col_agg, auto coarse_row_nnz) {
+            using index_type = std::decay_t<decltype(*agg_ptrs)>;
+            index_type count{};
+            for (auto i = agg_ptrs[row]; i < agg_ptrs[row + 1]; i++) {
+                const auto fine_row = agg_rows[i];
+                for (auto nz = row_ptrs[fine_row]; nz < row_ptrs[fine_row + 1];
+                     nz++) {
+                    const auto col = col_agg[col_idxs[nz]];
+                    bool first = true;
+                    for (auto j = agg_ptrs[row]; first && j <= i; j++) {
+                        const auto prev_row = agg_rows[j];
+                        const auto prev_end =
+                            j == i ? nz : row_ptrs[prev_row + 1];
+                        for (auto prev_nz = row_ptrs[prev_row];
+                             first && prev_nz < prev_end; prev_nz++) {
+                            first = col_agg[col_idxs[prev_nz]] != col;
+                        }
+                    }
+                    count += first ? 1 : 0;
+                }
+            }
+            coarse_row_nnz[row] = count;
+        },
+        num_agg, agg_ptrs, agg_rows, row_ptrs, col_idxs, col_agg,
+        coarse_row_nnz);
 }
 
-GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM_SORT_ROW_MAJOR);
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_GALERKIN_COUNT_KERNEL);
 
 
-template <typename ValueType, typename IndexType>
-void compute_coarse_coo(std::shared_ptr<const DefaultExecutor> exec,
-                        size_type fine_nnz, const IndexType* row_idxs,
-                        const IndexType* col_idxs, const ValueType* vals,
-                        matrix::Coo<ValueType, IndexType>* coarse_coo)
+template <typename IndexType>
+void galerkin_fill(std::shared_ptr<const DefaultExecutor> exec,
+                   size_type num_agg, const IndexType* agg_ptrs,
+                   const IndexType* agg_rows, const IndexType* row_ptrs,
+                   const IndexType* col_idxs, const IndexType* col_agg,
+                   size_type num_coarse_cols, const IndexType* coarse_row_ptrs,
+                   IndexType* coarse_col_idxs, IndexType* nz_map)
 {
-    auto vals_it = as_device_type(vals);
-    // this const_cast is necessary as a workaround for CCCL bug
-    // https://github.com/NVIDIA/cccl/issues/1527
-    // shipped with CUDA 12.4
-    auto key_it = thrust::make_zip_iterator(thrust::make_tuple(
-        const_cast<IndexType*>(row_idxs), const_cast<IndexType*>(col_idxs)));
-
-    auto coarse_vals_it = as_device_type(coarse_coo->get_values());
-    auto coarse_key_it = thrust::make_zip_iterator(thrust::make_tuple(
-        coarse_coo->get_row_idxs(), coarse_coo->get_col_idxs()));
-
-    thrust::reduce_by_key(thrust_policy(exec), key_it, key_it + fine_nnz,
-                          vals_it, coarse_key_it, coarse_vals_it);
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto agg_ptrs, auto agg_rows, auto row_ptrs,
+                      auto col_idxs, auto col_agg, auto coarse_row_ptrs,
+                      auto coarse_col_idxs, auto nz_map) {
+            const auto begin = coarse_row_ptrs[row];
+            const auto end = coarse_row_ptrs[row + 1];
+            auto out = begin;
+            for (auto i = agg_ptrs[row]; i < agg_ptrs[row + 1]; i++) {
+                const auto fine_row = agg_rows[i];
+                for (auto nz = row_ptrs[fine_row]; nz < row_ptrs[fine_row + 1];
+                     nz++) {
+                    const auto col = col_agg[col_idxs[nz]];
+                    bool found = false;
+                    for (auto k = begin; !found && k < out; k++) {
+                        found = coarse_col_idxs[k] == col;
+                    }
+                    if (!found) {
+                        coarse_col_idxs[out] = col;
+                        out++;
+                    }
+                }
+            }
+            // insertion sort of the few columns of the coarse row
+            for (auto k = begin + 1; k < end; k++) {
+                const auto col = coarse_col_idxs[k];
+                auto pos = k;
+                while (pos > begin && coarse_col_idxs[pos - 1] > col) {
+                    coarse_col_idxs[pos] = coarse_col_idxs[pos - 1];
+                    pos--;
+                }
+                coarse_col_idxs[pos] = col;
+            }
+            for (auto i = agg_ptrs[row]; i < agg_ptrs[row + 1]; i++) {
+                const auto fine_row = agg_rows[i];
+                for (auto nz = row_ptrs[fine_row]; nz < row_ptrs[fine_row + 1];
+                     nz++) {
+                    const auto col = col_agg[col_idxs[nz]];
+                    auto lo = begin;
+                    auto hi = end - 1;
+                    while (lo < hi) {
+                        const auto mid = lo + (hi - lo) / 2;
+                        if (coarse_col_idxs[mid] < col) {
+                            lo = mid + 1;
+                        } else {
+                            hi = mid;
+                        }
+                    }
+                    nz_map[nz] = lo;
+                }
+            }
+        },
+        num_agg, agg_ptrs, agg_rows, row_ptrs, col_idxs, col_agg,
+        coarse_row_ptrs, coarse_col_idxs, nz_map);
 }
 
-GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
-    GKO_DECLARE_PGM_COMPUTE_COARSE_COO);
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_GALERKIN_FILL_KERNEL);
 
 
 }  // namespace pgm
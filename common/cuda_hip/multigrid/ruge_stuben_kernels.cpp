@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/multigrid/ruge_stuben_kernels.hpp"
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace GKO_DEVICE_NAMESPACE {
+/**
+ * @brief The Ruge-Stueben namespace.
+ *
+ * @ingroup ruge_stuben
+ */
+namespace ruge_stuben {
+
+
+template <typename IndexType>
+void rs_first_pass(std::shared_ptr<const DefaultExecutor> exec,
+                   size_type num_rows, const IndexType* strong_row_ptrs,
+                   const IndexType* strong_col_idxs,
+                   const IndexType* strong_t_row_ptrs,
+                   const IndexType* strong_t_col_idxs,
+                   IndexType* state) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_RS_FIRST_PASS_KERNEL);
+
+
+template <typename IndexType>
+void extended_i_interpolation_count(
+    std::shared_ptr<const DefaultExecutor> exec, size_type num_rows,
+    const IndexType* strong_row_ptrs, const IndexType* strong_col_idxs,
+    const IndexType* state, IndexType* row_nnz) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_EXTENDED_I_INTERPOLATION_COUNT_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void extended_i_interpolation_fill(
+    std::shared_ptr<const DefaultExecutor> exec,
+    const matrix::Csr<ValueType, IndexType>* source,
+    const IndexType* strong_row_ptrs, const IndexType* strong_col_idxs,
+    const IndexType* state, const IndexType* coarse_map,
+    matrix::Csr<ValueType, IndexType>* prolong) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_EXTENDED_I_INTERPOLATION_FILL_KERNEL);
+
+
+}  // namespace ruge_stuben
+}  // namespace GKO_DEVICE_NAMESPACE
+}  // namespace kernels
+}  // namespace gko
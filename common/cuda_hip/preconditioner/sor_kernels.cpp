@@ -97,6 +97,31 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_SOR_INITIALIZE_WEIGHTED_L_U);
 
 
+template <typename IndexType>
+void compute_multicolor_ordering(std::shared_ptr<const DefaultExecutor> exec,
+                                 size_type num_rows, const IndexType* row_ptrs,
+                                 const IndexType* col_idxs,
+                                 const IndexType* trans_row_ptrs,
+                                 const IndexType* trans_col_idxs,
+                                 IndexType* permutation,
+                                 array<IndexType>& color_ptrs)
+    GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_SOR_COMPUTE_MULTICOLOR_ORDERING);
+
+
+template <typename ValueType, typename IndexType>
+void apply_multicolor_sweep(std::shared_ptr<const DefaultExecutor> exec,
+                            const matrix::Csr<ValueType, IndexType>* factor,
+                            const array<IndexType>& color_ptrs, bool forward,
+                            const matrix::Dense<ValueType>* b,
+                            matrix::Dense<ValueType>* x) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SOR_APPLY_MULTICOLOR_SWEEP);
+
+
 }  // namespace sor
 }  // namespace GKO_DEVICE_NAMESPACE
 }  // namespace kernels
@@ -4,6 +4,8 @@
 
 #include "core/multigrid/pgm_kernels.hpp"
 
+#include <type_traits>
+
 #include <ginkgo/core/base/math.hpp>
 
 #include "common/unified/base/kernel_launch.hpp"
@@ -96,68 +98,6 @@ void renumber(std::shared_ptr<const DefaultExecutor> exec,
 GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_RENUMBER_KERNEL);
 
 
-template <typename IndexType>
-void map_row(std::shared_ptr<const DefaultExecutor> exec,
-             size_type num_fine_row, const IndexType* fine_row_ptrs,
-             const IndexType* agg, IndexType* row_idxs)
-{
-    run_kernel(
-        exec,
-        [] GKO_KERNEL(auto tidx, auto fine_row_ptrs, auto agg, auto row_idxs) {
-            const auto coarse_row = agg[tidx];
-            // TODO: when it is necessary, it can use warp per row to improve.
-            for (auto i = fine_row_ptrs[tidx]; i < fine_row_ptrs[tidx + 1];
-                 i++) {
-                row_idxs[i] = coarse_row;
-            }
-        },
-        num_fine_row, fine_row_ptrs, agg, row_idxs);
-}
-
-GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_MAP_ROW_KERNEL);
-
-
-template <typename IndexType>
-void map_col(std::shared_ptr<const DefaultExecutor> exec, size_type nnz,
-             const IndexType* fine_col_idxs, const IndexType* agg,
-             IndexType* col_idxs)
-{
-    run_kernel(
-        exec,
-        [] GKO_KERNEL(auto tidx, auto fine_col_idxs, auto agg, auto col_idxs) {
-            col_idxs[tidx] = agg[fine_col_idxs[tidx]];
-        },
-        nnz, fine_col_idxs, agg, col_idxs);
-}
-
-GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_MAP_COL_KERNEL);
-
-
-template <typename IndexType>
-void count_unrepeated_nnz(std::shared_ptr<const DefaultExecutor> exec,
-                          size_type nnz, const IndexType* row_idxs,
-                          const IndexType* col_idxs, size_type* coarse_nnz)
-{
-    if (nnz > 1) {
-        array<IndexType> d_result(exec, 1);
-        run_kernel_reduction(
-            exec,
-            [] GKO_KERNEL(auto i, auto row_idxs, auto col_idxs) {
-                return row_idxs[i] != row_idxs[i + 1] ||
-                       col_idxs[i] != col_idxs[i + 1];
-            },
-            GKO_KERNEL_REDUCE_SUM(IndexType), d_result.get_data(), nnz - 1,
-            row_idxs, col_idxs);
-        *coarse_nnz = static_cast<size_type>(get_element(d_result, 0) + 1);
-    } else {
-        *coarse_nnz = nnz;
-    }
-}
-
-GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
-    GKO_DECLARE_PGM_COUNT_UNREPEATED_NNZ_KERNEL);
-
-
 template <typename ValueType, typename IndexType>
 void find_strongest_neighbor(
     std::shared_ptr<const DefaultExecutor> exec,
@@ -325,6 +265,114 @@ void gather_index(std::shared_ptr<const DefaultExecutor> exec,
 GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_GATHER_INDEX);
 
 
+template <typename ValueType, typename IndexType>
+void galerkin_numeric(std::shared_ptr<const DefaultExecutor> exec,
+                      size_type num_agg, const IndexType* agg_ptrs,
+                      const IndexType* agg_rows, const IndexType* row_ptrs,
+                      const ValueType* vals, const IndexType* nz_map,
+                      const IndexType* coarse_row_ptrs, ValueType* coarse_vals)
+{
+    // each coarse row only receives contributions from the fine rows of its
+    // aggregate, so no atomics are necessary
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto agg_ptrs, auto agg_rows, auto row_ptrs,
+                      auto vals, auto nz_map, auto coarse_row_ptrs,
+                      auto coarse_vals) {
+            for (auto nz = coarse_row_ptrs[row]; nz < coarse_row_ptrs[row + 1];
+                 nz++) {
+                coarse_vals[nz] = zero(coarse_vals[nz]);
+            }
+            for (auto i = agg_ptrs[row]; i < agg_ptrs[row + 1]; i++) {
+                const auto fine_row = agg_rows[i];
+                for (auto nz = row_ptrs[fine_row]; nz < row_ptrs[fine_row + 1];
+                     nz++) {
+                    coarse_vals[nz_map[nz]] += vals[nz];
+                }
+            }
+        },
+        num_agg, agg_ptrs, agg_rows, row_ptrs, vals, nz_map, coarse_row_ptrs,
+        coarse_vals);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PGM_GALERKIN_NUMERIC_KERNEL);
+
+template <typename ValueType, typename IndexType>
+void filter_prolongation_count(std::shared_ptr<const DefaultExecutor> exec,
+                               const matrix::Csr<ValueType, IndexType>* prolong,
+                               remove_complex<ValueType> threshold,
+                               IndexType* row_nnz)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto row_ptrs, auto vals, auto threshold,
+                      auto row_nnz) {
+            auto max_abs = zero(threshold);
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                max_abs = max(max_abs, abs(vals[nz]));
+            }
+            auto count = zero(row_nnz[row]);
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                count += abs(vals[nz]) >= threshold * max_abs ? 1 : 0;
+            }
+            row_nnz[row] = count;
+        },
+        prolong->get_size()[0], prolong->get_const_row_ptrs(),
+        prolong->get_const_values(), threshold, row_nnz);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PGM_FILTER_PROLONGATION_COUNT_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void filter_prolongation_fill(std::shared_ptr<const DefaultExecutor> exec,
+                              const matrix::Csr<ValueType, IndexType>* prolong,
+                              remove_complex<ValueType> threshold,
+                              matrix::Csr<ValueType, IndexType>* filtered)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto row_ptrs, auto col_idxs, auto vals,
+                      auto threshold, auto out_row_ptrs, auto out_col_idxs,
+                      auto out_vals) {
+            using value_type = std::decay_t<decltype(*vals)>;
+            auto max_abs = zero(threshold);
+            auto row_sum = zero<value_type>();
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                max_abs = max(max_abs, abs(vals[nz]));
+                row_sum += vals[nz];
+            }
+            auto kept_sum = zero<value_type>();
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                if (abs(vals[nz]) >= threshold * max_abs) {
+                    kept_sum += vals[nz];
+                }
+            }
+            // rescale the kept entries to preserve the row sum
+            const auto scale = kept_sum == zero<value_type>()
+                                   ? one<value_type>()
+                                   : row_sum / kept_sum;
+            auto out = out_row_ptrs[row];
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                if (abs(vals[nz]) >= threshold * max_abs) {
+                    out_col_idxs[out] = col_idxs[nz];
+                    out_vals[out] = vals[nz] * scale;
+                    out++;
+                }
+            }
+        },
+        prolong->get_size()[0], prolong->get_const_row_ptrs(),
+        prolong->get_const_col_idxs(), prolong->get_const_values(), threshold,
+        filtered->get_const_row_ptrs(), filtered->get_col_idxs(),
+        filtered->get_values());
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PGM_FILTER_PROLONGATION_FILL_KERNEL);
+
+
 }  // namespace pgm
 }  // namespace GKO_DEVICE_NAMESPACE
 }  // namespace kernels
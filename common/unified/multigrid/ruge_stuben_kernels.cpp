@@ -0,0 +1,380 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/multigrid/ruge_stuben_kernels.hpp"
+
+#include <type_traits>
+
+#include <ginkgo/core/base/math.hpp>
+
+#include "common/unified/base/kernel_launch.hpp"
+#include "common/unified/base/kernel_launch_reduction.hpp"
+#include "core/base/array_access.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace GKO_DEVICE_NAMESPACE {
+/**
+ * @brief The Ruge-Stueben namespace.
+ *
+ * @ingroup ruge_stuben
+ */
+namespace ruge_stuben {
+
+
+using kernels::ruge_stuben::cf_state;
+
+
+template <typename ValueType, typename IndexType>
+void compute_strong_count(std::shared_ptr<const DefaultExecutor> exec,
+                          const matrix::Csr<ValueType, IndexType>* source,
+                          remove_complex<ValueType> threshold,
+                          IndexType* row_nnz)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto row_ptrs, auto col_idxs, auto vals,
+                      auto threshold, auto row_nnz) {
+            const auto begin = row_ptrs[row];
+            const auto end = row_ptrs[row + 1];
+            // only couplings of the opposite sign as the diagonal can be
+            // strong
+            auto sign = one(threshold);
+            for (auto nz = begin; nz < end; nz++) {
+                if (col_idxs[nz] == row && real(vals[nz]) < zero(threshold)) {
+                    sign = -one(threshold);
+                }
+            }
+            auto max_coupling = zero(threshold);
+            for (auto nz = begin; nz < end; nz++) {
+                if (col_idxs[nz] != row) {
+                    max_coupling = max(max_coupling, -sign * real(vals[nz]));
+                }
+            }
+            auto count = zero(row_nnz[row]);
+            for (auto nz = begin; nz < end; nz++) {
+                const auto coupling = -sign * real(vals[nz]);
+                count += col_idxs[nz] != row && coupling > zero(threshold) &&
+                                 coupling >= threshold * max_coupling
+                             ? 1
+                             : 0;
+            }
+            row_nnz[row] = count;
+        },
+        source->get_size()[0], source->get_const_row_ptrs(),
+        source->get_const_col_idxs(), source->get_const_values(), threshold,
+        row_nnz);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_COMPUTE_STRONG_COUNT_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void compute_strong_fill(std::shared_ptr<const DefaultExecutor> exec,
+                         const matrix::Csr<ValueType, IndexType>* source,
+                         remove_complex<ValueType> threshold,
+                         const IndexType* strong_row_ptrs,
+                         IndexType* strong_col_idxs)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto row_ptrs, auto col_idxs, auto vals,
+                      auto threshold, auto strong_row_ptrs,
+                      auto strong_col_idxs) {
+            const auto begin = row_ptrs[row];
+            const auto end = row_ptrs[row + 1];
+            auto sign = one(threshold);
+            for (auto nz = begin; nz < end; nz++) {
+                if (col_idxs[nz] == row && real(vals[nz]) < zero(threshold)) {
+                    sign = -one(threshold);
+                }
+            }
+            auto max_coupling = zero(threshold);
+            for (auto nz = begin; nz < end; nz++) {
+                if (col_idxs[nz] != row) {
+                    max_coupling = max(max_coupling, -sign * real(vals[nz]));
+                }
+            }
+            auto out = strong_row_ptrs[row];
+            for (auto nz = begin; nz < end; nz++) {
+                const auto coupling = -sign * real(vals[nz]);
+                if (col_idxs[nz] != row && coupling > zero(threshold) &&
+                    coupling >= threshold * max_coupling) {
+                    strong_col_idxs[out] = col_idxs[nz];
+                    out++;
+                }
+            }
+        },
+        source->get_size()[0], source->get_const_row_ptrs(),
+        source->get_const_col_idxs(), source->get_const_values(), threshold,
+        strong_row_ptrs, strong_col_idxs);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_COMPUTE_STRONG_FILL_KERNEL);
+
+
+template <typename IndexType>
+void pmis_select(std::shared_ptr<const DefaultExecutor> exec,
+                 size_type num_rows, const IndexType* strong_row_ptrs,
+                 const IndexType* strong_col_idxs,
+                 const IndexType* strong_t_row_ptrs,
+                 const IndexType* strong_t_col_idxs, const IndexType* state,
+                 IndexType* new_state)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto strong_row_ptrs, auto strong_col_idxs,
+                      auto strong_t_row_ptrs, auto strong_t_col_idxs,
+                      auto state, auto new_state) {
+            new_state[row] = state[row];
+            if (state[row] != cf_state::undecided) {
+                return;
+            }
+            if (strong_t_row_ptrs[row] == strong_t_row_ptrs[row + 1]) {
+                // no point can interpolate from this one
+                new_state[row] = cf_state::fine;
+                return;
+            }
+            // the measure is the number of points strongly depending on a
+            // point, ties are broken by a hash of the index and the index
+            const auto measure =
+                (static_cast<uint64>(strong_t_row_ptrs[row + 1] -
+                                     strong_t_row_ptrs[row])
+                 << 32) |
+                static_cast<uint32>(static_cast<uint32>(row) * 2654435761u);
+            bool is_max = true;
+            for (auto nz = strong_row_ptrs[row]; nz < strong_row_ptrs[row + 1];
+                 nz++) {
+                const auto col = strong_col_idxs[nz];
+                const auto col_measure =
+                    (static_cast<uint64>(strong_t_row_ptrs[col + 1] -
+                                         strong_t_row_ptrs[col])
+                     << 32) |
+                    static_cast<uint32>(static_cast<uint32>(col) * 2654435761u);
+                is_max = is_max &&
+                         (state[col] != cf_state::undecided ||
+                          col_measure < measure ||
+                          (col_measure == measure && col < row));
+            }
+            for (auto nz = strong_t_row_ptrs[row];
+                 nz < strong_t_row_ptrs[row + 1]; nz++) {
+                const auto col = strong_t_col_idxs[nz];
+                const auto col_measure =
+                    (static_cast<uint64>(strong_t_row_ptrs[col + 1] -
+                                         strong_t_row_ptrs[col])
+                     << 32) |
+                    static_cast<uint32>(static_cast<uint32>(col) * 2654435761u);
+                is_max = is_max &&
+                         (state[col] != cf_state::undecided ||
+                          col_measure < measure ||
+                          (col_measure == measure && col < row));
+            }
+            if (is_max) {
+                new_state[row] = cf_state::coarse;
+            }
+        },
+        num_rows, strong_row_ptrs, strong_col_idxs, strong_t_row_ptrs,
+        strong_t_col_idxs, state, new_state);
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_RUGE_STUBEN_PMIS_SELECT_KERNEL);
+
+
+template <typename IndexType>
+void pmis_update(std::shared_ptr<const DefaultExecutor> exec,
+                 size_type num_rows, const IndexType* strong_row_ptrs,
+                 const IndexType* strong_col_idxs, const IndexType* new_state,
+                 IndexType* state)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto strong_row_ptrs, auto strong_col_idxs,
+                      auto new_state, auto state) {
+            auto row_state = new_state[row];
+            if (row_state == cf_state::undecided) {
+                for (auto nz = strong_row_ptrs[row];
+                     nz < strong_row_ptrs[row + 1]; nz++) {
+                    if (new_state[strong_col_idxs[nz]] == cf_state::coarse) {
+                        row_state = cf_state::fine;
+                    }
+                }
+            }
+            state[row] = row_state;
+        },
+        num_rows, strong_row_ptrs, strong_col_idxs, new_state, state);
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_RUGE_STUBEN_PMIS_UPDATE_KERNEL);
+
+
+template <typename IndexType>
+void count_undecided(std::shared_ptr<const DefaultExecutor> exec,
+                     size_type num_rows, const IndexType* state,
+                     IndexType* num_undecided)
+{
+    array<IndexType> d_result(exec, 1);
+    run_kernel_reduction(
+        exec,
+        [] GKO_KERNEL(auto row, auto state) {
+            return state[row] == cf_state::undecided;
+        },
+        GKO_KERNEL_REDUCE_SUM(IndexType), d_result.get_data(), num_rows,
+        state);
+
+    *num_undecided = get_element(d_result, 0);
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_COUNT_UNDECIDED_KERNEL);
+
+
+template <typename IndexType>
+void compute_coarse_map(std::shared_ptr<const DefaultExecutor> exec,
+                        size_type num_rows, const IndexType* state,
+                        IndexType* coarse_map)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto state, auto coarse_map) {
+            coarse_map[row] = state[row] == cf_state::coarse ? 1 : 0;
+        },
+        num_rows, state, coarse_map);
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_COMPUTE_COARSE_MAP_KERNEL);
+
+
+template <typename IndexType>
+void direct_interpolation_count(std::shared_ptr<const DefaultExecutor> exec,
+                                size_type num_rows,
+                                const IndexType* strong_row_ptrs,
+                                const IndexType* strong_col_idxs,
+                                const IndexType* state, IndexType* row_nnz)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto strong_row_ptrs, auto strong_col_idxs,
+                      auto state, auto row_nnz) {
+            if (state[row] == cf_state::coarse) {
+                row_nnz[row] = 1;
+                return;
+            }
+            auto count = zero(row_nnz[row]);
+            for (auto nz = strong_row_ptrs[row]; nz < strong_row_ptrs[row + 1];
+                 nz++) {
+                count += state[strong_col_idxs[nz]] == cf_state::coarse ? 1 : 0;
+            }
+            row_nnz[row] = count;
+        },
+        num_rows, strong_row_ptrs, strong_col_idxs, state, row_nnz);
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_DIRECT_INTERPOLATION_COUNT_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void direct_interpolation_fill(std::shared_ptr<const DefaultExecutor> exec,
+                               const matrix::Csr<ValueType, IndexType>* source,
+                               const IndexType* strong_row_ptrs,
+                               const IndexType* strong_col_idxs,
+                               const IndexType* state,
+                               const IndexType* coarse_map,
+                               matrix::Csr<ValueType, IndexType>* prolong)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto row_ptrs, auto col_idxs, auto vals,
+                      auto strong_row_ptrs, auto strong_col_idxs, auto state,
+                      auto coarse_map, auto out_row_ptrs, auto out_col_idxs,
+                      auto out_vals) {
+            using value_type = std::decay_t<decltype(*vals)>;
+            using real_type = remove_complex<value_type>;
+            auto out = out_row_ptrs[row];
+            if (state[row] == cf_state::coarse) {
+                out_col_idxs[out] = coarse_map[row];
+                out_vals[out] = one<value_type>();
+                return;
+            }
+            auto diag = zero<value_type>();
+            auto neg_sum = zero<value_type>();
+            auto pos_sum = zero<value_type>();
+            auto neg_interp_sum = zero<value_type>();
+            auto pos_interp_sum = zero<value_type>();
+            // the strong connections are a sorted subset of the row
+            auto strong_nz = strong_row_ptrs[row];
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                const auto col = col_idxs[nz];
+                const auto val = vals[nz];
+                bool interp = false;
+                if (strong_nz < strong_row_ptrs[row + 1] &&
+                    strong_col_idxs[strong_nz] == col) {
+                    interp = state[col] == cf_state::coarse;
+                    strong_nz++;
+                }
+                if (col == row) {
+                    diag += val;
+                } else if (real(val) < zero<real_type>()) {
+                    neg_sum += val;
+                    neg_interp_sum += interp ? val : zero<value_type>();
+                } else {
+                    pos_sum += val;
+                    pos_interp_sum += interp ? val : zero<value_type>();
+                }
+            }
+            // the positive couplings are lumped to the diagonal if there are
+            // no positive interpolatory couplings
+            const auto neg_scale = neg_interp_sum == zero<value_type>()
+                                       ? zero<value_type>()
+                                       : neg_sum / neg_interp_sum;
+            auto pos_scale = zero<value_type>();
+            if (pos_interp_sum == zero<value_type>()) {
+                diag += pos_sum;
+            } else {
+                pos_scale = pos_sum / pos_interp_sum;
+            }
+            for (auto nz = strong_row_ptrs[row]; nz < strong_row_ptrs[row + 1];
+                 nz++) {
+                const auto col = strong_col_idxs[nz];
+                if (state[col] != cf_state::coarse) {
+                    continue;
+                }
+                // binary search for the value of the strong connection
+                auto begin = row_ptrs[row];
+                auto end = row_ptrs[row + 1];
+                while (end - begin > 1) {
+                    const auto mid = begin + (end - begin) / 2;
+                    if (col_idxs[mid] <= col) {
+                        begin = mid;
+                    } else {
+                        end = mid;
+                    }
+                }
+                const auto val = vals[begin];
+                const auto scale =
+                    real(val) < zero<real_type>() ? neg_scale : pos_scale;
+                out_col_idxs[out] = coarse_map[col];
+                out_vals[out] = -scale * val / diag;
+                out++;
+            }
+        },
+        source->get_size()[0], source->get_const_row_ptrs(),
+        source->get_const_col_idxs(), source->get_const_values(),
+        strong_row_ptrs, strong_col_idxs, state, coarse_map,
+        prolong->get_const_row_ptrs(), prolong->get_col_idxs(),
+        prolong->get_values());
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_DIRECT_INTERPOLATION_FILL_KERNEL);
+
+
+}  // namespace ruge_stuben
+}  // namespace GKO_DEVICE_NAMESPACE
+}  // namespace kernels
+}  // namespace gko
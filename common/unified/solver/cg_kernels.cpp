@@ -6,6 +6,7 @@
 
 #include <ginkgo/core/base/math.hpp>
 
+#include "common/unified/base/kernel_launch_reduction.hpp"
 #include "common/unified/base/kernel_launch_solver.hpp"
 
 
@@ -109,6 +110,91 @@ void step_2(std::shared_ptr<const DefaultExecutor> exec,
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CG_STEP_2_KERNEL);
 
 
+template <typename ValueType>
+void fused_step_1(std::shared_ptr<const DefaultExecutor> exec,
+                  matrix::Dense<ValueType>* p,
+                  const matrix::Dense<ValueType>* r, const ValueType* inv_diag,
+                  const matrix::Dense<ValueType>* rho,
+                  const matrix::Dense<ValueType>* prev_rho,
+                  const array<stopping_status>* stop_status)
+{
+    run_kernel_solver(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto p, auto r, auto inv_diag,
+                      auto rho, auto prev_rho, auto stop) {
+            if (!stop[col].has_stopped()) {
+                auto tmp = safe_divide(rho[col], prev_rho[col]);
+                const auto z = inv_diag ? inv_diag[row] * r(row, col)
+                                        : r(row, col);
+                p(row, col) = z + tmp * p(row, col);
+            }
+        },
+        p->get_size(), p->get_stride(), default_stride(p), default_stride(r),
+        inv_diag, row_vector(rho), row_vector(prev_rho), *stop_status);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CG_FUSED_STEP_1_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void spmv_dot(std::shared_ptr<const DefaultExecutor> exec,
+              const matrix::Csr<ValueType, IndexType>* a,
+              const matrix::Dense<ValueType>* p, matrix::Dense<ValueType>* q,
+              matrix::Dense<ValueType>* beta, array<char>& tmp)
+{
+    // every entry of q is computed exactly once by the reduction, so it is
+    // stored as a side effect while p' * q is accumulated
+    run_kernel_col_reduction_cached(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto row_ptrs, auto col_idxs,
+                      auto vals, auto p, auto q) {
+            auto sum = zero(q(row, col));
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                sum += vals[nz] * p(col_idxs[nz], col);
+            }
+            q(row, col) = sum;
+            return conj(p(row, col)) * sum;
+        },
+        GKO_KERNEL_REDUCE_SUM(ValueType), beta->get_values(), q->get_size(),
+        tmp, a->get_const_row_ptrs(), a->get_const_col_idxs(),
+        a->get_const_values(), p, q);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CG_SPMV_DOT_KERNEL);
+
+
+template <typename ValueType>
+void fused_step_2(std::shared_ptr<const DefaultExecutor> exec,
+                  matrix::Dense<ValueType>* x, matrix::Dense<ValueType>* r,
+                  const matrix::Dense<ValueType>* p,
+                  const matrix::Dense<ValueType>* q, const ValueType* inv_diag,
+                  const matrix::Dense<ValueType>* beta,
+                  const matrix::Dense<ValueType>* prev_rho,
+                  matrix::Dense<ValueType>* rho, array<char>& tmp,
+                  const array<stopping_status>* stop_status)
+{
+    // the updates of x and r are side effects of the reduction computing the
+    // next rho = r' * inv_diag * r, each entry is visited exactly once
+    run_kernel_col_reduction_cached(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto x, auto r, auto p, auto q,
+                      auto inv_diag, auto beta, auto prev_rho, auto stop) {
+            if (!stop[col].has_stopped()) {
+                auto alpha = safe_divide(prev_rho[col], beta[col]);
+                x(row, col) += alpha * p(row, col);
+                r(row, col) -= alpha * q(row, col);
+            }
+            const auto r_val = r(row, col);
+            return conj(r_val) * (inv_diag ? inv_diag[row] * r_val : r_val);
+        },
+        GKO_KERNEL_REDUCE_SUM(ValueType), rho->get_values(), x->get_size(),
+        tmp, x, r, p, q, inv_diag, beta->get_const_values(),
+        prev_rho->get_const_values(), *stop_status);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CG_FUSED_STEP_2_KERNEL);
+
+
 }  // namespace cg
 }  // namespace GKO_DEVICE_NAMESPACE
 }  // namespace kernels
@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/solver/chebyshev_kernels.hpp"
+
+#include <ginkgo/core/base/math.hpp>
+
+#include "common/unified/base/kernel_launch.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace GKO_DEVICE_NAMESPACE {
+/**
+ * @brief The Chebyshev solver namespace.
+ *
+ * @ingroup chebyshev
+ */
+namespace chebyshev {
+
+
+template <typename ValueType>
+void init_update(std::shared_ptr<const DefaultExecutor> exec,
+                 const ValueType alpha,
+                 const matrix::Dense<ValueType>* inner_sol,
+                 matrix::Dense<ValueType>* update_sol,
+                 matrix::Dense<ValueType>* output)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto alpha, auto inner_sol,
+                      auto update_sol, auto output) {
+            const auto inner_val = inner_sol(row, col);
+            update_sol(row, col) = inner_val;
+            output(row, col) += alpha * inner_val;
+        },
+        output->get_size(), alpha, inner_sol, update_sol, output);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CHEBYSHEV_INIT_UPDATE_KERNEL);
+
+
+template <typename ValueType>
+void update(std::shared_ptr<const DefaultExecutor> exec, const ValueType alpha,
+            const ValueType beta, const matrix::Dense<ValueType>* inner_sol,
+            matrix::Dense<ValueType>* update_sol,
+            matrix::Dense<ValueType>* output)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto alpha, auto beta,
+                      auto inner_sol, auto update_sol, auto output) {
+            const auto update_val =
+                inner_sol(row, col) + beta * update_sol(row, col);
+            update_sol(row, col) = update_val;
+            output(row, col) += alpha * update_val;
+        },
+        output->get_size(), alpha, beta, inner_sol, update_sol, output);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CHEBYSHEV_UPDATE_KERNEL);
+
+
+}  // namespace chebyshev
+}  // namespace GKO_DEVICE_NAMESPACE
+}  // namespace kernels
+}  // namespace gko
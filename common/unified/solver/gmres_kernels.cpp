@@ -121,6 +121,227 @@ void multi_dot(std::shared_ptr<const DefaultExecutor> exec,
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_MULTI_DOT_KERNEL);
 
+
+template <typename ValueType>
+void block_dot(std::shared_ptr<const DefaultExecutor> exec,
+               const matrix::Dense<ValueType>* krylov_bases,
+               size_type num_prev_bases, size_type block_size,
+               matrix::Dense<ValueType>* block_coefficients)
+{
+    const auto num_bases = num_prev_bases + block_size;
+    const auto num_rows = krylov_bases->get_size()[0] / num_bases;
+    const auto num_rhs = krylov_bases->get_size()[1];
+    run_kernel_col_reduction(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto bases, auto num_prev_bases,
+                      auto block_size, auto num_rhs, auto num_rows) {
+            const auto irhs = col % num_rhs;
+            const auto entry = col / num_rhs;
+            const auto ivec = entry / block_size;  // which Krylov vector
+            const auto iblock = entry % block_size;  // which block vector
+            return conj(bases(ivec * num_rows + row, irhs)) *
+                   bases((num_prev_bases + iblock) * num_rows + row, irhs);
+        },
+        GKO_KERNEL_REDUCE_SUM(ValueType), block_coefficients->get_values(),
+        gko::dim<2>{num_rows, num_bases * block_size * num_rhs}, krylov_bases,
+        static_cast<int64>(num_prev_bases), static_cast<int64>(block_size),
+        static_cast<int64>(num_rhs), static_cast<int64>(num_rows));
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_BLOCK_DOT_KERNEL);
+
+
+template <typename ValueType>
+void block_cholesky(std::shared_ptr<const DefaultExecutor> exec,
+                    matrix::Dense<ValueType>* block_coefficients,
+                    size_type num_prev_bases, size_type block_size,
+                    const stopping_status* stop_status)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto rhs, auto coef, auto num_prev_bases,
+                      auto block_size, auto stop_status) {
+            using value_type = std::decay_t<decltype(coef(0, 0))>;
+            using real_type = remove_complex<value_type>;
+            if (stop_status[rhs].has_stopped()) {
+                return;
+            }
+            // gram = num_prev_bases * block_size is the offset of the gram
+            // matrix G = W^H W, the rows before contain R12 = V^H W
+            const auto gram = num_prev_bases * block_size;
+            // G = G - R12^H R12 is the gram matrix of W - V R12
+            for (int64 m = 0; m < block_size; m++) {
+                for (int64 l = m; l < block_size; l++) {
+                    auto value = coef(gram + m * block_size + l, rhs);
+                    for (int64 i = 0; i < num_prev_bases; i++) {
+                        value -= conj(coef(i * block_size + m, rhs)) *
+                                 coef(i * block_size + l, rhs);
+                    }
+                    coef(gram + m * block_size + l, rhs) = value;
+                }
+            }
+            // G = R22^H R22, computed in-place
+            for (int64 m = 0; m < block_size; m++) {
+                auto diag = real(coef(gram + m * block_size + m, rhs));
+                for (int64 i = 0; i < m; i++) {
+                    diag -= squared_norm(coef(gram + i * block_size + m, rhs));
+                }
+                for (int64 l = 0; l < m; l++) {
+                    coef(gram + m * block_size + l, rhs) = zero<value_type>();
+                }
+                if (!(diag > zero<real_type>())) {
+                    // the block is numerically rank-deficient
+                    for (int64 l = m; l < block_size; l++) {
+                        coef(gram + m * block_size + l, rhs) =
+                            zero<value_type>();
+                    }
+                    continue;
+                }
+                const value_type diag_root = sqrt(diag);
+                coef(gram + m * block_size + m, rhs) = diag_root;
+                for (int64 l = m + 1; l < block_size; l++) {
+                    auto value = coef(gram + m * block_size + l, rhs);
+                    for (int64 i = 0; i < m; i++) {
+                        value -= conj(coef(gram + i * block_size + m, rhs)) *
+                                 coef(gram + i * block_size + l, rhs);
+                    }
+                    coef(gram + m * block_size + l, rhs) = value / diag_root;
+                }
+            }
+        },
+        block_coefficients->get_size()[1], block_coefficients,
+        static_cast<int64>(num_prev_bases), static_cast<int64>(block_size),
+        stop_status);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_BLOCK_CHOLESKY_KERNEL);
+
+
+template <typename ValueType>
+void block_orthonormalize(std::shared_ptr<const DefaultExecutor> exec,
+                          matrix::Dense<ValueType>* krylov_bases,
+                          const matrix::Dense<ValueType>* block_coefficients,
+                          size_type num_prev_bases, size_type block_size,
+                          const stopping_status* stop_status)
+{
+    const auto num_bases = num_prev_bases + block_size;
+    const auto num_rows = krylov_bases->get_size()[0] / num_bases;
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto rhs, auto bases, auto coef,
+                      auto num_prev_bases, auto block_size, auto num_rows,
+                      auto stop_status) {
+            using value_type = std::decay_t<decltype(coef(0, 0))>;
+            if (stop_status[rhs].has_stopped()) {
+                return;
+            }
+            // q_l = (w_l - V R12(:, l) - Q(:, :l) R22(:l, l)) / R22(l, l)
+            for (int64 l = 0; l < block_size; l++) {
+                const auto block_row = (num_prev_bases + l) * num_rows + row;
+                auto value = bases(block_row, rhs);
+                for (int64 i = 0; i < num_prev_bases + l; i++) {
+                    value -= bases(i * num_rows + row, rhs) *
+                             coef(i * block_size + l, rhs);
+                }
+                const auto diag =
+                    coef((num_prev_bases + l) * block_size + l, rhs);
+                bases(block_row, rhs) =
+                    is_zero(diag) ? zero<value_type>() : value / diag;
+            }
+        },
+        dim<2>{num_rows, krylov_bases->get_size()[1]}, krylov_bases,
+        block_coefficients, static_cast<int64>(num_prev_bases),
+        static_cast<int64>(block_size), static_cast<int64>(num_rows),
+        stop_status);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(
+    GKO_DECLARE_GMRES_BLOCK_ORTHONORMALIZE_KERNEL);
+
+
+template <typename ValueType>
+void block_hessenberg(std::shared_ptr<const DefaultExecutor> exec,
+                      matrix::Dense<ValueType>* block_coefficients,
+                      const matrix::Dense<ValueType>* block_reorth_coefficients,
+                      matrix::Dense<ValueType>* arnoldi_hessenberg,
+                      matrix::Dense<ValueType>* hessenberg,
+                      matrix::Dense<ValueType>* basis_scaling, size_type iter,
+                      size_type block_size, const stopping_status* stop_status)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto rhs, auto coef, auto reorth, auto arnoldi,
+                      auto hessenberg, auto scaling, auto iter,
+                      auto block_size, auto num_rhs, auto stop_status) {
+            using value_type = std::decay_t<decltype(coef(0, 0))>;
+            using real_type = remove_complex<value_type>;
+            if (stop_status[rhs].has_stopped()) {
+                return;
+            }
+            const auto num_prev_bases = iter + 1;
+            const auto gram = num_prev_bases * block_size;
+            // combine both passes: W = V R12 + Q1 R22, Q1 = V R12' + Q R22'
+            // gives W = V (R12 + R12' R22) + Q R22' R22
+            for (int64 i = 0; i < num_prev_bases; i++) {
+                for (int64 l = 0; l < block_size; l++) {
+                    auto value = coef(i * block_size + l, rhs);
+                    for (int64 m = 0; m <= l; m++) {
+                        value += reorth(i * block_size + m, rhs) *
+                                 coef(gram + m * block_size + l, rhs);
+                    }
+                    coef(i * block_size + l, rhs) = value;
+                }
+            }
+            for (int64 m = 0; m < block_size; m++) {
+                for (int64 l = m; l < block_size; l++) {
+                    auto value = zero<value_type>();
+                    for (int64 i = m; i <= l; i++) {
+                        value += reorth(gram + m * block_size + i, rhs) *
+                                 coef(gram + i * block_size + l, rhs);
+                    }
+                    coef(gram + m * block_size + l, rhs) = value;
+                }
+            }
+            // A M K(:, c) = scale_c K(:, c + 1) for the s-step basis
+            // K = [v_iter, w_1, ..., w_s] = V R gives the columns of the
+            // Arnoldi relation A M V = V H one after another:
+            // H(:, iter + c) = (scale_c R(:, c + 1) - H(:, :iter + c)
+            //                  R(:iter + c, c)) / R(iter + c, c)
+            // with R(:, 0) = e_iter and R(:, c) = coef(:, c - 1) otherwise
+            const auto sigma = scaling(0, rhs);
+            auto new_sigma = abs(sigma);
+            for (int64 c = 0; c < block_size; c++) {
+                const auto col = iter + c;
+                const auto scale = c == 0 ? one<value_type>() : sigma;
+                const auto diag = c == 0 ? one<value_type>()
+                                         : coef(col * block_size + c - 1, rhs);
+                real_type col_norm{};
+                for (int64 row = 0; row <= col + 1; row++) {
+                    auto value = scale * coef(row * block_size + c, rhs);
+                    for (int64 l = row > 0 ? row - 1 : 0; l < col; l++) {
+                        const auto basis_coef =
+                            c == 0 ? (l == iter ? one<value_type>()
+                                                : zero<value_type>())
+                                   : coef(l * block_size + c - 1, rhs);
+                        value -= arnoldi(l, row * num_rhs + rhs) * basis_coef;
+                    }
+                    value = is_zero(diag) ? zero<value_type>() : value / diag;
+                    arnoldi(col, row * num_rhs + rhs) = value;
+                    hessenberg(col, row * num_rhs + rhs) = value;
+                    col_norm += squared_norm(value);
+                }
+                new_sigma = max(new_sigma, sqrt(col_norm));
+            }
+            scaling(0, rhs) = new_sigma;
+        },
+        block_coefficients->get_size()[1], block_coefficients,
+        block_reorth_coefficients, arnoldi_hessenberg, hessenberg,
+        basis_scaling, static_cast<int64>(iter), static_cast<int64>(block_size),
+        static_cast<int64>(block_coefficients->get_size()[1]), stop_status);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_BLOCK_HESSENBERG_KERNEL);
+
 }  // namespace gmres
 }  // namespace GKO_DEVICE_NAMESPACE
 }  // namespace kernels
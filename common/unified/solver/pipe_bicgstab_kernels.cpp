@@ -0,0 +1,213 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/solver/pipe_bicgstab_kernels.hpp"
+
+#include <ginkgo/core/base/math.hpp>
+
+#include "common/unified/base/kernel_launch_solver.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace GKO_DEVICE_NAMESPACE {
+/**
+ * @brief The PIPE_BICGSTAB solver namespace.
+ *
+ * @ingroup pipe_bicgstab
+ */
+namespace pipe_bicgstab {
+
+
+template <typename ValueType>
+void initialize(std::shared_ptr<const DefaultExecutor> exec,
+                const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* r,
+                matrix::Dense<ValueType>* ph, matrix::Dense<ValueType>* s,
+                matrix::Dense<ValueType>* sh, matrix::Dense<ValueType>* z,
+                matrix::Dense<ValueType>* zh, matrix::Dense<ValueType>* v,
+                matrix::Dense<ValueType>* alpha,
+                matrix::Dense<ValueType>* beta,
+                matrix::Dense<ValueType>* omega,
+                matrix::Dense<ValueType>* prev_rho,
+                matrix::Dense<ValueType>* yq, matrix::Dense<ValueType>* yy,
+                array<stopping_status>* stop_status)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto col, auto alpha, auto beta, auto omega,
+                      auto prev_rho, auto yq, auto yy, auto stop) {
+            alpha[col] = zero(alpha[col]);
+            beta[col] = zero(beta[col]);
+            omega[col] = zero(omega[col]);
+            prev_rho[col] = zero(prev_rho[col]);
+            yq[col] = zero(yq[col]);
+            yy[col] = zero(yy[col]);
+            stop[col].reset();
+        },
+        b->get_size()[1], row_vector(alpha), row_vector(beta),
+        row_vector(omega), row_vector(prev_rho), row_vector(yq),
+        row_vector(yy), *stop_status);
+    if (b->get_size()) {
+        run_kernel_solver(
+            exec,
+            [] GKO_KERNEL(auto row, auto col, auto b, auto r, auto ph, auto s,
+                          auto sh, auto z, auto zh, auto v) {
+                r(row, col) = b(row, col);
+                ph(row, col) = s(row, col) = sh(row, col) = z(row, col) =
+                    zh(row, col) = v(row, col) = zero(r(row, col));
+            },
+            b->get_size(), b->get_stride(), b, default_stride(r),
+            default_stride(ph), default_stride(s), default_stride(sh),
+            default_stride(z), default_stride(zh), default_stride(v));
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(
+    GKO_DECLARE_PIPE_BICGSTAB_INITIALIZE_KERNEL);
+
+
+template <typename ValueType>
+void step_1(std::shared_ptr<const DefaultExecutor> exec,
+            const matrix::Dense<ValueType>* r,
+            const matrix::Dense<ValueType>* rh,
+            const matrix::Dense<ValueType>* w,
+            const matrix::Dense<ValueType>* wh,
+            const matrix::Dense<ValueType>* t, matrix::Dense<ValueType>* ph,
+            matrix::Dense<ValueType>* s, matrix::Dense<ValueType>* sh,
+            matrix::Dense<ValueType>* z, const matrix::Dense<ValueType>* zh,
+            const matrix::Dense<ValueType>* v, matrix::Dense<ValueType>* q,
+            matrix::Dense<ValueType>* qh, matrix::Dense<ValueType>* y,
+            const matrix::Dense<ValueType>* alpha,
+            const matrix::Dense<ValueType>* beta,
+            const matrix::Dense<ValueType>* omega,
+            const array<stopping_status>* stop_status)
+{
+    run_kernel_solver(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto r, auto rh, auto w, auto wh,
+                      auto t, auto ph, auto s, auto sh, auto z, auto zh,
+                      auto v, auto q, auto qh, auto y, auto alpha, auto beta,
+                      auto omega, auto stop) {
+            if (!stop[col].has_stopped()) {
+                const auto new_ph =
+                    rh(row, col) +
+                    beta[col] * (ph(row, col) - omega[col] * sh(row, col));
+                const auto new_s =
+                    w(row, col) +
+                    beta[col] * (s(row, col) - omega[col] * z(row, col));
+                const auto new_sh =
+                    wh(row, col) +
+                    beta[col] * (sh(row, col) - omega[col] * zh(row, col));
+                const auto new_z =
+                    t(row, col) +
+                    beta[col] * (z(row, col) - omega[col] * v(row, col));
+                ph(row, col) = new_ph;
+                s(row, col) = new_s;
+                sh(row, col) = new_sh;
+                z(row, col) = new_z;
+                q(row, col) = r(row, col) - alpha[col] * new_s;
+                qh(row, col) = rh(row, col) - alpha[col] * new_sh;
+                y(row, col) = w(row, col) - alpha[col] * new_z;
+            }
+        },
+        r->get_size(), r->get_stride(), default_stride(r), default_stride(rh),
+        default_stride(w), default_stride(wh), default_stride(t),
+        default_stride(ph), default_stride(s), default_stride(sh),
+        default_stride(z), default_stride(zh), default_stride(v),
+        default_stride(q), default_stride(qh), default_stride(y),
+        row_vector(alpha), row_vector(beta), row_vector(omega), *stop_status);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_BICGSTAB_STEP_1_KERNEL);
+
+
+template <typename ValueType>
+void step_2(std::shared_ptr<const DefaultExecutor> exec,
+            matrix::Dense<ValueType>* x, matrix::Dense<ValueType>* r,
+            matrix::Dense<ValueType>* rh, matrix::Dense<ValueType>* w,
+            const matrix::Dense<ValueType>* wh,
+            const matrix::Dense<ValueType>* t,
+            const matrix::Dense<ValueType>* ph,
+            const matrix::Dense<ValueType>* q,
+            const matrix::Dense<ValueType>* qh,
+            const matrix::Dense<ValueType>* y,
+            const matrix::Dense<ValueType>* zh,
+            const matrix::Dense<ValueType>* v,
+            const matrix::Dense<ValueType>* alpha,
+            const matrix::Dense<ValueType>* yq,
+            const matrix::Dense<ValueType>* yy,
+            const array<stopping_status>* stop_status)
+{
+    run_kernel_solver(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto x, auto r, auto rh, auto w,
+                      auto wh, auto t, auto ph, auto q, auto qh, auto y,
+                      auto zh, auto v, auto alpha, auto yq, auto yy,
+                      auto stop) {
+            if (!stop[col].has_stopped()) {
+                const auto omega = safe_divide(yq[col], yy[col]);
+                x(row, col) += alpha[col] * ph(row, col) + omega * qh(row, col);
+                r(row, col) = q(row, col) - omega * y(row, col);
+                rh(row, col) =
+                    qh(row, col) -
+                    omega * (wh(row, col) - alpha[col] * zh(row, col));
+                w(row, col) = y(row, col) -
+                              omega * (t(row, col) - alpha[col] * v(row, col));
+            }
+        },
+        x->get_size(), r->get_stride(), x, default_stride(r),
+        default_stride(rh), default_stride(w), default_stride(wh),
+        default_stride(t), default_stride(ph), default_stride(q),
+        default_stride(qh), default_stride(y), default_stride(zh),
+        default_stride(v), row_vector(alpha), row_vector(yq), row_vector(yy),
+        *stop_status);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_BICGSTAB_STEP_2_KERNEL);
+
+
+template <typename ValueType>
+void step_3(std::shared_ptr<const DefaultExecutor> exec,
+            matrix::Dense<ValueType>* alpha, matrix::Dense<ValueType>* beta,
+            matrix::Dense<ValueType>* omega,
+            matrix::Dense<ValueType>* prev_rho,
+            const matrix::Dense<ValueType>* yq,
+            const matrix::Dense<ValueType>* yy,
+            const matrix::Dense<ValueType>* rho,
+            const matrix::Dense<ValueType>* rr_w,
+            const matrix::Dense<ValueType>* rr_s,
+            const matrix::Dense<ValueType>* rr_z,
+            const array<stopping_status>* stop_status)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto col, auto alpha, auto beta, auto omega,
+                      auto prev_rho, auto yq, auto yy, auto rho, auto rr_w,
+                      auto rr_s, auto rr_z, auto stop) {
+            if (!stop[col].has_stopped()) {
+                // all scalars are zero before the first iteration
+                const auto new_omega = safe_divide(yq[col], yy[col]);
+                const auto new_beta = safe_divide(alpha[col] * rho[col],
+                                                  new_omega * prev_rho[col]);
+                alpha[col] = safe_divide(
+                    rho[col], rr_w[col] + new_beta * rr_s[col] -
+                                  new_beta * new_omega * rr_z[col]);
+                beta[col] = new_beta;
+                omega[col] = new_omega;
+                prev_rho[col] = rho[col];
+            }
+        },
+        alpha->get_size()[1], row_vector(alpha), row_vector(beta),
+        row_vector(omega), row_vector(prev_rho), row_vector(yq),
+        row_vector(yy), row_vector(rho), row_vector(rr_w), row_vector(rr_s),
+        row_vector(rr_z), *stop_status);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_BICGSTAB_STEP_3_KERNEL);
+
+
+}  // namespace pipe_bicgstab
+}  // namespace GKO_DEVICE_NAMESPACE
+}  // namespace kernels
+}  // namespace gko
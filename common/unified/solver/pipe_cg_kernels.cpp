@@ -0,0 +1,141 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/solver/pipe_cg_kernels.hpp"
+
+#include <ginkgo/core/base/math.hpp>
+
+#include "common/unified/base/kernel_launch_solver.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace GKO_DEVICE_NAMESPACE {
+/**
+ * @brief The PIPE_CG solver namespace.
+ *
+ * @ingroup pipe_cg
+ */
+namespace pipe_cg {
+
+
+template <typename ValueType>
+void initialize(std::shared_ptr<const DefaultExecutor> exec,
+                const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* r,
+                matrix::Dense<ValueType>* z, matrix::Dense<ValueType>* q,
+                matrix::Dense<ValueType>* s, matrix::Dense<ValueType>* p,
+                matrix::Dense<ValueType>* prev_gamma,
+                matrix::Dense<ValueType>* alpha,
+                array<stopping_status>* stop_status)
+{
+    if (b->get_size()) {
+        run_kernel_solver(
+            exec,
+            [] GKO_KERNEL(auto row, auto col, auto b, auto r, auto z, auto q,
+                          auto s, auto p, auto prev_gamma, auto alpha,
+                          auto stop) {
+                if (row == 0) {
+                    prev_gamma[col] = zero(prev_gamma[col]);
+                    alpha[col] = zero(alpha[col]);
+                    stop[col].reset();
+                }
+                r(row, col) = b(row, col);
+                z(row, col) = q(row, col) = s(row, col) = p(row, col) =
+                    zero(z(row, col));
+            },
+            b->get_size(), b->get_stride(), b, default_stride(r),
+            default_stride(z), default_stride(q), default_stride(s),
+            default_stride(p), row_vector(prev_gamma), row_vector(alpha),
+            *stop_status);
+    } else {
+        run_kernel(
+            exec,
+            [] GKO_KERNEL(auto col, auto prev_gamma, auto alpha, auto stop) {
+                prev_gamma[col] = zero(prev_gamma[col]);
+                alpha[col] = zero(alpha[col]);
+                stop[col].reset();
+            },
+            b->get_size()[1], row_vector(prev_gamma), row_vector(alpha),
+            *stop_status);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG_INITIALIZE_KERNEL);
+
+
+template <typename ValueType>
+void step_1(std::shared_ptr<const DefaultExecutor> exec,
+            matrix::Dense<ValueType>* beta, matrix::Dense<ValueType>* alpha,
+            matrix::Dense<ValueType>* prev_gamma,
+            const matrix::Dense<ValueType>* gamma,
+            const matrix::Dense<ValueType>* delta,
+            const array<stopping_status>* stop_status)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto col, auto beta, auto alpha, auto prev_gamma,
+                      auto gamma, auto delta, auto stop) {
+            if (!stop[col].has_stopped()) {
+                // prev_gamma and alpha are zero in the first iteration
+                const auto new_beta = safe_divide(gamma[col], prev_gamma[col]);
+                const auto correction =
+                    safe_divide(new_beta * gamma[col], alpha[col]);
+                alpha[col] = safe_divide(gamma[col], delta[col] - correction);
+                beta[col] = new_beta;
+                prev_gamma[col] = gamma[col];
+            }
+        },
+        beta->get_size()[1], row_vector(beta), row_vector(alpha),
+        row_vector(prev_gamma), row_vector(gamma), row_vector(delta),
+        *stop_status);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG_STEP_1_KERNEL);
+
+
+template <typename ValueType>
+void step_2(std::shared_ptr<const DefaultExecutor> exec,
+            matrix::Dense<ValueType>* x, matrix::Dense<ValueType>* r,
+            matrix::Dense<ValueType>* u, matrix::Dense<ValueType>* w,
+            const matrix::Dense<ValueType>* m,
+            const matrix::Dense<ValueType>* n, matrix::Dense<ValueType>* z,
+            matrix::Dense<ValueType>* q, matrix::Dense<ValueType>* s,
+            matrix::Dense<ValueType>* p, const matrix::Dense<ValueType>* beta,
+            const matrix::Dense<ValueType>* alpha,
+            const array<stopping_status>* stop_status)
+{
+    run_kernel_solver(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto x, auto r, auto u, auto w,
+                      auto m, auto n, auto z, auto q, auto s, auto p,
+                      auto beta, auto alpha, auto stop) {
+            if (!stop[col].has_stopped()) {
+                const auto new_z = n(row, col) + beta[col] * z(row, col);
+                const auto new_q = m(row, col) + beta[col] * q(row, col);
+                const auto new_s = w(row, col) + beta[col] * s(row, col);
+                const auto new_p = u(row, col) + beta[col] * p(row, col);
+                z(row, col) = new_z;
+                q(row, col) = new_q;
+                s(row, col) = new_s;
+                p(row, col) = new_p;
+                x(row, col) += alpha[col] * new_p;
+                r(row, col) -= alpha[col] * new_s;
+                u(row, col) -= alpha[col] * new_q;
+                w(row, col) -= alpha[col] * new_z;
+            }
+        },
+        x->get_size(), r->get_stride(), x, default_stride(r),
+        default_stride(u), default_stride(w), default_stride(m),
+        default_stride(n), default_stride(z), default_stride(q),
+        default_stride(s), default_stride(p), row_vector(beta),
+        row_vector(alpha), *stop_status);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG_STEP_2_KERNEL);
+
+
+}  // namespace pipe_cg
+}  // namespace GKO_DEVICE_NAMESPACE
+}  // namespace kernels
+}  // namespace gko
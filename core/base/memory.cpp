@@ -4,7 +4,16 @@
 
 #include "ginkgo/core/base/memory.hpp"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <new>
+#include <thread>
 
 #include <ginkgo/core/base/exception_helpers.hpp>
 
@@ -26,4 +35,240 @@ void CpuAllocator::deallocate(void* ptr)
 }
 
 
+namespace {
+
+
+/** Smallest size class, all other size classes are powers of two of this. */
+constexpr size_type min_block_size = 64;
+
+constexpr size_type max_num_size_classes = 48;
+
+/** Marks blocks that don't belong to a size class and bypass the cache. */
+constexpr size_type uncached_size_class = ~size_type{};
+
+
+/** Stored in front of every block handed out by CachingCpuAllocator. */
+struct block_header {
+    size_type size_class;
+    size_type num_bytes;
+};
+
+constexpr size_type header_size =
+    std::max(sizeof(block_header), alignof(std::max_align_t));
+
+
+size_type get_size_class(size_type num_bytes)
+{
+    size_type size_class{};
+    while ((min_block_size << size_class) < num_bytes) {
+        size_class++;
+    }
+    return size_class;
+}
+
+
+size_type get_class_size(size_type size_class)
+{
+    return min_block_size << size_class;
+}
+
+
+block_header* allocate_block(size_type num_bytes)
+{
+    const auto total_bytes = header_size + num_bytes;
+    auto ptr = ::operator new (total_bytes, std::nothrow_t{});
+    GKO_ENSURE_ALLOCATED(ptr, "cpu", total_bytes);
+    return static_cast<block_header*>(ptr);
+}
+
+
+void free_block(block_header* block)
+{
+    ::operator delete (block, std::nothrow_t{});
+}
+
+
+void* get_user_ptr(block_header* block)
+{
+    return reinterpret_cast<char*>(block) + header_size;
+}
+
+
+block_header* get_block(void* ptr)
+{
+    return reinterpret_cast<block_header*>(static_cast<char*>(ptr) -
+                                           header_size);
+}
+
+
+/**
+ * Free blocks are kept in singly linked lists, with the pointer to the next
+ * block stored in the unused user memory of the block.
+ */
+block_header*& get_next_block(block_header* block)
+{
+    return *static_cast<block_header**>(get_user_ptr(block));
+}
+
+
+std::atomic<std::uint64_t> next_caching_allocator_id{1};
+
+
+}  // namespace
+
+
+struct CachingCpuAllocator::state {
+    struct thread_cache {
+        std::array<block_header*, max_num_size_classes> free_lists{};
+        size_type cached_bytes{};
+    };
+
+    state(size_type max_cached_size, size_type max_cached_bytes)
+        : max_cached_size{std::min(max_cached_size,
+                                   get_class_size(max_num_size_classes - 1))},
+          max_cached_bytes{max_cached_bytes},
+          id{next_caching_allocator_id++},
+          hits{},
+          misses{},
+          current_bytes{},
+          peak_bytes{}
+    {}
+
+    thread_cache& get_thread_cache()
+    {
+        // the allocator ids are never reused, so a stale entry can't match
+        thread_local std::uint64_t last_id{};
+        thread_local thread_cache* last_cache{};
+        if (last_id != id) {
+            std::lock_guard<std::mutex> guard{mutex};
+            auto& cache = caches[std::this_thread::get_id()];
+            if (!cache) {
+                cache = std::make_unique<thread_cache>();
+            }
+            last_id = id;
+            last_cache = cache.get();
+        }
+        return *last_cache;
+    }
+
+    size_type max_cached_size;
+    size_type max_cached_bytes;
+    std::uint64_t id;
+    std::mutex mutex;
+    std::map<std::thread::id, std::unique_ptr<thread_cache>> caches;
+    std::atomic<size_type> hits;
+    std::atomic<size_type> misses;
+    std::atomic<size_type> current_bytes;
+    std::atomic<size_type> peak_bytes;
+};
+
+
+CachingCpuAllocator::CachingCpuAllocator(size_type max_cached_size,
+                                         size_type max_cached_bytes)
+    : state_{std::make_unique<state>(max_cached_size, max_cached_bytes)}
+{}
+
+
+CachingCpuAllocator::~CachingCpuAllocator()
+{
+    for (auto& entry : state_->caches) {
+        for (auto block : entry.second->free_lists) {
+            while (block) {
+                auto next = get_next_block(block);
+                this->free_system(block);
+                block = next;
+            }
+        }
+    }
+}
+
+
+void* CachingCpuAllocator::allocate_system(size_type num_bytes)
+{
+    this->template log<log::Logger::allocation_started>(nullptr, num_bytes);
+    auto block = allocate_block(num_bytes);
+    this->template log<log::Logger::allocation_completed>(
+        nullptr, num_bytes, reinterpret_cast<uintptr>(get_user_ptr(block)));
+    return block;
+}
+
+
+void CachingCpuAllocator::free_system(void* ptr)
+{
+    auto block = static_cast<block_header*>(ptr);
+    const auto location = reinterpret_cast<uintptr>(get_user_ptr(block));
+    this->template log<log::Logger::free_started>(nullptr, location);
+    free_block(block);
+    this->template log<log::Logger::free_completed>(nullptr, location);
+}
+
+
+void* CachingCpuAllocator::allocate(size_type num_bytes)
+{
+    block_header* block{};
+    if (num_bytes > state_->max_cached_size) {
+        block = static_cast<block_header*>(this->allocate_system(num_bytes));
+        block->size_class = uncached_size_class;
+        state_->misses++;
+    } else {
+        const auto size_class = get_size_class(num_bytes);
+        auto& cache = state_->get_thread_cache();
+        auto& free_list = cache.free_lists[size_class];
+        if (free_list) {
+            block = free_list;
+            free_list = get_next_block(block);
+            cache.cached_bytes -= get_class_size(size_class);
+            state_->hits++;
+        } else {
+            block = static_cast<block_header*>(
+                this->allocate_system(get_class_size(size_class)));
+            block->size_class = size_class;
+            state_->misses++;
+        }
+    }
+    block->num_bytes = num_bytes;
+    const auto current =
+        state_->current_bytes.fetch_add(num_bytes) + num_bytes;
+    auto peak = state_->peak_bytes.load();
+    while (peak < current &&
+           !state_->peak_bytes.compare_exchange_weak(peak, current)) {
+    }
+    return get_user_ptr(block);
+}
+
+
+void CachingCpuAllocator::deallocate(void* ptr)
+{
+    if (!ptr) {
+        return;
+    }
+    auto block = get_block(ptr);
+    state_->current_bytes -= block->num_bytes;
+    const auto size_class = block->size_class;
+    if (size_class == uncached_size_class) {
+        this->free_system(block);
+        return;
+    }
+    const auto class_size = get_class_size(size_class);
+    auto& cache = state_->get_thread_cache();
+    if (cache.cached_bytes + class_size > state_->max_cached_bytes) {
+        this->free_system(block);
+        return;
+    }
+    // blocks freed by another thread than the allocating one simply move to
+    // the cache of the freeing thread
+    auto& free_list = cache.free_lists[size_class];
+    get_next_block(block) = free_list;
+    free_list = block;
+    cache.cached_bytes += class_size;
+}
+
+
+CachingCpuAllocator::statistics CachingCpuAllocator::get_statistics() const
+{
+    return {state_->hits.load(), state_->misses.load(),
+            state_->current_bytes.load(), state_->peak_bytes.load()};
+}
+
+
 }  // namespace gko
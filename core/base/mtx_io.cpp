@@ -6,16 +6,41 @@
 
 #include <algorithm>
 #include <cctype>
+#include <charconv>
+#include <cstdlib>
 #include <cstring>
+#include <exception>
+#include <fstream>
+#include <iterator>
 #include <limits>
+#include <locale>
 #include <map>
 #include <regex>
+#include <sstream>
 #include <string>
+#include <system_error>
+#include <thread>
 #include <type_traits>
-
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define GKO_MTX_IO_HAVE_MMAP 1
+#else
+#define GKO_MTX_IO_HAVE_MMAP 0
+#endif
+
+#include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/base/math.hpp>
 #include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+#include "core/base/mtx_io.hpp"
 
 
 namespace gko {
@@ -38,6 +63,107 @@ namespace {
 constexpr auto max_streamsize = std::numeric_limits<std::streamsize>::max();
 
 
+/**
+ * Minimum size of the chunks of a matrix market file parsed by a single
+ * thread. Smaller files are parsed sequentially.
+ */
+constexpr size_type min_parse_chunk_size = 1 << 20;
+
+
+/**
+ * Returns the number of threads used for parsing matrix market files. Like
+ * the OpenMP runtime, it is taken from OMP_NUM_THREADS if that is set, and
+ * from the number of hardware threads otherwise.
+ */
+size_type get_num_parse_threads()
+{
+    if (const auto str = std::getenv("OMP_NUM_THREADS")) {
+        // for nested parallelism, only the outermost level is relevant
+        size_type num_threads{};
+        const auto result =
+            std::from_chars(str, str + std::strlen(str), num_threads);
+        if (result.ec == std::errc{} && num_threads > 0) {
+            return num_threads;
+        }
+    }
+    return std::max<size_type>(std::thread::hardware_concurrency(), 1);
+}
+
+
+/** Skips spaces and tabs, but stops at line breaks. */
+const char* skip_blanks(const char* it, const char* end)
+{
+    while (it != end && (*it == ' ' || *it == '\t' || *it == '\r')) {
+        ++it;
+    }
+    return it;
+}
+
+
+/**
+ * Parses a one-based decimal index starting at `it` and advances `it` past
+ * it.
+ */
+template <typename IndexType>
+IndexType parse_index(const char*& it, const char* end)
+{
+    it = skip_blanks(it, end);
+    if (it != end && *it == '+') {
+        ++it;
+    }
+    if (it != end && *it == '-') {
+        throw GKO_STREAM_ERROR("negative matrix index");
+    }
+    IndexType result{};
+    const auto parsed = std::from_chars(it, end, result);
+    if (parsed.ec == std::errc::result_out_of_range) {
+        throw GKO_STREAM_ERROR("matrix index does not fit into the index type");
+    }
+    if (parsed.ec != std::errc{}) {
+        throw GKO_STREAM_ERROR("error when reading matrix index");
+    }
+    if (result == 0) {
+        throw GKO_STREAM_ERROR("matrix indices need to be one-based");
+    }
+    it = parsed.ptr;
+    return result;
+}
+
+
+/**
+ * Parses a floating point number starting at `it` on the current line and
+ * advances `it` past it. The decimal point is always '.', independent of the
+ * global locale.
+ */
+double parse_real(const char*& it, const char* end)
+{
+    it = skip_blanks(it, end);
+    // from_chars doesn't accept an explicit plus sign
+    if (it != end && *it == '+') {
+        ++it;
+    }
+    double result{};
+#ifdef __cpp_lib_to_chars
+    const auto parsed = std::from_chars(it, end, result);
+    if (parsed.ec != std::errc{}) {
+        throw GKO_STREAM_ERROR("error while reading matrix entry");
+    }
+    it = parsed.ptr;
+#else
+    // without floating point from_chars, the value is read through a stream
+    // using the classic locale
+    const auto value_end = std::find_if(it, end, [](char c) {
+        return std::isspace(static_cast<unsigned char>(c));
+    });
+    std::istringstream stream{std::string(it, value_end)};
+    stream.imbue(std::locale::classic());
+    GKO_CHECK_STREAM(stream >> result, "error while reading matrix entry");
+    it = value_end;
+#endif
+    return result;
+}
+
+
 /**
  * The mtx_io class provides the functionality of reading and writing matrix
  * market format files.
@@ -100,6 +226,8 @@ private:
      */
     struct entry_format {
         virtual ValueType read_entry(std::istream& is) const = 0;
+        virtual ValueType parse_entry(const char*& it,
+                                      const char* end) const = 0;
         virtual void write_entry(std::ostream& os,
                                  const ValueType& value) const = 0;
     };
@@ -127,6 +255,19 @@ private:
             return static_cast<ValueType>(result);
         }
 
+        /**
+         * parses entry from a line of text
+         *
+         * @param  it the position of the entry, is advanced past the entry
+         * @param  end the end of the text
+         *
+         * @return the matrix entry.
+         */
+        ValueType parse_entry(const char*& it, const char* end) const override
+        {
+            return static_cast<ValueType>(parse_real(it, end));
+        }
+
         /**
          * writes entry to the output stream
          *
@@ -174,6 +315,19 @@ private:
             return read_entry_impl<ValueType>(is);
         }
 
+        /**
+         * parses entry from a line of text
+         *
+         * @param  it the position of the entry, is advanced past the entry
+         * @param  end the end of the text
+         *
+         * @return the matrix entry.
+         */
+        ValueType parse_entry(const char*& it, const char* end) const override
+        {
+            return parse_entry_impl<ValueType>(it, end);
+        }
+
         /**
          * writes entry to the output stream
          *
@@ -209,6 +363,24 @@ private:
                 "trying to read a complex matrix into a real storage type");
         }
 
+        template <typename T>
+        static std::enable_if_t<is_complex_s<T>::value, T> parse_entry_impl(
+            const char*& it, const char* end)
+        {
+            using real_type = remove_complex<T>;
+            const auto real = parse_real(it, end);
+            const auto imag = parse_real(it, end);
+            return {static_cast<real_type>(real), static_cast<real_type>(imag)};
+        }
+
+        template <typename T>
+        static std::enable_if_t<!is_complex_s<T>::value, T> parse_entry_impl(
+            const char*&, const char*)
+        {
+            throw GKO_STREAM_ERROR(
+                "trying to read a complex matrix into a real storage type");
+        }
+
     } complex_format{};
 
     /**
@@ -227,6 +399,19 @@ private:
             return one<ValueType>();
         }
 
+        /**
+         * parses entry from a line of text
+         *
+         * @param  dummy position of the entry
+         * @param  dummy end of the text
+         *
+         * @return the matrix entry(one).
+         */
+        ValueType parse_entry(const char*&, const char*) const override
+        {
+            return one<ValueType>();
+        }
+
         /**
          * writes entry to the output stream
          *
@@ -506,20 +691,12 @@ private:
             matrix_data<ValueType, IndexType> data(dim<2>{num_rows, num_cols});
             data.nonzeros.reserve(modifier->get_reservation_size(
                 num_rows, num_cols, num_nonzeros));
-            for (size_type i = 0; i < num_nonzeros; ++i) {
-                IndexType row{};
-                IndexType col{};
-                GKO_CHECK_STREAM(
-                    content >> row >> col,
-                    "error when reading coordinates of matrix entry " +
-                        std::to_string(i));
-                auto entry = entry_reader->read_entry(content);
-                GKO_CHECK_STREAM(content, "error when reading matrix entry " +
-                                              std::to_string(i));
-                modifier->insert_entry(row - 1, col - 1, entry, data);
-                // discards rest of the line
-                content.ignore(max_streamsize, '\n');
-            }
+            parse_coordinate_entries(
+                content, num_nonzeros, entry_reader,
+                [&](const nonzero_type& entry) {
+                    modifier->insert_entry(entry.row, entry.column, entry.value,
+                                           data);
+                });
             return data;
         }
 
@@ -634,6 +811,130 @@ private:
     } array_layout{};
 
 
+    using nonzero_type = matrix_data_entry<ValueType, IndexType>;
+
+    /**
+     * Parses the coordinate entries on the lines in [begin, end) into result,
+     * stopping after max_entries entries.
+     */
+    static void parse_coordinate_lines(const char* begin, const char* end,
+                                       const entry_format* entry_reader,
+                                       size_type max_entries,
+                                       std::vector<nonzero_type>& result)
+    {
+        auto it = begin;
+        while (it != end && result.size() < max_entries) {
+            it = skip_blanks(it, end);
+            if (it == end) {
+                break;
+            }
+            // skips empty lines
+            if (*it != '\n') {
+                const auto row = parse_index<IndexType>(it, end);
+                const auto col = parse_index<IndexType>(it, end);
+                const auto entry = entry_reader->parse_entry(it, end);
+                result.emplace_back(row - 1, col - 1, entry);
+            }
+            // discards rest of the line
+            it = std::find(it, end, '\n');
+            if (it != end) {
+                ++it;
+            }
+        }
+    }
+
+    /**
+     * Parses the first num_nonzeros coordinate entries from the rest of the
+     * stream and passes them to insert in file order. The stream is read in
+     * blocks, which are split at line boundaries into chunks that are parsed
+     * concurrently, so only a single block of the text is kept in memory.
+     */
+    template <typename InsertFunction>
+    static void parse_coordinate_entries(std::istream& content,
+                                         size_type num_nonzeros,
+                                         const entry_format* entry_reader,
+                                         InsertFunction insert)
+    {
+        const auto num_threads = get_num_parse_threads();
+        const auto block_size = num_threads * min_parse_chunk_size;
+        std::vector<char> block;
+        std::vector<std::vector<nonzero_type>> chunks(num_threads);
+        std::vector<std::exception_ptr> errors(num_threads);
+        size_type num_inserted{};
+        while (num_inserted < num_nonzeros && content) {
+            // the incomplete last line of the previous block is kept at the
+            // beginning of the block
+            const auto leftover = block.size();
+            block.resize(leftover + block_size);
+            content.read(block.data() + leftover,
+                         static_cast<std::streamsize>(block_size));
+            block.resize(leftover + content.gcount());
+            const char* text_begin = block.data();
+            auto text_end = text_begin + block.size();
+            if (content) {
+                // only complete lines are parsed
+                text_end = std::find(std::make_reverse_iterator(text_end),
+                                     std::make_reverse_iterator(text_begin),
+                                     '\n')
+                               .base();
+            }
+            const auto text_size =
+                static_cast<size_type>(text_end - text_begin);
+            const auto num_chunks = std::max<size_type>(
+                std::min(num_threads, text_size / min_parse_chunk_size), 1);
+            std::vector<const char*> chunk_bounds(num_chunks + 1, text_end);
+            chunk_bounds[0] = text_begin;
+            for (size_type chunk = 1; chunk < num_chunks; chunk++) {
+                auto bound =
+                    std::max(text_begin + text_size / num_chunks * chunk,
+                             chunk_bounds[chunk - 1]);
+                bound = std::find(bound, text_end, '\n');
+                chunk_bounds[chunk] = bound == text_end ? bound : bound + 1;
+            }
+            const auto max_entries = num_nonzeros - num_inserted;
+            const auto parse_chunk = [&](size_type chunk) {
+                chunks[chunk].clear();
+                errors[chunk] = nullptr;
+                try {
+                    parse_coordinate_lines(
+                        chunk_bounds[chunk], chunk_bounds[chunk + 1],
+                        entry_reader, max_entries, chunks[chunk]);
+                } catch (...) {
+                    errors[chunk] = std::current_exception();
+                }
+            };
+            std::vector<std::thread> threads;
+            for (size_type chunk = 1; chunk < num_chunks; chunk++) {
+                threads.emplace_back(parse_chunk, chunk);
+            }
+            parse_chunk(0);
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            for (size_type chunk = 0;
+                 chunk < num_chunks && num_inserted < num_nonzeros; chunk++) {
+                for (const auto& entry : chunks[chunk]) {
+                    if (num_inserted == num_nonzeros) {
+                        break;
+                    }
+                    insert(entry);
+                    num_inserted++;
+                }
+                // errors after the last required entry are ignored, like the
+                // remainder of the file
+                if (errors[chunk] && num_inserted < num_nonzeros) {
+                    std::rethrow_exception(errors[chunk]);
+                }
+            }
+            block.erase(block.begin(), block.begin() + text_size);
+        }
+        if (num_inserted < num_nonzeros) {
+            throw GKO_STREAM_ERROR(
+                "error when reading coordinates of matrix entry " +
+                std::to_string(num_inserted));
+        }
+    }
+
     /**
      * the constructors establishes the mapping between specification strings to
      * classes representing algorithms
@@ -745,44 +1046,6 @@ matrix_data<ValueType, IndexType> read_raw(std::istream& is)
 }
 
 
-/**
- * Returns the magic number at the beginning of the binary format header for the
- * given type parameters.
- *
- * @tparam ValueType  the value type to be used for the binary storage
- * @tparam IndexType  the index type to be used for the binary storage
- */
-template <typename ValueType, typename IndexType>
-static constexpr uint64 binary_format_magic()
-{
-    constexpr auto is_int = std::is_same<IndexType, int32>::value;
-    constexpr auto is_long = std::is_same<IndexType, int64>::value;
-    constexpr auto is_double = std::is_same<ValueType, double>::value;
-    constexpr auto is_float = std::is_same<ValueType, float>::value;
-    constexpr auto is_complex_double =
-        std::is_same<ValueType, std::complex<double>>::value;
-    constexpr auto is_complex_float =
-        std::is_same<ValueType, std::complex<float>>::value;
-    static_assert(is_int || is_long, "invalid storage index type");
-    static_assert(
-        is_double || is_float || is_complex_double || is_complex_float,
-        "invalid storage value type");
-    constexpr auto index_bit = is_int ? 'I' : 'L';
-    constexpr auto value_bit =
-        is_double ? 'D' : (is_float ? 'S' : (is_complex_double ? 'Z' : 'C'));
-    constexpr uint64 shift = 256;
-    constexpr uint64 type_bits = index_bit * shift + value_bit;
-    return 'G' +
-           shift *
-               ('I' +
-                shift *
-                    ('N' +
-                     shift *
-                         ('K' +
-                          shift * ('G' + shift * ('O' + shift * type_bits)))));
-}
-
-
 namespace {
 
 
@@ -937,6 +1200,417 @@ void write_binary_raw(std::ostream& os,
 }
 
 
+namespace {
+
+
+/** Minimum number of entries of a binary file decoded by a single thread. */
+constexpr size_type min_decode_block_size = 1 << 16;
+
+
+/**
+ * Calls fn(begin, end) for a static partition of [0, size) into one
+ * contiguous block per thread, like the row partition of an OpenMP loop with
+ * static schedule. The first exception thrown by any block is rethrown.
+ */
+template <typename Function>
+void parallel_for_blocks(size_type size, Function fn)
+{
+    const auto num_blocks = std::max<size_type>(
+        std::min(get_num_parse_threads(), size / min_decode_block_size), 1);
+    std::vector<std::exception_ptr> errors(num_blocks);
+    const auto run_block = [&](size_type block) {
+        try {
+            fn(size * block / num_blocks, size * (block + 1) / num_blocks);
+        } catch (...) {
+            errors[block] = std::current_exception();
+        }
+    };
+    std::vector<std::thread> threads;
+    for (size_type block = 1; block < num_blocks; block++) {
+        threads.emplace_back(run_block, block);
+    }
+    run_block(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+
+/**
+ * Read-only view of the contents of a file. Where available, the file is
+ * mapped into memory copy-on-write, otherwise it is read into a buffer.
+ */
+class mapped_file {
+public:
+    explicit mapped_file(const std::string& filename) : data_{}, size_{}
+    {
+#if GKO_MTX_IO_HAVE_MMAP
+        const auto fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw GKO_STREAM_ERROR("failed opening file " + filename);
+        }
+        struct stat file_stat {};
+        if (::fstat(fd, &file_stat) != 0) {
+            ::close(fd);
+            throw GKO_STREAM_ERROR("failed reading size of file " + filename);
+        }
+        size_ = static_cast<size_type>(file_stat.st_size);
+        if (size_ > 0) {
+            // a private mapping allows modifying the data without affecting
+            // the file
+            auto ptr = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE, fd, 0);
+            if (ptr == MAP_FAILED) {
+                ::close(fd);
+                throw GKO_STREAM_ERROR("failed mapping file " + filename);
+            }
+            data_ = static_cast<char*>(ptr);
+        }
+        ::close(fd);
+#else
+        std::ifstream stream{filename, std::ios::binary | std::ios::ate};
+        GKO_CHECK_STREAM(stream, "failed opening file " + filename);
+        size_ = static_cast<size_type>(stream.tellg());
+        // uint64 storage keeps the sections aligned
+        buffer_.resize(ceildiv(size_, sizeof(uint64)));
+        data_ = reinterpret_cast<char*>(buffer_.data());
+        stream.seekg(0);
+        GKO_CHECK_STREAM(stream.read(data_, size_),
+                         "failed reading file " + filename);
+#endif
+    }
+
+    ~mapped_file()
+    {
+#if GKO_MTX_IO_HAVE_MMAP
+        if (data_) {
+            ::munmap(data_, size_);
+        }
+#endif
+    }
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    char* get_data() const { return data_; }
+
+    size_type get_size() const { return size_; }
+
+private:
+    char* data_;
+    size_type size_;
+#if !GKO_MTX_IO_HAVE_MMAP
+    std::vector<uint64> buffer_;
+#endif
+};
+
+
+binary_header read_binary_header(const mapped_file& file)
+{
+    static_assert(sizeof(binary_header) == 32, "unexpected header padding");
+    if (file.get_size() < sizeof(binary_header)) {
+        throw GKO_STREAM_ERROR("failed reading header");
+    }
+    binary_header header{};
+    std::memcpy(&header, file.get_data(), sizeof(binary_header));
+    return header;
+}
+
+
+template <typename IndexType>
+void check_binary_dimensions(const binary_header& header)
+{
+    if (header.num_rows > std::numeric_limits<IndexType>::max() ||
+        header.num_cols > std::numeric_limits<IndexType>::max() ||
+        header.num_entries > std::numeric_limits<IndexType>::max()) {
+        throw GKO_STREAM_ERROR(
+            "cannot read into this format, its index type would overflow");
+    }
+}
+
+
+template <typename FileValueType, typename ValueType>
+void check_binary_value_type()
+{
+    if (is_complex<FileValueType>() && !is_complex<ValueType>()) {
+        throw GKO_STREAM_ERROR(
+            "cannot read into this format, would assign complex to real");
+    }
+}
+
+
+template <typename FileType, typename Type>
+Type convert_binary_value(const char* input)
+{
+    FileType value{};
+    std::memcpy(&value, input, sizeof(FileType));
+    return static_cast<Type>(
+        select_helper<is_complex<Type>()>::get(value, real(value)));
+}
+
+
+template <typename FileType, typename Type>
+void convert_binary_section(const char* input, size_type size, Type* output)
+{
+    parallel_for_blocks(size, [&](size_type begin, size_type end) {
+        for (auto i = begin; i < end; i++) {
+            output[i] = convert_binary_value<FileType, Type>(
+                input + i * sizeof(FileType));
+        }
+    });
+}
+
+
+/**
+ * Checks that the CSR arrays read from a binary file describe a valid matrix
+ * of the size given in the header, so later accesses stay in bounds.
+ */
+template <typename IndexType>
+void check_binary_csr_indices(const binary_header& header,
+                              const IndexType* row_ptrs,
+                              const IndexType* col_idxs)
+{
+    const auto num_rows = static_cast<size_type>(header.num_rows);
+    const auto num_cols = static_cast<IndexType>(header.num_cols);
+    if (row_ptrs[0] != 0 ||
+        row_ptrs[num_rows] != static_cast<IndexType>(header.num_entries) ||
+        !std::is_sorted(row_ptrs, row_ptrs + num_rows + 1)) {
+        throw GKO_STREAM_ERROR(
+            "row pointers need to be sorted, starting at 0 and ending at " +
+            std::to_string(header.num_entries));
+    }
+    parallel_for_blocks(header.num_entries, [&](size_type begin,
+                                                size_type end) {
+        for (auto nz = begin; nz < end; nz++) {
+            if (col_idxs[nz] < 0 || col_idxs[nz] >= num_cols) {
+                throw GKO_STREAM_ERROR("column index " +
+                                       std::to_string(col_idxs[nz]) +
+                                       " of entry " + std::to_string(nz) +
+                                       " is out of bounds");
+            }
+        }
+    });
+}
+
+
+template <typename FileValueType, typename FileIndexType, typename ValueType,
+          typename IndexType>
+device_matrix_data<ValueType, IndexType> read_binary_file_convert(
+    std::shared_ptr<const Executor> exec, const mapped_file& file,
+    const binary_header& header)
+{
+    check_binary_dimensions<IndexType>(header);
+    check_binary_value_type<FileValueType, ValueType>();
+    constexpr auto entry_binary_size =
+        sizeof(FileValueType) + 2 * sizeof(FileIndexType);
+    const auto num_entries = static_cast<size_type>(header.num_entries);
+    if ((file.get_size() - sizeof(binary_header)) / entry_binary_size <
+        num_entries) {
+        throw GKO_STREAM_ERROR("file is too small for " +
+                               std::to_string(num_entries) + " entries");
+    }
+    // decode directly into separate arrays on the host
+    const auto host_exec = exec->get_master();
+    array<IndexType> row_idxs{host_exec, num_entries};
+    array<IndexType> col_idxs{host_exec, num_entries};
+    array<ValueType> values{host_exec, num_entries};
+    const auto rows = row_idxs.get_data();
+    const auto cols = col_idxs.get_data();
+    const auto vals = values.get_data();
+    const auto entries = file.get_data() + sizeof(binary_header);
+    const auto num_rows = static_cast<IndexType>(header.num_rows);
+    const auto num_cols = static_cast<IndexType>(header.num_cols);
+    parallel_for_blocks(num_entries, [&](size_type begin, size_type end) {
+        for (auto i = begin; i < end; i++) {
+            const auto entry = entries + i * entry_binary_size;
+            rows[i] = convert_binary_value<FileIndexType, IndexType>(entry);
+            cols[i] = convert_binary_value<FileIndexType, IndexType>(
+                entry + sizeof(FileIndexType));
+            vals[i] = convert_binary_value<FileValueType, ValueType>(
+                entry + 2 * sizeof(FileIndexType));
+            if (rows[i] < 0 || rows[i] >= num_rows || cols[i] < 0 ||
+                cols[i] >= num_cols) {
+                throw GKO_STREAM_ERROR("entry " + std::to_string(i) +
+                                       " is out of bounds");
+            }
+        }
+    });
+    device_matrix_data<ValueType, IndexType> result{
+        exec,
+        dim<2>{static_cast<size_type>(header.num_rows),
+               static_cast<size_type>(header.num_cols)},
+        array<IndexType>{exec, std::move(row_idxs)},
+        array<IndexType>{exec, std::move(col_idxs)},
+        array<ValueType>{exec, std::move(values)}};
+    result.sort_row_major();
+    return result;
+}
+
+
+/**
+ * Creates a host array for a section of the CSR binary format. If the types
+ * match, the array points into the mapped file and keeps it alive, otherwise
+ * the section is converted into a new array.
+ */
+template <typename FileType, typename Type>
+array<Type> map_binary_csr_section(std::shared_ptr<const Executor> host_exec,
+                                   std::shared_ptr<mapped_file> file,
+                                   uint64 offset, size_type size)
+{
+    const auto data = file->get_data() + offset;
+    if (std::is_same<FileType, Type>::value) {
+        return array<Type>{host_exec, size, reinterpret_cast<Type*>(data),
+                           [file](Type*) {}};
+    }
+    array<Type> result{host_exec, size};
+    convert_binary_section<FileType>(data, size, result.get_data());
+    return result;
+}
+
+
+template <typename FileValueType, typename FileIndexType, typename ValueType,
+          typename IndexType>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary_csr_file_map(
+    std::shared_ptr<const Executor> exec, std::shared_ptr<mapped_file> file,
+    const binary_header& header)
+{
+    check_binary_dimensions<IndexType>(header);
+    check_binary_value_type<FileValueType, ValueType>();
+    const auto num_rows = static_cast<size_type>(header.num_rows);
+    const auto num_entries = static_cast<size_type>(header.num_entries);
+    const auto row_ptrs_offset = align_binary_csr_offset(sizeof(binary_header));
+    const auto col_idxs_offset = align_binary_csr_offset(
+        row_ptrs_offset + (num_rows + 1) * sizeof(FileIndexType));
+    const auto values_offset = align_binary_csr_offset(
+        col_idxs_offset + num_entries * sizeof(FileIndexType));
+    const auto end_offset = values_offset + num_entries * sizeof(FileValueType);
+    if (file->get_size() < end_offset) {
+        throw GKO_STREAM_ERROR("file is too small for " +
+                               std::to_string(num_entries) + " entries");
+    }
+    // the sections are validated on the host, where they can be used in
+    // place, and only then copied to the executor if necessary
+    const auto host_exec = exec->get_master();
+    auto row_ptrs = map_binary_csr_section<FileIndexType, IndexType>(
+        host_exec, file, row_ptrs_offset, num_rows + 1);
+    auto col_idxs = map_binary_csr_section<FileIndexType, IndexType>(
+        host_exec, file, col_idxs_offset, num_entries);
+    check_binary_csr_indices(header, row_ptrs.get_const_data(),
+                             col_idxs.get_const_data());
+    auto values = map_binary_csr_section<FileValueType, ValueType>(
+        host_exec, file, values_offset, num_entries);
+    return matrix::Csr<ValueType, IndexType>::create(
+        exec, dim<2>{num_rows, static_cast<size_type>(header.num_cols)},
+        array<ValueType>{exec, std::move(values)},
+        array<IndexType>{exec, std::move(col_idxs)},
+        array<IndexType>{exec, std::move(row_ptrs)});
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+device_matrix_data<ValueType, IndexType> read_binary_file_raw(
+    std::shared_ptr<const Executor> exec, const std::string& filename)
+{
+    mapped_file file{filename};
+    const auto header = read_binary_header(file);
+#define DECLARE_OVERLOAD(_vtype, _itype)                                       \
+    else if (header.magic == binary_format_magic<_vtype, _itype>())            \
+    {                                                                          \
+        return read_binary_file_convert<_vtype, _itype, ValueType, IndexType>( \
+            exec, file, header);                                               \
+    }
+    if (false) {
+    }
+    DECLARE_OVERLOAD(double, int32)
+    DECLARE_OVERLOAD(float, int32)
+    DECLARE_OVERLOAD(std::complex<double>, int32)
+    DECLARE_OVERLOAD(std::complex<float>, int32)
+    DECLARE_OVERLOAD(double, int64)
+    DECLARE_OVERLOAD(float, int64)
+    DECLARE_OVERLOAD(std::complex<double>, int64)
+    DECLARE_OVERLOAD(std::complex<float>, int64)
+#undef DECLARE_OVERLOAD
+    else
+    {
+        throw GKO_STREAM_ERROR(
+            "invalid header magic number '" +
+            std::string(reinterpret_cast<const char*>(&header.magic), 8) +
+            "'");
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary_csr_file(
+    std::shared_ptr<const Executor> exec, const std::string& filename)
+{
+    auto file = std::make_shared<mapped_file>(filename);
+    const auto header = read_binary_header(*file);
+#define DECLARE_OVERLOAD(_vtype, _itype)                                       \
+    else if (header.magic == binary_csr_format_magic<_vtype, _itype>())        \
+    {                                                                          \
+        return read_binary_csr_file_map<_vtype, _itype, ValueType, IndexType>( \
+            exec, std::move(file), header);                                    \
+    }
+    if (false) {
+    }
+    DECLARE_OVERLOAD(double, int32)
+    DECLARE_OVERLOAD(float, int32)
+    DECLARE_OVERLOAD(std::complex<double>, int32)
+    DECLARE_OVERLOAD(std::complex<float>, int32)
+    DECLARE_OVERLOAD(double, int64)
+    DECLARE_OVERLOAD(float, int64)
+    DECLARE_OVERLOAD(std::complex<double>, int64)
+    DECLARE_OVERLOAD(std::complex<float>, int64)
+#undef DECLARE_OVERLOAD
+    // fall back to the coordinate binary format
+    file.reset();
+    auto result = matrix::Csr<ValueType, IndexType>::create(exec);
+    result->read(read_binary_file_raw<ValueType, IndexType>(exec, filename));
+    return result;
+}
+
+
+template <typename ValueType, typename IndexType>
+void write_binary_csr(std::ostream& os,
+                      const matrix::Csr<ValueType, IndexType>* matrix)
+{
+    auto host_matrix = make_temporary_clone(
+        matrix->get_executor()->get_master(), matrix);
+    binary_header header{binary_csr_format_magic<ValueType, IndexType>(),
+                         host_matrix->get_size()[0],
+                         host_matrix->get_size()[1],
+                         host_matrix->get_num_stored_elements()};
+    uint64 offset{};
+    const auto write_section = [&](const void* data, size_type num_bytes) {
+        const auto begin = align_binary_csr_offset(offset);
+        const std::vector<char> padding(begin - offset);
+        GKO_CHECK_STREAM(os.write(padding.data(), padding.size()),
+                         "failed writing padding");
+        GKO_CHECK_STREAM(
+            os.write(static_cast<const char*>(data), num_bytes),
+            "failed writing section at offset " + std::to_string(begin));
+        offset = begin + num_bytes;
+    };
+    write_section(&header, sizeof(header));
+    write_section(host_matrix->get_const_row_ptrs(),
+                  (header.num_rows + 1) * sizeof(IndexType));
+    write_section(host_matrix->get_const_col_idxs(),
+                  header.num_entries * sizeof(IndexType));
+    write_section(host_matrix->get_const_values(),
+                  header.num_entries * sizeof(ValueType));
+    os.flush();
+}
+
+
 /**
  * Writes raw data to the stream.
  *
@@ -970,11 +1644,23 @@ void write_raw(std::ostream& os, const matrix_data<ValueType, IndexType>& data,
                           const matrix_data<ValueType, IndexType>& data)
 #define GKO_DECLARE_READ_GENERIC_RAW(ValueType, IndexType) \
     matrix_data<ValueType, IndexType> read_generic_raw(std::istream& is)
+#define GKO_DECLARE_READ_BINARY_FILE_RAW(ValueType, IndexType)      \
+    device_matrix_data<ValueType, IndexType> read_binary_file_raw( \
+        std::shared_ptr<const Executor> exec, const std::string& filename)
+#define GKO_DECLARE_READ_BINARY_CSR_FILE(ValueType, IndexType)               \
+    std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary_csr_file( \
+        std::shared_ptr<const Executor> exec, const std::string& filename)
+#define GKO_DECLARE_WRITE_BINARY_CSR(ValueType, IndexType) \
+    void write_binary_csr(std::ostream& os,                \
+                          const matrix::Csr<ValueType, IndexType>* matrix)
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_RAW);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_WRITE_RAW);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_BINARY_RAW);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_WRITE_BINARY_RAW);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_GENERIC_RAW);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_BINARY_FILE_RAW);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_BINARY_CSR_FILE);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_WRITE_BINARY_CSR);
 
 
 }  // namespace gko
@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_BASE_MTX_IO_HPP_
+#define GKO_CORE_BASE_MTX_IO_HPP_
+
+
+#include <complex>
+#include <type_traits>
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+
+
+/**
+ * Returns the magic number at the beginning of the binary format header for the
+ * given type parameters.
+ *
+ * @tparam ValueType  the value type to be used for the binary storage
+ * @tparam IndexType  the index type to be used for the binary storage
+ */
+template <typename ValueType, typename IndexType>
+constexpr uint64 binary_format_magic()
+{
+    constexpr auto is_int = std::is_same<IndexType, int32>::value;
+    constexpr auto is_long = std::is_same<IndexType, int64>::value;
+    constexpr auto is_double = std::is_same<ValueType, double>::value;
+    constexpr auto is_float = std::is_same<ValueType, float>::value;
+    constexpr auto is_complex_double =
+        std::is_same<ValueType, std::complex<double>>::value;
+    constexpr auto is_complex_float =
+        std::is_same<ValueType, std::complex<float>>::value;
+    static_assert(is_int || is_long, "invalid storage index type");
+    static_assert(
+        is_double || is_float || is_complex_double || is_complex_float,
+        "invalid storage value type");
+    constexpr auto index_bit = is_int ? 'I' : 'L';
+    constexpr auto value_bit =
+        is_double ? 'D' : (is_float ? 'S' : (is_complex_double ? 'Z' : 'C'));
+    constexpr uint64 shift = 256;
+    constexpr uint64 type_bits = index_bit * shift + value_bit;
+    return 'G' +
+           shift *
+               ('I' +
+                shift *
+                    ('N' +
+                     shift *
+                         ('K' +
+                          shift * ('G' + shift * ('O' + shift * type_bits)))));
+}
+
+
+/**
+ * Returns the magic number at the beginning of the CSR binary format header
+ * for the given type parameters.
+ *
+ * @tparam ValueType  the value type to be used for the binary storage
+ * @tparam IndexType  the index type to be used for the binary storage
+ */
+template <typename ValueType, typename IndexType>
+constexpr uint64 binary_csr_format_magic()
+{
+    constexpr uint64 shift = 256;
+    // replace the GINKGO prefix by GKOCSR, keeping the type bits
+    constexpr uint64 prefix_size = shift * shift * shift * shift * shift;
+    constexpr uint64 type_bits =
+        binary_format_magic<ValueType, IndexType>() / (prefix_size * shift);
+    return 'G' +
+           shift *
+               ('K' +
+                shift *
+                    ('O' +
+                     shift *
+                         ('C' +
+                          shift * ('S' + shift * ('R' + shift * type_bits)))));
+}
+
+
+/**
+ * Alignment of the sections of the CSR binary format in bytes, which allows
+ * mapping the sections as arrays of any value and index type.
+ */
+constexpr uint64 binary_csr_alignment = 64;
+
+
+inline uint64 align_binary_csr_offset(uint64 offset)
+{
+    return ceildiv(offset, binary_csr_alignment) * binary_csr_alignment;
+}
+
+
+/**
+ * The header of the binary matrix format and the CSR binary format.
+ */
+struct binary_header {
+    uint64 magic;
+    uint64 num_rows;
+    uint64 num_cols;
+    uint64 num_entries;
+};
+
+
+}  // namespace gko
+
+
+#endif  // GKO_CORE_BASE_MTX_IO_HPP_
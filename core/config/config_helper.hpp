@@ -49,6 +49,9 @@ enum class LinOpFactoryType : int {
     Gcr,
     Gmres,
     CbGmres,
+    PipeCg,
+    PipeBicgstab,
+    Chebyshev,
     Direct,
     LowerTrs,
     UpperTrs,
@@ -68,6 +71,7 @@ enum class LinOpFactoryType : int {
     Sor,
     Multigrid,
     Pgm,
+    RugeStuben,
     Schwarz
 };
 
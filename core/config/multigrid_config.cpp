@@ -4,6 +4,7 @@
 
 #include "core/config/parse_macro.hpp"
 #include "ginkgo/core/multigrid/pgm.hpp"
+#include "ginkgo/core/multigrid/ruge_stuben.hpp"
 
 
 namespace gko {
@@ -11,6 +12,7 @@ namespace config {
 
 
 GKO_PARSE_VALUE_AND_INDEX_TYPE(Pgm, gko::multigrid::Pgm);
+GKO_PARSE_VALUE_AND_INDEX_TYPE(RugeStuben, gko::multigrid::RugeStuben);
 
 
 }  // namespace config
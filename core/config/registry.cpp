@@ -29,6 +29,9 @@ configuration_map generate_config_map()
             {"solver::Gcr", parse<LinOpFactoryType::Gcr>},
             {"solver::Gmres", parse<LinOpFactoryType::Gmres>},
             {"solver::CbGmres", parse<LinOpFactoryType::CbGmres>},
+            {"solver::PipeCg", parse<LinOpFactoryType::PipeCg>},
+            {"solver::PipeBicgstab", parse<LinOpFactoryType::PipeBicgstab>},
+            {"solver::Chebyshev", parse<LinOpFactoryType::Chebyshev>},
             {"solver::Direct", parse<LinOpFactoryType::Direct>},
             {"solver::LowerTrs", parse<LinOpFactoryType::LowerTrs>},
             {"solver::UpperTrs", parse<LinOpFactoryType::UpperTrs>},
@@ -49,6 +52,7 @@ configuration_map generate_config_map()
             {"preconditioner::Sor", parse<LinOpFactoryType::Sor>},
             {"solver::Multigrid", parse<LinOpFactoryType::Multigrid>},
             {"multigrid::Pgm", parse<LinOpFactoryType::Pgm>},
+            {"multigrid::RugeStuben", parse<LinOpFactoryType::RugeStuben>},
 #if GINKGO_BUILD_MPI
         {
             "preconditioner::Schwarz", parse<LinOpFactoryType::Schwarz>
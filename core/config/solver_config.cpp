@@ -12,6 +12,7 @@
 #include <ginkgo/core/solver/cb_gmres.hpp>
 #include <ginkgo/core/solver/cg.hpp>
 #include <ginkgo/core/solver/cgs.hpp>
+#include <ginkgo/core/solver/chebyshev.hpp>
 #include <ginkgo/core/solver/direct.hpp>
 #include <ginkgo/core/solver/fcg.hpp>
 #include <ginkgo/core/solver/gcr.hpp>
@@ -19,6 +20,8 @@
 #include <ginkgo/core/solver/idr.hpp>
 #include <ginkgo/core/solver/ir.hpp>
 #include <ginkgo/core/solver/multigrid.hpp>
+#include <ginkgo/core/solver/pipe_bicgstab.hpp>
+#include <ginkgo/core/solver/pipe_cg.hpp>
 #include <ginkgo/core/solver/triangular.hpp>
 
 #include "core/config/config_helper.hpp"
@@ -40,6 +43,9 @@ GKO_PARSE_VALUE_TYPE(Idr, gko::solver::Idr);
 GKO_PARSE_VALUE_TYPE(Gcr, gko::solver::Gcr);
 GKO_PARSE_VALUE_TYPE(Gmres, gko::solver::Gmres);
 GKO_PARSE_VALUE_TYPE(CbGmres, gko::solver::CbGmres);
+GKO_PARSE_VALUE_TYPE(PipeCg, gko::solver::PipeCg);
+GKO_PARSE_VALUE_TYPE(PipeBicgstab, gko::solver::PipeBicgstab);
+GKO_PARSE_VALUE_TYPE(Chebyshev, gko::solver::Chebyshev);
 GKO_PARSE_VALUE_AND_INDEX_TYPE(Direct, gko::experimental::solver::Direct);
 GKO_PARSE_VALUE_AND_INDEX_TYPE(LowerTrs, gko::solver::LowerTrs);
 GKO_PARSE_VALUE_AND_INDEX_TYPE(UpperTrs, gko::solver::UpperTrs);
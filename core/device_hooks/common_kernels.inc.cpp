@@ -45,10 +45,12 @@
 #include "core/matrix/sellp_kernels.hpp"
 #include "core/matrix/sparsity_csr_kernels.hpp"
 #include "core/multigrid/pgm_kernels.hpp"
+#include "core/multigrid/ruge_stuben_kernels.hpp"
 #include "core/preconditioner/batch_jacobi_kernels.hpp"
 #include "core/preconditioner/isai_kernels.hpp"
 #include "core/preconditioner/jacobi_kernels.hpp"
 #include "core/preconditioner/sor_kernels.hpp"
+#include "core/reorder/graph_partition_kernels.hpp"
 #include "core/reorder/rcm_kernels.hpp"
 #include "core/solver/batch_bicgstab_kernels.hpp"
 #include "core/solver/batch_cg_kernels.hpp"
@@ -57,6 +59,7 @@
 #include "core/solver/cb_gmres_kernels.hpp"
 #include "core/solver/cg_kernels.hpp"
 #include "core/solver/cgs_kernels.hpp"
+#include "core/solver/chebyshev_kernels.hpp"
 #include "core/solver/common_gmres_kernels.hpp"
 #include "core/solver/fcg_kernels.hpp"
 #include "core/solver/gcr_kernels.hpp"
@@ -65,6 +68,8 @@
 #include "core/solver/ir_kernels.hpp"
 #include "core/solver/lower_trs_kernels.hpp"
 #include "core/solver/multigrid_kernels.hpp"
+#include "core/solver/pipe_bicgstab_kernels.hpp"
+#include "core/solver/pipe_cg_kernels.hpp"
 #include "core/solver/upper_trs_kernels.hpp"
 #include "core/stop/criterion_kernels.hpp"
 #include "core/stop/residual_norm_kernels.hpp"
@@ -442,6 +447,9 @@ namespace cg {
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_CG_INITIALIZE_KERNEL);
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_CG_STEP_1_KERNEL);
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_CG_STEP_2_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_CG_FUSED_STEP_1_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CG_SPMV_DOT_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_CG_FUSED_STEP_2_KERNEL);
 
 
 }  // namespace cg
@@ -504,6 +512,39 @@ GKO_STUB_VALUE_TYPE(GKO_DECLARE_BICGSTAB_FINALIZE_KERNEL);
 }  // namespace bicgstab
 
 
+namespace pipe_cg {
+
+
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_PIPE_CG_INITIALIZE_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_PIPE_CG_STEP_1_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_PIPE_CG_STEP_2_KERNEL);
+
+
+}  // namespace pipe_cg
+
+
+namespace pipe_bicgstab {
+
+
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_PIPE_BICGSTAB_INITIALIZE_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_PIPE_BICGSTAB_STEP_1_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_PIPE_BICGSTAB_STEP_2_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_PIPE_BICGSTAB_STEP_3_KERNEL);
+
+
+}  // namespace pipe_bicgstab
+
+
+namespace chebyshev {
+
+
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_CHEBYSHEV_INIT_UPDATE_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_CHEBYSHEV_UPDATE_KERNEL);
+
+
+}  // namespace chebyshev
+
+
 namespace idr {
 
 
@@ -555,6 +596,10 @@ namespace gmres {
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_GMRES_RESTART_KERNEL);
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_GMRES_MULTI_AXPY_KERNEL);
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_GMRES_MULTI_DOT_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_GMRES_BLOCK_DOT_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_GMRES_BLOCK_CHOLESKY_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_GMRES_BLOCK_ORTHONORMALIZE_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_GMRES_BLOCK_HESSENBERG_KERNEL);
 
 
 }  // namespace gmres
@@ -825,6 +870,8 @@ namespace sor {
 
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SOR_INITIALIZE_WEIGHTED_L);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SOR_INITIALIZE_WEIGHTED_L_U);
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_SOR_COMPUTE_MULTICOLOR_ORDERING);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SOR_APPLY_MULTICOLOR_SWEEP);
 
 
 }  // namespace sor
@@ -945,6 +992,16 @@ GKO_STUB_VALUE_AND_INDEX_TYPE(
 }  // namespace par_ilut_factorization
 
 
+namespace graph_partition {
+
+
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_GRAPH_PARTITION_MATCH_EDGES_KERNEL);
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_GRAPH_PARTITION_CONTRACT_GRAPH_KERNEL);
+
+
+}  // namespace graph_partition
+
+
 namespace rcm {
 
 
@@ -961,20 +1018,45 @@ GKO_STUB_INDEX_TYPE(GKO_DECLARE_PGM_MATCH_EDGE_KERNEL);
 GKO_STUB_INDEX_TYPE(GKO_DECLARE_PGM_COUNT_UNAGG_KERNEL);
 GKO_STUB_INDEX_TYPE(GKO_DECLARE_PGM_RENUMBER_KERNEL);
 GKO_STUB_INDEX_TYPE(GKO_DECLARE_PGM_SORT_AGG_KERNEL);
-GKO_STUB_INDEX_TYPE(GKO_DECLARE_PGM_MAP_ROW_KERNEL);
-GKO_STUB_INDEX_TYPE(GKO_DECLARE_PGM_MAP_COL_KERNEL);
-GKO_STUB_INDEX_TYPE(GKO_DECLARE_PGM_COUNT_UNREPEATED_NNZ_KERNEL);
 GKO_STUB_NON_COMPLEX_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_PGM_FIND_STRONGEST_NEIGHBOR);
 GKO_STUB_NON_COMPLEX_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM_ASSIGN_TO_EXIST_AGG);
-GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM_SORT_ROW_MAJOR);
-GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM_COMPUTE_COARSE_COO);
 GKO_STUB_INDEX_TYPE(GKO_DECLARE_PGM_GATHER_INDEX);
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_PGM_GALERKIN_COUNT_KERNEL);
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_PGM_GALERKIN_FILL_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM_GALERKIN_NUMERIC_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PGM_FILTER_PROLONGATION_COUNT_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM_FILTER_PROLONGATION_FILL_KERNEL);
 
 
 }  // namespace pgm
 
 
+namespace ruge_stuben {
+
+
+GKO_STUB_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_COMPUTE_STRONG_COUNT_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_COMPUTE_STRONG_FILL_KERNEL);
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_RUGE_STUBEN_PMIS_SELECT_KERNEL);
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_RUGE_STUBEN_PMIS_UPDATE_KERNEL);
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_RUGE_STUBEN_COUNT_UNDECIDED_KERNEL);
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_RUGE_STUBEN_RS_FIRST_PASS_KERNEL);
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_RUGE_STUBEN_COMPUTE_COARSE_MAP_KERNEL);
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_RUGE_STUBEN_DIRECT_INTERPOLATION_COUNT_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_DIRECT_INTERPOLATION_FILL_KERNEL);
+GKO_STUB_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_EXTENDED_I_INTERPOLATION_COUNT_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_EXTENDED_I_INTERPOLATION_FILL_KERNEL);
+
+
+}  // namespace ruge_stuben
+
+
 namespace set_all_statuses {
 
 
@@ -4,6 +4,7 @@
 
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/memory.hpp>
 #include <ginkgo/core/base/scoped_device_id_guard.hpp>
 #include <ginkgo/core/base/version.hpp>
 
@@ -30,6 +31,16 @@ std::string OmpExecutor::get_description() const GKO_NOT_COMPILED(omp);
 int OmpExecutor::get_num_omp_threads() { return 1; }
 
 
+void OmpExecutor::bind_threads_to_cores() const GKO_NOT_COMPILED(omp);
+
+
+void* OmpFirstTouchAllocator::allocate(size_type num_bytes)
+    GKO_NOT_COMPILED(omp);
+
+
+void OmpFirstTouchAllocator::deallocate(void* ptr) GKO_NOT_COMPILED(omp);
+
+
 }  // namespace gko
 
 
@@ -6,10 +6,15 @@
 #define GKO_CORE_DISTRIBUTED_HELPERS_HPP_
 
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
 
 #include <ginkgo/config.hpp>
 #include <ginkgo/core/distributed/matrix.hpp>
+#include <ginkgo/core/distributed/partition.hpp>
 #include <ginkgo/core/distributed/vector.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 
@@ -212,6 +217,196 @@ create_submatrix_helper(experimental::distributed::Vector<ValueType>* mtx,
 #endif
 
 
+/**
+ * Handle for a sum over all processes started by start_global_sum. After
+ * wait() returns, the summed values are stored in the Dense matrix passed to
+ * start_global_sum.
+ */
+template <typename ValueType>
+class global_sum_handle {
+public:
+    global_sum_handle() = default;
+
+#if GINKGO_BUILD_MPI
+
+    global_sum_handle(
+        experimental::mpi::request request, matrix::Dense<ValueType>* values,
+        std::unique_ptr<matrix::Dense<ValueType>> host_values = nullptr)
+        : request_{std::move(request)},
+          values_{values},
+          host_values_{std::move(host_values)}
+    {}
+
+#endif
+
+    global_sum_handle(const global_sum_handle&) = delete;
+
+    global_sum_handle(global_sum_handle&& other) noexcept
+#if GINKGO_BUILD_MPI
+        : request_{std::move(other.request_)},
+          values_{std::exchange(other.values_, nullptr)},
+          host_values_{std::move(other.host_values_)}
+#endif
+    {}
+
+    global_sum_handle& operator=(const global_sum_handle&) = delete;
+
+    global_sum_handle& operator=(global_sum_handle&&) = delete;
+
+    /**
+     * Waits for a sum that is still in progress, since MPI may access the
+     * buffers until it completes, e.g. if the solver is left by an exception.
+     * Only the request is checked, since it is reset exactly when the sum
+     * has completed.
+     */
+    ~global_sum_handle()
+    {
+#if GINKGO_BUILD_MPI
+        if (*request_.get() != MPI_REQUEST_NULL) {
+            MPI_Wait(request_.get(), MPI_STATUS_IGNORE);
+        }
+#endif
+    }
+
+    /** Blocks until the sum is complete. */
+    void wait()
+    {
+#if GINKGO_BUILD_MPI
+        if (values_) {
+            request_.wait();
+            if (host_values_) {
+                values_->copy_from(host_values_);
+            }
+            values_ = nullptr;
+        }
+#endif
+    }
+
+private:
+#if GINKGO_BUILD_MPI
+    experimental::mpi::request request_;
+    matrix::Dense<ValueType>* values_{};
+    std::unique_ptr<matrix::Dense<ValueType>> host_values_;
+#endif
+};
+
+
+/**
+ * Starts summing up the process-local values over all processes that share
+ * the given vector. For non-distributed vectors, the local values are already
+ * the global values, so nothing needs to be done.
+ *
+ * @param vector  the vector determining the communicator
+ * @param values  the contiguous local values that will be overwritten by their
+ *                global sum. They must not be accessed before the returned
+ *                handle was waited on.
+ */
+template <typename ValueType>
+global_sum_handle<ValueType> start_global_sum(
+    const matrix::Dense<ValueType>* vector, matrix::Dense<ValueType>* values)
+{
+    return {};
+}
+
+
+#if GINKGO_BUILD_MPI
+
+
+/**
+ * @copydoc start_global_sum(const matrix::Dense<ValueType>*,
+ *                           matrix::Dense<ValueType>*)
+ */
+template <typename ValueType>
+global_sum_handle<ValueType> start_global_sum(
+    const experimental::distributed::Vector<ValueType>* vector,
+    matrix::Dense<ValueType>* values)
+{
+    GKO_ASSERT(values->get_stride() == values->get_size()[1] ||
+               values->get_size()[0] <= 1);
+    const auto exec = values->get_executor();
+    const auto comm = vector->get_communicator();
+    const auto count =
+        static_cast<int>(values->get_size()[0] * values->get_size()[1]);
+    // the local values may still be computed asynchronously
+    exec->synchronize();
+    if (experimental::mpi::requires_host_buffer(exec, comm)) {
+        auto host_values = gko::clone(exec->get_master(), values);
+        auto request = comm.i_all_reduce(
+            exec->get_master(), host_values->get_values(), count, MPI_SUM);
+        return {std::move(request), values, std::move(host_values)};
+    }
+    return {comm.i_all_reduce(exec, values->get_values(), count, MPI_SUM),
+            values};
+}
+
+
+/**
+ * Returns the owning part and the index within the owning part of a global
+ * index.
+ *
+ * @param host_partition  the partition, stored on a host executor
+ * @param global_idx  the global index
+ */
+template <typename LocalIndexType, typename GlobalIndexType>
+std::pair<experimental::distributed::comm_index_type, LocalIndexType>
+find_owner(const experimental::distributed::Partition<
+               LocalIndexType, GlobalIndexType>* host_partition,
+           GlobalIndexType global_idx)
+{
+    const auto bounds = host_partition->get_range_bounds();
+    const auto range =
+        std::upper_bound(bounds,
+                         bounds + host_partition->get_num_ranges() + 1,
+                         global_idx) -
+        bounds - 1;
+    return {host_partition->get_part_ids()[range],
+            static_cast<LocalIndexType>(
+                global_idx - bounds[range] +
+                host_partition->get_range_starting_indices()[range])};
+}
+
+
+/**
+ * Sends send_sizes[i] consecutive entries of send to rank i and returns the
+ * entries received from all ranks, ordered by their source rank. All buffers
+ * are stored on the host.
+ *
+ * @param comm  the communicator
+ * @param host  the host executor
+ * @param send  the entries to send, ordered by their target rank
+ * @param send_sizes  the number of entries to send to each rank
+ * @param recv_sizes  the output number of entries received from each rank
+ *
+ * @return the received entries
+ */
+template <typename T>
+std::vector<T> host_all_to_all_v(
+    const experimental::mpi::communicator& comm,
+    std::shared_ptr<const Executor> host, const std::vector<T>& send,
+    const std::vector<experimental::distributed::comm_index_type>& send_sizes,
+    std::vector<experimental::distributed::comm_index_type>& recv_sizes)
+{
+    using experimental::distributed::comm_index_type;
+    const auto num_ranks = comm.size();
+    recv_sizes.resize(num_ranks);
+    comm.all_to_all(host, send_sizes.data(), 1, recv_sizes.data(), 1);
+    std::vector<comm_index_type> send_offsets(num_ranks + 1);
+    std::vector<comm_index_type> recv_offsets(num_ranks + 1);
+    std::partial_sum(send_sizes.begin(), send_sizes.end(),
+                     send_offsets.begin() + 1);
+    std::partial_sum(recv_sizes.begin(), recv_sizes.end(),
+                     recv_offsets.begin() + 1);
+    std::vector<T> recv(recv_offsets.back());
+    comm.all_to_all_v(host, send.data(), send_sizes.data(),
+                      send_offsets.data(), recv.data(), recv_sizes.data(),
+                      recv_offsets.data());
+    return recv;
+}
+
+
+#endif
+
+
 }  // namespace detail
 }  // namespace gko
 
@@ -4,6 +4,12 @@
 
 #include "ginkgo/core/distributed/matrix.hpp"
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
 #include <ginkgo/core/base/precision_dispatch.hpp>
 #include <ginkgo/core/distributed/vector.hpp>
 #include <ginkgo/core/matrix/coo.hpp>
@@ -28,6 +34,66 @@ GKO_REGISTER_OPERATION(separate_local_nonlocal,
 }  // namespace matrix
 
 
+namespace {
+
+
+/**
+ * Returns a distributed graph communicator on comm with the given neighbors.
+ *
+ * Creating a graph communicator is a costly collective operation, so all
+ * matrices with the same neighbors on the same communicator, e.g. matrices
+ * read with the same partitions and sparsity pattern, share a single graph
+ * communicator. The cache only holds weak references, the graph communicator
+ * is released together with the last matrix using it.
+ */
+std::shared_ptr<const mpi::communicator> get_neighborhood_communicator(
+    std::shared_ptr<const Executor> exec, const mpi::communicator& comm,
+    const std::vector<comm_index_type>& sources,
+    const std::vector<comm_index_type>& destinations)
+{
+    using key_type = std::tuple<MPI_Comm, std::vector<comm_index_type>,
+                                std::vector<comm_index_type>>;
+    static std::mutex cache_mutex;
+    static std::map<key_type, std::weak_ptr<const mpi::communicator>> cache;
+    const key_type key{comm.get(), sources, destinations};
+    std::shared_ptr<const mpi::communicator> neighbor_comm;
+    {
+        std::lock_guard<std::mutex> guard{cache_mutex};
+        for (auto it = cache.begin(); it != cache.end();) {
+            it = it->second.expired() ? cache.erase(it) : std::next(it);
+        }
+        auto it = cache.find(key);
+        if (it != cache.end()) {
+            neighbor_comm = it->second.lock();
+        }
+    }
+    if (neighbor_comm) {
+        // the handle of a freed communicator may be reused by a new one, so
+        // the cached graph communicator also needs to span the same processes
+        int result{};
+        GKO_ASSERT_NO_MPI_ERRORS(
+            MPI_Comm_compare(comm.get(), neighbor_comm->get(), &result));
+        if (result != MPI_CONGRUENT) {
+            neighbor_comm.reset();
+        }
+    }
+    // the graph communicator needs to be created collectively, unless it is
+    // found in the cache on every process
+    int found = neighbor_comm != nullptr;
+    comm.all_reduce(std::move(exec), &found, 1, MPI_LAND);
+    if (!found) {
+        neighbor_comm =
+            std::make_shared<mpi::communicator>(comm, sources, destinations);
+        std::lock_guard<std::mutex> guard{cache_mutex};
+        cache[key] = neighbor_comm;
+    }
+    return neighbor_comm;
+}
+
+
+}  // namespace
+
+
 template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
 Matrix<ValueType, LocalIndexType, GlobalIndexType>::Matrix(
     std::shared_ptr<const Executor> exec, mpi::communicator comm)
@@ -136,6 +202,7 @@ Matrix<ValueType, LocalIndexType, GlobalIndexType>::Matrix(
     if (use_host_buffer) {
         gather_idxs_.set_executor(exec);
     }
+    this->setup_neighborhood();
 
     one_scalar_.init(exec, dim<2>{1, 1});
     one_scalar_->fill(one<value_type>());
@@ -212,7 +279,14 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::convert_to(
     result->recv_offsets_ = this->recv_offsets_;
     result->recv_sizes_ = this->recv_sizes_;
     result->send_sizes_ = this->send_sizes_;
+    result->neighbor_comm_ = this->neighbor_comm_;
+    result->neighbor_send_offsets_ = this->neighbor_send_offsets_;
+    result->neighbor_send_sizes_ = this->neighbor_send_sizes_;
+    result->neighbor_recv_offsets_ = this->neighbor_recv_offsets_;
+    result->neighbor_recv_sizes_ = this->neighbor_recv_sizes_;
     result->non_local_to_global_ = this->non_local_to_global_;
+    result->row_partition_ = this->row_partition_;
+    result->col_partition_ = this->col_partition_;
     result->set_size(this->get_size());
 }
 
@@ -231,7 +305,14 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::move_to(
     result->recv_offsets_ = std::move(this->recv_offsets_);
     result->recv_sizes_ = std::move(this->recv_sizes_);
     result->send_sizes_ = std::move(this->send_sizes_);
+    result->neighbor_comm_ = std::move(this->neighbor_comm_);
+    result->neighbor_send_offsets_ = std::move(this->neighbor_send_offsets_);
+    result->neighbor_send_sizes_ = std::move(this->neighbor_send_sizes_);
+    result->neighbor_recv_offsets_ = std::move(this->neighbor_recv_offsets_);
+    result->neighbor_recv_sizes_ = std::move(this->neighbor_recv_sizes_);
     result->non_local_to_global_ = std::move(this->non_local_to_global_);
+    result->row_partition_ = std::move(this->row_partition_);
+    result->col_partition_ = std::move(this->col_partition_);
     result->set_size(this->get_size());
     this->set_size({});
 }
@@ -252,6 +333,8 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::read_distributed(
     GKO_ASSERT_EQ(comm.size(), col_partition->get_num_parts());
     auto exec = this->get_executor();
     auto local_part = comm.rank();
+    row_partition_ = row_partition;
+    col_partition_ = col_partition;
 
     // set up LinOp sizes
     auto num_parts = static_cast<size_type>(row_partition->get_num_parts());
@@ -349,6 +432,7 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::read_distributed(
     if (use_host_buffer) {
         gather_idxs_.set_executor(exec);
     }
+    this->setup_neighborhood();
 }
 
 
@@ -390,6 +474,33 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::read_distributed(
 }
 
 
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Matrix<ValueType, LocalIndexType, GlobalIndexType>::setup_neighborhood()
+{
+    const auto comm = this->get_communicator();
+    std::vector<comm_index_type> sources;
+    std::vector<comm_index_type> destinations;
+    neighbor_send_offsets_.clear();
+    neighbor_send_sizes_.clear();
+    neighbor_recv_offsets_.clear();
+    neighbor_recv_sizes_.clear();
+    for (comm_index_type rank = 0; rank < comm.size(); rank++) {
+        if (recv_sizes_[rank] > 0) {
+            sources.push_back(rank);
+            neighbor_recv_sizes_.push_back(recv_sizes_[rank]);
+            neighbor_recv_offsets_.push_back(recv_offsets_[rank]);
+        }
+        if (send_sizes_[rank] > 0) {
+            destinations.push_back(rank);
+            neighbor_send_sizes_.push_back(send_sizes_[rank]);
+            neighbor_send_offsets_.push_back(send_offsets_[rank]);
+        }
+    }
+    neighbor_comm_ = get_neighborhood_communicator(
+        this->get_executor()->get_master(), comm, sources, destinations);
+}
+
+
 template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
 mpi::request Matrix<ValueType, LocalIndexType, GlobalIndexType>::communicate(
     const local_vector_type* local_b) const
@@ -424,17 +535,35 @@ mpi::request Matrix<ValueType, LocalIndexType, GlobalIndexType>::communicate(
     auto recv_ptr = use_host_buffer ? host_recv_buffer_->get_values()
                                     : recv_buffer_->get_values();
     exec->synchronize();
+    auto comm_exec = use_host_buffer ? exec->get_master() : exec;
+    if (neighbor_comm_) {
+        // only exchange data with the neighbors instead of the whole
+        // communicator
+#ifdef GINKGO_FORCE_SPMV_BLOCKING_COMM
+        neighbor_comm_->neighbor_all_to_all_v(
+            comm_exec, send_ptr, neighbor_send_sizes_.data(),
+            neighbor_send_offsets_.data(), type.get(), recv_ptr,
+            neighbor_recv_sizes_.data(), neighbor_recv_offsets_.data(),
+            type.get());
+        return {};
+#else
+        return neighbor_comm_->i_neighbor_all_to_all_v(
+            comm_exec, send_ptr, neighbor_send_sizes_.data(),
+            neighbor_send_offsets_.data(), type.get(), recv_ptr,
+            neighbor_recv_sizes_.data(), neighbor_recv_offsets_.data(),
+            type.get());
+#endif
+    }
 #ifdef GINKGO_FORCE_SPMV_BLOCKING_COMM
-    comm.all_to_all_v(use_host_buffer ? exec->get_master() : exec, send_ptr,
-                      send_sizes_.data(), send_offsets_.data(), type.get(),
-                      recv_ptr, recv_sizes_.data(), recv_offsets_.data(),
-                      type.get());
+    comm.all_to_all_v(comm_exec, send_ptr, send_sizes_.data(),
+                      send_offsets_.data(), type.get(), recv_ptr,
+                      recv_sizes_.data(), recv_offsets_.data(), type.get());
     return {};
 #else
-    return comm.i_all_to_all_v(
-        use_host_buffer ? exec->get_master() : exec, send_ptr,
-        send_sizes_.data(), send_offsets_.data(), type.get(), recv_ptr,
-        recv_sizes_.data(), recv_offsets_.data(), type.get());
+    return comm.i_all_to_all_v(comm_exec, send_ptr, send_sizes_.data(),
+                               send_offsets_.data(), type.get(), recv_ptr,
+                               recv_sizes_.data(), recv_offsets_.data(),
+                               type.get());
 #endif
 }
 
@@ -611,8 +740,15 @@ Matrix<ValueType, LocalIndexType, GlobalIndexType>::operator=(
         send_offsets_ = other.send_offsets_;
         recv_offsets_ = other.recv_offsets_;
         send_sizes_ = other.send_sizes_;
+        neighbor_comm_ = other.neighbor_comm_;
+        neighbor_send_offsets_ = other.neighbor_send_offsets_;
+        neighbor_send_sizes_ = other.neighbor_send_sizes_;
+        neighbor_recv_offsets_ = other.neighbor_recv_offsets_;
+        neighbor_recv_sizes_ = other.neighbor_recv_sizes_;
         recv_sizes_ = other.recv_sizes_;
         non_local_to_global_ = other.non_local_to_global_;
+        row_partition_ = other.row_partition_;
+        col_partition_ = other.col_partition_;
         one_scalar_.init(this->get_executor(), dim<2>{1, 1});
         one_scalar_->fill(one<value_type>());
     }
@@ -635,8 +771,15 @@ Matrix<ValueType, LocalIndexType, GlobalIndexType>::operator=(Matrix&& other)
         send_offsets_ = std::move(other.send_offsets_);
         recv_offsets_ = std::move(other.recv_offsets_);
         send_sizes_ = std::move(other.send_sizes_);
+        neighbor_comm_ = std::move(other.neighbor_comm_);
+        neighbor_send_offsets_ = std::move(other.neighbor_send_offsets_);
+        neighbor_send_sizes_ = std::move(other.neighbor_send_sizes_);
+        neighbor_recv_offsets_ = std::move(other.neighbor_recv_offsets_);
+        neighbor_recv_sizes_ = std::move(other.neighbor_recv_sizes_);
         recv_sizes_ = std::move(other.recv_sizes_);
         non_local_to_global_ = std::move(other.non_local_to_global_);
+        row_partition_ = std::move(other.row_partition_);
+        col_partition_ = std::move(other.col_partition_);
         one_scalar_.init(this->get_executor(), dim<2>{1, 1});
         one_scalar_->fill(one<value_type>());
     }
@@ -0,0 +1,405 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "ginkgo/core/distributed/mtx_io.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/temporary_clone.hpp>
+#include <ginkgo/core/distributed/partition.hpp>
+
+#include "core/base/mtx_io.hpp"
+#include "core/distributed/helpers.hpp"
+
+
+namespace gko {
+namespace experimental {
+namespace distributed {
+namespace {
+
+
+/**
+ * Read-only view of a file opened collectively with MPI-IO.
+ */
+class mpi_input_file {
+public:
+    mpi_input_file(const mpi::communicator& comm, const std::string& filename)
+    {
+        if (MPI_File_open(comm.get(), filename.c_str(), MPI_MODE_RDONLY,
+                          MPI_INFO_NULL, &handle_) != MPI_SUCCESS) {
+            throw GKO_STREAM_ERROR("failed opening file " + filename);
+        }
+    }
+
+    mpi_input_file(const mpi_input_file&) = delete;
+
+    mpi_input_file& operator=(const mpi_input_file&) = delete;
+
+    ~mpi_input_file() { MPI_File_close(&handle_); }
+
+    size_type get_size() const
+    {
+        MPI_Offset size{};
+        GKO_ASSERT_NO_MPI_ERRORS(MPI_File_get_size(handle_, &size));
+        return static_cast<size_type>(size);
+    }
+
+    /**
+     * Reads num_bytes bytes starting at the given offset. The read is
+     * independent of the other ranks.
+     */
+    void read_at(size_type offset, void* data, size_type num_bytes) const
+    {
+        // MPI counts are limited to int, so large reads are split
+        constexpr size_type max_chunk_size = size_type{1} << 30;
+        auto ptr = static_cast<char*>(data);
+        while (num_bytes > 0) {
+            const auto chunk_size = std::min(num_bytes, max_chunk_size);
+            MPI_Status status;
+            GKO_ASSERT_NO_MPI_ERRORS(MPI_File_read_at(
+                handle_, static_cast<MPI_Offset>(offset), ptr,
+                static_cast<int>(chunk_size), MPI_BYTE, &status));
+            int count{};
+            GKO_ASSERT_NO_MPI_ERRORS(MPI_Get_count(&status, MPI_BYTE, &count));
+            if (count != static_cast<int>(chunk_size)) {
+                throw GKO_STREAM_ERROR("failed reading " +
+                                       std::to_string(chunk_size) +
+                                       " bytes at offset " +
+                                       std::to_string(offset));
+            }
+            offset += chunk_size;
+            ptr += chunk_size;
+            num_bytes -= chunk_size;
+        }
+    }
+
+private:
+    MPI_File handle_;
+};
+
+
+/**
+ * Rethrows the error of a rank-local part of the reader on all ranks. The
+ * reads and checks of each rank are independent, so an error that is only
+ * thrown on one rank would leave the others waiting in the next collective
+ * operation.
+ *
+ * @param comm  the communicator of the reader
+ * @param exec  the host executor
+ * @param error  the exception thrown on this rank, or nullptr
+ */
+void rethrow_collectively(const mpi::communicator& comm,
+                          std::shared_ptr<const Executor> exec,
+                          std::exception_ptr error)
+{
+    int failed = error != nullptr;
+    comm.all_reduce(std::move(exec), &failed, 1, MPI_LOR);
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    if (failed) {
+        throw GKO_STREAM_ERROR("reading the matrix failed on another rank");
+    }
+}
+
+
+template <typename Type, typename FileType>
+Type convert_binary_entry(FileType value)
+{
+    if constexpr (is_complex<Type>() || !is_complex<FileType>()) {
+        return static_cast<Type>(value);
+    } else {
+        // complex to real conversions are rejected before reading
+        return static_cast<Type>(real(value));
+    }
+}
+
+
+/**
+ * Reads count consecutive entries of type FileType starting at offset and
+ * converts them to Type.
+ */
+template <typename FileType, typename Type>
+std::vector<Type> read_binary_section(const mpi_input_file& file,
+                                      size_type offset, size_type count)
+{
+    std::vector<char> block(count * sizeof(FileType));
+    file.read_at(offset, block.data(), block.size());
+    std::vector<Type> result(count);
+    for (size_type i = 0; i < count; i++) {
+        FileType value{};
+        std::memcpy(&value, block.data() + i * sizeof(FileType),
+                    sizeof(FileType));
+        result[i] = convert_binary_entry<Type>(value);
+    }
+    return result;
+}
+
+
+template <typename FileValueType, typename ValueType>
+void check_binary_value_type()
+{
+    if (is_complex<FileValueType>() && !is_complex<ValueType>()) {
+        throw GKO_STREAM_ERROR(
+            "cannot read into this format, would assign complex to real");
+    }
+}
+
+
+template <typename FileValueType, typename FileIndexType, typename ValueType,
+          typename LocalIndexType, typename GlobalIndexType>
+device_matrix_data<ValueType, GlobalIndexType> read_binary_distributed_coo(
+    std::shared_ptr<const Executor> exec, const mpi::communicator& comm,
+    const mpi_input_file& file, const binary_header& header,
+    const Partition<LocalIndexType, GlobalIndexType>* host_partition)
+{
+    check_binary_value_type<FileValueType, ValueType>();
+    constexpr auto entry_binary_size =
+        sizeof(FileIndexType) * 2 + sizeof(FileValueType);
+    const auto num_entries = header.num_entries;
+    if (file.get_size() <
+        sizeof(binary_header) + num_entries * entry_binary_size) {
+        throw GKO_STREAM_ERROR("file is too small for " +
+                               std::to_string(num_entries) + " entries");
+    }
+    // the entries of a row can be anywhere in the file, so every rank reads
+    // an equally sized block and sends the entries to the owners of the rows
+    const auto num_ranks = static_cast<uint64>(comm.size());
+    const auto rank = static_cast<uint64>(comm.rank());
+    const auto begin = num_entries * rank / num_ranks;
+    const auto end = num_entries * (rank + 1) / num_ranks;
+    const auto num_block_entries = static_cast<size_type>(end - begin);
+    std::vector<comm_index_type> owners(num_block_entries);
+    std::vector<comm_index_type> send_sizes(num_ranks);
+    std::vector<GlobalIndexType> rows(num_block_entries);
+    std::vector<GlobalIndexType> cols(num_block_entries);
+    std::vector<ValueType> values(num_block_entries);
+    std::exception_ptr error;
+    try {
+        std::vector<char> block(num_block_entries * entry_binary_size);
+        file.read_at(sizeof(binary_header) + begin * entry_binary_size,
+                     block.data(), block.size());
+        for (size_type i = 0; i < num_block_entries; i++) {
+            const auto entry = block.data() + i * entry_binary_size;
+            FileIndexType row{};
+            FileIndexType col{};
+            FileValueType value{};
+            std::memcpy(&row, entry, sizeof(FileIndexType));
+            std::memcpy(&col, entry + sizeof(FileIndexType),
+                        sizeof(FileIndexType));
+            std::memcpy(&value, entry + 2 * sizeof(FileIndexType),
+                        sizeof(FileValueType));
+            if (row < 0 || static_cast<uint64>(row) >= header.num_rows ||
+                col < 0 || static_cast<uint64>(col) >= header.num_cols) {
+                throw GKO_STREAM_ERROR("entry " + std::to_string(begin + i) +
+                                       " is out of bounds");
+            }
+            rows[i] = static_cast<GlobalIndexType>(row);
+            cols[i] = static_cast<GlobalIndexType>(col);
+            values[i] = convert_binary_entry<ValueType>(value);
+            owners[i] = gko::detail::find_owner(host_partition, rows[i]).first;
+            send_sizes[owners[i]]++;
+        }
+    } catch (...) {
+        error = std::current_exception();
+    }
+    auto host = exec->get_master();
+    rethrow_collectively(comm, host, error);
+    std::vector<comm_index_type> send_offsets(num_ranks + 1);
+    std::partial_sum(send_sizes.begin(), send_sizes.end(),
+                     send_offsets.begin() + 1);
+    std::vector<GlobalIndexType> send_rows(num_block_entries);
+    std::vector<GlobalIndexType> send_cols(num_block_entries);
+    std::vector<ValueType> send_values(num_block_entries);
+    for (size_type i = 0; i < num_block_entries; i++) {
+        const auto out = send_offsets[owners[i]]++;
+        send_rows[out] = rows[i];
+        send_cols[out] = cols[i];
+        send_values[out] = values[i];
+    }
+
+    std::vector<comm_index_type> recv_sizes;
+    auto local_rows = gko::detail::host_all_to_all_v(comm, host, send_rows,
+                                                     send_sizes, recv_sizes);
+    auto local_cols = gko::detail::host_all_to_all_v(comm, host, send_cols,
+                                                     send_sizes, recv_sizes);
+    auto local_values = gko::detail::host_all_to_all_v(
+        comm, host, send_values, send_sizes, recv_sizes);
+    device_matrix_data<ValueType, GlobalIndexType> result{
+        exec,
+        dim<2>{static_cast<size_type>(header.num_rows),
+               static_cast<size_type>(header.num_cols)},
+        array<GlobalIndexType>{exec, local_rows.begin(), local_rows.end()},
+        array<GlobalIndexType>{exec, local_cols.begin(), local_cols.end()},
+        array<ValueType>{exec, local_values.begin(), local_values.end()}};
+    result.sort_row_major();
+    return result;
+}
+
+
+template <typename FileValueType, typename FileIndexType, typename ValueType,
+          typename LocalIndexType, typename GlobalIndexType>
+device_matrix_data<ValueType, GlobalIndexType> read_binary_distributed_csr(
+    std::shared_ptr<const Executor> exec, const mpi::communicator& comm,
+    const mpi_input_file& file, const binary_header& header,
+    const Partition<LocalIndexType, GlobalIndexType>* host_partition)
+{
+    check_binary_value_type<FileValueType, ValueType>();
+    const auto num_rows = header.num_rows;
+    const auto num_entries = header.num_entries;
+    const auto row_ptrs_offset = align_binary_csr_offset(sizeof(binary_header));
+    const auto col_idxs_offset = align_binary_csr_offset(
+        row_ptrs_offset + (num_rows + 1) * sizeof(FileIndexType));
+    const auto values_offset = align_binary_csr_offset(
+        col_idxs_offset + num_entries * sizeof(FileIndexType));
+    const auto end_offset = values_offset + num_entries * sizeof(FileValueType);
+    if (file.get_size() < end_offset) {
+        throw GKO_STREAM_ERROR("file is too small for " +
+                               std::to_string(num_entries) + " entries");
+    }
+    // only read the byte ranges of the row ranges owned by this rank
+    const auto rank = comm.rank();
+    const auto bounds = host_partition->get_range_bounds();
+    const auto part_ids = host_partition->get_part_ids();
+    std::vector<GlobalIndexType> rows;
+    std::vector<GlobalIndexType> cols;
+    std::vector<ValueType> values;
+    std::exception_ptr error;
+    try {
+        for (size_type range = 0; range < host_partition->get_num_ranges();
+             range++) {
+            if (part_ids[range] != rank) {
+                continue;
+            }
+            const auto first_row = static_cast<uint64>(bounds[range]);
+            const auto last_row = static_cast<uint64>(bounds[range + 1]);
+            // negative indices become too large as uint64, so a single upper
+            // bound check covers them
+            const auto row_ptrs = read_binary_section<FileIndexType, uint64>(
+                file, row_ptrs_offset + first_row * sizeof(FileIndexType),
+                last_row - first_row + 1);
+            if (!std::is_sorted(row_ptrs.begin(), row_ptrs.end()) ||
+                row_ptrs.back() > num_entries) {
+                throw GKO_STREAM_ERROR("invalid row pointers for rows " +
+                                       std::to_string(first_row) + " to " +
+                                       std::to_string(last_row));
+            }
+            const auto begin = row_ptrs.front();
+            const auto end = row_ptrs.back();
+            const auto range_cols = read_binary_section<FileIndexType, uint64>(
+                file, col_idxs_offset + begin * sizeof(FileIndexType),
+                end - begin);
+            const auto range_values =
+                read_binary_section<FileValueType, ValueType>(
+                    file, values_offset + begin * sizeof(FileValueType),
+                    end - begin);
+            for (auto row = first_row; row < last_row; row++) {
+                rows.insert(rows.end(),
+                            row_ptrs[row - first_row + 1] -
+                                row_ptrs[row - first_row],
+                            static_cast<GlobalIndexType>(row));
+            }
+            for (size_type i = 0; i < range_cols.size(); i++) {
+                if (range_cols[i] >= header.num_cols) {
+                    throw GKO_STREAM_ERROR(
+                        "column index " + std::to_string(begin + i) +
+                        " is out of bounds");
+                }
+                cols.push_back(static_cast<GlobalIndexType>(range_cols[i]));
+            }
+            values.insert(values.end(), range_values.begin(),
+                          range_values.end());
+        }
+    } catch (...) {
+        error = std::current_exception();
+    }
+    // the caller continues with collective operations on the matrix data
+    rethrow_collectively(comm, exec->get_master(), error);
+    return device_matrix_data<ValueType, GlobalIndexType>{
+        exec,
+        dim<2>{static_cast<size_type>(header.num_rows),
+               static_cast<size_type>(header.num_cols)},
+        array<GlobalIndexType>{exec, rows.begin(), rows.end()},
+        array<GlobalIndexType>{exec, cols.begin(), cols.end()},
+        array<ValueType>{exec, values.begin(), values.end()}};
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+device_matrix_data<ValueType, GlobalIndexType> read_binary_distributed_raw(
+    std::shared_ptr<const Executor> exec, mpi::communicator comm,
+    const std::string& filename,
+    std::shared_ptr<const Partition<LocalIndexType, GlobalIndexType>>
+        row_partition)
+{
+    GKO_ASSERT_EQ(comm.size(), row_partition->get_num_parts());
+    auto host_partition =
+        make_temporary_clone(exec->get_master(), row_partition);
+    mpi_input_file file{comm, filename};
+    binary_header header{};
+    if (file.get_size() < sizeof(binary_header)) {
+        throw GKO_STREAM_ERROR("failed reading header");
+    }
+    file.read_at(0, &header, sizeof(binary_header));
+    if (header.num_rows != host_partition->get_size()) {
+        throw GKO_STREAM_ERROR(
+            "the number of rows does not match the partition size");
+    }
+    if (header.num_rows > std::numeric_limits<GlobalIndexType>::max() ||
+        header.num_cols > std::numeric_limits<GlobalIndexType>::max()) {
+        throw GKO_STREAM_ERROR(
+            "cannot read into this format, its index type would overflow");
+    }
+#define DECLARE_OVERLOAD(_vtype, _itype)                               \
+    if (header.magic == binary_format_magic<_vtype, _itype>()) {       \
+        return read_binary_distributed_coo<_vtype, _itype, ValueType>( \
+            exec, comm, file, header, host_partition.get());           \
+    }                                                                  \
+    if (header.magic == binary_csr_format_magic<_vtype, _itype>()) {   \
+        return read_binary_distributed_csr<_vtype, _itype, ValueType>( \
+            exec, comm, file, header, host_partition.get());           \
+    }
+    DECLARE_OVERLOAD(double, int32)
+    DECLARE_OVERLOAD(float, int32)
+    DECLARE_OVERLOAD(std::complex<double>, int32)
+    DECLARE_OVERLOAD(std::complex<float>, int32)
+    DECLARE_OVERLOAD(double, int64)
+    DECLARE_OVERLOAD(float, int64)
+    DECLARE_OVERLOAD(std::complex<double>, int64)
+    DECLARE_OVERLOAD(std::complex<float>, int64)
+#undef DECLARE_OVERLOAD
+    throw GKO_STREAM_ERROR("unknown binary format header");
+}
+
+
+#define GKO_DECLARE_READ_BINARY_DISTRIBUTED_RAW(ValueType, LocalIndexType,   \
+                                                GlobalIndexType)             \
+    device_matrix_data<ValueType, GlobalIndexType>                           \
+    read_binary_distributed_raw<ValueType, LocalIndexType, GlobalIndexType>( \
+        std::shared_ptr<const Executor> exec, mpi::communicator comm,        \
+        const std::string& filename,                                         \
+        std::shared_ptr<const Partition<LocalIndexType, GlobalIndexType>>    \
+            row_partition)
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_LOCAL_GLOBAL_INDEX_TYPE(
+    GKO_DECLARE_READ_BINARY_DISTRIBUTED_RAW);
+
+
+}  // namespace distributed
+}  // namespace experimental
+}  // namespace gko
@@ -4,12 +4,18 @@
 
 #include "ginkgo/core/distributed/partition_helpers.hpp"
 
+#include <algorithm>
+#include <array>
 #include <numeric>
+#include <utility>
+#include <vector>
 
+#include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/distributed/partition.hpp>
 
 #include "core/components/fill_array_kernels.hpp"
 #include "core/distributed/partition_helpers_kernels.hpp"
+#include "core/reorder/graph_partition.hpp"
 
 
 namespace gko {
@@ -119,6 +125,69 @@ GKO_INSTANTIATE_FOR_EACH_LOCAL_GLOBAL_INDEX_TYPE(
     GKO_DECLARE_BUILD_PARTITION_FROM_LOCAL_SIZE);
 
 
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+std::unique_ptr<Partition<LocalIndexType, GlobalIndexType>>
+build_partition_from_matrix_data(
+    std::shared_ptr<const Executor> exec, mpi::communicator comm,
+    const device_matrix_data<ValueType, GlobalIndexType>& global_data)
+{
+    auto host_exec = exec->get_master();
+    // only the data on rank 0 is used, so all ranks check its size to throw
+    // together instead of waiting for the mapping
+    std::array<uint64, 2> size{
+        static_cast<uint64>(global_data.get_size()[0]),
+        static_cast<uint64>(global_data.get_size()[1])};
+    comm.broadcast(host_exec, size.data(), 2, 0);
+    GKO_ASSERT_IS_SQUARE_MATRIX(dim<2>(size[0], size[1]));
+    const auto num_rows = static_cast<GlobalIndexType>(size[0]);
+    array<comm_index_type> mapping(host_exec, num_rows);
+    if (comm.rank() == 0) {
+        // build the symmetrized adjacency graph without self loops
+        const auto host_data = global_data.copy_to_host();
+        std::vector<std::pair<GlobalIndexType, GlobalIndexType>> edges;
+        edges.reserve(2 * host_data.nonzeros.size());
+        for (const auto& entry : host_data.nonzeros) {
+            if (entry.row != entry.column) {
+                edges.emplace_back(entry.row, entry.column);
+                edges.emplace_back(entry.column, entry.row);
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+        array<GlobalIndexType> row_ptrs(host_exec, num_rows + 1);
+        array<GlobalIndexType> col_idxs(host_exec, edges.size());
+        array<GlobalIndexType> parts(host_exec, num_rows);
+        row_ptrs.fill(zero<GlobalIndexType>());
+        for (size_type i = 0; i < edges.size(); i++) {
+            row_ptrs.get_data()[edges[i].first + 1]++;
+            col_idxs.get_data()[i] = edges[i].second;
+        }
+        std::partial_sum(row_ptrs.get_data(),
+                         row_ptrs.get_data() + num_rows + 1,
+                         row_ptrs.get_data());
+        reorder::graph_partition::partition_graph(
+            host_exec, num_rows, row_ptrs.get_const_data(),
+            col_idxs.get_const_data(),
+            static_cast<GlobalIndexType>(comm.size()), parts.get_data());
+        std::copy_n(parts.get_const_data(), num_rows, mapping.get_data());
+    }
+    comm.broadcast(host_exec, mapping.get_data(), static_cast<int>(num_rows),
+                   0);
+    mapping.set_executor(exec);
+    return Partition<LocalIndexType, GlobalIndexType>::build_from_mapping(
+        exec, mapping, comm.size());
+}
+
+#define GKO_DECLARE_BUILD_PARTITION_FROM_MATRIX_DATA(                 \
+    _value_type, _local_type, _global_type)                           \
+    std::unique_ptr<Partition<_local_type, _global_type>>             \
+    build_partition_from_matrix_data(                                 \
+        std::shared_ptr<const Executor> exec, mpi::communicator comm, \
+        const device_matrix_data<_value_type, _global_type>& global_data)
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_LOCAL_GLOBAL_INDEX_TYPE(
+    GKO_DECLARE_BUILD_PARTITION_FROM_MATRIX_DATA);
+
+
 }  // namespace distributed
 }  // namespace experimental
 }  // namespace gko
@@ -4,17 +4,26 @@
 
 #include "ginkgo/core/distributed/preconditioner/schwarz.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/matrix_data.hpp>
+#include <ginkgo/core/base/mpi.hpp>
 #include <ginkgo/core/base/precision_dispatch.hpp>
 #include <ginkgo/core/base/temporary_conversion.hpp>
 #include <ginkgo/core/base/utils.hpp>
 #include <ginkgo/core/config/config.hpp>
 #include <ginkgo/core/config/registry.hpp>
 #include <ginkgo/core/distributed/matrix.hpp>
+#include <ginkgo/core/distributed/partition.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 
@@ -47,6 +56,25 @@ Schwarz<ValueType, LocalIndexType, GlobalIndexType>::parse(
             gko::config::parse_or_get_factory<const LinOpFactory>(
                 obj, context, td_for_child));
     }
+    if (auto& obj = config.get("overlap")) {
+        params.with_overlap(gko::config::get_value<size_type>(obj));
+    }
+    if (auto& obj = config.get("restricted")) {
+        params.with_restricted(gko::config::get_value<bool>(obj));
+    }
+    if (auto& obj = config.get("coarse_level")) {
+        params.with_coarse_level(
+            gko::config::parse_or_get_factory<const LinOpFactory>(
+                obj, context, td_for_child));
+    }
+    if (auto& obj = config.get("coarse_solver")) {
+        params.with_coarse_solver(
+            gko::config::parse_or_get_factory<const LinOpFactory>(
+                obj, context, td_for_child));
+    }
+    if (auto& obj = config.get("coarse_weight")) {
+        params.with_coarse_weight(gko::config::get_value<ValueType>(obj));
+    }
 
     return params;
 }
@@ -76,15 +104,112 @@ template <typename VectorType>
 void Schwarz<ValueType, LocalIndexType, GlobalIndexType>::apply_dense_impl(
     const VectorType* dense_b, VectorType* dense_x) const
 {
-    using Vector = matrix::Dense<ValueType>;
     auto exec = this->get_executor();
-    if (this->local_solver_ != nullptr) {
-        this->local_solver_->apply(gko::detail::get_local(dense_b),
-                                   gko::detail::get_local(dense_x));
+    if constexpr (std::is_same_v<VectorType, Vector<ValueType>>) {
+        const auto comm = dense_b->get_communicator();
+        if (this->local_solver_ != nullptr) {
+            if (parameters_.overlap > 0) {
+                this->apply_overlap(comm, gko::detail::get_local(dense_b),
+                                    gko::detail::get_local(dense_x));
+            } else {
+                this->local_solver_->apply(gko::detail::get_local(dense_b),
+                                           gko::detail::get_local(dense_x));
+            }
+        }
+        if (coarse_solver_ != nullptr) {
+            auto restrict_op = coarse_level_->get_restrict_op();
+            const auto num_rhs = dense_b->get_size()[1];
+            const auto num_local_coarse_rows =
+                as<Matrix<ValueType, LocalIndexType, GlobalIndexType>>(
+                    restrict_op)
+                    ->get_local_matrix()
+                    ->get_size()[0];
+            const dim<2> global_size{restrict_op->get_size()[0], num_rhs};
+            const dim<2> local_size{num_local_coarse_rows, num_rhs};
+            coarse_rhs_.init(exec, comm, global_size, local_size);
+            coarse_sol_.init(exec, comm, global_size, local_size);
+            restrict_op->apply(dense_b, coarse_rhs_.get());
+            coarse_sol_->fill(zero<ValueType>());
+            coarse_solver_->apply(coarse_rhs_.get(), coarse_sol_.get());
+            coarse_level_->get_prolong_op()->apply(
+                coarse_weight_, coarse_sol_.get(), one_, dense_x);
+        }
+    } else {
+        if (parameters_.overlap > 0 || coarse_solver_ != nullptr) {
+            GKO_NOT_SUPPORTED(dense_b);
+        }
+        if (this->local_solver_ != nullptr) {
+            this->local_solver_->apply(gko::detail::get_local(dense_b),
+                                       gko::detail::get_local(dense_x));
+        }
+    }
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Schwarz<ValueType, LocalIndexType, GlobalIndexType>::apply_overlap(
+    const mpi::communicator& comm, const matrix::Dense<ValueType>* local_b,
+    matrix::Dense<ValueType>* local_x) const
+{
+    auto exec = this->get_executor();
+    const auto num_rhs = local_b->get_size()[1];
+    const auto num_ext_rows = num_local_rows_ + num_overlap_rows_;
+    const span local_rows{0, num_local_rows_};
+    const span overlap_rows{num_local_rows_, num_ext_rows};
+    const span cols{0, num_rhs};
+    send_buffer_.init(exec, {overlap_send_idxs_.get_size(), num_rhs});
+    recv_buffer_.init(exec, {num_overlap_rows_, num_rhs});
+    ext_b_.init(exec, {num_ext_rows, num_rhs});
+    ext_x_.init(exec, {num_ext_rows, num_rhs});
+
+    // gather the right-hand side of the overlap rows from their owners
+    local_b->row_gather(&overlap_send_idxs_, send_buffer_.get());
+    this->exchange_rows(comm, send_buffer_.get(), overlap_send_sizes_,
+                        overlap_send_offsets_, recv_buffer_.get(),
+                        overlap_recv_sizes_, overlap_recv_offsets_);
+    ext_b_->create_submatrix(local_rows, cols)->copy_from(local_b);
+    ext_b_->create_submatrix(overlap_rows, cols)->copy_from(recv_buffer_.get());
+    ext_x_->create_submatrix(local_rows, cols)->copy_from(local_x);
+    ext_x_->create_submatrix(overlap_rows, cols)->fill(zero<ValueType>());
+
+    this->local_solver_->apply(ext_b_.get(), ext_x_.get());
+
+    auto local_ext_x = ext_x_->create_submatrix(local_rows, cols);
+    local_x->copy_from(local_ext_x);
+    if (!parameters_.restricted) {
+        // add the overlap contributions to the solution on their owners
+        auto overlap_ext_x = ext_x_->create_submatrix(overlap_rows, cols);
+        recv_buffer_->copy_from(overlap_ext_x);
+        this->exchange_rows(comm, recv_buffer_.get(), overlap_recv_sizes_,
+                            overlap_recv_offsets_, send_buffer_.get(),
+                            overlap_send_sizes_, overlap_send_offsets_);
+        overlap_scatter_->apply(one_, send_buffer_.get(), one_, local_x);
     }
 }
 
 
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Schwarz<ValueType, LocalIndexType, GlobalIndexType>::exchange_rows(
+    const mpi::communicator& comm, const matrix::Dense<ValueType>* send_buffer,
+    const std::vector<comm_index_type>& send_sizes,
+    const std::vector<comm_index_type>& send_offsets,
+    matrix::Dense<ValueType>* recv_buffer,
+    const std::vector<comm_index_type>& recv_sizes,
+    const std::vector<comm_index_type>& recv_offsets) const
+{
+    auto exec = this->get_executor();
+    auto comm_exec =
+        mpi::requires_host_buffer(exec, comm) ? exec->get_master() : exec;
+    auto send = make_temporary_clone(comm_exec, send_buffer);
+    auto recv = make_temporary_clone(comm_exec, recv_buffer);
+    mpi::contiguous_type type(send_buffer->get_size()[1],
+                              mpi::type_impl<ValueType>::get_type());
+    comm.all_to_all_v(comm_exec, send->get_const_values(), send_sizes.data(),
+                      send_offsets.data(), type.get(), recv->get_values(),
+                      recv_sizes.data(), recv_offsets.data(), type.get());
+}
+
+
 template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
 void Schwarz<ValueType, LocalIndexType, GlobalIndexType>::apply_impl(
     const LinOp* alpha, const LinOp* b, const LinOp* beta, LinOp* x) const
@@ -130,15 +255,270 @@ void Schwarz<ValueType, LocalIndexType, GlobalIndexType>::generate(
             "Requires either a generated solver or an solver factory");
     }
 
+    if (parameters_.generated_local_solver && parameters_.overlap > 0) {
+        GKO_INVALID_STATE(
+            "A generated solver can not be used on overlapping subdomains");
+    }
+
+    if (static_cast<bool>(parameters_.coarse_level) !=
+        static_cast<bool>(parameters_.coarse_solver)) {
+        GKO_INVALID_STATE(
+            "The coarse grid correction requires both a coarse level and a "
+            "coarse solver factory");
+    }
+
+    auto exec = this->get_executor();
+    one_ = initialize<matrix::Dense<ValueType>>({one<ValueType>()}, exec);
     if (parameters_.local_solver) {
+        auto dist_mat = as<experimental::distributed::Matrix<
+            ValueType, LocalIndexType, GlobalIndexType>>(system_matrix);
         this->set_solver(gko::share(parameters_.local_solver->generate(
-            as<experimental::distributed::Matrix<
-                ValueType, LocalIndexType, GlobalIndexType>>(system_matrix)
-                ->get_local_matrix())));
+            parameters_.overlap > 0 ? this->generate_overlap(dist_mat.get())
+                                    : dist_mat->get_local_matrix())));
 
     } else {
         this->set_solver(parameters_.generated_local_solver);
     }
+
+    if (parameters_.coarse_level) {
+        coarse_level_ = as<multigrid::MultigridLevel>(
+            share(parameters_.coarse_level->generate(system_matrix)));
+        coarse_solver_ = share(parameters_.coarse_solver->generate(
+            coarse_level_->get_coarse_op()));
+        coarse_weight_ = initialize<matrix::Dense<ValueType>>(
+            {parameters_.coarse_weight}, exec);
+    }
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+std::shared_ptr<const LinOp>
+Schwarz<ValueType, LocalIndexType, GlobalIndexType>::generate_overlap(
+    const Matrix<ValueType, LocalIndexType, GlobalIndexType>* system_matrix)
+{
+    using csr_type = matrix::Csr<ValueType, LocalIndexType>;
+    if (!system_matrix->row_partition_ || !system_matrix->col_partition_) {
+        GKO_INVALID_STATE(
+            "The overlap requires the partition of the system matrix");
+    }
+    auto exec = this->get_executor();
+    auto host = exec->get_master();
+    const auto comm = system_matrix->get_communicator();
+    const auto num_ranks = comm.size();
+    const auto rank = comm.rank();
+    auto part = make_temporary_clone(host, system_matrix->row_partition_);
+    auto col_part = make_temporary_clone(host, system_matrix->col_partition_);
+    const auto num_ranges = part->get_num_ranges();
+    const auto bounds = part->get_range_bounds();
+    if (col_part->get_num_ranges() != num_ranges ||
+        !std::equal(bounds, bounds + num_ranges + 1,
+                    col_part->get_range_bounds()) ||
+        !std::equal(part->get_part_ids(), part->get_part_ids() + num_ranges,
+                    col_part->get_part_ids())) {
+        GKO_INVALID_STATE(
+            "The overlap requires the same row and column partition");
+    }
+    auto local = csr_type::create(host);
+    auto non_local = csr_type::create(host);
+    as<ConvertibleTo<csr_type>>(system_matrix->get_local_matrix())
+        ->convert_to(local);
+    as<ConvertibleTo<csr_type>>(system_matrix->get_non_local_matrix())
+        ->convert_to(non_local);
+    const array<GlobalIndexType> non_local_to_global{
+        host, system_matrix->non_local_to_global_};
+
+    // the owned rows with global column indices
+    num_local_rows_ = local->get_size()[0];
+    std::vector<GlobalIndexType> local_to_global(num_local_rows_);
+    for (size_type range = 0; range < num_ranges; range++) {
+        if (part->get_part_ids()[range] == rank) {
+            std::iota(local_to_global.begin() +
+                          part->get_range_starting_indices()[range],
+                      local_to_global.begin() +
+                          part->get_range_starting_indices()[range] +
+                          (bounds[range + 1] - bounds[range]),
+                      bounds[range]);
+        }
+    }
+    std::vector<size_type> owned_row_ptrs(num_local_rows_ + 1);
+    std::vector<GlobalIndexType> owned_cols;
+    std::vector<ValueType> owned_vals;
+    for (size_type row = 0; row < num_local_rows_; row++) {
+        for (auto nz = local->get_const_row_ptrs()[row];
+             nz < local->get_const_row_ptrs()[row + 1]; nz++) {
+            owned_cols.push_back(
+                local_to_global[local->get_const_col_idxs()[nz]]);
+            owned_vals.push_back(local->get_const_values()[nz]);
+        }
+        for (auto nz = non_local->get_const_row_ptrs()[row];
+             nz < non_local->get_const_row_ptrs()[row + 1]; nz++) {
+            owned_cols.push_back(non_local_to_global.get_const_data()
+                                     [non_local->get_const_col_idxs()[nz]]);
+            owned_vals.push_back(non_local->get_const_values()[nz]);
+        }
+        owned_row_ptrs[row + 1] = owned_cols.size();
+    }
+
+    // add the overlap rows layer by layer, each layer consisting of the rows
+    // adjacent to the previous one that are not yet part of the subdomain
+    std::unordered_set<GlobalIndexType> subdomain(local_to_global.begin(),
+                                                  local_to_global.end());
+    std::vector<GlobalIndexType> overlap_idxs;
+    std::vector<size_type> overlap_row_ptrs{0};
+    std::vector<GlobalIndexType> overlap_cols;
+    std::vector<ValueType> overlap_vals;
+    std::vector<GlobalIndexType> frontier(
+        non_local_to_global.get_const_data(),
+        non_local_to_global.get_const_data() + non_local_to_global.get_size());
+    for (size_type layer = 0; layer < parameters_.overlap; layer++) {
+        std::vector<std::pair<comm_index_type, GlobalIndexType>> requests;
+        for (auto global_idx : frontier) {
+            requests.emplace_back(
+                gko::detail::find_owner(part.get(), global_idx).first,
+                global_idx);
+        }
+        std::sort(requests.begin(), requests.end());
+        std::vector<comm_index_type> request_sizes(num_ranks);
+        std::vector<GlobalIndexType> request_idxs;
+        for (const auto& request : requests) {
+            request_sizes[request.first]++;
+            request_idxs.push_back(request.second);
+        }
+        std::vector<comm_index_type> requested_sizes;
+        auto requested_idxs = gko::detail::host_all_to_all_v(
+            comm, host, request_idxs, request_sizes, requested_sizes);
+
+        // send back the requested rows
+        std::vector<GlobalIndexType> reply_row_nnz;
+        std::vector<comm_index_type> reply_sizes(num_ranks);
+        std::vector<GlobalIndexType> reply_cols;
+        std::vector<ValueType> reply_vals;
+        size_type requested = 0;
+        for (comm_index_type target = 0; target < num_ranks; target++) {
+            for (comm_index_type i = 0; i < requested_sizes[target]; i++) {
+                const auto row =
+                    gko::detail::find_owner(part.get(),
+                                            requested_idxs[requested++])
+                        .second;
+                const auto begin = owned_row_ptrs[row];
+                const auto end = owned_row_ptrs[row + 1];
+                reply_row_nnz.push_back(end - begin);
+                reply_sizes[target] += end - begin;
+                reply_cols.insert(reply_cols.end(), owned_cols.begin() + begin,
+                                  owned_cols.begin() + end);
+                reply_vals.insert(reply_vals.end(), owned_vals.begin() + begin,
+                                  owned_vals.begin() + end);
+            }
+        }
+        std::vector<comm_index_type> recv_sizes;
+        auto row_nnz = gko::detail::host_all_to_all_v(
+            comm, host, reply_row_nnz, requested_sizes, recv_sizes);
+        auto cols = gko::detail::host_all_to_all_v(comm, host, reply_cols,
+                                                   reply_sizes, recv_sizes);
+        auto vals = gko::detail::host_all_to_all_v(comm, host, reply_vals,
+                                                   reply_sizes, recv_sizes);
+
+        subdomain.insert(request_idxs.begin(), request_idxs.end());
+        overlap_idxs.insert(overlap_idxs.end(), request_idxs.begin(),
+                            request_idxs.end());
+        overlap_cols.insert(overlap_cols.end(), cols.begin(), cols.end());
+        overlap_vals.insert(overlap_vals.end(), vals.begin(), vals.end());
+        frontier.clear();
+        std::unordered_set<GlobalIndexType> next_layer;
+        for (auto nnz : row_nnz) {
+            const auto begin = overlap_row_ptrs.back();
+            overlap_row_ptrs.push_back(begin + nnz);
+            for (auto nz = begin; nz < overlap_row_ptrs.back(); nz++) {
+                const auto col = overlap_cols[nz];
+                if (subdomain.count(col) == 0 && next_layer.count(col) == 0) {
+                    next_layer.insert(col);
+                    frontier.push_back(col);
+                }
+            }
+        }
+    }
+
+    // order the overlap rows by their owner, so the rows received from each
+    // rank are contiguous
+    num_overlap_rows_ = overlap_idxs.size();
+    std::vector<std::pair<comm_index_type, size_type>> overlap_order;
+    for (size_type i = 0; i < num_overlap_rows_; i++) {
+        overlap_order.emplace_back(
+            gko::detail::find_owner(part.get(), overlap_idxs[i]).first, i);
+    }
+    std::sort(overlap_order.begin(), overlap_order.end());
+    std::unordered_map<GlobalIndexType, LocalIndexType> global_to_ext;
+    for (size_type row = 0; row < num_local_rows_; row++) {
+        global_to_ext[local_to_global[row]] = row;
+    }
+    overlap_recv_sizes_.assign(num_ranks, 0);
+    std::vector<GlobalIndexType> ordered_overlap_idxs;
+    for (size_type i = 0; i < num_overlap_rows_; i++) {
+        const auto overlap_idx = overlap_idxs[overlap_order[i].second];
+        global_to_ext[overlap_idx] = num_local_rows_ + i;
+        overlap_recv_sizes_[overlap_order[i].first]++;
+        ordered_overlap_idxs.push_back(overlap_idx);
+    }
+
+    // assemble the extended local matrix, dropping the couplings to rows
+    // outside the subdomain
+    const auto num_ext_rows = num_local_rows_ + num_overlap_rows_;
+    matrix_data<ValueType, LocalIndexType> ext_data{
+        dim<2>{num_ext_rows, num_ext_rows}};
+    auto add_row = [&](size_type row, size_type begin, size_type end,
+                       const std::vector<GlobalIndexType>& cols,
+                       const std::vector<ValueType>& vals) {
+        for (auto nz = begin; nz < end; nz++) {
+            auto it = global_to_ext.find(cols[nz]);
+            if (it != global_to_ext.end()) {
+                ext_data.nonzeros.emplace_back(
+                    static_cast<LocalIndexType>(row), it->second, vals[nz]);
+            }
+        }
+    };
+    for (size_type row = 0; row < num_local_rows_; row++) {
+        add_row(row, owned_row_ptrs[row], owned_row_ptrs[row + 1], owned_cols,
+                owned_vals);
+    }
+    for (size_type i = 0; i < num_overlap_rows_; i++) {
+        const auto row = overlap_order[i].second;
+        add_row(num_local_rows_ + i, overlap_row_ptrs[row],
+                overlap_row_ptrs[row + 1], overlap_cols, overlap_vals);
+    }
+    ext_data.sort_row_major();
+    auto ext_mtx = csr_type::create(exec);
+    ext_mtx->read(ext_data);
+
+    // let the owners know which of their rows are needed
+    auto send_global_idxs = gko::detail::host_all_to_all_v(
+        comm, host, ordered_overlap_idxs, overlap_recv_sizes_,
+        overlap_send_sizes_);
+    array<LocalIndexType> send_idxs{host, send_global_idxs.size()};
+    for (size_type i = 0; i < send_global_idxs.size(); i++) {
+        send_idxs.get_data()[i] =
+            gko::detail::find_owner(part.get(), send_global_idxs[i]).second;
+    }
+    overlap_send_offsets_.assign(num_ranks + 1, 0);
+    overlap_recv_offsets_.assign(num_ranks + 1, 0);
+    std::partial_sum(overlap_send_sizes_.begin(), overlap_send_sizes_.end(),
+                     overlap_send_offsets_.begin() + 1);
+    std::partial_sum(overlap_recv_sizes_.begin(), overlap_recv_sizes_.end(),
+                     overlap_recv_offsets_.begin() + 1);
+    overlap_send_idxs_ = array<LocalIndexType>{exec, send_idxs};
+    if (!parameters_.restricted) {
+        matrix_data<ValueType, LocalIndexType> scatter_data{
+            dim<2>{num_local_rows_, send_idxs.get_size()}};
+        for (size_type i = 0; i < send_idxs.get_size(); i++) {
+            scatter_data.nonzeros.emplace_back(send_idxs.get_const_data()[i],
+                                               static_cast<LocalIndexType>(i),
+                                               one<ValueType>());
+        }
+        scatter_data.sort_row_major();
+        auto scatter = csr_type::create(exec);
+        scatter->read(scatter_data);
+        overlap_scatter_ = std::move(scatter);
+    }
+    return ext_mtx;
 }
 
 
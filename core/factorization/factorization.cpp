@@ -9,7 +9,13 @@
 #include <ginkgo/core/matrix/csr.hpp>
 
 #include "core/base/array_access.hpp"
+#include "core/components/fill_array_kernels.hpp"
+#include "core/factorization/cholesky_kernels.hpp"
+#include "core/factorization/elimination_forest.hpp"
 #include "core/factorization/factorization_kernels.hpp"
+#include "core/factorization/lu_kernels.hpp"
+#include "core/matrix/csr_kernels.hpp"
+#include "core/matrix/csr_lookup.hpp"
 
 
 namespace gko {
@@ -24,11 +30,34 @@ GKO_REGISTER_OPERATION(initialize_l_u, factorization::initialize_l_u);
 GKO_REGISTER_OPERATION(initialize_row_ptrs_l,
                        factorization::initialize_row_ptrs_l);
 GKO_REGISTER_OPERATION(initialize_l, factorization::initialize_l);
+GKO_REGISTER_OPERATION(fill_array, components::fill_array);
+GKO_REGISTER_OPERATION(build_lookup_offsets, csr::build_lookup_offsets);
+GKO_REGISTER_OPERATION(build_lookup, csr::build_lookup);
+GKO_REGISTER_OPERATION(forest_from_factor, cholesky::forest_from_factor);
+GKO_REGISTER_OPERATION(lu_initialize, lu_factorization::initialize);
+GKO_REGISTER_OPERATION(lu_factorize, lu_factorization::factorize);
+GKO_REGISTER_OPERATION(cholesky_initialize, cholesky::initialize);
+GKO_REGISTER_OPERATION(cholesky_factorize, cholesky::factorize);
 
 
 }  // namespace
 
 
+template <typename ValueType, typename IndexType>
+struct Factorization<ValueType, IndexType>::symbolic_data {
+    symbolic_data(std::shared_ptr<const Executor> exec, size_type num_rows)
+        : storage_offsets{exec, num_rows + 1},
+          row_descs{exec, num_rows},
+          storage{exec}
+    {}
+
+    array<IndexType> storage_offsets;
+    array<int64> row_descs;
+    array<int32> storage;
+    std::unique_ptr<gko::factorization::elimination_forest<IndexType>> forest;
+};
+
+
 template <typename ValueType, typename IndexType>
 std::unique_ptr<Factorization<ValueType, IndexType>>
 Factorization<ValueType, IndexType>::unpack() const
@@ -205,6 +234,7 @@ Factorization<ValueType, IndexType>::operator=(const Factorization& fact)
         EnableLinOp<Factorization<ValueType, IndexType>>::operator=(fact);
         storage_type_ = fact.storage_type_;
         *factors_ = *fact.factors_;
+        symbolic_ = fact.symbolic_;
     }
     return *this;
 }
@@ -220,6 +250,7 @@ Factorization<ValueType, IndexType>::operator=(Factorization&& fact)
         storage_type_ = std::exchange(fact.storage_type_, storage_type::empty);
         factors_ =
             std::exchange(fact.factors_, fact.factors_->create_default());
+        symbolic_ = std::exchange(fact.symbolic_, nullptr);
         if (factors_->get_executor() != this->get_executor()) {
             factors_ = factors_->clone(this->get_executor());
         }
@@ -317,6 +348,97 @@ Factorization<ValueType, IndexType>::create_from_combined_ldl(
 }
 
 
+template <typename ValueType, typename IndexType>
+void Factorization<ValueType, IndexType>::update_values(
+    std::shared_ptr<const LinOp> system_matrix)
+{
+    if (storage_type_ != storage_type::combined_lu &&
+        storage_type_ != storage_type::symm_combined_cholesky) {
+        GKO_NOT_SUPPORTED(storage_type_);
+    }
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, system_matrix);
+    const auto exec = this->get_executor();
+    const auto mtx = copy_and_convert_to<matrix_type>(exec, system_matrix);
+    // the combined matrix may be shared with copies of this factorization, so
+    // the new values are computed in a copy of it
+    auto factors = gko::clone(exec, this->get_combined());
+    this->factorize_combined(mtx.get(), factors.get(), nullptr);
+    factors_ = composition_type::create(gko::share(std::move(factors)));
+}
+
+
+template <typename ValueType, typename IndexType>
+void Factorization<ValueType, IndexType>::factorize_combined(
+    const matrix_type* mtx, matrix_type* factors,
+    std::unique_ptr<gko::factorization::elimination_forest<IndexType>> forest)
+{
+    const auto exec = this->get_executor();
+    const auto num_rows = factors->get_size()[0];
+    const auto is_symmetric =
+        storage_type_ == storage_type::symm_combined_cholesky;
+    // the symbolic data only depends on the sparsity pattern of the factors
+    if (!symbolic_ || symbolic_->storage_offsets.get_executor() != exec) {
+        auto symbolic = std::make_shared<symbolic_data>(exec, num_rows);
+        const auto allowed_sparsity = gko::matrix::csr::sparsity_type::bitmap |
+                                      gko::matrix::csr::sparsity_type::full |
+                                      gko::matrix::csr::sparsity_type::hash;
+        exec->run(make_build_lookup_offsets(
+            factors->get_const_row_ptrs(), factors->get_const_col_idxs(),
+            num_rows, allowed_sparsity, symbolic->storage_offsets.get_data()));
+        const auto storage_size = static_cast<size_type>(
+            get_element(symbolic->storage_offsets, num_rows));
+        symbolic->storage.resize_and_reset(storage_size);
+        exec->run(make_build_lookup(
+            factors->get_const_row_ptrs(), factors->get_const_col_idxs(),
+            num_rows, allowed_sparsity,
+            symbolic->storage_offsets.get_const_data(),
+            symbolic->row_descs.get_data(), symbolic->storage.get_data()));
+        if (is_symmetric) {
+            if (!forest) {
+                forest = std::make_unique<
+                    gko::factorization::elimination_forest<IndexType>>(
+                    exec, static_cast<IndexType>(num_rows));
+                exec->run(make_forest_from_factor(factors, *forest));
+            }
+            symbolic->forest = std::move(forest);
+        }
+        symbolic_ = std::move(symbolic);
+    }
+    // initialize factors
+    array<IndexType> diag_idxs{exec, num_rows};
+    exec->run(make_fill_array(factors->get_values(),
+                              factors->get_num_stored_elements(),
+                              zero<ValueType>()));
+    // run numerical factorization
+    array<int> tmp{exec};
+    if (is_symmetric) {
+        array<IndexType> transpose_idxs{exec,
+                                        factors->get_num_stored_elements()};
+        exec->run(make_cholesky_initialize(
+            mtx, symbolic_->storage_offsets.get_const_data(),
+            symbolic_->row_descs.get_const_data(),
+            symbolic_->storage.get_const_data(), diag_idxs.get_data(),
+            transpose_idxs.get_data(), factors));
+        exec->run(make_cholesky_factorize(
+            symbolic_->storage_offsets.get_const_data(),
+            symbolic_->row_descs.get_const_data(),
+            symbolic_->storage.get_const_data(), diag_idxs.get_const_data(),
+            transpose_idxs.get_const_data(), *symbolic_->forest, factors,
+            tmp));
+    } else {
+        exec->run(make_lu_initialize(
+            mtx, symbolic_->storage_offsets.get_const_data(),
+            symbolic_->row_descs.get_const_data(),
+            symbolic_->storage.get_const_data(), diag_idxs.get_data(),
+            factors));
+        exec->run(make_lu_factorize(symbolic_->storage_offsets.get_const_data(),
+                                    symbolic_->row_descs.get_const_data(),
+                                    symbolic_->storage.get_const_data(),
+                                    diag_idxs.get_const_data(), factors, tmp));
+    }
+}
+
+
 template <typename ValueType, typename IndexType>
 void Factorization<ValueType, IndexType>::apply_impl(const LinOp* b,
                                                      LinOp* x) const
@@ -58,7 +58,9 @@ Ilu<ValueType, IndexType>::parse(const config::pnode& config,
 
 template <typename ValueType, typename IndexType>
 std::unique_ptr<Composition<ValueType>> Ilu<ValueType, IndexType>::generate_l_u(
-    const std::shared_ptr<const LinOp>& system_matrix, bool skip_sorting) const
+    const std::shared_ptr<const LinOp>& system_matrix, bool skip_sorting,
+    std::shared_ptr<const matrix_type> l_pattern,
+    std::shared_ptr<const matrix_type> u_pattern) const
 {
     GKO_ASSERT_IS_SQUARE_MATRIX(system_matrix);
 
@@ -81,30 +83,39 @@ std::unique_ptr<Composition<ValueType>> Ilu<ValueType, IndexType>::generate_l_u(
     // Compute LU factorization
     exec->run(ilu_factorization::make_compute_ilu(local_system_matrix.get()));
 
-    // Separate L and U factors: nnz
     const auto matrix_size = local_system_matrix->get_size();
-    const auto num_rows = matrix_size[0];
-    array<IndexType> l_row_ptrs{exec, num_rows + 1};
-    array<IndexType> u_row_ptrs{exec, num_rows + 1};
-    exec->run(ilu_factorization::make_initialize_row_ptrs_l_u(
-        local_system_matrix.get(), l_row_ptrs.get_data(),
-        u_row_ptrs.get_data()));
-
-    // Get nnz from device memory
-    auto l_nnz = static_cast<size_type>(get_element(l_row_ptrs, num_rows));
-    auto u_nnz = static_cast<size_type>(get_element(u_row_ptrs, num_rows));
-
-    // Init arrays
-    array<IndexType> l_col_idxs{exec, l_nnz};
-    array<ValueType> l_vals{exec, l_nnz};
-    std::shared_ptr<matrix_type> l_factor = matrix_type::create(
-        exec, matrix_size, std::move(l_vals), std::move(l_col_idxs),
-        std::move(l_row_ptrs), parameters_.l_strategy);
-    array<IndexType> u_col_idxs{exec, u_nnz};
-    array<ValueType> u_vals{exec, u_nnz};
-    std::shared_ptr<matrix_type> u_factor = matrix_type::create(
-        exec, matrix_size, std::move(u_vals), std::move(u_col_idxs),
-        std::move(u_row_ptrs), parameters_.u_strategy);
+    std::shared_ptr<matrix_type> l_factor;
+    std::shared_ptr<matrix_type> u_factor;
+    if (l_pattern && u_pattern) {
+        // The patterns only depend on the pattern of the system matrix, so
+        // the values and column indices are overwritten below
+        l_factor = gko::clone(exec, l_pattern);
+        u_factor = gko::clone(exec, u_pattern);
+    } else {
+        // Separate L and U factors: nnz
+        const auto num_rows = matrix_size[0];
+        array<IndexType> l_row_ptrs{exec, num_rows + 1};
+        array<IndexType> u_row_ptrs{exec, num_rows + 1};
+        exec->run(ilu_factorization::make_initialize_row_ptrs_l_u(
+            local_system_matrix.get(), l_row_ptrs.get_data(),
+            u_row_ptrs.get_data()));
+
+        // Get nnz from device memory
+        auto l_nnz = static_cast<size_type>(get_element(l_row_ptrs, num_rows));
+        auto u_nnz = static_cast<size_type>(get_element(u_row_ptrs, num_rows));
+
+        // Init arrays
+        array<IndexType> l_col_idxs{exec, l_nnz};
+        array<ValueType> l_vals{exec, l_nnz};
+        l_factor = matrix_type::create(
+            exec, matrix_size, std::move(l_vals), std::move(l_col_idxs),
+            std::move(l_row_ptrs), parameters_.l_strategy);
+        array<IndexType> u_col_idxs{exec, u_nnz};
+        array<ValueType> u_vals{exec, u_nnz};
+        u_factor = matrix_type::create(
+            exec, matrix_size, std::move(u_vals), std::move(u_col_idxs),
+            std::move(u_row_ptrs), parameters_.u_strategy);
+    }
 
     // Separate L and U: columns and values
     exec->run(ilu_factorization::make_initialize_l_u(
@@ -115,6 +126,17 @@ std::unique_ptr<Composition<ValueType>> Ilu<ValueType, IndexType>::generate_l_u(
 }
 
 
+template <typename ValueType, typename IndexType>
+void Ilu<ValueType, IndexType>::update_values(
+    std::shared_ptr<const LinOp> system_matrix)
+{
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, system_matrix);
+    generate_l_u(system_matrix, parameters_.skip_sorting, this->get_l_factor(),
+                 this->get_u_factor())
+        ->move_to(this);
+}
+
+
 #define GKO_DECLARE_ILU(ValueType, IndexType) class Ilu<ValueType, IndexType>
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_ILU);
 
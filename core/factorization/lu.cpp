@@ -10,14 +10,9 @@
 #include <ginkgo/core/config/config.hpp>
 #include <ginkgo/core/config/registry.hpp>
 
-#include "core/base/array_access.hpp"
-#include "core/components/fill_array_kernels.hpp"
 #include "core/config/config_helper.hpp"
 #include "core/factorization/elimination_forest.hpp"
-#include "core/factorization/lu_kernels.hpp"
 #include "core/factorization/symbolic.hpp"
-#include "core/matrix/csr_kernels.hpp"
-#include "core/matrix/csr_lookup.hpp"
 
 
 namespace gko {
@@ -26,11 +21,6 @@ namespace factorization {
 namespace {
 
 
-GKO_REGISTER_OPERATION(fill_array, components::fill_array);
-GKO_REGISTER_OPERATION(build_lookup_offsets, csr::build_lookup_offsets);
-GKO_REGISTER_OPERATION(build_lookup, csr::build_lookup);
-GKO_REGISTER_OPERATION(initialize, lu_factorization::initialize);
-GKO_REGISTER_OPERATION(factorize, lu_factorization::factorize);
 GKO_REGISTER_HOST_OPERATION(symbolic_cholesky,
                             gko::factorization::symbolic_cholesky);
 GKO_REGISTER_HOST_OPERATION(symbolic_lu, gko::factorization::symbolic_lu);
@@ -134,37 +124,13 @@ std::unique_ptr<LinOp> Lu<ValueType, IndexType>::generate_impl(
         // update srow to be safe
         factors->set_strategy(factors->get_strategy());
     }
-    // setup lookup structure on factors
-    array<IndexType> storage_offsets{exec, num_rows + 1};
-    array<int64> row_descs{exec, num_rows};
-    array<IndexType> diag_idxs{exec, num_rows};
-    const auto allowed_sparsity = gko::matrix::csr::sparsity_type::bitmap |
-                                  gko::matrix::csr::sparsity_type::full |
-                                  gko::matrix::csr::sparsity_type::hash;
-    exec->run(make_build_lookup_offsets(
-        factors->get_const_row_ptrs(), factors->get_const_col_idxs(), num_rows,
-        allowed_sparsity, storage_offsets.get_data()));
-    const auto storage_size =
-        static_cast<size_type>(get_element(storage_offsets, num_rows));
-    array<int32> storage{exec, storage_size};
-    exec->run(make_build_lookup(
-        factors->get_const_row_ptrs(), factors->get_const_col_idxs(), num_rows,
-        allowed_sparsity, storage_offsets.get_const_data(),
-        row_descs.get_data(), storage.get_data()));
-    // initialize factors
-    exec->run(make_fill_array(factors->get_values(),
-                              factors->get_num_stored_elements(),
-                              zero<ValueType>()));
-    exec->run(make_initialize(
-        mtx.get(), storage_offsets.get_const_data(), row_descs.get_const_data(),
-        storage.get_const_data(), diag_idxs.get_data(), factors.get()));
-    // run numerical factorization
-    array<int> tmp{exec};
-    exec->run(make_factorize(storage_offsets.get_const_data(),
-                             row_descs.get_const_data(),
-                             storage.get_const_data(),
-                             diag_idxs.get_const_data(), factors.get(), tmp));
-    return factorization_type::create_from_combined_lu(std::move(factors));
+    // run numerical factorization, which keeps the lookup structures in the
+    // factorization for later value updates
+    const auto factors_ptr = factors.get();
+    auto result =
+        factorization_type::create_from_combined_lu(std::move(factors));
+    result->factorize_combined(mtx.get(), factors_ptr, nullptr);
+    return result;
 }
 
 
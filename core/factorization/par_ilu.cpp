@@ -71,7 +71,9 @@ std::unique_ptr<Composition<ValueType>>
 ParIlu<ValueType, IndexType>::generate_l_u(
     const std::shared_ptr<const LinOp>& system_matrix, bool skip_sorting,
     std::shared_ptr<typename l_matrix_type::strategy_type> l_strategy,
-    std::shared_ptr<typename u_matrix_type::strategy_type> u_strategy) const
+    std::shared_ptr<typename u_matrix_type::strategy_type> u_strategy,
+    std::shared_ptr<const matrix_type> l_pattern,
+    std::shared_ptr<const matrix_type> u_pattern) const
 {
     using CsrMatrix = matrix::Csr<ValueType, IndexType>;
     using CooMatrix = matrix::Coo<ValueType, IndexType>;
@@ -95,28 +97,40 @@ ParIlu<ValueType, IndexType>::generate_l_u(
         csr_system_matrix.get(), true));
 
     const auto matrix_size = csr_system_matrix->get_size();
-    const auto number_rows = matrix_size[0];
-    array<IndexType> l_row_ptrs{exec, number_rows + 1};
-    array<IndexType> u_row_ptrs{exec, number_rows + 1};
-    exec->run(par_ilu_factorization::make_initialize_row_ptrs_l_u(
-        csr_system_matrix.get(), l_row_ptrs.get_data(), u_row_ptrs.get_data()));
-
-    // Get nnz from device memory
-    auto l_nnz = static_cast<size_type>(get_element(l_row_ptrs, number_rows));
-    auto u_nnz = static_cast<size_type>(get_element(u_row_ptrs, number_rows));
-
-    // Since `row_ptrs` of L and U is already created, the matrix can be
-    // directly created with it
-    array<IndexType> l_col_idxs{exec, l_nnz};
-    array<ValueType> l_vals{exec, l_nnz};
-    std::shared_ptr<CsrMatrix> l_factor = l_matrix_type::create(
-        exec, matrix_size, std::move(l_vals), std::move(l_col_idxs),
-        std::move(l_row_ptrs), l_strategy);
-    array<IndexType> u_col_idxs{exec, u_nnz};
-    array<ValueType> u_vals{exec, u_nnz};
-    std::shared_ptr<CsrMatrix> u_factor = u_matrix_type::create(
-        exec, matrix_size, std::move(u_vals), std::move(u_col_idxs),
-        std::move(u_row_ptrs), u_strategy);
+    std::shared_ptr<CsrMatrix> l_factor;
+    std::shared_ptr<CsrMatrix> u_factor;
+    if (l_pattern && u_pattern) {
+        // The patterns only depend on the pattern of the system matrix, so
+        // the values and column indices are overwritten below
+        l_factor = gko::clone(exec, l_pattern);
+        u_factor = gko::clone(exec, u_pattern);
+    } else {
+        const auto number_rows = matrix_size[0];
+        array<IndexType> l_row_ptrs{exec, number_rows + 1};
+        array<IndexType> u_row_ptrs{exec, number_rows + 1};
+        exec->run(par_ilu_factorization::make_initialize_row_ptrs_l_u(
+            csr_system_matrix.get(), l_row_ptrs.get_data(),
+            u_row_ptrs.get_data()));
+
+        // Get nnz from device memory
+        auto l_nnz =
+            static_cast<size_type>(get_element(l_row_ptrs, number_rows));
+        auto u_nnz =
+            static_cast<size_type>(get_element(u_row_ptrs, number_rows));
+
+        // Since `row_ptrs` of L and U is already created, the matrix can be
+        // directly created with it
+        array<IndexType> l_col_idxs{exec, l_nnz};
+        array<ValueType> l_vals{exec, l_nnz};
+        l_factor = l_matrix_type::create(exec, matrix_size, std::move(l_vals),
+                                         std::move(l_col_idxs),
+                                         std::move(l_row_ptrs), l_strategy);
+        array<IndexType> u_col_idxs{exec, u_nnz};
+        array<ValueType> u_vals{exec, u_nnz};
+        u_factor = u_matrix_type::create(exec, matrix_size, std::move(u_vals),
+                                         std::move(u_col_idxs),
+                                         std::move(u_row_ptrs), u_strategy);
+    }
 
     exec->run(par_ilu_factorization::make_initialize_l_u(
         csr_system_matrix.get(), l_factor.get(), u_factor.get()));
@@ -159,6 +173,18 @@ ParIlu<ValueType, IndexType>::generate_l_u(
 }
 
 
+template <typename ValueType, typename IndexType>
+void ParIlu<ValueType, IndexType>::update_values(
+    std::shared_ptr<const LinOp> system_matrix)
+{
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, system_matrix);
+    generate_l_u(system_matrix, parameters_.skip_sorting,
+                 parameters_.l_strategy, parameters_.u_strategy,
+                 this->get_l_factor(), this->get_u_factor())
+        ->move_to(this);
+}
+
+
 #define GKO_DECLARE_PAR_ILU(ValueType, IndexType) \
     class ParIlu<ValueType, IndexType>
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PAR_ILU);
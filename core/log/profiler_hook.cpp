@@ -305,7 +305,8 @@ void ProfilerHook::set_synchronization(bool synchronize)
 
 void ProfilerHook::maybe_synchronize(const Executor* exec) const
 {
-    if (synchronize_) {
+    // allocator events are not bound to an executor
+    if (synchronize_ && exec) {
         profiling_scope_guard sync_guard{"synchronize",
                                          profile_event_category::internal,
                                          begin_hook_, end_hook_};
@@ -88,6 +88,19 @@ void FixedCoarsening<ValueType, IndexType>::generate()
 }
 
 
+template <typename ValueType, typename IndexType>
+void FixedCoarsening<ValueType, IndexType>::update_values(
+    std::shared_ptr<const LinOp> system_matrix)
+{
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, system_matrix);
+    system_matrix_ = system_matrix;
+    this->set_fine_op(system_matrix_);
+    if (system_matrix_->get_size()[0] != 0) {
+        this->generate();
+    }
+}
+
+
 #define GKO_DECLARE_FIXED_COARSENING(_vtype, _itype) \
     class FixedCoarsening<_vtype, _itype>
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_FIXED_COARSENING);
@@ -14,21 +14,24 @@
 #include <ginkgo/core/distributed/base.hpp>
 #include <ginkgo/core/distributed/matrix.hpp>
 #include <ginkgo/core/distributed/vector.hpp>
-#include <ginkgo/core/matrix/coo.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
 #include <ginkgo/core/matrix/identity.hpp>
 #include <ginkgo/core/matrix/row_gatherer.hpp>
 #include <ginkgo/core/matrix/sparsity_csr.hpp>
 
+#include "core/base/array_access.hpp"
 #include "core/base/dispatch_helper.hpp"
 #include "core/base/iterator_factory.hpp"
 #include "core/base/utils.hpp"
 #include "core/components/fill_array_kernels.hpp"
 #include "core/components/format_conversion_kernels.hpp"
+#include "core/components/prefix_sum_kernels.hpp"
 #include "core/config/config_helper.hpp"
 #include "core/matrix/csr_builder.hpp"
 #include "core/multigrid/pgm_kernels.hpp"
+#include "core/multigrid/spectral_radius.hpp"
 
 
 namespace gko {
@@ -43,15 +46,18 @@ GKO_REGISTER_OPERATION(renumber, pgm::renumber);
 GKO_REGISTER_OPERATION(find_strongest_neighbor, pgm::find_strongest_neighbor);
 GKO_REGISTER_OPERATION(assign_to_exist_agg, pgm::assign_to_exist_agg);
 GKO_REGISTER_OPERATION(sort_agg, pgm::sort_agg);
-GKO_REGISTER_OPERATION(map_row, pgm::map_row);
-GKO_REGISTER_OPERATION(map_col, pgm::map_col);
-GKO_REGISTER_OPERATION(sort_row_major, pgm::sort_row_major);
-GKO_REGISTER_OPERATION(count_unrepeated_nnz, pgm::count_unrepeated_nnz);
-GKO_REGISTER_OPERATION(compute_coarse_coo, pgm::compute_coarse_coo);
 GKO_REGISTER_OPERATION(fill_array, components::fill_array);
 GKO_REGISTER_OPERATION(fill_seq_array, components::fill_seq_array);
 GKO_REGISTER_OPERATION(convert_idxs_to_ptrs, components::convert_idxs_to_ptrs);
 GKO_REGISTER_OPERATION(gather_index, pgm::gather_index);
+GKO_REGISTER_OPERATION(galerkin_count, pgm::galerkin_count);
+GKO_REGISTER_OPERATION(galerkin_fill, pgm::galerkin_fill);
+GKO_REGISTER_OPERATION(galerkin_numeric, pgm::galerkin_numeric);
+GKO_REGISTER_OPERATION(filter_prolongation_count,
+                       pgm::filter_prolongation_count);
+GKO_REGISTER_OPERATION(filter_prolongation_fill, pgm::filter_prolongation_fill);
+GKO_REGISTER_OPERATION(prefix_sum_nonnegative,
+                       components::prefix_sum_nonnegative);
 
 
 }  // anonymous namespace
@@ -76,63 +82,141 @@ void agg_to_restrict(std::shared_ptr<const Executor> exec, IndexType num_agg,
 }
 
 
+/**
+ * Computes the values of the Galerkin product R * A * P of an aggregation-based
+ * restriction R and prolongation P = R^T into the coarse matrix, whose
+ * sparsity pattern was computed by generate_coarse with the mapping nz_map from
+ * the entries of A to the coarse entries.
+ */
 template <typename ValueType, typename IndexType>
-std::shared_ptr<matrix::Csr<ValueType, IndexType>> generate_coarse(
+void compute_coarse_values(
     std::shared_ptr<const Executor> exec,
-    const matrix::Csr<ValueType, IndexType>* fine_csr, IndexType num_agg,
-    const gko::array<IndexType>& agg, IndexType non_local_num_agg,
-    const gko::array<IndexType>& non_local_agg)
+    const matrix::SparsityCsr<ValueType, IndexType>* restrict_op,
+    const matrix::Csr<ValueType, IndexType>* fine_csr,
+    const array<IndexType>& nz_map, matrix::Csr<ValueType, IndexType>* coarse)
 {
-    const auto num = fine_csr->get_size()[0];
-    const auto nnz = fine_csr->get_num_stored_elements();
-    gko::array<IndexType> row_idxs(exec, nnz);
-    gko::array<IndexType> col_idxs(exec, nnz);
-    gko::array<ValueType> vals(exec, nnz);
-    exec->copy_from(exec, nnz, fine_csr->get_const_values(), vals.get_data());
-
-    if (nnz == 0) {
-        return matrix::Csr<ValueType, IndexType>::create(
-            exec, dim<2>(num_agg, non_local_num_agg));
-    }
-
-    // map row_ptrs to coarse row index
-    exec->run(pgm::make_map_row(num, fine_csr->get_const_row_ptrs(),
-                                agg.get_const_data(), row_idxs.get_data()));
-    // map col_idxs to coarse col index
-    exec->run(pgm::make_map_col(nnz, fine_csr->get_const_col_idxs(),
-                                non_local_agg.get_const_data(),
-                                col_idxs.get_data()));
-    // sort by row, col
-    exec->run(pgm::make_sort_row_major(nnz, row_idxs.get_data(),
-                                       col_idxs.get_data(), vals.get_data()));
-    // compute the total nnz and create the fine csr
-    size_type coarse_nnz = 0;
-    exec->run(pgm::make_count_unrepeated_nnz(nnz, row_idxs.get_const_data(),
-                                             col_idxs.get_const_data(),
-                                             &coarse_nnz));
-    // reduce by key (row, col)
-    auto coarse_coo = matrix::Coo<ValueType, IndexType>::create(
-        exec,
-        gko::dim<2>{static_cast<size_type>(num_agg),
-                    static_cast<size_type>(non_local_num_agg)},
-        coarse_nnz);
-    exec->run(pgm::make_compute_coarse_coo(
-        nnz, row_idxs.get_const_data(), col_idxs.get_const_data(),
-        vals.get_const_data(), coarse_coo.get()));
-    // use move_to
-    auto coarse_csr = matrix::Csr<ValueType, IndexType>::create(exec);
-    coarse_csr->move_from(coarse_coo);
-    return std::move(coarse_csr);
+    exec->run(pgm::make_galerkin_numeric(
+        restrict_op->get_size()[0], restrict_op->get_const_row_ptrs(),
+        restrict_op->get_const_col_idxs(), fine_csr->get_const_row_ptrs(),
+        fine_csr->get_const_values(), nz_map.get_const_data(),
+        coarse->get_const_row_ptrs(), coarse->get_values()));
 }
 
 
+/**
+ * Computes the Galerkin product R * A * P of an aggregation-based restriction
+ * R and prolongation P = R^T without forming A * P. The rows of R are the
+ * fine rows of each aggregate, col_agg maps the columns of A to the coarse
+ * columns. The symbolic phase stores the position of the coarse entry each
+ * entry of A contributes to in nz_map, so the values can be recomputed by
+ * compute_coarse_values for a matrix with the same sparsity pattern.
+ */
 template <typename ValueType, typename IndexType>
 std::shared_ptr<matrix::Csr<ValueType, IndexType>> generate_coarse(
     std::shared_ptr<const Executor> exec,
-    const matrix::Csr<ValueType, IndexType>* fine_csr, IndexType num_agg,
-    const gko::array<IndexType>& agg)
+    const matrix::SparsityCsr<ValueType, IndexType>* restrict_op,
+    const matrix::Csr<ValueType, IndexType>* fine_csr,
+    IndexType num_coarse_cols, const array<IndexType>& col_agg,
+    array<IndexType>& nz_map)
 {
-    return generate_coarse(exec, fine_csr, num_agg, agg, num_agg, agg);
+    const auto num_agg = restrict_op->get_size()[0];
+    array<IndexType> row_ptrs(exec, num_agg + 1);
+    nz_map.set_executor(exec);
+    nz_map.resize_and_reset(fine_csr->get_num_stored_elements());
+    exec->run(pgm::make_galerkin_count(
+        num_agg, restrict_op->get_const_row_ptrs(),
+        restrict_op->get_const_col_idxs(), fine_csr->get_const_row_ptrs(),
+        fine_csr->get_const_col_idxs(), col_agg.get_const_data(),
+        num_coarse_cols, row_ptrs.get_data()));
+    exec->run(pgm::make_prefix_sum_nonnegative(row_ptrs.get_data(),
+                                               num_agg + 1));
+    const auto coarse_nnz =
+        static_cast<size_type>(get_element(row_ptrs, num_agg));
+    array<IndexType> col_idxs(exec, coarse_nnz);
+    exec->run(pgm::make_galerkin_fill(
+        num_agg, restrict_op->get_const_row_ptrs(),
+        restrict_op->get_const_col_idxs(), fine_csr->get_const_row_ptrs(),
+        fine_csr->get_const_col_idxs(), col_agg.get_const_data(),
+        num_coarse_cols, row_ptrs.get_const_data(), col_idxs.get_data(),
+        nz_map.get_data()));
+    auto coarse_csr = share(matrix::Csr<ValueType, IndexType>::create(
+        exec, dim<2>{num_agg, static_cast<size_type>(num_coarse_cols)},
+        array<ValueType>(exec, coarse_nnz), std::move(col_idxs),
+        std::move(row_ptrs)));
+    compute_coarse_values(exec, restrict_op, fine_csr, nz_map,
+                          coarse_csr.get());
+    return coarse_csr;
+}
+
+
+/**
+ * Computes the transfer operators and the coarse matrix of smoothed
+ * aggregation. The tentative prolongation T of the aggregates is smoothed by
+ * damped Jacobi to P = T - omega D^-1 A T with omega = relaxation / rho(D^-1
+ * A), and optionally filtered. The restriction is P^H and the coarse matrix is
+ * P^H A P.
+ *
+ * @return a tuple with prolongation, coarse, and restriction linop
+ */
+template <typename ValueType, typename IndexType>
+std::tuple<std::shared_ptr<LinOp>, std::shared_ptr<LinOp>,
+           std::shared_ptr<LinOp>>
+generate_smoothed_level(std::shared_ptr<const Executor> exec,
+                        const matrix::Csr<ValueType, IndexType>* fine_csr,
+                        const array<IndexType>& agg, IndexType num_agg,
+                        double relaxation, size_type num_estimation_iterations,
+                        double filter_threshold)
+{
+    using csr_type = matrix::Csr<ValueType, IndexType>;
+    using real_type = remove_complex<ValueType>;
+    const auto num_rows = fine_csr->get_size()[0];
+    const dim<2> prolong_size{num_rows, static_cast<size_type>(num_agg)};
+    // the tentative prolongation contains a single one per row
+    array<IndexType> row_ptrs(exec, num_rows + 1);
+    exec->run(pgm::make_fill_seq_array(row_ptrs.get_data(), num_rows + 1));
+    array<ValueType> values(exec, num_rows);
+    exec->run(pgm::make_fill_array(values.get_data(), num_rows,
+                                   one<ValueType>()));
+    auto tentative =
+        csr_type::create(exec, prolong_size, std::move(values),
+                         array<IndexType>(exec, agg), std::move(row_ptrs));
+    // D^-1 A
+    auto scaled_mtx = fine_csr->clone();
+    fine_csr->extract_diagonal()->inverse_apply(fine_csr, scaled_mtx);
+    const auto radius = detail::estimate_spectral_radius<ValueType>(
+        scaled_mtx.get(), num_estimation_iterations);
+    std::shared_ptr<csr_type> prolong = tentative->clone();
+    if (radius > zero<real_type>()) {
+        // P = T - omega D^-1 A T
+        auto neg_omega = initialize<matrix::Dense<ValueType>>(
+            {static_cast<ValueType>(-relaxation / radius)}, exec);
+        auto scalar_one = initialize<matrix::Dense<ValueType>>({1.0}, exec);
+        scaled_mtx->apply(neg_omega, tentative, scalar_one, prolong);
+    }
+    if (filter_threshold > 0.0) {
+        const auto threshold = static_cast<real_type>(filter_threshold);
+        array<IndexType> filtered_row_ptrs(exec, num_rows + 1);
+        exec->run(pgm::make_filter_prolongation_count(
+            prolong.get(), threshold, filtered_row_ptrs.get_data()));
+        exec->run(pgm::make_prefix_sum_nonnegative(filtered_row_ptrs.get_data(),
+                                                   num_rows + 1));
+        const auto filtered_nnz =
+            static_cast<size_type>(get_element(filtered_row_ptrs, num_rows));
+        auto filtered = share(csr_type::create(
+            exec, prolong_size, array<ValueType>(exec, filtered_nnz),
+            array<IndexType>(exec, filtered_nnz),
+            std::move(filtered_row_ptrs)));
+        exec->run(pgm::make_filter_prolongation_fill(prolong.get(), threshold,
+                                                     filtered.get()));
+        prolong = filtered;
+    }
+    auto restrict_op = share(as<csr_type>(prolong->conj_transpose()));
+    auto fine_prolong = csr_type::create(exec, prolong_size);
+    fine_csr->apply(prolong, fine_prolong);
+    auto coarse = share(csr_type::create(
+        exec, dim<2>{prolong_size[1], prolong_size[1]}));
+    restrict_op->apply(fine_prolong, coarse);
+    return std::make_tuple(prolong, coarse, restrict_op);
 }
 
 
@@ -158,6 +242,20 @@ Pgm<ValueType, IndexType>::parse(const config::pnode& config,
     if (auto& obj = config.get("skip_sorting")) {
         params.with_skip_sorting(gko::config::get_value<bool>(obj));
     }
+    if (auto& obj = config.get("smoothed_aggregation")) {
+        params.with_smoothed_aggregation(gko::config::get_value<bool>(obj));
+    }
+    if (auto& obj = config.get("smoothing_relaxation")) {
+        params.with_smoothing_relaxation(gko::config::get_value<double>(obj));
+    }
+    if (auto& obj = config.get("num_estimation_iterations")) {
+        params.with_num_estimation_iterations(
+            gko::config::get_value<unsigned>(obj));
+    }
+    if (auto& obj = config.get("prolongation_filter_threshold")) {
+        params.with_prolongation_filter_threshold(
+            gko::config::get_value<double>(obj));
+    }
 
     return params;
 }
@@ -224,6 +322,13 @@ Pgm<ValueType, IndexType>::generate_local(
     IndexType num_agg = 0;
     // Renumber the index
     exec->run(pgm::make_renumber(agg_, &num_agg));
+    if (parameters_.smoothed_aggregation) {
+        return generate_smoothed_level(
+            exec, local_matrix.get(), agg_, num_agg,
+            parameters_.smoothing_relaxation,
+            parameters_.num_estimation_iterations,
+            parameters_.prolongation_filter_threshold);
+    }
     gko::dim<2>::dimension_type coarse_dim = num_agg;
     auto fine_dim = local_matrix->get_size()[0];
     // prolong_row_gather is the lightway implementation for prolongation
@@ -238,9 +343,9 @@ Pgm<ValueType, IndexType>::generate_local(
                     restrict_sparsity->get_col_idxs());
 
     // Construct the coarse matrix
-    // TODO: improve it
     auto coarse_matrix =
-        generate_coarse(exec, local_matrix.get(), num_agg, agg_);
+        generate_coarse(exec, restrict_sparsity.get(), local_matrix.get(),
+                        num_agg, agg_, coarse_nz_map_);
 
     return std::tie(prolong_row_gather, coarse_matrix, restrict_sparsity);
 }
@@ -386,9 +491,14 @@ template <typename ValueType, typename IndexType>
 void Pgm<ValueType, IndexType>::generate()
 {
     using csr_type = matrix::Csr<ValueType, IndexType>;
+    using sparsity_type = matrix::SparsityCsr<ValueType, IndexType>;
 #if GINKGO_BUILD_MPI
     if (std::dynamic_pointer_cast<
             const experimental::distributed::DistributedBase>(system_matrix_)) {
+        if (parameters_.smoothed_aggregation) {
+            // the smoothed transfer operators would need non-local columns
+            GKO_NOT_SUPPORTED(system_matrix_);
+        }
         auto convert_fine_op = [&](auto matrix) {
             using global_index_type = typename std::decay_t<
                 decltype(*matrix)>::result_type::global_index_type;
@@ -481,10 +591,11 @@ void Pgm<ValueType, IndexType>::generate()
             // build csr from row and col map
             // unlike non-distributed version, generate_coarse uses different
             // row and col maps.
+            array<IndexType> non_local_nz_map(exec);
             auto result_non_local_csr = generate_coarse(
-                exec, non_local_csr.get(),
-                static_cast<IndexType>(std::get<1>(result)->get_size()[0]),
-                agg_, non_local_num_agg, non_local_col_map);
+                exec, as<const sparsity_type>(std::get<2>(result)).get(),
+                non_local_csr.get(), non_local_num_agg, non_local_col_map,
+                non_local_nz_map);
             // use local and non-local to build coarse matrix
             // also restriction and prolongation (Local-only-global matrix)
             auto coarse_size =
@@ -540,6 +651,63 @@ void Pgm<ValueType, IndexType>::generate()
 }
 
 
+template <typename ValueType, typename IndexType>
+void Pgm<ValueType, IndexType>::update_values(
+    std::shared_ptr<const LinOp> system_matrix)
+{
+    using csr_type = matrix::Csr<ValueType, IndexType>;
+    using sparsity_type = matrix::SparsityCsr<ValueType, IndexType>;
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, system_matrix);
+#if GINKGO_BUILD_MPI
+    if (std::dynamic_pointer_cast<
+            const experimental::distributed::DistributedBase>(system_matrix_) ||
+        std::dynamic_pointer_cast<
+            const experimental::distributed::DistributedBase>(system_matrix)) {
+        GKO_NOT_SUPPORTED(system_matrix);
+    }
+#endif  // GINKGO_BUILD_MPI
+    auto exec = this->get_executor();
+    auto pgm_op = std::dynamic_pointer_cast<const csr_type>(system_matrix);
+    if (!parameters_.skip_sorting || !pgm_op) {
+        pgm_op = convert_to_with_sorting<csr_type>(exec, system_matrix,
+                                                   parameters_.skip_sorting);
+    }
+    // the coarse entries are addressed through the stored entries of the
+    // matrix the hierarchy was generated from
+    if (!parameters_.smoothed_aggregation &&
+        system_matrix->get_size()[0] > 0) {
+        GKO_ASSERT_EQ(pgm_op->get_num_stored_elements(),
+                      coarse_nz_map_.get_size());
+    }
+    system_matrix_ = system_matrix;
+    this->set_fine_op(pgm_op);
+    if (system_matrix_->get_size()[0] == 0) {
+        return;
+    }
+    if (parameters_.smoothed_aggregation) {
+        // the smoothed transfer operators depend on the values, so everything
+        // after the aggregation is recomputed
+        auto result = generate_smoothed_level(
+            exec, pgm_op.get(), agg_,
+            static_cast<IndexType>(this->get_coarse_op()->get_size()[0]),
+            parameters_.smoothing_relaxation,
+            parameters_.num_estimation_iterations,
+            parameters_.prolongation_filter_threshold);
+        this->set_multigrid_level(std::get<0>(result), std::get<1>(result),
+                                  std::get<2>(result));
+        return;
+    }
+    // the aggregates stay fixed, so only the values of the coarse matrix are
+    // recomputed on the sparsity pattern of the previous one
+    auto coarse_matrix = share(as<csr_type>(this->get_coarse_op())->clone());
+    compute_coarse_values(
+        exec, as<const sparsity_type>(this->get_restrict_op()).get(),
+        pgm_op.get(), coarse_nz_map_, coarse_matrix.get());
+    this->set_multigrid_level(this->get_prolong_op(), coarse_matrix,
+                              this->get_restrict_op());
+}
+
+
 #define GKO_DECLARE_PGM(_vtype, _itype) class Pgm<_vtype, _itype>
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM);
 
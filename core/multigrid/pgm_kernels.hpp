@@ -9,7 +9,6 @@
 #include <memory>
 
 #include <ginkgo/core/base/executor.hpp>
-#include <ginkgo/core/matrix/coo.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/matrix/diagonal.hpp>
@@ -39,22 +38,6 @@ namespace pgm {
     void sort_agg(std::shared_ptr<const DefaultExecutor> exec, IndexType num, \
                   IndexType* row_idxs, IndexType* col_idxs)
 
-#define GKO_DECLARE_PGM_MAP_ROW_KERNEL(IndexType)                        \
-    void map_row(std::shared_ptr<const DefaultExecutor> exec,            \
-                 size_type num_fine_row, const IndexType* fine_row_ptrs, \
-                 const IndexType* agg, IndexType* row_idxs)
-
-#define GKO_DECLARE_PGM_MAP_COL_KERNEL(IndexType)                            \
-    void map_col(std::shared_ptr<const DefaultExecutor> exec, size_type nnz, \
-                 const IndexType* fine_col_idxs, const IndexType* agg,       \
-                 IndexType* col_idxs)
-
-#define GKO_DECLARE_PGM_COUNT_UNREPEATED_NNZ_KERNEL(IndexType)             \
-    void count_unrepeated_nnz(std::shared_ptr<const DefaultExecutor> exec, \
-                              size_type nnz, const IndexType* row_idxs,    \
-                              const IndexType* col_idxs,                   \
-                              size_type* coarse_nnz)
-
 #define GKO_DECLARE_PGM_FIND_STRONGEST_NEIGHBOR(ValueType, IndexType)   \
     void find_strongest_neighbor(                                       \
         std::shared_ptr<const DefaultExecutor> exec,                    \
@@ -69,48 +52,75 @@ namespace pgm {
         const matrix::Diagonal<ValueType>* diag, array<IndexType>& agg, \
         array<IndexType>& intermediate_agg)
 
-#define GKO_DECLARE_PGM_SORT_ROW_MAJOR(ValueType, IndexType)         \
-    void sort_row_major(std::shared_ptr<const DefaultExecutor> exec, \
-                        size_type nnz, IndexType* row_idxs,          \
-                        IndexType* col_idxs, ValueType* vals)
-
-#define GKO_DECLARE_PGM_COMPUTE_COARSE_COO(ValueType, IndexType)              \
-    void compute_coarse_coo(std::shared_ptr<const DefaultExecutor> exec,      \
-                            size_type fine_nnz, const IndexType* row_idxs,    \
-                            const IndexType* col_idxs, const ValueType* vals, \
-                            matrix::Coo<ValueType, IndexType>* coarse_coo)
-
 #define GKO_DECLARE_PGM_GATHER_INDEX(IndexType)                    \
     void gather_index(std::shared_ptr<const DefaultExecutor> exec, \
                       size_type num_res, const IndexType* orig,    \
                       const IndexType* gather_map, IndexType* result)
 
-
-#define GKO_DECLARE_ALL_AS_TEMPLATES                               \
-    template <typename IndexType>                                  \
-    GKO_DECLARE_PGM_MATCH_EDGE_KERNEL(IndexType);                  \
-    template <typename IndexType>                                  \
-    GKO_DECLARE_PGM_COUNT_UNAGG_KERNEL(IndexType);                 \
-    template <typename IndexType>                                  \
-    GKO_DECLARE_PGM_RENUMBER_KERNEL(IndexType);                    \
-    template <typename IndexType>                                  \
-    GKO_DECLARE_PGM_SORT_AGG_KERNEL(IndexType);                    \
-    template <typename IndexType>                                  \
-    GKO_DECLARE_PGM_MAP_ROW_KERNEL(IndexType);                     \
-    template <typename IndexType>                                  \
-    GKO_DECLARE_PGM_MAP_COL_KERNEL(IndexType);                     \
-    template <typename IndexType>                                  \
-    GKO_DECLARE_PGM_COUNT_UNREPEATED_NNZ_KERNEL(IndexType);        \
-    template <typename ValueType, typename IndexType>              \
-    GKO_DECLARE_PGM_FIND_STRONGEST_NEIGHBOR(ValueType, IndexType); \
-    template <typename ValueType, typename IndexType>              \
-    GKO_DECLARE_PGM_ASSIGN_TO_EXIST_AGG(ValueType, IndexType);     \
-    template <typename ValueType, typename IndexType>              \
-    GKO_DECLARE_PGM_SORT_ROW_MAJOR(ValueType, IndexType);          \
-    template <typename ValueType, typename IndexType>              \
-    GKO_DECLARE_PGM_COMPUTE_COARSE_COO(ValueType, IndexType);      \
-    template <typename IndexType>                                  \
-    GKO_DECLARE_PGM_GATHER_INDEX(IndexType)
+#define GKO_DECLARE_PGM_GALERKIN_COUNT_KERNEL(IndexType)                      \
+    void galerkin_count(std::shared_ptr<const DefaultExecutor> exec,          \
+                        size_type num_agg, const IndexType* agg_ptrs,         \
+                        const IndexType* agg_rows, const IndexType* row_ptrs, \
+                        const IndexType* col_idxs, const IndexType* col_agg,  \
+                        size_type num_coarse_cols, IndexType* coarse_row_nnz)
+
+#define GKO_DECLARE_PGM_GALERKIN_FILL_KERNEL(IndexType)                      \
+    void galerkin_fill(std::shared_ptr<const DefaultExecutor> exec,          \
+                       size_type num_agg, const IndexType* agg_ptrs,         \
+                       const IndexType* agg_rows, const IndexType* row_ptrs, \
+                       const IndexType* col_idxs, const IndexType* col_agg,  \
+                       size_type num_coarse_cols,                            \
+                       const IndexType* coarse_row_ptrs,                     \
+                       IndexType* coarse_col_idxs, IndexType* nz_map)
+
+#define GKO_DECLARE_PGM_GALERKIN_NUMERIC_KERNEL(ValueType, IndexType)       \
+    void galerkin_numeric(std::shared_ptr<const DefaultExecutor> exec,      \
+                          size_type num_agg, const IndexType* agg_ptrs,     \
+                          const IndexType* agg_rows,                        \
+                          const IndexType* row_ptrs, const ValueType* vals, \
+                          const IndexType* nz_map,                          \
+                          const IndexType* coarse_row_ptrs,                 \
+                          ValueType* coarse_vals)
+
+#define GKO_DECLARE_PGM_FILTER_PROLONGATION_COUNT_KERNEL(ValueType, IndexType) \
+    void filter_prolongation_count(                                            \
+        std::shared_ptr<const DefaultExecutor> exec,                           \
+        const matrix::Csr<ValueType, IndexType>* prolong,                      \
+        remove_complex<ValueType> threshold, IndexType* row_nnz)
+
+#define GKO_DECLARE_PGM_FILTER_PROLONGATION_FILL_KERNEL(ValueType, IndexType) \
+    void filter_prolongation_fill(                                            \
+        std::shared_ptr<const DefaultExecutor> exec,                          \
+        const matrix::Csr<ValueType, IndexType>* prolong,                     \
+        remove_complex<ValueType> threshold,                                  \
+        matrix::Csr<ValueType, IndexType>* filtered)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                                        \
+    template <typename IndexType>                                           \
+    GKO_DECLARE_PGM_MATCH_EDGE_KERNEL(IndexType);                           \
+    template <typename IndexType>                                           \
+    GKO_DECLARE_PGM_COUNT_UNAGG_KERNEL(IndexType);                          \
+    template <typename IndexType>                                           \
+    GKO_DECLARE_PGM_RENUMBER_KERNEL(IndexType);                             \
+    template <typename IndexType>                                           \
+    GKO_DECLARE_PGM_SORT_AGG_KERNEL(IndexType);                             \
+    template <typename ValueType, typename IndexType>                       \
+    GKO_DECLARE_PGM_FIND_STRONGEST_NEIGHBOR(ValueType, IndexType);          \
+    template <typename ValueType, typename IndexType>                       \
+    GKO_DECLARE_PGM_ASSIGN_TO_EXIST_AGG(ValueType, IndexType);              \
+    template <typename IndexType>                                           \
+    GKO_DECLARE_PGM_GATHER_INDEX(IndexType);                                \
+    template <typename IndexType>                                           \
+    GKO_DECLARE_PGM_GALERKIN_COUNT_KERNEL(IndexType);                       \
+    template <typename IndexType>                                           \
+    GKO_DECLARE_PGM_GALERKIN_FILL_KERNEL(IndexType);                        \
+    template <typename ValueType, typename IndexType>                       \
+    GKO_DECLARE_PGM_GALERKIN_NUMERIC_KERNEL(ValueType, IndexType);          \
+    template <typename ValueType, typename IndexType>                       \
+    GKO_DECLARE_PGM_FILTER_PROLONGATION_COUNT_KERNEL(ValueType, IndexType); \
+    template <typename ValueType, typename IndexType>                       \
+    GKO_DECLARE_PGM_FILTER_PROLONGATION_FILL_KERNEL(ValueType, IndexType)
 
 
 }  // namespace pgm
@@ -0,0 +1,292 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "ginkgo/core/multigrid/ruge_stuben.hpp"
+
+#include <tuple>
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/polymorphic_object.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/distributed/base.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/sparsity_csr.hpp>
+
+#include "core/base/array_access.hpp"
+#include "core/base/utils.hpp"
+#include "core/components/fill_array_kernels.hpp"
+#include "core/components/prefix_sum_kernels.hpp"
+#include "core/config/config_helper.hpp"
+#include "core/multigrid/ruge_stuben_kernels.hpp"
+
+
+namespace gko {
+namespace multigrid {
+namespace ruge_stuben {
+namespace {
+
+
+GKO_REGISTER_OPERATION(compute_strong_count, ruge_stuben::compute_strong_count);
+GKO_REGISTER_OPERATION(compute_strong_fill, ruge_stuben::compute_strong_fill);
+GKO_REGISTER_OPERATION(pmis_select, ruge_stuben::pmis_select);
+GKO_REGISTER_OPERATION(pmis_update, ruge_stuben::pmis_update);
+GKO_REGISTER_OPERATION(count_undecided, ruge_stuben::count_undecided);
+GKO_REGISTER_OPERATION(rs_first_pass, ruge_stuben::rs_first_pass);
+GKO_REGISTER_OPERATION(compute_coarse_map, ruge_stuben::compute_coarse_map);
+GKO_REGISTER_OPERATION(direct_interpolation_count,
+                       ruge_stuben::direct_interpolation_count);
+GKO_REGISTER_OPERATION(direct_interpolation_fill,
+                       ruge_stuben::direct_interpolation_fill);
+GKO_REGISTER_OPERATION(extended_i_interpolation_count,
+                       ruge_stuben::extended_i_interpolation_count);
+GKO_REGISTER_OPERATION(extended_i_interpolation_fill,
+                       ruge_stuben::extended_i_interpolation_fill);
+GKO_REGISTER_OPERATION(fill_array, components::fill_array);
+GKO_REGISTER_OPERATION(prefix_sum_nonnegative,
+                       components::prefix_sum_nonnegative);
+
+
+/**
+ * Computes the strong connections of a sorted matrix as a sparsity pattern
+ * with sorted column indices.
+ */
+template <typename ValueType, typename IndexType>
+std::shared_ptr<matrix::SparsityCsr<ValueType, IndexType>> compute_strength(
+    std::shared_ptr<const Executor> exec,
+    const matrix::Csr<ValueType, IndexType>* fine_csr, double threshold)
+{
+    using real_type = remove_complex<ValueType>;
+    const auto num_rows = fine_csr->get_size()[0];
+    const auto real_threshold = static_cast<real_type>(threshold);
+    array<IndexType> row_ptrs(exec, num_rows + 1);
+    exec->run(ruge_stuben::make_compute_strong_count(fine_csr, real_threshold,
+                                                     row_ptrs.get_data()));
+    exec->run(ruge_stuben::make_prefix_sum_nonnegative(row_ptrs.get_data(),
+                                                       num_rows + 1));
+    const auto nnz = static_cast<size_type>(get_element(row_ptrs, num_rows));
+    array<IndexType> col_idxs(exec, nnz);
+    exec->run(ruge_stuben::make_compute_strong_fill(
+        fine_csr, real_threshold, row_ptrs.get_const_data(),
+        col_idxs.get_data()));
+    return matrix::SparsityCsr<ValueType, IndexType>::create(
+        exec, fine_csr->get_size(), std::move(col_idxs), std::move(row_ptrs));
+}
+
+
+/**
+ * Computes the transfer operators and the coarse matrix of a given C/F
+ * splitting.
+ *
+ * @return a tuple with prolongation, coarse, and restriction linop
+ */
+template <typename ValueType, typename IndexType>
+std::tuple<std::shared_ptr<LinOp>, std::shared_ptr<LinOp>,
+           std::shared_ptr<LinOp>>
+generate_level(std::shared_ptr<const Executor> exec,
+               const matrix::Csr<ValueType, IndexType>* fine_csr,
+               const matrix::SparsityCsr<ValueType, IndexType>* strength,
+               const array<IndexType>& cf_splitting,
+               interpolation_type interpolation)
+{
+    using csr_type = matrix::Csr<ValueType, IndexType>;
+    const auto num_rows = fine_csr->get_size()[0];
+    const auto strong_row_ptrs = strength->get_const_row_ptrs();
+    const auto strong_col_idxs = strength->get_const_col_idxs();
+    const auto state = cf_splitting.get_const_data();
+    // coarse_map[row] is the coarse index of the coarse point row
+    array<IndexType> coarse_map(exec, num_rows + 1);
+    exec->run(ruge_stuben::make_compute_coarse_map(num_rows, state,
+                                                   coarse_map.get_data()));
+    exec->run(ruge_stuben::make_prefix_sum_nonnegative(coarse_map.get_data(),
+                                                       num_rows + 1));
+    const auto num_coarse =
+        static_cast<size_type>(get_element(coarse_map, num_rows));
+    const dim<2> prolong_size{num_rows, num_coarse};
+    array<IndexType> row_ptrs(exec, num_rows + 1);
+    if (interpolation == interpolation_type::direct) {
+        exec->run(ruge_stuben::make_direct_interpolation_count(
+            num_rows, strong_row_ptrs, strong_col_idxs, state,
+            row_ptrs.get_data()));
+    } else {
+        exec->run(ruge_stuben::make_extended_i_interpolation_count(
+            num_rows, strong_row_ptrs, strong_col_idxs, state,
+            row_ptrs.get_data()));
+    }
+    exec->run(ruge_stuben::make_prefix_sum_nonnegative(row_ptrs.get_data(),
+                                                       num_rows + 1));
+    const auto nnz = static_cast<size_type>(get_element(row_ptrs, num_rows));
+    auto prolong = share(csr_type::create(exec, prolong_size,
+                                          array<ValueType>(exec, nnz),
+                                          array<IndexType>(exec, nnz),
+                                          std::move(row_ptrs)));
+    if (interpolation == interpolation_type::direct) {
+        exec->run(ruge_stuben::make_direct_interpolation_fill(
+            fine_csr, strong_row_ptrs, strong_col_idxs, state,
+            coarse_map.get_const_data(), prolong.get()));
+    } else {
+        exec->run(ruge_stuben::make_extended_i_interpolation_fill(
+            fine_csr, strong_row_ptrs, strong_col_idxs, state,
+            coarse_map.get_const_data(), prolong.get()));
+    }
+    auto restrict_op = share(as<csr_type>(prolong->conj_transpose()));
+    auto fine_prolong = csr_type::create(exec, prolong_size);
+    fine_csr->apply(prolong, fine_prolong);
+    auto coarse =
+        share(csr_type::create(exec, dim<2>{num_coarse, num_coarse}));
+    restrict_op->apply(fine_prolong, coarse);
+    return std::make_tuple(prolong, coarse, restrict_op);
+}
+
+
+}  // anonymous namespace
+}  // namespace ruge_stuben
+
+
+template <typename ValueType, typename IndexType>
+typename RugeStuben<ValueType, IndexType>::parameters_type
+RugeStuben<ValueType, IndexType>::parse(
+    const config::pnode& config, const config::registry& context,
+    const config::type_descriptor& td_for_child)
+{
+    auto params = RugeStuben<ValueType, IndexType>::build();
+    if (auto& obj = config.get("strength_threshold")) {
+        params.with_strength_threshold(gko::config::get_value<double>(obj));
+    }
+    if (auto& obj = config.get("splitting")) {
+        auto str = obj.get_string();
+        if (str == "pmis") {
+            params.with_splitting(splitting_type::pmis);
+        } else if (str == "hmis") {
+            params.with_splitting(splitting_type::hmis);
+        } else {
+            GKO_INVALID_CONFIG_VALUE("splitting", str);
+        }
+    }
+    if (auto& obj = config.get("interpolation")) {
+        auto str = obj.get_string();
+        if (str == "direct") {
+            params.with_interpolation(interpolation_type::direct);
+        } else if (str == "extended_i") {
+            params.with_interpolation(interpolation_type::extended_i);
+        } else {
+            GKO_INVALID_CONFIG_VALUE("interpolation", str);
+        }
+    }
+    if (auto& obj = config.get("skip_sorting")) {
+        params.with_skip_sorting(gko::config::get_value<bool>(obj));
+    }
+
+    return params;
+}
+
+
+template <typename ValueType, typename IndexType>
+void RugeStuben<ValueType, IndexType>::generate()
+{
+    using csr_type = matrix::Csr<ValueType, IndexType>;
+    using sparsity_type = matrix::SparsityCsr<ValueType, IndexType>;
+#if GINKGO_BUILD_MPI
+    if (std::dynamic_pointer_cast<
+            const experimental::distributed::DistributedBase>(system_matrix_)) {
+        GKO_NOT_SUPPORTED(system_matrix_);
+    }
+#endif  // GINKGO_BUILD_MPI
+    auto exec = this->get_executor();
+    const auto num_rows = system_matrix_->get_size()[0];
+    // Only support csr matrix currently.
+    auto rs_op = std::dynamic_pointer_cast<const csr_type>(system_matrix_);
+    // If system matrix is not csr or need sorting, generate the csr.
+    if (!parameters_.skip_sorting || !rs_op) {
+        rs_op = convert_to_with_sorting<csr_type>(exec, system_matrix_,
+                                                  parameters_.skip_sorting);
+        // keep the same precision data in fine_op
+        this->set_fine_op(rs_op);
+    }
+    auto strength = ruge_stuben::compute_strength(
+        exec, rs_op.get(), parameters_.strength_threshold);
+    // the points depending strongly on each point
+    auto strength_t = as<sparsity_type>(strength->transpose());
+    const auto strong_row_ptrs = strength->get_const_row_ptrs();
+    const auto strong_col_idxs = strength->get_const_col_idxs();
+    const auto strong_t_row_ptrs = strength_t->get_const_row_ptrs();
+    const auto strong_t_col_idxs = strength_t->get_const_col_idxs();
+
+    cf_splitting_.resize_and_reset(num_rows);
+    exec->run(ruge_stuben::make_fill_array(
+        cf_splitting_.get_data(), num_rows,
+        static_cast<IndexType>(kernels::ruge_stuben::cf_state::undecided)));
+    if (parameters_.splitting == splitting_type::hmis) {
+        // all points are local, so the first pass decides all of them
+        exec->run(ruge_stuben::make_rs_first_pass(
+            num_rows, strong_row_ptrs, strong_col_idxs, strong_t_row_ptrs,
+            strong_t_col_idxs, cf_splitting_.get_data()));
+    }
+    array<IndexType> new_splitting(exec, num_rows);
+    IndexType num_undecided{};
+    exec->run(ruge_stuben::make_count_undecided(
+        num_rows, cf_splitting_.get_const_data(), &num_undecided));
+    while (num_undecided > 0) {
+        exec->run(ruge_stuben::make_pmis_select(
+            num_rows, strong_row_ptrs, strong_col_idxs, strong_t_row_ptrs,
+            strong_t_col_idxs, cf_splitting_.get_const_data(),
+            new_splitting.get_data()));
+        exec->run(ruge_stuben::make_pmis_update(
+            num_rows, strong_row_ptrs, strong_col_idxs,
+            new_splitting.get_const_data(), cf_splitting_.get_data()));
+        exec->run(ruge_stuben::make_count_undecided(
+            num_rows, cf_splitting_.get_const_data(), &num_undecided));
+    }
+
+    auto result =
+        ruge_stuben::generate_level(exec, rs_op.get(), strength.get(),
+                                    cf_splitting_, parameters_.interpolation);
+    this->set_multigrid_level(std::get<0>(result), std::get<1>(result),
+                              std::get<2>(result));
+}
+
+
+template <typename ValueType, typename IndexType>
+void RugeStuben<ValueType, IndexType>::update_values(
+    std::shared_ptr<const LinOp> system_matrix)
+{
+    using csr_type = matrix::Csr<ValueType, IndexType>;
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, system_matrix);
+#if GINKGO_BUILD_MPI
+    if (std::dynamic_pointer_cast<
+            const experimental::distributed::DistributedBase>(system_matrix)) {
+        GKO_NOT_SUPPORTED(system_matrix);
+    }
+#endif  // GINKGO_BUILD_MPI
+    auto exec = this->get_executor();
+    system_matrix_ = system_matrix;
+    auto rs_op = std::dynamic_pointer_cast<const csr_type>(system_matrix_);
+    if (!parameters_.skip_sorting || !rs_op) {
+        rs_op = convert_to_with_sorting<csr_type>(exec, system_matrix_,
+                                                  parameters_.skip_sorting);
+    }
+    this->set_fine_op(rs_op);
+    if (system_matrix_->get_size()[0] == 0) {
+        return;
+    }
+    // the splitting stays fixed, while the interpolation weights follow the
+    // new values
+    auto strength = ruge_stuben::compute_strength(
+        exec, rs_op.get(), parameters_.strength_threshold);
+    auto result =
+        ruge_stuben::generate_level(exec, rs_op.get(), strength.get(),
+                                    cf_splitting_, parameters_.interpolation);
+    this->set_multigrid_level(std::get<0>(result), std::get<1>(result),
+                              std::get<2>(result));
+}
+
+
+#define GKO_DECLARE_RUGE_STUBEN(_vtype, _itype) class RugeStuben<_vtype, _itype>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_RUGE_STUBEN);
+
+
+}  // namespace multigrid
+}  // namespace gko
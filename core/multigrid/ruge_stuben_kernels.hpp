@@ -0,0 +1,195 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_MULTIGRID_RUGE_STUBEN_KERNELS_HPP_
+#define GKO_CORE_MULTIGRID_RUGE_STUBEN_KERNELS_HPP_
+
+
+#include <memory>
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+#include "core/base/kernel_declaration.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace ruge_stuben {
+
+
+/**
+ * The state of a point in the C/F splitting.
+ */
+enum cf_state : int { undecided = -1, fine = 0, coarse = 1 };
+
+
+}  // namespace ruge_stuben
+
+
+/**
+ * Counts the strong connections of each row. The off-diagonal entry a_ij is
+ * strong if -a_ij s_i >= threshold max_k(-a_ik s_i), where s_i is the sign of
+ * the real part of the diagonal entry, so only couplings of the opposite sign
+ * as the diagonal can be strong.
+ */
+#define GKO_DECLARE_RUGE_STUBEN_COMPUTE_STRONG_COUNT_KERNEL(ValueType,         \
+                                                            IndexType)         \
+    void compute_strong_count(std::shared_ptr<const DefaultExecutor> exec,     \
+                              const matrix::Csr<ValueType, IndexType>* source, \
+                              remove_complex<ValueType> threshold,             \
+                              IndexType* row_nnz)
+
+/**
+ * Fills the sorted column indices of the strong connections of each row.
+ */
+#define GKO_DECLARE_RUGE_STUBEN_COMPUTE_STRONG_FILL_KERNEL(ValueType,         \
+                                                           IndexType)         \
+    void compute_strong_fill(std::shared_ptr<const DefaultExecutor> exec,     \
+                             const matrix::Csr<ValueType, IndexType>* source, \
+                             remove_complex<ValueType> threshold,             \
+                             const IndexType* strong_row_ptrs,                \
+                             IndexType* strong_col_idxs)
+
+/**
+ * Selects an independent set of coarse points among the undecided points as
+ * one round of PMIS. An undecided point becomes coarse if its measure, the
+ * number of points strongly depending on it with ties broken by a hash of the
+ * index, is larger than that of all undecided points it is strongly connected
+ * to. Undecided points on which no point strongly depends become fine.
+ */
+#define GKO_DECLARE_RUGE_STUBEN_PMIS_SELECT_KERNEL(IndexType)               \
+    void pmis_select(                                                       \
+        std::shared_ptr<const DefaultExecutor> exec, size_type num_rows,    \
+        const IndexType* strong_row_ptrs, const IndexType* strong_col_idxs, \
+        const IndexType* strong_t_row_ptrs,                                 \
+        const IndexType* strong_t_col_idxs, const IndexType* state,         \
+        IndexType* new_state)
+
+/**
+ * Completes one round of PMIS: undecided points strongly depending on a new
+ * coarse point become fine.
+ */
+#define GKO_DECLARE_RUGE_STUBEN_PMIS_UPDATE_KERNEL(IndexType)              \
+    void pmis_update(std::shared_ptr<const DefaultExecutor> exec,          \
+                     size_type num_rows, const IndexType* strong_row_ptrs, \
+                     const IndexType* strong_col_idxs,                     \
+                     const IndexType* new_state, IndexType* state)
+
+#define GKO_DECLARE_RUGE_STUBEN_COUNT_UNDECIDED_KERNEL(IndexType)     \
+    void count_undecided(std::shared_ptr<const DefaultExecutor> exec, \
+                         size_type num_rows, const IndexType* state,  \
+                         IndexType* num_undecided)
+
+/**
+ * Computes the C/F splitting by the classical sequential first pass of
+ * Ruge-Stueben coarsening, which decides all points.
+ */
+#define GKO_DECLARE_RUGE_STUBEN_RS_FIRST_PASS_KERNEL(IndexType)             \
+    void rs_first_pass(                                                     \
+        std::shared_ptr<const DefaultExecutor> exec, size_type num_rows,    \
+        const IndexType* strong_row_ptrs, const IndexType* strong_col_idxs, \
+        const IndexType* strong_t_row_ptrs,                                 \
+        const IndexType* strong_t_col_idxs, IndexType* state)
+
+/**
+ * Sets coarse_map[i] to 1 for coarse points and 0 otherwise, which is turned
+ * into the coarse index of each point by an exclusive prefix sum.
+ */
+#define GKO_DECLARE_RUGE_STUBEN_COMPUTE_COARSE_MAP_KERNEL(IndexType)     \
+    void compute_coarse_map(std::shared_ptr<const DefaultExecutor> exec, \
+                            size_type num_rows, const IndexType* state,  \
+                            IndexType* coarse_map)
+
+/**
+ * Counts the entries of each row of the direct interpolation, whose
+ * interpolatory points are the strong coarse neighbors.
+ */
+#define GKO_DECLARE_RUGE_STUBEN_DIRECT_INTERPOLATION_COUNT_KERNEL(IndexType) \
+    void direct_interpolation_count(                                         \
+        std::shared_ptr<const DefaultExecutor> exec, size_type num_rows,     \
+        const IndexType* strong_row_ptrs, const IndexType* strong_col_idxs,  \
+        const IndexType* state, IndexType* row_nnz)
+
+/**
+ * Computes the direct interpolation into the prolongation, whose row pointers
+ * were computed from direct_interpolation_count.
+ */
+#define GKO_DECLARE_RUGE_STUBEN_DIRECT_INTERPOLATION_FILL_KERNEL(ValueType, \
+                                                                 IndexType) \
+    void direct_interpolation_fill(                                         \
+        std::shared_ptr<const DefaultExecutor> exec,                        \
+        const matrix::Csr<ValueType, IndexType>* source,                    \
+        const IndexType* strong_row_ptrs, const IndexType* strong_col_idxs, \
+        const IndexType* state, const IndexType* coarse_map,                \
+        matrix::Csr<ValueType, IndexType>* prolong)
+
+/**
+ * Counts the entries of each row of the extended+i interpolation, whose
+ * interpolatory points are the strong coarse neighbors and the strong coarse
+ * neighbors of the strong fine neighbors.
+ */
+#define GKO_DECLARE_RUGE_STUBEN_EXTENDED_I_INTERPOLATION_COUNT_KERNEL(      \
+    IndexType)                                                              \
+    void extended_i_interpolation_count(                                    \
+        std::shared_ptr<const DefaultExecutor> exec, size_type num_rows,    \
+        const IndexType* strong_row_ptrs, const IndexType* strong_col_idxs, \
+        const IndexType* state, IndexType* row_nnz)
+
+/**
+ * Computes the extended+i interpolation into the prolongation, whose row
+ * pointers were computed from extended_i_interpolation_count.
+ */
+#define GKO_DECLARE_RUGE_STUBEN_EXTENDED_I_INTERPOLATION_FILL_KERNEL(       \
+    ValueType, IndexType)                                                   \
+    void extended_i_interpolation_fill(                                     \
+        std::shared_ptr<const DefaultExecutor> exec,                        \
+        const matrix::Csr<ValueType, IndexType>* source,                    \
+        const IndexType* strong_row_ptrs, const IndexType* strong_col_idxs, \
+        const IndexType* state, const IndexType* coarse_map,                \
+        matrix::Csr<ValueType, IndexType>* prolong)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                                          \
+    template <typename ValueType, typename IndexType>                         \
+    GKO_DECLARE_RUGE_STUBEN_COMPUTE_STRONG_COUNT_KERNEL(ValueType,            \
+                                                        IndexType);           \
+    template <typename ValueType, typename IndexType>                         \
+    GKO_DECLARE_RUGE_STUBEN_COMPUTE_STRONG_FILL_KERNEL(ValueType, IndexType); \
+    template <typename IndexType>                                             \
+    GKO_DECLARE_RUGE_STUBEN_PMIS_SELECT_KERNEL(IndexType);                    \
+    template <typename IndexType>                                             \
+    GKO_DECLARE_RUGE_STUBEN_PMIS_UPDATE_KERNEL(IndexType);                    \
+    template <typename IndexType>                                             \
+    GKO_DECLARE_RUGE_STUBEN_COUNT_UNDECIDED_KERNEL(IndexType);                \
+    template <typename IndexType>                                             \
+    GKO_DECLARE_RUGE_STUBEN_RS_FIRST_PASS_KERNEL(IndexType);                  \
+    template <typename IndexType>                                             \
+    GKO_DECLARE_RUGE_STUBEN_COMPUTE_COARSE_MAP_KERNEL(IndexType);             \
+    template <typename IndexType>                                             \
+    GKO_DECLARE_RUGE_STUBEN_DIRECT_INTERPOLATION_COUNT_KERNEL(IndexType);     \
+    template <typename ValueType, typename IndexType>                         \
+    GKO_DECLARE_RUGE_STUBEN_DIRECT_INTERPOLATION_FILL_KERNEL(ValueType,       \
+                                                             IndexType);      \
+    template <typename IndexType>                                             \
+    GKO_DECLARE_RUGE_STUBEN_EXTENDED_I_INTERPOLATION_COUNT_KERNEL(IndexType); \
+    template <typename ValueType, typename IndexType>                         \
+    GKO_DECLARE_RUGE_STUBEN_EXTENDED_I_INTERPOLATION_FILL_KERNEL(ValueType,   \
+                                                                 IndexType)
+
+
+GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(ruge_stuben,
+                                        GKO_DECLARE_ALL_AS_TEMPLATES);
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MULTIGRID_RUGE_STUBEN_KERNELS_HPP_
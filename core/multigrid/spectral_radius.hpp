@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_MULTIGRID_SPECTRAL_RADIUS_HPP_
+#define GKO_CORE_MULTIGRID_SPECTRAL_RADIUS_HPP_
+
+
+#include <random>
+#include <utility>
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+namespace gko {
+namespace detail {
+
+
+/**
+ * Estimates the spectral radius of the matrix by power iteration started from
+ * a fixed pseudo-random vector.
+ *
+ * @param mtx  the square matrix
+ * @param num_iterations  the number of power iterations
+ *
+ * @return the norm of A v for the last normalized iterate v, or zero if the
+ *         iteration reaches the zero vector
+ */
+template <typename ValueType>
+remove_complex<ValueType> estimate_spectral_radius(const LinOp* mtx,
+                                                   size_type num_iterations)
+{
+    using Vector = matrix::Dense<ValueType>;
+    using real_type = remove_complex<ValueType>;
+    auto exec = mtx->get_executor();
+    const dim<2> vector_size{mtx->get_size()[0], 1};
+    // the fixed seed makes the estimate reproducible
+    std::default_random_engine engine{42};
+    std::uniform_real_distribution<double> dist{-1.0, 1.0};
+    auto host_v = Vector::create(exec->get_master(), vector_size);
+    for (size_type row = 0; row < vector_size[0]; row++) {
+        host_v->at(row, 0) = static_cast<ValueType>(dist(engine));
+    }
+    auto v = gko::clone(exec, host_v);
+    auto w = Vector::create(exec, vector_size);
+    auto norm = matrix::Dense<real_type>::create(exec, dim<2>{1, 1});
+    auto scalar = Vector::create(exec, dim<2>{1, 1});
+    const auto norm2 = [&](const Vector* a) {
+        a->compute_norm2(norm);
+        return exec->copy_val_to_host(norm->get_const_values());
+    };
+    auto v_norm = norm2(v.get());
+    auto radius = zero<real_type>();
+    for (size_type iter = 0; iter < num_iterations; iter++) {
+        if (!(v_norm > zero<real_type>())) {
+            break;
+        }
+        scalar->fill(one<ValueType>() / static_cast<ValueType>(v_norm));
+        v->scale(scalar);
+        mtx->apply(v, w);
+        // ||A v|| for the normalized v approximates the spectral radius
+        v_norm = norm2(w.get());
+        radius = v_norm;
+        std::swap(v, w);
+    }
+    return radius;
+}
+
+
+}  // namespace detail
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MULTIGRID_SPECTRAL_RADIUS_HPP_
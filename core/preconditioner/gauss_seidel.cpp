@@ -36,6 +36,9 @@ GaussSeidel<ValueType, IndexType>::parse(
             gko::config::parse_or_get_factory<const LinOpFactory>(
                 obj, context, td_for_child));
     }
+    if (auto& obj = config.get("multicolor")) {
+        params.with_multicolor(config::get_value<bool>(obj));
+    }
 
     return params;
 }
@@ -63,6 +66,7 @@ std::unique_ptr<LinOp> GaussSeidel<ValueType, IndexType>::generate_impl(
         .with_relaxation_factor(static_cast<remove_complex<ValueType>>(1.0))
         .with_l_solver(parameters_.l_solver)
         .with_u_solver(parameters_.u_solver)
+        .with_multicolor(parameters_.multicolor)
         .on(this->get_executor())
         ->generate(std::move(system_matrix));
 }
@@ -124,7 +124,8 @@ Isai<IsaiType, ValueType, IndexType>::parse(
 template <isai_type IsaiType, typename ValueType, typename IndexType>
 void Isai<IsaiType, ValueType, IndexType>::generate_inverse(
     std::shared_ptr<const LinOp> input, bool skip_sorting, int power,
-    IndexType excess_limit, remove_complex<ValueType> excess_solver_reduction)
+    IndexType excess_limit, remove_complex<ValueType> excess_solver_reduction,
+    std::shared_ptr<const Csr> inverse_pattern)
 {
     using Dense = matrix::Dense<ValueType>;
     using LowerTrs = solver::LowerTrs<ValueType, IndexType>;
@@ -139,7 +140,10 @@ void Isai<IsaiType, ValueType, IndexType>::generate_inverse(
     auto to_invert = convert_to_with_sorting<Csr>(exec, input, skip_sorting);
     auto num_rows = to_invert->get_size()[0];
     std::shared_ptr<Csr> inverted;
-    if (!is_spd) {
+    if (inverse_pattern) {
+        // the values are overwritten by the inverse generation below
+        inverted = gko::clone(exec, inverse_pattern);
+    } else if (!is_spd) {
         inverted = extend_sparsity(exec, to_invert, power);
     } else {
         // Extract lower triangular part: compute non-zeros
@@ -267,6 +271,38 @@ void Isai<IsaiType, ValueType, IndexType>::generate_inverse(
 }
 
 
+template <isai_type IsaiType, typename ValueType, typename IndexType>
+void Isai<IsaiType, ValueType, IndexType>::compose_spd_inverse()
+{
+    auto inv = share(as<Csr>(approximate_inverse_));
+    auto inv_transp = share(inv->conj_transpose());
+    approximate_inverse_ = Composition<ValueType>::create(inv_transp, inv);
+}
+
+
+template <isai_type IsaiType, typename ValueType, typename IndexType>
+void Isai<IsaiType, ValueType, IndexType>::update_values(
+    std::shared_ptr<const LinOp> system_matrix)
+{
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, system_matrix);
+    const auto is_spd = IsaiType == isai_type::spd;
+    // the spd ISAI stores the composition L^H * L
+    auto inverse_pattern =
+        is_spd ? as<Csr>(as<Composition<ValueType>>(approximate_inverse_)
+                             ->get_operators()[1])
+               : as<Csr>(approximate_inverse_);
+    generate_inverse(system_matrix, parameters_.skip_sorting,
+                     parameters_.sparsity_power,
+                     static_cast<IndexType>(parameters_.excess_limit),
+                     static_cast<remove_complex<ValueType>>(
+                         parameters_.excess_solver_reduction),
+                     std::move(inverse_pattern));
+    if (is_spd) {
+        this->compose_spd_inverse();
+    }
+}
+
+
 template <isai_type IsaiType, typename ValueType, typename IndexType>
 Isai<IsaiType, ValueType, IndexType>&
 Isai<IsaiType, ValueType, IndexType>::operator=(const Isai& other)
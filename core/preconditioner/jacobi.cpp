@@ -99,6 +99,7 @@ Jacobi<ValueType, IndexType>& Jacobi<ValueType, IndexType>::operator=(
         num_blocks_ = other.num_blocks_;
         blocks_ = other.blocks_;
         conditioning_ = other.conditioning_;
+        requested_precisions_ = other.requested_precisions_;
         parameters_ = other.parameters_;
     }
     return *this;
@@ -118,6 +119,7 @@ Jacobi<ValueType, IndexType>& Jacobi<ValueType, IndexType>::operator=(
         num_blocks_ = std::exchange(other.num_blocks_, 0);
         blocks_ = std::move(other.blocks_);
         conditioning_ = std::move(other.conditioning_);
+        requested_precisions_ = std::move(other.requested_precisions_);
         parameters_ = std::exchange(other.parameters_, parameters_type{});
     }
     return *this;
@@ -304,6 +306,20 @@ std::unique_ptr<LinOp> Jacobi<ValueType, IndexType>::conj_transpose() const
 }
 
 
+template <typename ValueType, typename IndexType>
+void Jacobi<ValueType, IndexType>::update_values(
+    std::shared_ptr<const LinOp> system_matrix)
+{
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, system_matrix);
+    // the block pointers were stored in the parameters on generation, so
+    // generate skips the block detection
+    if (requested_precisions_.get_size() > 0) {
+        parameters_.storage_optimization.block_wise = requested_precisions_;
+    }
+    this->generate(system_matrix.get(), parameters_.skip_sorting);
+}
+
+
 template <typename ValueType, typename IndexType>
 void Jacobi<ValueType, IndexType>::detect_blocks(
     const matrix::Csr<ValueType, IndexType>* system_matrix)
@@ -6,7 +6,9 @@
 #include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/base/precision_dispatch.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/matrix/diagonal.hpp>
+#include <ginkgo/core/matrix/permutation.hpp>
 #include <ginkgo/core/preconditioner/sor.hpp>
 #include <ginkgo/core/solver/triangular.hpp>
 
@@ -28,6 +30,83 @@ GKO_REGISTER_OPERATION(initialize_row_ptrs_l_u,
                        factorization::initialize_row_ptrs_l_u);
 GKO_REGISTER_OPERATION(initialize_weighted_l, sor::initialize_weighted_l);
 GKO_REGISTER_OPERATION(initialize_weighted_l_u, sor::initialize_weighted_l_u);
+GKO_REGISTER_OPERATION(compute_multicolor_ordering,
+                       sor::compute_multicolor_ordering);
+GKO_REGISTER_OPERATION(apply_multicolor_sweep, sor::apply_multicolor_sweep);
+
+
+/**
+ * Solves a triangular system whose rows are ordered by color, such that rows
+ * of the same color are not coupled. The colors are processed one after the
+ * other, the rows within a color in parallel.
+ */
+template <typename ValueType, typename IndexType>
+class MulticolorSweep
+    : public EnableLinOp<MulticolorSweep<ValueType, IndexType>> {
+    friend class EnablePolymorphicObject<MulticolorSweep, LinOp>;
+
+public:
+    using Csr = matrix::Csr<ValueType, IndexType>;
+
+    /**
+     * Creates the sweep.
+     *
+     * @param factor  the lower or upper triangular factor in color order
+     * @param color_ptrs  the first row of every color, followed by the number
+     *                    of rows
+     * @param forward  true for a lower, false for an upper triangular factor
+     */
+    static std::unique_ptr<MulticolorSweep> create(
+        std::shared_ptr<const Csr> factor, array<IndexType> color_ptrs,
+        bool forward)
+    {
+        return std::unique_ptr<MulticolorSweep>{new MulticolorSweep{
+            std::move(factor), std::move(color_ptrs), forward}};
+    }
+
+protected:
+    explicit MulticolorSweep(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<MulticolorSweep>(exec), color_ptrs_{exec}, forward_{}
+    {}
+
+    MulticolorSweep(std::shared_ptr<const Csr> factor,
+                    array<IndexType> color_ptrs, bool forward)
+        : EnableLinOp<MulticolorSweep>(factor->get_executor(),
+                                       factor->get_size()),
+          factor_{std::move(factor)},
+          color_ptrs_{factor_->get_executor(), std::move(color_ptrs)},
+          forward_{forward}
+    {}
+
+    void apply_impl(const LinOp* b, LinOp* x) const override
+    {
+        precision_dispatch_real_complex<ValueType>(
+            [this](auto dense_b, auto dense_x) {
+                this->get_executor()->run(make_apply_multicolor_sweep(
+                    factor_.get(), color_ptrs_, forward_, dense_b, dense_x));
+            },
+            b, x);
+    }
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override
+    {
+        precision_dispatch_real_complex<ValueType>(
+            [this](auto dense_alpha, auto dense_b, auto dense_beta,
+                   auto dense_x) {
+                auto x_clone = dense_x->clone();
+                this->apply_impl(dense_b, x_clone.get());
+                dense_x->scale(dense_beta);
+                dense_x->add_scaled(dense_alpha, x_clone);
+            },
+            alpha, b, beta, x);
+    }
+
+private:
+    std::shared_ptr<const Csr> factor_;
+    array<IndexType> color_ptrs_;
+    bool forward_;
+};
 
 
 }  // namespace
@@ -61,6 +140,9 @@ Sor<ValueType, IndexType>::parse(const config::pnode& config,
             gko::config::parse_or_get_factory<const LinOpFactory>(
                 obj, context, td_for_child));
     }
+    if (auto& obj = config.get("multicolor")) {
+        params.with_multicolor(config::get_value<bool>(obj));
+    }
 
     return params;
 }
@@ -91,12 +173,44 @@ std::unique_ptr<LinOp> Sor<ValueType, IndexType>::generate_impl(
     auto exec = this->get_executor();
     auto size = system_matrix->get_size();
 
-    auto csr_matrix = convert_to_with_sorting<Csr>(exec, system_matrix,
-                                                   parameters_.skip_sorting);
+    std::shared_ptr<const Csr> csr_matrix = convert_to_with_sorting<Csr>(
+        exec, system_matrix, parameters_.skip_sorting);
+
+    std::shared_ptr<const matrix::Permutation<index_type>> permutation;
+    array<index_type> color_ptrs{exec};
+    if (parameters_.multicolor) {
+        // reorder the matrix by color, so that the diagonal blocks belonging
+        // to the individual colors are diagonal matrices
+        auto transposed = as<Csr>(csr_matrix->transpose());
+        array<index_type> permutation_array{exec, size[0]};
+        exec->run(make_compute_multicolor_ordering(
+            size[0], csr_matrix->get_const_row_ptrs(),
+            csr_matrix->get_const_col_idxs(), transposed->get_const_row_ptrs(),
+            transposed->get_const_col_idxs(), permutation_array.get_data(),
+            color_ptrs));
+        permutation = matrix::Permutation<index_type>::create(
+            exec, std::move(permutation_array));
+        auto permuted = csr_matrix->permute(permutation);
+        permuted->sort_by_column_index();
+        csr_matrix = std::move(permuted);
+    }
+
+    // inverts a triangular factor either by a triangular solver or by a
+    // multicolor sweep
+    auto invert_factor = [&](std::shared_ptr<const LinOpFactory> trs_factory,
+                             std::unique_ptr<Csr> factor,
+                             bool forward) -> std::shared_ptr<const LinOp> {
+        if (parameters_.multicolor) {
+            return MulticolorSweep<value_type, index_type>::create(
+                std::move(factor), color_ptrs, forward);
+        }
+        return trs_factory->generate(std::move(factor));
+    };
 
     auto l_trs_factory =
         parameters_.l_solver ? parameters_.l_solver : LTrs::build().on(exec);
 
+    std::vector<std::shared_ptr<const LinOp>> operators;
     if (parameters_.symmetric) {
         auto u_trs_factory = parameters_.u_solver ? parameters_.u_solver
                                                   : UTrs::build().on(exec);
@@ -129,12 +243,12 @@ std::unique_ptr<LinOp> Sor<ValueType, IndexType>::generate_impl(
         diag->inverse_apply(u_mtx, u_mtx);
 
         // invert the triangular matrices with triangular solvers
-        auto l_trs = l_trs_factory->generate(std::move(l_mtx));
-        auto u_trs = u_trs_factory->generate(std::move(u_mtx));
+        auto l_trs = invert_factor(l_trs_factory, std::move(l_mtx), true);
+        auto u_trs = invert_factor(u_trs_factory, std::move(u_mtx), false);
 
         // return (1/(w * (1 - w)) (D + wL) D^-1 (D + wU))^-1
         // because of the inversion, the factor order is switched
-        return composition_type::create(std::move(u_trs), std::move(l_trs));
+        operators = {std::move(u_trs), std::move(l_trs)};
     } else {
         array<index_type> l_row_ptrs{exec, size[0] + 1};
         exec->run(make_initialize_row_ptrs_l(csr_matrix.get(),
@@ -152,10 +266,14 @@ std::unique_ptr<LinOp> Sor<ValueType, IndexType>::generate_impl(
             csr_matrix.get(), parameters_.relaxation_factor, l_mtx.get()));
 
         // invert the triangular matrices with triangular solvers
-        auto l_trs = l_trs_factory->generate(std::move(l_mtx));
-
-        return composition_type::create(std::move(l_trs));
+        operators = {invert_factor(l_trs_factory, std::move(l_mtx), true)};
+    }
+    if (parameters_.multicolor) {
+        // solve the reordered system P A P^T (P x) = P b
+        operators.insert(operators.begin(), permutation->compute_inverse());
+        operators.push_back(permutation);
     }
+    return composition_type::create(operators.begin(), operators.end());
 }
 
 
@@ -6,7 +6,9 @@
 #define GKO_CORE_PRECONDITIONER_SOR_KERNELS_HPP_
 
 
+#include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/preconditioner/sor.hpp>
 
 #include "core/base/kernel_declaration.hpp"
@@ -31,11 +33,31 @@ namespace kernels {
         matrix::Csr<_vtype, _itype>* u_factor)
 
 
-#define GKO_DECLARE_ALL_AS_TEMPLATES                             \
-    template <typename ValueType, typename IndexType>            \
-    GKO_DECLARE_SOR_INITIALIZE_WEIGHTED_L(ValueType, IndexType); \
-    template <typename ValueType, typename IndexType>            \
-    GKO_DECLARE_SOR_INITIALIZE_WEIGHTED_L_U(ValueType, IndexType)
+#define GKO_DECLARE_SOR_COMPUTE_MULTICOLOR_ORDERING(_itype)              \
+    void compute_multicolor_ordering(                                    \
+        std::shared_ptr<const DefaultExecutor> exec, size_type num_rows, \
+        const _itype* row_ptrs, const _itype* col_idxs,                  \
+        const _itype* trans_row_ptrs, const _itype* trans_col_idxs,      \
+        _itype* permutation, array<_itype>& color_ptrs)
+
+
+#define GKO_DECLARE_SOR_APPLY_MULTICOLOR_SWEEP(_vtype, _itype) \
+    void apply_multicolor_sweep(                               \
+        std::shared_ptr<const DefaultExecutor> exec,           \
+        const matrix::Csr<_vtype, _itype>* factor,             \
+        const array<_itype>& color_ptrs, bool forward,         \
+        const matrix::Dense<_vtype>* b, matrix::Dense<_vtype>* x)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                               \
+    template <typename ValueType, typename IndexType>              \
+    GKO_DECLARE_SOR_INITIALIZE_WEIGHTED_L(ValueType, IndexType);   \
+    template <typename ValueType, typename IndexType>              \
+    GKO_DECLARE_SOR_INITIALIZE_WEIGHTED_L_U(ValueType, IndexType); \
+    template <typename IndexType>                                  \
+    GKO_DECLARE_SOR_COMPUTE_MULTICOLOR_ORDERING(IndexType);        \
+    template <typename ValueType, typename IndexType>              \
+    GKO_DECLARE_SOR_APPLY_MULTICOLOR_SWEEP(ValueType, IndexType)
 
 
 GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(sor, GKO_DECLARE_ALL_AS_TEMPLATES);
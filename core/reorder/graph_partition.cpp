@@ -0,0 +1,632 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/reorder/graph_partition.hpp"
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/math.hpp>
+
+#include "core/base/allocator.hpp"
+#include "core/components/addressable_pq.hpp"
+#include "core/reorder/graph_partition_kernels.hpp"
+
+
+namespace gko {
+namespace experimental {
+namespace reorder {
+namespace graph_partition {
+namespace {
+
+
+/**
+ * Runs the reference kernel on a ReferenceExecutor and the OpenMP kernel on an
+ * OmpExecutor. The partitioner only runs on the host, so there are no device
+ * kernels.
+ */
+#define GKO_DISPATCH_HOST_KERNEL(_kernel)                                      \
+    template <typename... Args>                                               \
+    void _kernel(std::shared_ptr<const Executor> exec, Args&&... args)        \
+    {                                                                         \
+        if (auto ref =                                                        \
+                std::dynamic_pointer_cast<const ReferenceExecutor>(exec)) {   \
+            kernels::reference::graph_partition::_kernel(                    \
+                ref, std::forward<Args>(args)...);                            \
+        } else {                                                              \
+            kernels::omp::graph_partition::_kernel(                           \
+                as<OmpExecutor>(exec), std::forward<Args>(args)...);          \
+        }                                                                     \
+    }                                                                         \
+    GKO_REGISTER_HOST_OPERATION(_kernel, _kernel)
+
+GKO_DISPATCH_HOST_KERNEL(match_edges);
+GKO_DISPATCH_HOST_KERNEL(contract_graph);
+
+#undef GKO_DISPATCH_HOST_KERNEL
+
+
+// coarsening stops once the graph has at most this many vertices
+constexpr int coarsest_graph_size = 100;
+// coarsening stops once a level removes less than 10% of the vertices
+constexpr double min_coarsening_ratio = 0.9;
+// number of greedy graph growing attempts on the coarsest graph
+constexpr int num_initial_bisections = 4;
+constexpr int max_refinement_passes = 8;
+// allowed deviation of the weight of a side from its target weight, relative
+// to the total weight of the graph
+constexpr double max_imbalance = 0.03;
+
+
+/** An undirected graph with integer vertex and edge weights in CSR format. */
+template <typename IndexType>
+struct weighted_graph {
+    explicit weighted_graph(std::shared_ptr<const Executor> exec)
+        : row_ptrs{exec},
+          col_idxs{exec},
+          edge_weights{exec},
+          vertex_weights{exec}
+    {}
+
+    IndexType get_num_vertices() const
+    {
+        return static_cast<IndexType>(vertex_weights.get_size());
+    }
+
+    IndexType get_total_weight() const
+    {
+        const auto weights = vertex_weights.get_const_data();
+        return std::accumulate(weights, weights + get_num_vertices(),
+                               IndexType{});
+    }
+
+    IndexType get_max_vertex_weight() const
+    {
+        const auto weights = vertex_weights.get_const_data();
+        return std::accumulate(
+            weights, weights + get_num_vertices(), IndexType{},
+            [](IndexType a, IndexType b) { return std::max(a, b); });
+    }
+
+    array<IndexType> row_ptrs;
+    array<IndexType> col_idxs;
+    array<IndexType> edge_weights;
+    array<IndexType> vertex_weights;
+};
+
+
+/** The cut weight of a bisection and the deviation from its target weight. */
+template <typename IndexType>
+struct bisection_quality {
+    IndexType cut;
+    IndexType imbalance;
+};
+
+
+template <typename IndexType>
+bool is_better(bisection_quality<IndexType> a, bisection_quality<IndexType> b,
+               IndexType tolerance)
+{
+    const auto a_balanced = a.imbalance <= tolerance;
+    const auto b_balanced = b.imbalance <= tolerance;
+    if (a_balanced != b_balanced) {
+        return a_balanced;
+    }
+    if (!a_balanced) {
+        return a.imbalance < b.imbalance;
+    }
+    return a.cut < b.cut || (a.cut == b.cut && a.imbalance < b.imbalance);
+}
+
+
+/**
+ * Extracts the subgraph induced by the given vertices with unit weights.
+ * local_ids needs to be filled with invalid_index for all vertices, it is
+ * restored before returning.
+ */
+template <typename IndexType>
+weighted_graph<IndexType> extract_subgraph(
+    std::shared_ptr<const Executor> exec, const IndexType* row_ptrs,
+    const IndexType* col_idxs, const vector<IndexType>& vertices,
+    vector<IndexType>& local_ids)
+{
+    const auto num_vertices = static_cast<IndexType>(vertices.size());
+    for (IndexType i = 0; i < num_vertices; i++) {
+        local_ids[vertices[i]] = i;
+    }
+    weighted_graph<IndexType> graph{exec};
+    graph.row_ptrs.resize_and_reset(num_vertices + 1);
+    graph.vertex_weights.resize_and_reset(num_vertices);
+    graph.vertex_weights.fill(one<IndexType>());
+    const auto sub_row_ptrs = graph.row_ptrs.get_data();
+    sub_row_ptrs[0] = 0;
+    for (IndexType i = 0; i < num_vertices; i++) {
+        const auto vertex = vertices[i];
+        sub_row_ptrs[i + 1] = sub_row_ptrs[i];
+        for (auto nz = row_ptrs[vertex]; nz < row_ptrs[vertex + 1]; nz++) {
+            if (local_ids[col_idxs[nz]] != invalid_index<IndexType>()) {
+                sub_row_ptrs[i + 1]++;
+            }
+        }
+    }
+    graph.col_idxs.resize_and_reset(sub_row_ptrs[num_vertices]);
+    graph.edge_weights.resize_and_reset(sub_row_ptrs[num_vertices]);
+    graph.edge_weights.fill(one<IndexType>());
+    const auto sub_col_idxs = graph.col_idxs.get_data();
+    for (IndexType i = 0; i < num_vertices; i++) {
+        const auto vertex = vertices[i];
+        auto out = sub_row_ptrs[i];
+        for (auto nz = row_ptrs[vertex]; nz < row_ptrs[vertex + 1]; nz++) {
+            const auto local_id = local_ids[col_idxs[nz]];
+            if (local_id != invalid_index<IndexType>()) {
+                sub_col_idxs[out++] = local_id;
+            }
+        }
+    }
+    for (auto vertex : vertices) {
+        local_ids[vertex] = invalid_index<IndexType>();
+    }
+    return graph;
+}
+
+
+/**
+ * Computes an initial bisection by growing side 0 from the seed vertex,
+ * always adding the vertex that increases the cut the least, until side 0
+ * reaches the target weight.
+ */
+template <typename IndexType>
+void grow_bisection(std::shared_ptr<const Executor> exec,
+                    const weighted_graph<IndexType>& graph,
+                    IndexType target_weight, IndexType seed,
+                    vector<IndexType>& side)
+{
+    const auto num_vertices = graph.get_num_vertices();
+    const auto row_ptrs = graph.row_ptrs.get_const_data();
+    const auto col_idxs = graph.col_idxs.get_const_data();
+    const auto edge_weights = graph.edge_weights.get_const_data();
+    const auto vertex_weights = graph.vertex_weights.get_const_data();
+    side.assign(num_vertices, 1);
+    // gain of moving a vertex from side 1 to side 0
+    vector<IndexType> gains(num_vertices, exec);
+    for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+        gains[vertex] = -std::accumulate(edge_weights + row_ptrs[vertex],
+                                         edge_weights + row_ptrs[vertex + 1],
+                                         IndexType{});
+    }
+    addressable_priority_queue<IndexType, IndexType> queue{
+        exec, static_cast<size_type>(num_vertices)};
+    vector<bool> queued(num_vertices, false, exec);
+    IndexType weight{};
+    IndexType next_unassigned{};
+    auto next = seed;
+    while (weight < target_weight) {
+        if (next == invalid_index<IndexType>()) {
+            if (!queue.empty()) {
+                next = queue.min_node();
+                queue.pop_min();
+                queued[next] = false;
+            } else {
+                // continue in a different connected component
+                while (next_unassigned < num_vertices &&
+                       side[next_unassigned] == 0) {
+                    next_unassigned++;
+                }
+                if (next_unassigned == num_vertices) {
+                    break;
+                }
+                next = next_unassigned;
+            }
+        }
+        // stop if adding the vertex moves us further away from the target
+        if (weight + vertex_weights[next] - target_weight >
+            target_weight - weight) {
+            break;
+        }
+        side[next] = 0;
+        weight += vertex_weights[next];
+        for (auto nz = row_ptrs[next]; nz < row_ptrs[next + 1]; nz++) {
+            const auto neighbor = col_idxs[nz];
+            if (side[neighbor] == 0) {
+                continue;
+            }
+            gains[neighbor] += 2 * edge_weights[nz];
+            if (queued[neighbor]) {
+                queue.update_key(-gains[neighbor], neighbor);
+            } else {
+                queue.insert(-gains[neighbor], neighbor);
+                queued[neighbor] = true;
+            }
+        }
+        next = invalid_index<IndexType>();
+    }
+}
+
+
+/**
+ * Improves a bisection with Fiduccia-Mattheyses passes: boundary vertices are
+ * moved to the other side in the order of their gain as long as the balance
+ * allows it, and the best intermediate state is kept.
+ */
+template <typename IndexType>
+bisection_quality<IndexType> refine_bisection(
+    std::shared_ptr<const Executor> exec,
+    const weighted_graph<IndexType>& graph, IndexType target_weight,
+    IndexType tolerance, vector<IndexType>& side)
+{
+    const auto num_vertices = graph.get_num_vertices();
+    const auto row_ptrs = graph.row_ptrs.get_const_data();
+    const auto col_idxs = graph.col_idxs.get_const_data();
+    const auto edge_weights = graph.edge_weights.get_const_data();
+    const auto vertex_weights = graph.vertex_weights.get_const_data();
+    const auto max_stalled_moves =
+        std::min<IndexType>(std::max<IndexType>(num_vertices / 100, 25), 100);
+    using queue_type = addressable_priority_queue<IndexType, IndexType>;
+    // the queues are ordered by the negative gain of moving the vertices
+    std::array<queue_type, 2> queues{
+        queue_type{exec, static_cast<size_type>(num_vertices)},
+        queue_type{exec, static_cast<size_type>(num_vertices)}};
+    vector<IndexType> gains(num_vertices, exec);
+    vector<bool> queued(num_vertices, exec);
+    vector<bool> locked(num_vertices, exec);
+    vector<IndexType> moves{exec};
+    IndexType weight{};
+    for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+        if (side[vertex] == 0) {
+            weight += vertex_weights[vertex];
+        }
+    }
+    const auto imbalance = [&](IndexType weight) {
+        return weight > target_weight ? weight - target_weight
+                                      : target_weight - weight;
+    };
+    bisection_quality<IndexType> best{};
+    for (int pass = 0; pass < max_refinement_passes; pass++) {
+        IndexType cut{};
+        for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+            IndexType external{};
+            IndexType internal{};
+            for (auto nz = row_ptrs[vertex]; nz < row_ptrs[vertex + 1]; nz++) {
+                if (side[col_idxs[nz]] != side[vertex]) {
+                    external += edge_weights[nz];
+                } else {
+                    internal += edge_weights[nz];
+                }
+            }
+            gains[vertex] = external - internal;
+            cut += external;
+            queued[vertex] = external > 0;
+            locked[vertex] = false;
+            if (queued[vertex]) {
+                queues[side[vertex]].insert(-gains[vertex], vertex);
+            }
+        }
+        best = {cut / 2, imbalance(weight)};
+        auto current = best;
+        size_type best_num_moves{};
+        IndexType stalled_moves{};
+        moves.clear();
+        while (true) {
+            int from = -1;
+            IndexType from_gain{};
+            IndexType from_imbalance{};
+            for (int candidate = 0; candidate < 2; candidate++) {
+                if (queues[candidate].empty()) {
+                    continue;
+                }
+                const auto vertex = queues[candidate].min_node();
+                const auto gain = -queues[candidate].min_key();
+                const auto new_imbalance =
+                    imbalance(candidate == 0 ? weight - vertex_weights[vertex]
+                                             : weight + vertex_weights[vertex]);
+                if (new_imbalance > tolerance &&
+                    new_imbalance >= current.imbalance) {
+                    continue;
+                }
+                if (from < 0 || gain > from_gain ||
+                    (gain == from_gain && new_imbalance < from_imbalance)) {
+                    from = candidate;
+                    from_gain = gain;
+                    from_imbalance = new_imbalance;
+                }
+            }
+            if (from < 0) {
+                break;
+            }
+            const auto vertex = queues[from].min_node();
+            queues[from].pop_min();
+            queued[vertex] = false;
+            locked[vertex] = true;
+            side[vertex] = 1 - from;
+            weight += from == 0 ? -vertex_weights[vertex]
+                                : vertex_weights[vertex];
+            current = {current.cut - from_gain, from_imbalance};
+            moves.push_back(vertex);
+            for (auto nz = row_ptrs[vertex]; nz < row_ptrs[vertex + 1]; nz++) {
+                const auto neighbor = col_idxs[nz];
+                if (locked[neighbor]) {
+                    continue;
+                }
+                if (side[neighbor] == side[vertex]) {
+                    gains[neighbor] -= 2 * edge_weights[nz];
+                } else {
+                    gains[neighbor] += 2 * edge_weights[nz];
+                }
+                if (queued[neighbor]) {
+                    queues[side[neighbor]].update_key(-gains[neighbor],
+                                                      neighbor);
+                } else if (side[neighbor] != side[vertex]) {
+                    queues[side[neighbor]].insert(-gains[neighbor], neighbor);
+                    queued[neighbor] = true;
+                }
+            }
+            if (is_better(current, best, tolerance)) {
+                best = current;
+                best_num_moves = moves.size();
+                stalled_moves = 0;
+            } else if (++stalled_moves > max_stalled_moves) {
+                break;
+            }
+        }
+        // roll back the moves after the best state
+        for (auto i = moves.size(); i > best_num_moves; i--) {
+            const auto vertex = moves[i - 1];
+            weight += side[vertex] == 0 ? -vertex_weights[vertex]
+                                        : vertex_weights[vertex];
+            side[vertex] = 1 - side[vertex];
+        }
+        queues[0].reset();
+        queues[1].reset();
+        if (best_num_moves == 0) {
+            break;
+        }
+    }
+    return best;
+}
+
+
+/**
+ * Computes a multilevel bisection of the graph where side 0 has roughly the
+ * given target weight.
+ */
+template <typename IndexType>
+void bisect(std::shared_ptr<const Executor> exec,
+            const weighted_graph<IndexType>& graph, IndexType target_weight,
+            vector<IndexType>& side)
+{
+    const auto total_weight = graph.get_total_weight();
+    const auto tolerance = std::max(
+        static_cast<IndexType>(max_imbalance * total_weight), IndexType{1});
+    const auto max_vertex_weight =
+        std::max(static_cast<IndexType>(1.5 * total_weight /
+                                         coarsest_graph_size),
+                 IndexType{1});
+    std::deque<weighted_graph<IndexType>> levels;
+    std::deque<array<IndexType>> coarse_maps;
+    auto current = &graph;
+    while (current->get_num_vertices() > coarsest_graph_size) {
+        const auto num_vertices = current->get_num_vertices();
+        array<IndexType> match{exec, static_cast<size_type>(num_vertices)};
+        array<IndexType> coarse_map{exec, static_cast<size_type>(num_vertices)};
+        weighted_graph<IndexType> coarse{exec};
+        exec->run(make_match_edges(
+            exec, num_vertices, current->row_ptrs.get_const_data(),
+            current->col_idxs.get_const_data(),
+            current->edge_weights.get_const_data(),
+            current->vertex_weights.get_const_data(), max_vertex_weight,
+            match.get_data()));
+        exec->run(make_contract_graph(
+            exec, num_vertices, current->row_ptrs.get_const_data(),
+            current->col_idxs.get_const_data(),
+            current->edge_weights.get_const_data(),
+            current->vertex_weights.get_const_data(), match.get_const_data(),
+            coarse_map.get_data(), coarse.row_ptrs, coarse.col_idxs,
+            coarse.edge_weights, coarse.vertex_weights));
+        if (coarse.get_num_vertices() > min_coarsening_ratio * num_vertices) {
+            break;
+        }
+        levels.push_back(std::move(coarse));
+        coarse_maps.push_back(std::move(coarse_map));
+        current = &levels.back();
+    }
+    // bisect the coarsest graph from several seeds and keep the best result
+    const auto coarsest_num_vertices = current->get_num_vertices();
+    const auto coarsest_tolerance =
+        std::max(tolerance, current->get_max_vertex_weight());
+    vector<IndexType> candidate{exec};
+    bisection_quality<IndexType> best{};
+    side.clear();
+    for (IndexType attempt = 0; attempt < num_initial_bisections &&
+                                attempt < coarsest_num_vertices;
+         attempt++) {
+        const auto seed = static_cast<IndexType>(
+            static_cast<int64>(attempt) * coarsest_num_vertices /
+            num_initial_bisections);
+        grow_bisection(exec, *current, target_weight, seed, candidate);
+        const auto quality = refine_bisection(exec, *current, target_weight,
+                                              coarsest_tolerance, candidate);
+        if (attempt == 0 || is_better(quality, best, coarsest_tolerance)) {
+            best = quality;
+            side = candidate;
+        }
+    }
+    // project the bisection back to the finer levels and refine it there
+    for (auto level = levels.size(); level > 0; level--) {
+        const auto& fine = level > 1 ? levels[level - 2] : graph;
+        const auto coarse_map = coarse_maps[level - 1].get_const_data();
+        candidate.resize(fine.get_num_vertices());
+        for (IndexType vertex = 0; vertex < fine.get_num_vertices();
+             vertex++) {
+            candidate[vertex] = side[coarse_map[vertex]];
+        }
+        std::swap(side, candidate);
+        refine_bisection(exec, fine, target_weight,
+                         std::max(tolerance, fine.get_max_vertex_weight()),
+                         side);
+    }
+}
+
+
+}  // namespace
+
+
+template <typename IndexType>
+void partition_graph(std::shared_ptr<const Executor> host_exec,
+                     IndexType num_vertices, const IndexType* row_ptrs,
+                     const IndexType* col_idxs, IndexType num_parts,
+                     IndexType* parts)
+{
+    struct task {
+        vector<IndexType> vertices;
+        IndexType first_part;
+        IndexType num_parts;
+    };
+    vector<IndexType> local_ids(num_vertices, invalid_index<IndexType>(),
+                                host_exec);
+    vector<IndexType> all_vertices(num_vertices, host_exec);
+    std::iota(all_vertices.begin(), all_vertices.end(), IndexType{});
+    std::vector<task> tasks;
+    tasks.push_back({std::move(all_vertices), 0, num_parts});
+    vector<IndexType> side{host_exec};
+    // recursive bisection, processed depth-first
+    while (!tasks.empty()) {
+        auto current = std::move(tasks.back());
+        tasks.pop_back();
+        if (current.num_parts <= 1 || current.vertices.empty()) {
+            for (auto vertex : current.vertices) {
+                parts[vertex] = current.first_part;
+            }
+            continue;
+        }
+        const auto subgraph = extract_subgraph(
+            host_exec, row_ptrs, col_idxs, current.vertices, local_ids);
+        const auto first_num_parts = current.num_parts / 2;
+        const auto target_weight = static_cast<IndexType>(
+            static_cast<int64>(current.vertices.size()) * first_num_parts /
+            current.num_parts);
+        bisect(host_exec, subgraph, target_weight, side);
+        task first{vector<IndexType>{host_exec}, current.first_part,
+                   first_num_parts};
+        task second{vector<IndexType>{host_exec},
+                    current.first_part + first_num_parts,
+                    current.num_parts - first_num_parts};
+        for (size_type i = 0; i < current.vertices.size(); i++) {
+            (side[i] == 0 ? first : second)
+                .vertices.push_back(current.vertices[i]);
+        }
+        tasks.push_back(std::move(second));
+        tasks.push_back(std::move(first));
+    }
+}
+
+#define GKO_DECLARE_GRAPH_PARTITION_PARTITION_GRAPH(IndexType)              \
+    void partition_graph(std::shared_ptr<const Executor> host_exec,         \
+                         IndexType num_vertices, const IndexType* row_ptrs, \
+                         const IndexType* col_idxs, IndexType num_parts,    \
+                         IndexType* parts)
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_GRAPH_PARTITION_PARTITION_GRAPH);
+
+
+template <typename IndexType>
+void nested_dissection(std::shared_ptr<const Executor> host_exec,
+                       IndexType num_vertices, const IndexType* row_ptrs,
+                       const IndexType* col_idxs, IndexType max_leaf_size,
+                       IndexType* permutation)
+{
+    struct task {
+        vector<IndexType> vertices;
+        IndexType begin;
+    };
+    vector<IndexType> local_ids(num_vertices, invalid_index<IndexType>(),
+                                host_exec);
+    vector<IndexType> all_vertices(num_vertices, host_exec);
+    std::iota(all_vertices.begin(), all_vertices.end(), IndexType{});
+    std::vector<task> tasks;
+    tasks.push_back({std::move(all_vertices), 0});
+    vector<IndexType> side{host_exec};
+    vector<bool> is_boundary{host_exec};
+    while (!tasks.empty()) {
+        auto current = std::move(tasks.back());
+        tasks.pop_back();
+        const auto num_task_vertices =
+            static_cast<IndexType>(current.vertices.size());
+        if (num_task_vertices > max_leaf_size) {
+            const auto subgraph = extract_subgraph(
+                host_exec, row_ptrs, col_idxs, current.vertices, local_ids);
+            bisect(host_exec, subgraph, num_task_vertices / 2, side);
+            // the boundary of the side with fewer boundary vertices
+            // separates both sides, unless it contains the whole side
+            const auto sub_row_ptrs = subgraph.row_ptrs.get_const_data();
+            const auto sub_col_idxs = subgraph.col_idxs.get_const_data();
+            std::array<IndexType, 2> boundary_sizes{};
+            std::array<IndexType, 2> side_sizes{};
+            is_boundary.assign(num_task_vertices, false);
+            for (IndexType i = 0; i < num_task_vertices; i++) {
+                side_sizes[side[i]]++;
+                for (auto nz = sub_row_ptrs[i]; nz < sub_row_ptrs[i + 1];
+                     nz++) {
+                    if (side[sub_col_idxs[nz]] != side[i]) {
+                        is_boundary[i] = true;
+                        boundary_sizes[side[i]]++;
+                        break;
+                    }
+                }
+            }
+            const std::array<bool, 2> keeps_side{
+                boundary_sizes[0] < side_sizes[0],
+                boundary_sizes[1] < side_sizes[1]};
+            const auto separator_side =
+                keeps_side[0] != keeps_side[1]
+                    ? (keeps_side[0] ? 0 : 1)
+                    : (boundary_sizes[0] <= boundary_sizes[1] ? 0 : 1);
+            task first{vector<IndexType>{host_exec}, current.begin};
+            task second{vector<IndexType>{host_exec}, 0};
+            vector<IndexType> separator{host_exec};
+            for (IndexType i = 0; i < num_task_vertices; i++) {
+                const auto vertex = current.vertices[i];
+                if (side[i] == separator_side && is_boundary[i]) {
+                    separator.push_back(vertex);
+                } else {
+                    (side[i] == 0 ? first : second).vertices.push_back(vertex);
+                }
+            }
+            // only recurse if the bisection actually split the graph
+            if (!first.vertices.empty() && !second.vertices.empty()) {
+                second.begin = current.begin +
+                               static_cast<IndexType>(first.vertices.size());
+                std::copy(separator.begin(), separator.end(),
+                          permutation + second.begin +
+                              second.vertices.size());
+                tasks.push_back(std::move(second));
+                tasks.push_back(std::move(first));
+                continue;
+            }
+        }
+        // leaves keep their original order
+        std::copy(current.vertices.begin(), current.vertices.end(),
+                  permutation + current.begin);
+    }
+}
+
+#define GKO_DECLARE_GRAPH_PARTITION_NESTED_DISSECTION(IndexType)               \
+    void nested_dissection(std::shared_ptr<const Executor> host_exec,          \
+                           IndexType num_vertices, const IndexType* row_ptrs,  \
+                           const IndexType* col_idxs, IndexType max_leaf_size, \
+                           IndexType* permutation)
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_GRAPH_PARTITION_NESTED_DISSECTION);
+
+
+}  // namespace graph_partition
+}  // namespace reorder
+}  // namespace experimental
+}  // namespace gko
@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_REORDER_GRAPH_PARTITION_HPP_
+#define GKO_CORE_REORDER_GRAPH_PARTITION_HPP_
+
+
+#include <memory>
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+namespace experimental {
+namespace reorder {
+namespace graph_partition {
+
+
+/**
+ * Partitions the vertices of an undirected graph into parts of roughly equal
+ * size while keeping the number of edges between different parts small.
+ *
+ * The partition is computed by recursive multilevel bisection: the graph is
+ * coarsened by contracting heavy-edge matchings, the coarsest graph is
+ * bisected by greedy graph growing, and the bisection is refined with
+ * Fiduccia-Mattheyses passes while it is projected back to the finer graphs.
+ * The result is deterministic and does not depend on the number of threads.
+ *
+ * @param host_exec  the host executor used to run the coarsening kernels
+ * @param num_vertices  the number of vertices
+ * @param row_ptrs  the row pointers of the symmetric adjacency matrix
+ * @param col_idxs  the column indices of the symmetric adjacency matrix,
+ *                  which must not contain self loops
+ * @param num_parts  the number of parts
+ * @param parts  the output array mapping every vertex to its part
+ */
+template <typename IndexType>
+void partition_graph(std::shared_ptr<const Executor> host_exec,
+                     IndexType num_vertices, const IndexType* row_ptrs,
+                     const IndexType* col_idxs, IndexType num_parts,
+                     IndexType* parts);
+
+
+/**
+ * Computes a fill-reducing nested dissection ordering of an undirected graph.
+ *
+ * Every subgraph larger than max_leaf_size is bisected like in
+ * partition_graph, and the boundary vertices of the smaller side of the cut
+ * are used as a vertex separator, which is ordered after both halves. Smaller
+ * subgraphs keep their original order.
+ *
+ * @param host_exec  the host executor used to run the coarsening kernels
+ * @param num_vertices  the number of vertices
+ * @param row_ptrs  the row pointers of the symmetric adjacency matrix
+ * @param col_idxs  the column indices of the symmetric adjacency matrix,
+ *                  which must not contain self loops
+ * @param max_leaf_size  the largest subgraph that is not dissected further
+ * @param permutation  the output permutation, mapping new to old indices
+ */
+template <typename IndexType>
+void nested_dissection(std::shared_ptr<const Executor> host_exec,
+                       IndexType num_vertices, const IndexType* row_ptrs,
+                       const IndexType* col_idxs, IndexType max_leaf_size,
+                       IndexType* permutation);
+
+
+}  // namespace graph_partition
+}  // namespace reorder
+}  // namespace experimental
+}  // namespace gko
+
+
+#endif  // GKO_CORE_REORDER_GRAPH_PARTITION_HPP_
@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_REORDER_GRAPH_PARTITION_KERNELS_HPP_
+#define GKO_CORE_REORDER_GRAPH_PARTITION_KERNELS_HPP_
+
+
+#include <memory>
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+#include "core/base/kernel_declaration.hpp"
+
+
+namespace gko {
+namespace kernels {
+
+
+/**
+ * Computes a heavy-edge matching of a weighted undirected graph without self
+ * loops. Every vertex is matched to at most one neighbor such that the
+ * combined vertex weight does not exceed max_vertex_weight. Ties between
+ * edges of equal weight are broken by a hash of their end points, so the
+ * result is deterministic. Unmatched vertices are matched to themselves.
+ */
+#define GKO_DECLARE_GRAPH_PARTITION_MATCH_EDGES_KERNEL(IndexType)       \
+    void match_edges(std::shared_ptr<const DefaultExecutor> exec,       \
+                     IndexType num_vertices, const IndexType* row_ptrs, \
+                     const IndexType* col_idxs,                         \
+                     const IndexType* edge_weights,                     \
+                     const IndexType* vertex_weights,                   \
+                     IndexType max_vertex_weight, IndexType* match)
+
+/**
+ * Contracts every matched pair of vertices into a single coarse vertex.
+ * Coarse vertices are numbered in the order of their smaller fine vertex,
+ * vertex and edge weights of the coarse graph are sums of the fine weights.
+ */
+#define GKO_DECLARE_GRAPH_PARTITION_CONTRACT_GRAPH_KERNEL(IndexType)          \
+    void contract_graph(                                                      \
+        std::shared_ptr<const DefaultExecutor> exec, IndexType num_vertices,  \
+        const IndexType* row_ptrs, const IndexType* col_idxs,                 \
+        const IndexType* edge_weights, const IndexType* vertex_weights,       \
+        const IndexType* match, IndexType* coarse_map,                        \
+        array<IndexType>& coarse_row_ptrs, array<IndexType>& coarse_col_idxs, \
+        array<IndexType>& coarse_edge_weights,                                \
+        array<IndexType>& coarse_vertex_weights)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                           \
+    template <typename IndexType>                              \
+    GKO_DECLARE_GRAPH_PARTITION_MATCH_EDGES_KERNEL(IndexType); \
+    template <typename IndexType>                              \
+    GKO_DECLARE_GRAPH_PARTITION_CONTRACT_GRAPH_KERNEL(IndexType)
+
+
+// the partitioner only runs on the host, so there are only host kernels
+namespace omp {
+namespace graph_partition {
+
+GKO_DECLARE_ALL_AS_TEMPLATES;
+
+}  // namespace graph_partition
+}  // namespace omp
+
+
+namespace reference {
+namespace graph_partition {
+
+GKO_DECLARE_ALL_AS_TEMPLATES;
+
+}  // namespace graph_partition
+}  // namespace reference
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_REORDER_GRAPH_PARTITION_KERNELS_HPP_
@@ -4,8 +4,10 @@
 
 #include "ginkgo/core/reorder/nested_dissection.hpp"
 
+#include <algorithm>
 #include <memory>
 
+#include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/base/temporary_clone.hpp>
 #include <ginkgo/core/matrix/sparsity_csr.hpp>
@@ -17,6 +19,7 @@
 
 
 #include "core/base/allocator.hpp"
+#include "core/reorder/graph_partition.hpp"
 
 
 namespace gko {
@@ -25,6 +28,9 @@ namespace reorder {
 namespace {
 
 
+#if GKO_HAVE_METIS
+
+
 std::string metis_error_message(idx_t metis_error)
 {
     switch (metis_error) {
@@ -105,6 +111,12 @@ void metis_nd<idx_t>(std::shared_ptr<const Executor> host_exec,
 GKO_REGISTER_HOST_OPERATION(metis_nd, metis_nd);
 
 
+#endif  // GKO_HAVE_METIS
+
+
+GKO_REGISTER_HOST_OPERATION(native_nd, graph_partition::nested_dissection);
+
+
 }  // namespace
 
 
@@ -145,12 +157,25 @@ std::unique_ptr<LinOp> NestedDissection<ValueType, IndexType>::generate_impl(
     const auto host_mtx = make_temporary_clone(host_exec, sparsity_mtx);
     const auto num_rows = host_mtx->get_size()[0];
     array<IndexType> permutation(host_exec, num_rows);
-    array<IndexType> inv_permutation(host_exec, num_rows);
-    exec->run(make_metis_nd(host_exec, num_rows, host_mtx->get_const_row_ptrs(),
-                            host_mtx->get_const_col_idxs(),
-                            build_metis_options(parameters_.options),
-                            permutation.get_data(),
-                            inv_permutation.get_data()));
+    if (parameters_.use_metis) {
+#if GKO_HAVE_METIS
+        array<IndexType> inv_permutation(host_exec, num_rows);
+        exec->run(make_metis_nd(
+            host_exec, num_rows, host_mtx->get_const_row_ptrs(),
+            host_mtx->get_const_col_idxs(),
+            build_metis_options(parameters_.options), permutation.get_data(),
+            inv_permutation.get_data()));
+#else
+        GKO_NOT_COMPILED(metis);
+#endif
+    } else {
+        exec->run(make_native_nd(
+            host_exec, static_cast<IndexType>(num_rows),
+            host_mtx->get_const_row_ptrs(), host_mtx->get_const_col_idxs(),
+            static_cast<IndexType>(
+                std::min(parameters_.max_leaf_size, num_rows)),
+            permutation.get_data()));
+    }
     permutation.set_executor(exec);
     // we discard the inverse permutation
     return permutation_type::create(exec, std::move(permutation));
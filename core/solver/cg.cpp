@@ -11,7 +11,11 @@
 #include <ginkgo/core/base/name_demangling.hpp>
 #include <ginkgo/core/base/precision_dispatch.hpp>
 #include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/identity.hpp>
+#include <ginkgo/core/preconditioner/jacobi.hpp>
 
+#include "core/base/dispatch_helper.hpp"
 #include "core/config/solver_config.hpp"
 #include "core/distributed/helpers.hpp"
 #include "core/solver/cg_kernels.hpp"
@@ -27,6 +31,56 @@ namespace {
 GKO_REGISTER_OPERATION(initialize, cg::initialize);
 GKO_REGISTER_OPERATION(step_1, cg::step_1);
 GKO_REGISTER_OPERATION(step_2, cg::step_2);
+GKO_REGISTER_OPERATION(fused_step_1, cg::fused_step_1);
+GKO_REGISTER_OPERATION(spmv_dot, cg::spmv_dot);
+GKO_REGISTER_OPERATION(fused_step_2, cg::fused_step_2);
+
+
+template <typename ValueType, typename IndexType>
+bool get_scalar_jacobi_diagonal(const LinOp* preconditioner,
+                                const ValueType*& inv_diag)
+{
+    auto jacobi =
+        dynamic_cast<const preconditioner::Jacobi<ValueType, IndexType>*>(
+            preconditioner);
+    if (jacobi && jacobi->get_parameters().max_block_size == 1) {
+        inv_diag = jacobi->get_blocks();
+        return true;
+    }
+    return false;
+}
+
+
+/**
+ * Checks whether the fused CG iteration can be used for the given system
+ * matrix and preconditioner. The fused kernels apply the preconditioner as a
+ * diagonal scaling, inv_diag is set to the inverted diagonal, or to nullptr
+ * for the identity.
+ */
+template <typename ValueType>
+bool is_fusable(std::shared_ptr<const Executor> exec,
+                const LinOp* system_matrix, const LinOp* preconditioner,
+                const ValueType*& inv_diag)
+{
+    // the fused SpMV is a plain row-parallel kernel, it only pays off for
+    // the bandwidth-bound host executors
+    if (exec != exec->get_master() || system_matrix->get_executor() != exec ||
+        preconditioner->get_executor() != exec) {
+        return false;
+    }
+    if (!dynamic_cast<const matrix::Csr<ValueType, int32>*>(system_matrix) &&
+        !dynamic_cast<const matrix::Csr<ValueType, int64>*>(system_matrix)) {
+        return false;
+    }
+    if (dynamic_cast<const matrix::Identity<ValueType>*>(preconditioner)) {
+        inv_diag = nullptr;
+        return true;
+    }
+    return get_scalar_jacobi_diagonal<ValueType, int32>(preconditioner,
+                                                        inv_diag) ||
+           get_scalar_jacobi_diagonal<ValueType, int64>(preconditioner,
+                                                        inv_diag);
+}
 
 
 }  // anonymous namespace
@@ -125,6 +179,21 @@ void Cg<ValueType>::apply_dense_impl(const VectorType* dense_b,
         this->get_system_matrix(),
         std::shared_ptr<const LinOp>(dense_b, [](const LinOp*) {}), dense_x, r);
 
+    // For non-distributed vectors with a Csr matrix and an identity or scalar
+    // Jacobi preconditioner, the preconditioner application and the dot
+    // products are fused into the SpMV and vector update kernels.
+    const ValueType* inv_diag{};
+    const auto use_fused =
+        std::is_same<VectorType, LocalVector>::value &&
+        cg::is_fusable(exec, this->get_system_matrix().get(),
+                       this->get_preconditioner().get(), inv_diag);
+    if (use_fused) {
+        // z = preconditioner * r
+        this->get_preconditioner()->apply(r, z);
+        // rho = dot(r, z)
+        r->compute_conj_dot(z, rho, reduction_tmp);
+    }
+
     int iter = -1;
     /* Memory movement summary:
      * 18n * values + matrix/preconditioner storage
@@ -134,12 +203,21 @@ void Cg<ValueType>::apply_dense_impl(const VectorType* dense_b,
      * 1x step 1 (axpy)   3n
      * 1x step 2 (axpys)  6n
      * 1x norm2 residual   n
+     *
+     * Fused iteration:
+     * 12n * values + matrix storage (+ 2n for the Jacobi diagonal)
+     * 1x fused step 1:   3n
+     * 1x SpMV + dot:     2n * values + storage
+     * 1x fused step 2:   6n
+     * 1x norm2 residual   n
      */
     while (true) {
-        // z = preconditioner * r
-        this->get_preconditioner()->apply(r, z);
-        // rho = dot(r, z)
-        r->compute_conj_dot(z, rho, reduction_tmp);
+        if (!use_fused) {
+            // z = preconditioner * r
+            this->get_preconditioner()->apply(r, z);
+            // rho = dot(r, z)
+            r->compute_conj_dot(z, rho, reduction_tmp);
+        }
 
         ++iter;
         bool all_stopped =
@@ -156,6 +234,32 @@ void Cg<ValueType>::apply_dense_impl(const VectorType* dense_b,
             break;
         }
 
+        if (use_fused) {
+            auto local_r = gko::detail::get_local(r);
+            auto local_p = gko::detail::get_local(p);
+            auto local_q = gko::detail::get_local(q);
+            // tmp = rho / prev_rho
+            // p = inv_diag * r + tmp * p
+            exec->run(cg::make_fused_step_1(local_p, local_r, inv_diag, rho,
+                                            prev_rho, &stop_status));
+            // q = A * p
+            // beta = dot(p, q)
+            run<matrix::Csr<ValueType, int32>, matrix::Csr<ValueType, int64>>(
+                this->get_system_matrix().get(), [&](auto mtx) {
+                    exec->run(cg::make_spmv_dot(mtx, local_p, local_q, beta,
+                                                reduction_tmp));
+                });
+            swap(prev_rho, rho);
+            // tmp = prev_rho / beta
+            // x = x + tmp * p
+            // r = r - tmp * q
+            // rho = dot(r, inv_diag * r)
+            exec->run(cg::make_fused_step_2(
+                gko::detail::get_local(dense_x), local_r, local_p, local_q,
+                inv_diag, beta, prev_rho, rho, reduction_tmp, &stop_status));
+            continue;
+        }
+
         // tmp = rho / prev_rho
         // p = z + tmp * p
         exec->run(cg::make_step_1(gko::detail::get_local(p),
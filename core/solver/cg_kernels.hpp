@@ -11,6 +11,7 @@
 #include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/math.hpp>
 #include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/stop/stopping_status.hpp>
 
@@ -48,13 +49,46 @@ namespace cg {
                 const array<stopping_status>* stop_status)
 
 
-#define GKO_DECLARE_ALL_AS_TEMPLATES             \
-    template <typename ValueType>                \
-    GKO_DECLARE_CG_INITIALIZE_KERNEL(ValueType); \
-    template <typename ValueType>                \
-    GKO_DECLARE_CG_STEP_1_KERNEL(ValueType);     \
-    template <typename ValueType>                \
-    GKO_DECLARE_CG_STEP_2_KERNEL(ValueType)
+#define GKO_DECLARE_CG_FUSED_STEP_1_KERNEL(_type)                             \
+    void fused_step_1(std::shared_ptr<const DefaultExecutor> exec,            \
+                      matrix::Dense<_type>* p, const matrix::Dense<_type>* r, \
+                      const _type* inv_diag, const matrix::Dense<_type>* rho, \
+                      const matrix::Dense<_type>* prev_rho,                   \
+                      const array<stopping_status>* stop_status)
+
+
+#define GKO_DECLARE_CG_SPMV_DOT_KERNEL(_vtype, _itype)                      \
+    void spmv_dot(std::shared_ptr<const DefaultExecutor> exec,              \
+                  const matrix::Csr<_vtype, _itype>* a,                     \
+                  const matrix::Dense<_vtype>* p, matrix::Dense<_vtype>* q, \
+                  matrix::Dense<_vtype>* beta, array<char>& tmp)
+
+
+#define GKO_DECLARE_CG_FUSED_STEP_2_KERNEL(_type)                       \
+    void fused_step_2(std::shared_ptr<const DefaultExecutor> exec,      \
+                      matrix::Dense<_type>* x, matrix::Dense<_type>* r, \
+                      const matrix::Dense<_type>* p,                    \
+                      const matrix::Dense<_type>* q,                    \
+                      const _type* inv_diag,                            \
+                      const matrix::Dense<_type>* beta,                 \
+                      const matrix::Dense<_type>* prev_rho,             \
+                      matrix::Dense<_type>* rho, array<char>& tmp,      \
+                      const array<stopping_status>* stop_status)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                      \
+    template <typename ValueType>                         \
+    GKO_DECLARE_CG_INITIALIZE_KERNEL(ValueType);          \
+    template <typename ValueType>                         \
+    GKO_DECLARE_CG_STEP_1_KERNEL(ValueType);              \
+    template <typename ValueType>                         \
+    GKO_DECLARE_CG_STEP_2_KERNEL(ValueType);              \
+    template <typename ValueType>                         \
+    GKO_DECLARE_CG_FUSED_STEP_1_KERNEL(ValueType);        \
+    template <typename ValueType, typename IndexType>     \
+    GKO_DECLARE_CG_SPMV_DOT_KERNEL(ValueType, IndexType); \
+    template <typename ValueType>                         \
+    GKO_DECLARE_CG_FUSED_STEP_2_KERNEL(ValueType)
 
 
 }  // namespace cg
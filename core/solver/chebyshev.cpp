@@ -0,0 +1,498 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "ginkgo/core/solver/chebyshev.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/utils.hpp>
+
+#include "core/config/config_helper.hpp"
+#include "core/config/solver_config.hpp"
+#include "core/distributed/helpers.hpp"
+#include "core/solver/chebyshev_kernels.hpp"
+#include "core/solver/ir_kernels.hpp"
+#include "core/solver/solver_base.hpp"
+#include "core/solver/solver_boilerplate.hpp"
+
+
+namespace gko {
+namespace solver {
+namespace chebyshev {
+namespace {
+
+
+GKO_REGISTER_OPERATION(initialize, ir::initialize);
+GKO_REGISTER_OPERATION(init_update, chebyshev::init_update);
+GKO_REGISTER_OPERATION(update, chebyshev::update);
+
+
+/**
+ * Computes the smallest and largest eigenvalue of the symmetric tridiagonal
+ * matrix with the given diagonal and off-diagonal by bisection on its Sturm
+ * sequence.
+ */
+template <typename RealType>
+std::pair<RealType, RealType> tridiagonal_extreme_eigenvalues(
+    const std::vector<RealType>& diag, const std::vector<RealType>& off_diag)
+{
+    const auto size = diag.size();
+    // the Gershgorin discs contain all eigenvalues
+    auto lower = diag[0];
+    auto upper = diag[0];
+    for (size_type i = 0; i < size; i++) {
+        const auto radius = (i > 0 ? abs(off_diag[i - 1]) : RealType{}) +
+                            (i + 1 < size ? abs(off_diag[i]) : RealType{});
+        lower = std::min(lower, diag[i] - radius);
+        upper = std::max(upper, diag[i] + radius);
+    }
+    // the number of negative pivots of the LDL^T factorization of T - shift I
+    // is the number of eigenvalues smaller than shift
+    const auto count_below = [&](RealType shift) {
+        size_type count{};
+        RealType pivot{1};
+        for (size_type i = 0; i < size; i++) {
+            pivot = diag[i] - shift -
+                    (i > 0 ? off_diag[i - 1] * off_diag[i - 1] / pivot
+                           : RealType{});
+            if (pivot == RealType{}) {
+                pivot = std::numeric_limits<RealType>::min();
+            }
+            count += pivot < RealType{} ? 1 : 0;
+        }
+        return count;
+    };
+    const auto bisect = [&](size_type index) {
+        auto left = lower;
+        auto right = upper;
+        while (true) {
+            const auto mid = (left + right) / 2;
+            if (mid <= left || mid >= right) {
+                return mid;
+            }
+            if (count_below(mid) > index) {
+                right = mid;
+            } else {
+                left = mid;
+            }
+        }
+    };
+    return {bisect(0), bisect(size - 1)};
+}
+
+
+/**
+ * Estimates the extreme eigenvalues of preconditioner * system_matrix by the
+ * Ritz values of the preconditioned Lanczos method. It requires both
+ * operators to be symmetric (hermitian) and the preconditioner to be positive
+ * definite.
+ */
+template <typename ValueType>
+std::pair<remove_complex<ValueType>, remove_complex<ValueType>>
+estimate_extreme_eigenvalues(const LinOp* system_matrix,
+                             const LinOp* preconditioner,
+                             size_type max_iterations)
+{
+    using Vector = matrix::Dense<ValueType>;
+    using real_type = remove_complex<ValueType>;
+    auto exec = system_matrix->get_executor();
+    const dim<2> vector_size{system_matrix->get_size()[0], 1};
+    // the fixed seed makes the estimate reproducible
+    std::default_random_engine engine{42};
+    std::uniform_real_distribution<double> dist{-1.0, 1.0};
+    auto host_v = Vector::create(exec->get_master(), vector_size);
+    for (size_type row = 0; row < vector_size[0]; row++) {
+        host_v->at(row, 0) = static_cast<ValueType>(dist(engine));
+    }
+    auto v = gko::clone(exec, host_v);
+    auto v_prev = Vector::create(exec, vector_size);
+    auto w = Vector::create(exec, vector_size);
+    auto u = Vector::create(exec, vector_size);
+    auto dot = Vector::create(exec, dim<2>{1, 1});
+    auto scalar = Vector::create(exec, dim<2>{1, 1});
+    const auto conj_dot = [&](const Vector* a, const Vector* b) {
+        a->compute_conj_dot(b, dot);
+        return real(exec->copy_val_to_host(dot->get_const_values()));
+    };
+    const auto apply_preconditioner = [&](const Vector* in, Vector* out) {
+        if (preconditioner->apply_uses_initial_guess()) {
+            out->fill(zero<ValueType>());
+        }
+        preconditioner->apply(in, out);
+    };
+    // v is the Lanczos vector of the M^-1 inner product and w = M v
+    apply_preconditioner(v.get(), w.get());
+    auto beta = std::sqrt(conj_dot(v.get(), w.get()));
+    if (!(beta > zero<real_type>())) {
+        return {zero<real_type>(), zero<real_type>()};
+    }
+    scalar->fill(one<ValueType>() / static_cast<ValueType>(beta));
+    v->scale(scalar);
+    w->scale(scalar);
+    v_prev->fill(zero<ValueType>());
+    beta = zero<real_type>();
+    std::vector<real_type> diag;
+    std::vector<real_type> off_diag;
+    for (size_type iter = 0; iter < max_iterations; iter++) {
+        system_matrix->apply(w, u);
+        const auto alpha = conj_dot(w.get(), u.get());
+        diag.push_back(alpha);
+        if (iter + 1 == max_iterations) {
+            break;
+        }
+        // u = A w - alpha v - beta v_prev
+        scalar->fill(static_cast<ValueType>(-alpha));
+        u->add_scaled(scalar, v);
+        scalar->fill(static_cast<ValueType>(-beta));
+        u->add_scaled(scalar, v_prev);
+        apply_preconditioner(u.get(), w.get());
+        beta = std::sqrt(conj_dot(u.get(), w.get()));
+        // stop on an invariant subspace, the Ritz values are exact then
+        if (!(beta > std::numeric_limits<real_type>::epsilon() * abs(alpha))) {
+            break;
+        }
+        off_diag.push_back(beta);
+        std::swap(v, v_prev);
+        scalar->fill(one<ValueType>() / static_cast<ValueType>(beta));
+        v->copy_from(u);
+        v->scale(scalar);
+        w->scale(scalar);
+    }
+    return tridiagonal_extreme_eigenvalues(diag, off_diag);
+}
+
+
+}  // anonymous namespace
+}  // namespace chebyshev
+
+
+template <typename ValueType>
+typename Chebyshev<ValueType>::parameters_type Chebyshev<ValueType>::parse(
+    const config::pnode& config, const config::registry& context,
+    const config::type_descriptor& td_for_child)
+{
+    auto params = solver::Chebyshev<ValueType>::build();
+    common_solver_parse(params, config, context, td_for_child);
+    if (auto& obj = config.get("foci")) {
+        const auto& arr = obj.get_array();
+        if (arr.size() != 2) {
+            GKO_INVALID_STATE(
+                "The entry >foci< needs to be an array of two values");
+        }
+        params.with_foci(gko::config::get_value<ValueType>(arr.at(0)),
+                         gko::config::get_value<ValueType>(arr.at(1)));
+    }
+    if (auto& obj = config.get("num_estimation_iterations")) {
+        params.with_num_estimation_iterations(
+            gko::config::get_value<size_type>(obj));
+    }
+    if (auto& obj = config.get("max_eigenvalue_scale")) {
+        params.with_max_eigenvalue_scale(
+            gko::config::get_value<remove_complex<ValueType>>(obj));
+    }
+    if (auto& obj = config.get("min_eigenvalue_ratio")) {
+        params.with_min_eigenvalue_ratio(
+            gko::config::get_value<remove_complex<ValueType>>(obj));
+    }
+    if (auto& obj = config.get("default_initial_guess")) {
+        params.with_default_initial_guess(
+            gko::config::get_value<solver::initial_guess_mode>(obj));
+    }
+    return params;
+}
+
+
+template <typename ValueType>
+void Chebyshev<ValueType>::setup_foci()
+{
+    foci_ = parameters_.foci;
+    if (foci_.first != zero<ValueType>() || foci_.second != zero<ValueType>()) {
+        return;
+    }
+    if (gko::detail::is_distributed(this->get_system_matrix().get())) {
+        GKO_NOT_SUPPORTED(this->get_system_matrix().get());
+    }
+    auto eigenvalues = chebyshev::estimate_extreme_eigenvalues<ValueType>(
+        this->get_system_matrix().get(), this->get_preconditioner().get(),
+        std::max<size_type>(parameters_.num_estimation_iterations, 1));
+    const auto upper = eigenvalues.second * parameters_.max_eigenvalue_scale;
+    const auto lower = parameters_.min_eigenvalue_ratio > 0
+                           ? upper * parameters_.min_eigenvalue_ratio
+                           : eigenvalues.first;
+    foci_ = std::make_pair(static_cast<ValueType>(lower),
+                           static_cast<ValueType>(upper));
+}
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> Chebyshev<ValueType>::transpose() const
+{
+    return build()
+        .with_generated_preconditioner(
+            share(as<Transposable>(this->get_preconditioner())->transpose()))
+        .with_criteria(this->get_stop_criterion_factory())
+        .with_foci(foci_)
+        .with_default_initial_guess(parameters_.default_initial_guess)
+        .on(this->get_executor())
+        ->generate(
+            share(as<Transposable>(this->get_system_matrix())->transpose()));
+}
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> Chebyshev<ValueType>::conj_transpose() const
+{
+    return build()
+        .with_generated_preconditioner(share(
+            as<Transposable>(this->get_preconditioner())->conj_transpose()))
+        .with_criteria(this->get_stop_criterion_factory())
+        .with_foci(conj(foci_.first), conj(foci_.second))
+        .with_default_initial_guess(parameters_.default_initial_guess)
+        .on(this->get_executor())
+        ->generate(share(
+            as<Transposable>(this->get_system_matrix())->conj_transpose()));
+}
+
+
+template <typename ValueType>
+void Chebyshev<ValueType>::apply_impl(const LinOp* b, LinOp* x) const
+{
+    this->apply_with_initial_guess_impl(b, x,
+                                        this->get_default_initial_guess());
+}
+
+
+template <typename ValueType>
+void Chebyshev<ValueType>::apply_with_initial_guess_impl(
+    const LinOp* b, LinOp* x, initial_guess_mode guess) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    experimental::precision_dispatch_real_complex_distributed<ValueType>(
+        [this, guess](auto dense_b, auto dense_x) {
+            prepare_initial_guess(dense_b, dense_x, guess);
+            this->apply_dense_impl(dense_b, dense_x, guess);
+        },
+        b, x);
+}
+
+
+template <typename ValueType>
+template <typename VectorType>
+void Chebyshev<ValueType>::apply_dense_impl(const VectorType* dense_b,
+                                            VectorType* dense_x,
+                                            initial_guess_mode guess) const
+{
+    using ws = workspace_traits<Chebyshev>;
+    constexpr uint8 relative_stopping_id{1};
+
+    auto exec = this->get_executor();
+    this->setup_workspace();
+
+    GKO_SOLVER_VECTOR(residual, dense_b);
+    GKO_SOLVER_VECTOR(inner_solution, dense_b);
+    GKO_SOLVER_VECTOR(update_solution, dense_b);
+
+    GKO_SOLVER_ONE_MINUS_ONE();
+
+    bool one_changed{};
+    auto& stop_status = this->template create_workspace_array<stopping_status>(
+        ws::stop, dense_b->get_size()[1]);
+    exec->run(chebyshev::make_initialize(&stop_status));
+    if (guess != initial_guess_mode::zero) {
+        residual->copy_from(dense_b);
+        this->get_system_matrix()->apply(neg_one_op, dense_x, one_op, residual);
+    }
+    // zero input the residual is dense_b
+    const VectorType* residual_ptr =
+        guess == initial_guess_mode::zero ? dense_b : residual;
+
+    auto stop_criterion = this->get_stop_criterion_factory()->generate(
+        this->get_system_matrix(),
+        std::shared_ptr<const LinOp>(dense_b, [](const LinOp*) {}), dense_x,
+        residual_ptr);
+
+    // the center and the half width of the spectrum interval
+    const auto center = (foci_.second + foci_.first) / ValueType{2};
+    const auto half_width = (foci_.second - foci_.first) / ValueType{2};
+    auto alpha = zero<ValueType>();
+    auto beta = zero<ValueType>();
+
+    int iter = -1;
+    while (true) {
+        ++iter;
+
+        if (iter == 0) {
+            // In iter 0, the iteration and residual are updated.
+            bool all_stopped = stop_criterion->update()
+                                   .num_iterations(iter)
+                                   .residual(residual_ptr)
+                                   .solution(dense_x)
+                                   .check(relative_stopping_id, true,
+                                          &stop_status, &one_changed);
+            this->template log<log::Logger::iteration_complete>(
+                this, dense_b, dense_x, iter, residual_ptr, nullptr, nullptr,
+                &stop_status, all_stopped);
+            if (all_stopped) {
+                break;
+            }
+        } else {
+            // In the other iterations, the residual can be updated separately.
+            bool all_stopped = stop_criterion->update()
+                                   .num_iterations(iter)
+                                   .solution(dense_x)
+                                   // we have the residual check later
+                                   .ignore_residual_check(true)
+                                   .check(relative_stopping_id, false,
+                                          &stop_status, &one_changed);
+            if (all_stopped) {
+                this->template log<log::Logger::iteration_complete>(
+                    this, dense_b, dense_x, iter, nullptr, nullptr, nullptr,
+                    &stop_status, all_stopped);
+                break;
+            }
+            residual_ptr = residual;
+            // residual = b - A * x
+            residual->copy_from(dense_b);
+            this->get_system_matrix()->apply(neg_one_op, dense_x, one_op,
+                                             residual);
+            all_stopped = stop_criterion->update()
+                              .num_iterations(iter)
+                              .residual(residual_ptr)
+                              .solution(dense_x)
+                              .check(relative_stopping_id, true, &stop_status,
+                                     &one_changed);
+            this->template log<log::Logger::iteration_complete>(
+                this, dense_b, dense_x, iter, residual_ptr, nullptr, nullptr,
+                &stop_status, all_stopped);
+            if (all_stopped) {
+                break;
+            }
+        }
+
+        // inner_solution = preconditioner * residual
+        if (this->get_preconditioner()->apply_uses_initial_guess()) {
+            inner_solution->copy_from(residual_ptr);
+        }
+        this->get_preconditioner()->apply(residual_ptr, inner_solution);
+
+        if (iter == 0) {
+            // update_solution = inner_solution
+            // x = x + alpha * update_solution
+            alpha = one<ValueType>() / center;
+            exec->run(chebyshev::make_init_update(
+                alpha, gko::detail::get_local(inner_solution),
+                gko::detail::get_local(update_solution),
+                gko::detail::get_local(dense_x)));
+        } else {
+            const auto scaled_width = half_width * alpha;
+            beta = iter == 1 ? scaled_width * scaled_width / ValueType{2}
+                             : scaled_width * scaled_width / ValueType{4};
+            alpha = one<ValueType>() / (center - beta / alpha);
+            // update_solution = inner_solution + beta * update_solution
+            // x = x + alpha * update_solution
+            exec->run(chebyshev::make_update(
+                alpha, beta, gko::detail::get_local(inner_solution),
+                gko::detail::get_local(update_solution),
+                gko::detail::get_local(dense_x)));
+        }
+    }
+}
+
+
+template <typename ValueType>
+void Chebyshev<ValueType>::apply_impl(const LinOp* alpha, const LinOp* b,
+                                      const LinOp* beta, LinOp* x) const
+{
+    this->apply_with_initial_guess_impl(alpha, b, beta, x,
+                                        this->get_default_initial_guess());
+}
+
+
+template <typename ValueType>
+void Chebyshev<ValueType>::apply_with_initial_guess_impl(
+    const LinOp* alpha, const LinOp* b, const LinOp* beta, LinOp* x,
+    initial_guess_mode guess) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    experimental::precision_dispatch_real_complex_distributed<ValueType>(
+        [this, guess](auto dense_alpha, auto dense_b, auto dense_beta,
+                      auto dense_x) {
+            prepare_initial_guess(dense_b, dense_x, guess);
+            auto x_clone = dense_x->clone();
+            this->apply_dense_impl(dense_b, x_clone.get(), guess);
+            dense_x->scale(dense_beta);
+            dense_x->add_scaled(dense_alpha, x_clone);
+        },
+        alpha, b, beta, x);
+}
+
+
+template <typename ValueType>
+int workspace_traits<Chebyshev<ValueType>>::num_arrays(const Solver&)
+{
+    return 1;
+}
+
+
+template <typename ValueType>
+int workspace_traits<Chebyshev<ValueType>>::num_vectors(const Solver&)
+{
+    return 5;
+}
+
+
+template <typename ValueType>
+std::vector<std::string> workspace_traits<Chebyshev<ValueType>>::op_names(
+    const Solver&)
+{
+    return {
+        "residual", "inner_solution", "update_solution", "one", "minus_one",
+    };
+}
+
+
+template <typename ValueType>
+std::vector<std::string> workspace_traits<Chebyshev<ValueType>>::array_names(
+    const Solver&)
+{
+    return {"stop"};
+}
+
+
+template <typename ValueType>
+std::vector<int> workspace_traits<Chebyshev<ValueType>>::scalars(const Solver&)
+{
+    return {};
+}
+
+
+template <typename ValueType>
+std::vector<int> workspace_traits<Chebyshev<ValueType>>::vectors(const Solver&)
+{
+    return {residual, inner_solution, update_solution};
+}
+
+
+#define GKO_DECLARE_CHEBYSHEV(_type) class Chebyshev<_type>
+#define GKO_DECLARE_CHEBYSHEV_TRAITS(_type) \
+    struct workspace_traits<Chebyshev<_type>>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CHEBYSHEV);
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CHEBYSHEV_TRAITS);
+
+
+}  // namespace solver
+}  // namespace gko
@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_SOLVER_CHEBYSHEV_KERNELS_HPP_
+#define GKO_CORE_SOLVER_CHEBYSHEV_KERNELS_HPP_
+
+
+#include <memory>
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+#include "core/base/kernel_declaration.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace chebyshev {
+
+
+#define GKO_DECLARE_CHEBYSHEV_INIT_UPDATE_KERNEL(_type)           \
+    void init_update(std::shared_ptr<const DefaultExecutor> exec, \
+                     const _type alpha,                           \
+                     const matrix::Dense<_type>* inner_sol,       \
+                     matrix::Dense<_type>* update_sol,            \
+                     matrix::Dense<_type>* output)
+
+
+#define GKO_DECLARE_CHEBYSHEV_UPDATE_KERNEL(_type)           \
+    void update(std::shared_ptr<const DefaultExecutor> exec, \
+                const _type alpha, const _type beta,         \
+                const matrix::Dense<_type>* inner_sol,       \
+                matrix::Dense<_type>* update_sol,            \
+                matrix::Dense<_type>* output)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                     \
+    template <typename ValueType>                        \
+    GKO_DECLARE_CHEBYSHEV_INIT_UPDATE_KERNEL(ValueType); \
+    template <typename ValueType>                        \
+    GKO_DECLARE_CHEBYSHEV_UPDATE_KERNEL(ValueType)
+
+
+}  // namespace chebyshev
+
+
+GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(chebyshev,
+                                        GKO_DECLARE_ALL_AS_TEMPLATES);
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_SOLVER_CHEBYSHEV_KERNELS_HPP_
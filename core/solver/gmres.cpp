@@ -34,6 +34,10 @@ GKO_REGISTER_OPERATION(hessenberg_qr, common_gmres::hessenberg_qr);
 GKO_REGISTER_OPERATION(solve_krylov, common_gmres::solve_krylov);
 GKO_REGISTER_OPERATION(multi_axpy, gmres::multi_axpy);
 GKO_REGISTER_OPERATION(multi_dot, gmres::multi_dot);
+GKO_REGISTER_OPERATION(block_dot, gmres::block_dot);
+GKO_REGISTER_OPERATION(block_cholesky, gmres::block_cholesky);
+GKO_REGISTER_OPERATION(block_orthonormalize, gmres::block_orthonormalize);
+GKO_REGISTER_OPERATION(block_hessenberg, gmres::block_hessenberg);
 
 
 }  // anonymous namespace
@@ -48,6 +52,8 @@ std::ostream& operator<<(std::ostream& stream, ortho_method ortho)
         return stream << "cgs";
     case ortho_method::cgs2:
         return stream << "cgs2";
+    case ortho_method::block_cgs2:
+        return stream << "block_cgs2";
     }
     return stream;
 }
@@ -78,11 +84,16 @@ typename Gmres<ValueType>::parameters_type Gmres<ValueType>::parse(
             ortho = gmres::ortho_method::cgs;
         } else if (str == "cgs2") {
             ortho = gmres::ortho_method::cgs2;
+        } else if (str == "block_cgs2") {
+            ortho = gmres::ortho_method::block_cgs2;
         } else {
             GKO_INVALID_CONFIG_VALUE("ortho_method", str);
         }
         params.with_ortho_method(ortho);
     }
+    if (auto& obj = config.get("s_step")) {
+        params.with_s_step(gko::config::get_value<size_type>(obj));
+    }
     return params;
 }
 
@@ -96,6 +107,8 @@ std::unique_ptr<LinOp> Gmres<ValueType>::transpose() const
         .with_criteria(this->get_stop_criterion_factory())
         .with_krylov_dim(this->get_krylov_dim())
         .with_flexible(this->get_parameters().flexible)
+        .with_ortho_method(this->get_parameters().ortho_method)
+        .with_s_step(this->get_parameters().s_step)
         .on(this->get_executor())
         ->generate(
             share(as<Transposable>(this->get_system_matrix())->transpose()));
@@ -111,6 +124,8 @@ std::unique_ptr<LinOp> Gmres<ValueType>::conj_transpose() const
         .with_criteria(this->get_stop_criterion_factory())
         .with_krylov_dim(this->get_krylov_dim())
         .with_flexible(this->get_parameters().flexible)
+        .with_ortho_method(this->get_parameters().ortho_method)
+        .with_s_step(this->get_parameters().s_step)
         .on(this->get_executor())
         ->generate(share(
             as<Transposable>(this->get_system_matrix())->conj_transpose()));
@@ -296,6 +311,74 @@ void orthogonalize_cgs2(matrix::Dense<ValueType>* hessenberg_iter,
 }
 
 
+template <typename ValueType, typename VectorType>
+void orthogonalize_block_cgs2(
+    const LinOp* system_matrix, const LinOp* preconditioner,
+    VectorType* krylov_bases, VectorType* preconditioned_vector,
+    matrix::Dense<ValueType>* block_coefficients,
+    matrix::Dense<ValueType>* block_reorth_coefficients,
+    matrix::Dense<ValueType>* arnoldi_hessenberg,
+    matrix::Dense<ValueType>* hessenberg,
+    matrix::Dense<ValueType>* basis_scaling, const stopping_status* stop_status,
+    size_type restart_iter, size_type block_size, size_type num_rows,
+    size_type num_rhs, size_type local_num_rows)
+{
+    auto exec = hessenberg->get_executor();
+    // generate the s-step basis
+    // krylov_bases(:, restart_iter + 1) = A * M * krylov_bases(:, restart_iter)
+    // krylov_bases(:, restart_iter + c + 1) =
+    //     A * M * krylov_bases(:, restart_iter + c) / basis_scaling
+    for (size_type c = 0; c < block_size; c++) {
+        auto this_vector = ::gko::detail::create_submatrix_helper(
+            krylov_bases, dim<2>{num_rows, num_rhs},
+            span{local_num_rows * (restart_iter + c),
+                 local_num_rows * (restart_iter + c + 1)},
+            span{0, num_rhs});
+        auto next_vector = ::gko::detail::create_submatrix_helper(
+            krylov_bases, dim<2>{num_rows, num_rhs},
+            span{local_num_rows * (restart_iter + c + 1),
+                 local_num_rows * (restart_iter + c + 2)},
+            span{0, num_rhs});
+        preconditioner->apply(this_vector, preconditioned_vector);
+        system_matrix->apply(preconditioned_vector, next_vector);
+        if (c > 0) {
+            next_vector->inv_scale(basis_scaling);
+        }
+    }
+    // orthonormalize the block W against the previous bases V and itself
+    // twice, each pass only needs a single global reduction
+    const auto num_prev_bases = restart_iter + 1;
+    auto krylov_bases_small = ::gko::detail::create_submatrix_helper(
+        krylov_bases, dim<2>{num_rows, num_rhs},
+        span{0, local_num_rows * (num_prev_bases + block_size)},
+        span{0, num_rhs});
+    const auto num_coefficients = (num_prev_bases + block_size) * block_size;
+    for (auto coefficients : {block_coefficients, block_reorth_coefficients}) {
+        // coefficients = [V, W]' * W
+        exec->run(gmres::make_block_dot(
+            gko::detail::get_local(krylov_bases_small.get()), num_prev_bases,
+            block_size, coefficients));
+        auto reduced_coefficients = coefficients->create_submatrix(
+            span{0, num_coefficients}, span{0, num_rhs});
+        gko::detail::start_global_sum(krylov_bases,
+                                      reduced_coefficients.get())
+            .wait();
+        // R22 = cholesky(W' * W - R12' * R12) with R12 = V' * W
+        exec->run(gmres::make_block_cholesky(coefficients, num_prev_bases,
+                                             block_size, stop_status));
+        // W = (W - V * R12) / R22
+        exec->run(gmres::make_block_orthonormalize(
+            gko::detail::get_local(krylov_bases_small.get()), coefficients,
+            num_prev_bases, block_size, stop_status));
+    }
+    // hessenberg(restart_iter : restart_iter + block_size, :) =
+    //     Arnoldi columns recovered from both passes
+    exec->run(gmres::make_block_hessenberg(
+        block_coefficients, block_reorth_coefficients, arnoldi_hessenberg,
+        hessenberg, basis_scaling, restart_iter, block_size, stop_status));
+}
+
+
 template <typename ValueType>
 struct help_compute_norm<ValueType,
                          std::enable_if_t<is_complex_s<ValueType>::value>> {
@@ -365,6 +448,31 @@ void Gmres<ValueType>::apply_dense_impl(const VectorType* dense_b,
         hessenberg_aux = this->template create_workspace_op<LocalVector>(
             ws::hessenberg_aux, dim<2>{(krylov_dim + 1), num_rhs});
     }
+    // For block orthogonalization, a copy of the Hessenberg matrix before
+    // applying the Givens rotations is necessary to recover the Arnoldi
+    // relation of the s-step basis.
+    const auto is_block_ortho =
+        this->parameters_.ortho_method == gmres::ortho_method::block_cgs2;
+    const auto s_step = this->parameters_.s_step;
+    LocalVector* arnoldi_hessenberg = nullptr;
+    LocalVector* block_coefficients = nullptr;
+    LocalVector* block_reorth_coefficients = nullptr;
+    LocalVector* basis_scaling = nullptr;
+    if (is_block_ortho) {
+        arnoldi_hessenberg = this->template create_workspace_op<LocalVector>(
+            ws::arnoldi_hessenberg,
+            dim<2>{krylov_dim, (krylov_dim + 1) * num_rhs});
+        block_coefficients = this->template create_workspace_op<LocalVector>(
+            ws::block_coefficients,
+            dim<2>{(krylov_dim + 1) * s_step, num_rhs});
+        block_reorth_coefficients =
+            this->template create_workspace_op<LocalVector>(
+                ws::block_reorth_coefficients,
+                dim<2>{(krylov_dim + 1) * s_step, num_rhs});
+        basis_scaling = this->template create_workspace_op<LocalVector>(
+            ws::basis_scaling, dim<2>{1, num_rhs});
+        basis_scaling->fill(zero<ValueType>());
+    }
     auto givens_sin = this->template create_workspace_op<LocalVector>(
         ws::givens_sin, dim<2>{krylov_dim, num_rhs});
     auto givens_cos = this->template create_workspace_op<LocalVector>(
@@ -419,6 +527,8 @@ void Gmres<ValueType>::apply_dense_impl(const VectorType* dense_b,
 
     int total_iter = -1;
     size_type restart_iter = 0;
+    // end of the current block of Krylov vectors for block orthogonalization
+    size_type block_end = 0;
 
     /* Memory movement summary for average iteration with krylov_dim d:
      * (5/2d+21/2+14/d)n * values + (1+1/d) * matrix/preconditioner storage
@@ -487,32 +597,8 @@ void Gmres<ValueType>::apply_dense_impl(const VectorType* dense_b,
                 residual_norm_collection, gko::detail::get_local(krylov_bases),
                 final_iter_nums.get_data()));
             restart_iter = 0;
+            block_end = 0;
         }
-        auto this_krylov = ::gko::detail::create_submatrix_helper(
-            krylov_bases, dim<2>{num_rows, num_rhs},
-            span{local_num_rows * restart_iter,
-                 local_num_rows * (restart_iter + 1)},
-            span{0, num_rhs});
-
-        auto next_krylov = ::gko::detail::create_submatrix_helper(
-            krylov_bases, dim<2>{num_rows, num_rhs},
-            span{local_num_rows * (restart_iter + 1),
-                 local_num_rows * (restart_iter + 2)},
-            span{0, num_rhs});
-        std::unique_ptr<VectorType> preconditioned_krylov;
-        auto preconditioned_krylov_vector = preconditioned_vector;
-        if (is_flexible) {
-            preconditioned_krylov = ::gko::detail::create_submatrix_helper(
-                preconditioned_krylov_bases, dim<2>{num_rows, num_rhs},
-                span{local_num_rows * restart_iter,
-                     local_num_rows * (restart_iter + 1)},
-                span{0, num_rhs});
-            preconditioned_krylov_vector = preconditioned_krylov.get();
-        }
-        // preconditioned_krylov_vector = get_preconditioner() * this_krylov
-        this->get_preconditioner()->apply(this_krylov,
-                                          preconditioned_krylov_vector);
-
         // Create view of current column in the hessenberg matrix:
         // hessenberg_iter = hessenberg(:, restart_iter), which
         // is actually stored as a row, hessenberg(restart_iter, :),
@@ -524,34 +610,86 @@ void Gmres<ValueType>::apply_dense_impl(const VectorType* dense_b,
                                 restart_iter * hessenberg->get_size()[1]),
             num_rhs);
 
-        // Start of Arnoldi
-        // next_krylov = A * preconditioned_krylov_vector
-        this->get_system_matrix()->apply(preconditioned_krylov_vector,
-                                         next_krylov);
-        if (this->parameters_.ortho_method == gmres::ortho_method::mgs) {
-            orthogonalize_mgs(hessenberg_iter.get(), krylov_bases,
-                              next_krylov.get(), reduction_tmp, restart_iter,
-                              num_rows, num_rhs, local_num_rows);
-        } else if (this->parameters_.ortho_method == gmres::ortho_method::cgs) {
-            orthogonalize_cgs(hessenberg_iter.get(), krylov_bases,
-                              next_krylov.get(), restart_iter, num_rows,
-                              num_rhs, local_num_rows);
-        } else if (this->parameters_.ortho_method ==
-                   gmres::ortho_method::cgs2) {
-            orthogonalize_cgs2(hessenberg_iter.get(), krylov_bases,
-                               next_krylov.get(), hessenberg_aux, one_op,
-                               restart_iter, num_rows, num_rhs, local_num_rows);
+        if (is_block_ortho) {
+            if (restart_iter == block_end) {
+                // The very first block only consists of a single vector, so
+                // that the basis scaling can be estimated from its Hessenberg
+                // column before generating longer monomial bases.
+                const auto block_size =
+                    total_iter == 0
+                        ? size_type{1}
+                        : std::min(s_step, krylov_dim - restart_iter);
+                // Start of Arnoldi
+                orthogonalize_block_cgs2(
+                    this->get_system_matrix().get(),
+                    this->get_preconditioner().get(), krylov_bases,
+                    preconditioned_vector, block_coefficients,
+                    block_reorth_coefficients, arnoldi_hessenberg, hessenberg,
+                    basis_scaling, stop_status.get_const_data(), restart_iter,
+                    block_size, num_rows, num_rhs, local_num_rows);
+                block_end = restart_iter + block_size;
+            }
+        } else {
+            auto this_krylov = ::gko::detail::create_submatrix_helper(
+                krylov_bases, dim<2>{num_rows, num_rhs},
+                span{local_num_rows * restart_iter,
+                     local_num_rows * (restart_iter + 1)},
+                span{0, num_rhs});
+
+            auto next_krylov = ::gko::detail::create_submatrix_helper(
+                krylov_bases, dim<2>{num_rows, num_rhs},
+                span{local_num_rows * (restart_iter + 1),
+                     local_num_rows * (restart_iter + 2)},
+                span{0, num_rhs});
+            std::unique_ptr<VectorType> preconditioned_krylov;
+            auto preconditioned_krylov_vector = preconditioned_vector;
+            if (is_flexible) {
+                preconditioned_krylov = ::gko::detail::create_submatrix_helper(
+                    preconditioned_krylov_bases, dim<2>{num_rows, num_rhs},
+                    span{local_num_rows * restart_iter,
+                         local_num_rows * (restart_iter + 1)},
+                    span{0, num_rhs});
+                preconditioned_krylov_vector = preconditioned_krylov.get();
+            }
+            // preconditioned_krylov_vector =
+            //     get_preconditioner() * this_krylov
+            this->get_preconditioner()->apply(this_krylov,
+                                              preconditioned_krylov_vector);
+
+            // Start of Arnoldi
+            // next_krylov = A * preconditioned_krylov_vector
+            this->get_system_matrix()->apply(preconditioned_krylov_vector,
+                                             next_krylov);
+            if (this->parameters_.ortho_method == gmres::ortho_method::mgs) {
+                orthogonalize_mgs(hessenberg_iter.get(), krylov_bases,
+                                  next_krylov.get(), reduction_tmp,
+                                  restart_iter, num_rows, num_rhs,
+                                  local_num_rows);
+            } else if (this->parameters_.ortho_method ==
+                       gmres::ortho_method::cgs) {
+                orthogonalize_cgs(hessenberg_iter.get(), krylov_bases,
+                                  next_krylov.get(), restart_iter, num_rows,
+                                  num_rhs, local_num_rows);
+            } else if (this->parameters_.ortho_method ==
+                       gmres::ortho_method::cgs2) {
+                orthogonalize_cgs2(hessenberg_iter.get(), krylov_bases,
+                                   next_krylov.get(), hessenberg_aux, one_op,
+                                   restart_iter, num_rows, num_rhs,
+                                   local_num_rows);
+            }
+            // normalize next_krylov:
+            // hessenberg(restart_iter+1, restart_iter) = norm(next_krylov)
+            // (stored in
+            //  hessenberg(restart_iter, (restart_iter + 1) * num_rhs))
+            // next_krylov /= hessenberg(restart_iter+1, restart_iter)
+            auto hessenberg_norm_entry = hessenberg_iter->create_submatrix(
+                span{restart_iter + 1, restart_iter + 2}, span{0, num_rhs});
+            help_compute_norm<ValueType>::
+                compute_next_krylov_norm_into_hessenberg(
+                    next_krylov.get(), hessenberg_norm_entry.get(),
+                    next_krylov_norm_tmp, reduction_tmp);
+            next_krylov->inv_scale(hessenberg_norm_entry);
         }
-        // normalize next_krylov:
-        // hessenberg(restart_iter+1, restart_iter) = norm(next_krylov)
-        // (stored in hessenberg(restart_iter, (restart_iter + 1) * num_rhs))
-        // next_krylov /= hessenberg(restart_iter+1, restart_iter)
-        auto hessenberg_norm_entry = hessenberg_iter->create_submatrix(
-            span{restart_iter + 1, restart_iter + 2}, span{0, num_rhs});
-        help_compute_norm<ValueType>::compute_next_krylov_norm_into_hessenberg(
-            next_krylov.get(), hessenberg_norm_entry.get(),
-            next_krylov_norm_tmp, reduction_tmp);
-        next_krylov->inv_scale(hessenberg_norm_entry);
         // End of Arnoldi
 
         // update QR factorization and Krylov RHS for last column:
@@ -649,7 +787,7 @@ int workspace_traits<Gmres<ValueType>>::num_arrays(const Solver&)
 template <typename ValueType>
 int workspace_traits<Gmres<ValueType>>::num_vectors(const Solver&)
 {
-    return 16;
+    return 20;
 }
 
 
@@ -672,7 +810,11 @@ std::vector<std::string> workspace_traits<Gmres<ValueType>>::op_names(
             "one",
             "minus_one",
             "next_krylov_norm_tmp",
-            "preconditioned_krylov_bases"};
+            "preconditioned_krylov_bases",
+            "arnoldi_hessenberg",
+            "block_coefficients",
+            "block_reorth_coefficients",
+            "basis_scaling"};
 }
 
 
@@ -687,9 +829,18 @@ std::vector<std::string> workspace_traits<Gmres<ValueType>>::array_names(
 template <typename ValueType>
 std::vector<int> workspace_traits<Gmres<ValueType>>::scalars(const Solver&)
 {
-    return {hessenberg, hessenberg_aux,           givens_sin,
-            givens_cos, residual_norm_collection, residual_norm,
-            y,          next_krylov_norm_tmp};
+    return {hessenberg,
+            hessenberg_aux,
+            givens_sin,
+            givens_cos,
+            residual_norm_collection,
+            residual_norm,
+            y,
+            next_krylov_norm_tmp,
+            arnoldi_hessenberg,
+            block_coefficients,
+            block_reorth_coefficients,
+            basis_scaling};
 }
 
 
@@ -45,13 +45,54 @@ namespace gmres {
                    matrix::Dense<_type>* hessenberg_col)
 
 
-#define GKO_DECLARE_ALL_AS_TEMPLATES                \
-    template <typename ValueType>                   \
-    GKO_DECLARE_GMRES_RESTART_KERNEL(ValueType);    \
-    template <typename ValueType>                   \
-    GKO_DECLARE_GMRES_MULTI_AXPY_KERNEL(ValueType); \
-    template <typename ValueType>                   \
-    GKO_DECLARE_GMRES_MULTI_DOT_KERNEL(ValueType)
+#define GKO_DECLARE_GMRES_BLOCK_DOT_KERNEL(_type)                  \
+    void block_dot(std::shared_ptr<const DefaultExecutor> exec,    \
+                   const matrix::Dense<_type>* krylov_bases,       \
+                   size_type num_prev_bases, size_type block_size, \
+                   matrix::Dense<_type>* block_coefficients)
+
+
+#define GKO_DECLARE_GMRES_BLOCK_CHOLESKY_KERNEL(_type)                  \
+    void block_cholesky(std::shared_ptr<const DefaultExecutor> exec,    \
+                        matrix::Dense<_type>* block_coefficients,       \
+                        size_type num_prev_bases, size_type block_size, \
+                        const stopping_status* stop_status)
+
+
+#define GKO_DECLARE_GMRES_BLOCK_ORTHONORMALIZE_KERNEL(_type)                  \
+    void block_orthonormalize(std::shared_ptr<const DefaultExecutor> exec,    \
+                              matrix::Dense<_type>* krylov_bases,             \
+                              const matrix::Dense<_type>* block_coefficients, \
+                              size_type num_prev_bases, size_type block_size, \
+                              const stopping_status* stop_status)
+
+
+#define GKO_DECLARE_GMRES_BLOCK_HESSENBERG_KERNEL(_type)                       \
+    void block_hessenberg(                                                     \
+        std::shared_ptr<const DefaultExecutor> exec,                           \
+        matrix::Dense<_type>* block_coefficients,                              \
+        const matrix::Dense<_type>* block_reorth_coefficients,                 \
+        matrix::Dense<_type>* arnoldi_hessenberg,                              \
+        matrix::Dense<_type>* hessenberg, matrix::Dense<_type>* basis_scaling, \
+        size_type iter, size_type block_size,                                  \
+        const stopping_status* stop_status)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                          \
+    template <typename ValueType>                             \
+    GKO_DECLARE_GMRES_RESTART_KERNEL(ValueType);              \
+    template <typename ValueType>                             \
+    GKO_DECLARE_GMRES_MULTI_AXPY_KERNEL(ValueType);           \
+    template <typename ValueType>                             \
+    GKO_DECLARE_GMRES_MULTI_DOT_KERNEL(ValueType);            \
+    template <typename ValueType>                             \
+    GKO_DECLARE_GMRES_BLOCK_DOT_KERNEL(ValueType);            \
+    template <typename ValueType>                             \
+    GKO_DECLARE_GMRES_BLOCK_CHOLESKY_KERNEL(ValueType);       \
+    template <typename ValueType>                             \
+    GKO_DECLARE_GMRES_BLOCK_ORTHONORMALIZE_KERNEL(ValueType); \
+    template <typename ValueType>                             \
+    GKO_DECLARE_GMRES_BLOCK_HESSENBERG_KERNEL(ValueType)
 
 
 }  // namespace gmres
@@ -683,69 +683,50 @@ typename Multigrid::parameters_type Multigrid::parse(
 }
 
 
-void Multigrid::generate()
+void Multigrid::generate_smoothers(
+    size_type index,
+    std::shared_ptr<const gko::multigrid::MultigridLevel> mg_level,
+    std::vector<std::shared_ptr<const LinOp>>& pre_smoother_list,
+    std::vector<std::shared_ptr<const LinOp>>& mid_smoother_list,
+    std::vector<std::shared_ptr<const LinOp>>& post_smoother_list)
 {
-    // generate coarse matrix until reaching max_level or min_coarse_rows
-    auto num_rows = this->get_system_matrix()->get_size()[0];
-    size_type level = 0;
-    auto matrix = this->get_system_matrix();
-    auto exec = this->get_executor();
-    // Always generate smoother with size = level.
-    while (level < parameters_.max_levels &&
-           num_rows > parameters_.min_coarse_rows) {
-        auto index = level_selector_(level, matrix.get());
-        GKO_ENSURE_IN_BOUNDS(index, parameters_.mg_level.size());
-        auto mg_level_factory = parameters_.mg_level.at(index);
-        // coarse generate
-        auto mg_level = as<gko::multigrid::MultigridLevel>(
-            share(mg_level_factory->generate(matrix)));
-        if (mg_level->get_coarse_op()->get_size()[0] == num_rows) {
-            // do not reduce dimension
-            break;
-        }
-
-        run<gko::multigrid::EnableMultigridLevel, float, double,
-            std::complex<float>, std::complex<double>>(
-            mg_level,
-            [this](auto mg_level, auto index, auto matrix) {
-                using value_type =
-                    typename std::decay_t<decltype(*mg_level)>::value_type;
+    run<gko::multigrid::EnableMultigridLevel, float, double,
+        std::complex<float>, std::complex<double>>(
+        mg_level,
+        [&, this](auto mg_level, auto index, auto matrix) {
+            using value_type =
+                typename std::decay_t<decltype(*mg_level)>::value_type;
+            handle_list<value_type>(
+                index, matrix, parameters_.pre_smoother, pre_smoother_list,
+                parameters_.smoother_iters, parameters_.smoother_relax);
+            if (parameters_.mid_case ==
+                multigrid::mid_smooth_type::standalone) {
                 handle_list<value_type>(
-                    index, matrix, parameters_.pre_smoother, pre_smoother_list_,
+                    index, matrix, parameters_.mid_smoother, mid_smoother_list,
                     parameters_.smoother_iters, parameters_.smoother_relax);
-                if (parameters_.mid_case ==
-                    multigrid::mid_smooth_type::standalone) {
-                    handle_list<value_type>(
-                        index, matrix, parameters_.mid_smoother,
-                        mid_smoother_list_, parameters_.smoother_iters,
-                        parameters_.smoother_relax);
-                }
-                if (!parameters_.post_uses_pre) {
-                    handle_list<value_type>(
-                        index, matrix, parameters_.post_smoother,
-                        post_smoother_list_, parameters_.smoother_iters,
-                        parameters_.smoother_relax);
-                }
-            },
-            index, mg_level->get_fine_op());
+            }
+            if (!parameters_.post_uses_pre) {
+                handle_list<value_type>(
+                    index, matrix, parameters_.post_smoother,
+                    post_smoother_list, parameters_.smoother_iters,
+                    parameters_.smoother_relax);
+            }
+        },
+        index, mg_level->get_fine_op());
+}
 
-        mg_level_list_.emplace_back(mg_level);
-        matrix = mg_level_list_.back()->get_coarse_op();
-        num_rows = matrix->get_size()[0];
-        level++;
-    }
-    if (parameters_.post_uses_pre) {
-        post_smoother_list_ = pre_smoother_list_;
-    }
-    // Generate at least one level
-    GKO_ASSERT_EQ(level > 0, true);
-    auto last_mg_level = mg_level_list_.back();
 
+std::shared_ptr<const LinOp> Multigrid::generate_coarsest_solver(
+    size_type level,
+    std::shared_ptr<const gko::multigrid::MultigridLevel> last_mg_level)
+{
+    auto matrix = last_mg_level->get_coarse_op();
+    std::shared_ptr<const LinOp> coarsest_solver;
     // generate coarsest solver
     run<gko::multigrid::EnableMultigridLevel, float, double,
         std::complex<float>, std::complex<double>>(
         last_mg_level,
-        [this](auto mg_level, auto level, auto matrix) {
+        [&, this](auto mg_level, auto level, auto matrix) {
             using value_type =
                 typename std::decay_t<decltype(*mg_level)>::value_type;
             auto exec = this->get_executor();
@@ -817,20 +798,109 @@ void Multigrid::generate()
                 }
             };
             if (parameters_.coarsest_solver.size() == 0) {
-                coarsest_solver_ = gen_default_solver();
+                coarsest_solver = gen_default_solver();
             } else {
                 auto temp_index = solver_selector_(level, matrix.get());
                 GKO_ENSURE_IN_BOUNDS(temp_index,
                                      parameters_.coarsest_solver.size());
                 auto solver = parameters_.coarsest_solver.at(temp_index);
                 if (solver == nullptr) {
-                    coarsest_solver_ = gen_default_solver();
+                    coarsest_solver = gen_default_solver();
                 } else {
-                    coarsest_solver_ = solver->generate(matrix);
+                    coarsest_solver = solver->generate(matrix);
                 }
             }
         },
         level, matrix);
+    return coarsest_solver;
+}
+
+
+void Multigrid::generate()
+{
+    // generate coarse matrix until reaching max_level or min_coarse_rows
+    auto num_rows = this->get_system_matrix()->get_size()[0];
+    size_type level = 0;
+    auto matrix = this->get_system_matrix();
+    auto exec = this->get_executor();
+    // Always generate smoother with size = level.
+    while (level < parameters_.max_levels &&
+           num_rows > parameters_.min_coarse_rows) {
+        auto index = level_selector_(level, matrix.get());
+        GKO_ENSURE_IN_BOUNDS(index, parameters_.mg_level.size());
+        auto mg_level_factory = parameters_.mg_level.at(index);
+        // coarse generate
+        auto mg_level = as<gko::multigrid::MultigridLevel>(
+            share(mg_level_factory->generate(matrix)));
+        if (mg_level->get_coarse_op()->get_size()[0] == num_rows) {
+            // do not reduce dimension
+            break;
+        }
+
+        this->generate_smoothers(index, mg_level, pre_smoother_list_,
+                                 mid_smoother_list_, post_smoother_list_);
+
+        mg_level_list_.emplace_back(mg_level);
+        matrix = mg_level_list_.back()->get_coarse_op();
+        num_rows = matrix->get_size()[0];
+        level++;
+    }
+    if (parameters_.post_uses_pre) {
+        post_smoother_list_ = pre_smoother_list_;
+    }
+    // Generate at least one level
+    GKO_ASSERT_EQ(level > 0, true);
+    coarsest_solver_ =
+        this->generate_coarsest_solver(level, mg_level_list_.back());
+}
+
+
+void Multigrid::update_values(std::shared_ptr<const LinOp> system_matrix)
+{
+    GKO_ASSERT_EQUAL_DIMENSIONS(this->get_system_matrix(), system_matrix);
+    // an empty system matrix doesn't have a hierarchy to update
+    if (mg_level_list_.empty()) {
+        this->set_system_matrix(std::move(system_matrix));
+        cache_.state.reset();
+        return;
+    }
+    // check before generating anything that all levels can be updated
+    for (const auto& mg_level : mg_level_list_) {
+        as<ValueUpdatable>(mg_level);
+    }
+    // the new hierarchy is built next to the old one and only swapped in at
+    // the end, so an exception leaves the solver unchanged
+    std::vector<std::shared_ptr<const gko::multigrid::MultigridLevel>>
+        mg_level_list;
+    std::vector<std::shared_ptr<const LinOp>> pre_smoother_list;
+    std::vector<std::shared_ptr<const LinOp>> mid_smoother_list;
+    std::vector<std::shared_ptr<const LinOp>> post_smoother_list;
+    auto matrix = system_matrix;
+    for (size_type level = 0; level < mg_level_list_.size(); level++) {
+        auto index = level_selector_(level, matrix.get());
+        GKO_ENSURE_IN_BOUNDS(index, parameters_.mg_level.size());
+        // update a copy, since the old level may still be referenced elsewhere
+        auto mg_level = share(as<LinOp>(mg_level_list_.at(level))->clone());
+        as<ValueUpdatable>(mg_level)->update_values(matrix);
+        auto updated_mg_level = as<gko::multigrid::MultigridLevel>(mg_level);
+        this->generate_smoothers(index, updated_mg_level, pre_smoother_list,
+                                 mid_smoother_list, post_smoother_list);
+        mg_level_list.emplace_back(updated_mg_level);
+        matrix = mg_level_list.back()->get_coarse_op();
+    }
+    if (parameters_.post_uses_pre) {
+        post_smoother_list = pre_smoother_list;
+    }
+    auto coarsest_solver = this->generate_coarsest_solver(
+        mg_level_list.size(), mg_level_list.back());
+    this->set_system_matrix(std::move(system_matrix));
+    mg_level_list_ = std::move(mg_level_list);
+    pre_smoother_list_ = std::move(pre_smoother_list);
+    mid_smoother_list_ = std::move(mid_smoother_list);
+    post_smoother_list_ = std::move(post_smoother_list);
+    coarsest_solver_ = std::move(coarsest_solver);
+    // the cached vectors refer to the old system matrix
+    cache_.state.reset();
 }
 
 
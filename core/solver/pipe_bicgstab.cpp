@@ -0,0 +1,408 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "ginkgo/core/solver/pipe_bicgstab.hpp"
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/solver/solver_base.hpp>
+
+#include "core/config/solver_config.hpp"
+#include "core/distributed/helpers.hpp"
+#include "core/solver/pipe_bicgstab_kernels.hpp"
+#include "core/solver/solver_boilerplate.hpp"
+
+
+namespace gko {
+namespace solver {
+namespace pipe_bicgstab {
+namespace {
+
+
+GKO_REGISTER_OPERATION(initialize, pipe_bicgstab::initialize);
+GKO_REGISTER_OPERATION(step_1, pipe_bicgstab::step_1);
+GKO_REGISTER_OPERATION(step_2, pipe_bicgstab::step_2);
+GKO_REGISTER_OPERATION(step_3, pipe_bicgstab::step_3);
+
+
+}  // anonymous namespace
+}  // namespace pipe_bicgstab
+
+
+template <typename ValueType>
+typename PipeBicgstab<ValueType>::parameters_type
+PipeBicgstab<ValueType>::parse(const config::pnode& config,
+                               const config::registry& context,
+                               const config::type_descriptor& td_for_child)
+{
+    auto params = solver::PipeBicgstab<ValueType>::build();
+    common_solver_parse(params, config, context, td_for_child);
+    if (auto& obj = config.get("replacement_period")) {
+        params.with_replacement_period(gko::config::get_value<size_type>(obj));
+    }
+    return params;
+}
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> PipeBicgstab<ValueType>::transpose() const
+{
+    return build()
+        .with_generated_preconditioner(
+            share(as<Transposable>(this->get_preconditioner())->transpose()))
+        .with_criteria(this->get_stop_criterion_factory())
+        .with_replacement_period(this->get_parameters().replacement_period)
+        .on(this->get_executor())
+        ->generate(
+            share(as<Transposable>(this->get_system_matrix())->transpose()));
+}
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> PipeBicgstab<ValueType>::conj_transpose() const
+{
+    return build()
+        .with_generated_preconditioner(share(
+            as<Transposable>(this->get_preconditioner())->conj_transpose()))
+        .with_criteria(this->get_stop_criterion_factory())
+        .with_replacement_period(this->get_parameters().replacement_period)
+        .on(this->get_executor())
+        ->generate(share(
+            as<Transposable>(this->get_system_matrix())->conj_transpose()));
+}
+
+
+template <typename ValueType>
+void PipeBicgstab<ValueType>::apply_impl(const LinOp* b, LinOp* x) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    experimental::precision_dispatch_real_complex_distributed<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            this->apply_dense_impl(dense_b, dense_x);
+        },
+        b, x);
+}
+
+
+template <typename ValueType>
+template <typename VectorType>
+void PipeBicgstab<ValueType>::apply_dense_impl(const VectorType* dense_b,
+                                               VectorType* dense_x) const
+{
+    using LocalVector = matrix::Dense<ValueType>;
+
+    constexpr uint8 RelativeStoppingId{1};
+
+    auto exec = this->get_executor();
+    this->setup_workspace();
+
+    GKO_SOLVER_VECTOR(r, dense_b);
+    GKO_SOLVER_VECTOR(rr, dense_b);
+    GKO_SOLVER_VECTOR(rh, dense_b);
+    GKO_SOLVER_VECTOR(w, dense_b);
+    GKO_SOLVER_VECTOR(wh, dense_b);
+    GKO_SOLVER_VECTOR(t, dense_b);
+    GKO_SOLVER_VECTOR(ph, dense_b);
+    GKO_SOLVER_VECTOR(s, dense_b);
+    GKO_SOLVER_VECTOR(sh, dense_b);
+    GKO_SOLVER_VECTOR(z, dense_b);
+    GKO_SOLVER_VECTOR(zh, dense_b);
+    GKO_SOLVER_VECTOR(v, dense_b);
+    GKO_SOLVER_VECTOR(q, dense_b);
+    GKO_SOLVER_VECTOR(qh, dense_b);
+    GKO_SOLVER_VECTOR(y, dense_b);
+
+    GKO_SOLVER_SCALAR(alpha, dense_b);
+    GKO_SOLVER_SCALAR(beta, dense_b);
+    GKO_SOLVER_SCALAR(omega, dense_b);
+    GKO_SOLVER_SCALAR(prev_rho, dense_b);
+
+    GKO_SOLVER_ONE_MINUS_ONE();
+
+    bool one_changed{};
+    GKO_SOLVER_STOP_REDUCTION_ARRAYS();
+
+    // the dot products of each group are stored contiguously to reduce them
+    // together
+    const auto num_rhs = dense_b->get_size()[1];
+    auto first_dots = this->template create_workspace_op<LocalVector>(
+        GKO_SOLVER_TRAITS::first_dots, dim<2>{2, num_rhs});
+    auto second_dots = this->template create_workspace_op<LocalVector>(
+        GKO_SOLVER_TRAITS::second_dots, dim<2>{4, num_rhs});
+    const auto dot_row = [num_rhs](LocalVector* dots, size_type row) {
+        return dots->create_submatrix(span{row, row + 1}, span{0, num_rhs});
+    };
+    auto yq = dot_row(first_dots, 0);
+    auto yy = dot_row(first_dots, 1);
+    auto rho = dot_row(second_dots, 0);
+    auto rr_w = dot_row(second_dots, 1);
+    auto rr_s = dot_row(second_dots, 2);
+    auto rr_z = dot_row(second_dots, 3);
+    // rho = dot(rr, r), rr_w = dot(rr, w), rr_s = dot(rr, s),
+    // rr_z = dot(rr, z)
+    const auto compute_second_dots = [&] {
+        const auto local_rr = gko::detail::get_local(rr);
+        local_rr->compute_conj_dot(gko::detail::get_local(r), rho,
+                                   reduction_tmp);
+        local_rr->compute_conj_dot(gko::detail::get_local(w), rr_w,
+                                   reduction_tmp);
+        local_rr->compute_conj_dot(gko::detail::get_local(s), rr_s,
+                                   reduction_tmp);
+        local_rr->compute_conj_dot(gko::detail::get_local(z), rr_z,
+                                   reduction_tmp);
+        return gko::detail::start_global_sum(dense_b, second_dots);
+    };
+
+    // r = dense_b
+    // alpha = beta = omega = prev_rho = yq = yy = 0.0
+    // ph = s = sh = z = zh = v = 0
+    // stop_status = 0x00
+    exec->run(pipe_bicgstab::make_initialize(
+        gko::detail::get_local(dense_b), gko::detail::get_local(r),
+        gko::detail::get_local(ph), gko::detail::get_local(s),
+        gko::detail::get_local(sh), gko::detail::get_local(z),
+        gko::detail::get_local(zh), gko::detail::get_local(v), alpha, beta,
+        omega, prev_rho, yq.get(), yy.get(), &stop_status));
+
+    // r = b - Ax
+    this->get_system_matrix()->apply(neg_one_op, dense_x, one_op, r);
+    auto stop_criterion = this->get_stop_criterion_factory()->generate(
+        this->get_system_matrix(),
+        std::shared_ptr<const LinOp>(dense_b, [](const LinOp*) {}), dense_x, r);
+    // rr = r
+    rr->copy_from(r);
+    // rh = preconditioner * r
+    this->get_preconditioner()->apply(r, rh);
+    // w = A * rh
+    this->get_system_matrix()->apply(rh, w);
+    {
+        auto reduction = compute_second_dots();
+        // wh = preconditioner * w
+        this->get_preconditioner()->apply(w, wh);
+        // t = A * wh
+        this->get_system_matrix()->apply(wh, t);
+        reduction.wait();
+    }
+    // alpha = rho / rr_w
+    // prev_rho = rho
+    exec->run(pipe_bicgstab::make_step_3(
+        alpha, beta, omega, prev_rho, yq.get(), yy.get(), rho.get(),
+        rr_w.get(), rr_s.get(), rr_z.get(), &stop_status));
+
+    int iter = -1;
+
+    /* Memory movement summary:
+     * 57n * values + 2 * matrix/preconditioner storage
+     * 2x SpMV:                4n * values + 2 * storage
+     * 2x Preconditioner:      4n * values + 2 * storage
+     * 6x dot                 12n
+     * 1x step 1 (fused axpys) 20n
+     * 1x step 2 (fused axpys) 16n
+     * 1x norm2 residual        n
+     */
+    while (true) {
+        ++iter;
+        bool all_stopped =
+            stop_criterion->update()
+                .num_iterations(iter)
+                .residual(r)
+                .implicit_sq_residual_norm(rho)
+                .solution(dense_x)
+                .check(RelativeStoppingId, true, &stop_status, &one_changed);
+        this->template log<log::Logger::iteration_complete>(
+            this, dense_b, dense_x, iter, r, nullptr, rho.get(), &stop_status,
+            all_stopped);
+        if (all_stopped) {
+            break;
+        }
+
+        // ph = rh + beta * (ph - omega * sh)
+        // s = w + beta * (s - omega * z)
+        // sh = wh + beta * (sh - omega * zh)
+        // z = t + beta * (z - omega * v)
+        // q = r - alpha * s
+        // qh = rh - alpha * sh
+        // y = w - alpha * z
+        exec->run(pipe_bicgstab::make_step_1(
+            gko::detail::get_local(r), gko::detail::get_local(rh),
+            gko::detail::get_local(w), gko::detail::get_local(wh),
+            gko::detail::get_local(t), gko::detail::get_local(ph),
+            gko::detail::get_local(s), gko::detail::get_local(sh),
+            gko::detail::get_local(z), gko::detail::get_local(zh),
+            gko::detail::get_local(v), gko::detail::get_local(q),
+            gko::detail::get_local(qh), gko::detail::get_local(y), alpha, beta,
+            omega, &stop_status));
+        // yq = dot(y, q)
+        // yy = dot(y, y)
+        gko::detail::get_local(y)->compute_conj_dot(gko::detail::get_local(q),
+                                                    yq, reduction_tmp);
+        gko::detail::get_local(y)->compute_conj_dot(gko::detail::get_local(y),
+                                                    yy, reduction_tmp);
+        {
+            auto reduction = gko::detail::start_global_sum(dense_b, first_dots);
+            // the reduction is overlapped with
+            // zh = preconditioner * z
+            // v = A * zh
+            this->get_preconditioner()->apply(z, zh);
+            this->get_system_matrix()->apply(zh, v);
+            reduction.wait();
+        }
+        // omega = yq / yy
+        // x = x + alpha * ph + omega * qh
+        // r = q - omega * y
+        // rh = qh - omega * (wh - alpha * zh)
+        // w = y - omega * (t - alpha * v)
+        exec->run(pipe_bicgstab::make_step_2(
+            gko::detail::get_local(dense_x), gko::detail::get_local(r),
+            gko::detail::get_local(rh), gko::detail::get_local(w),
+            gko::detail::get_local(wh), gko::detail::get_local(t),
+            gko::detail::get_local(ph), gko::detail::get_local(q),
+            gko::detail::get_local(qh), gko::detail::get_local(y),
+            gko::detail::get_local(zh), gko::detail::get_local(v), alpha,
+            yq.get(), yy.get(), &stop_status));
+        const auto period = this->get_parameters().replacement_period;
+        if (period > 0 && (iter + 1) % period == 0) {
+            // replace the recursively updated vectors by their true values to
+            // remove the rounding errors accumulated in the recurrences
+            // r = b - A * x
+            // rh = preconditioner * r
+            // w = A * rh
+            // s = A * ph
+            // sh = preconditioner * s
+            // z = A * sh
+            // zh = preconditioner * z
+            // v = A * zh
+            r->copy_from(dense_b);
+            this->get_system_matrix()->apply(neg_one_op, dense_x, one_op, r);
+            this->get_preconditioner()->apply(r, rh);
+            this->get_system_matrix()->apply(rh, w);
+            this->get_system_matrix()->apply(ph, s);
+            this->get_preconditioner()->apply(s, sh);
+            this->get_system_matrix()->apply(sh, z);
+            this->get_preconditioner()->apply(z, zh);
+            this->get_system_matrix()->apply(zh, v);
+        }
+        {
+            auto reduction = compute_second_dots();
+            // the reduction is overlapped with
+            // wh = preconditioner * w
+            // t = A * wh
+            this->get_preconditioner()->apply(w, wh);
+            this->get_system_matrix()->apply(wh, t);
+            reduction.wait();
+        }
+        // omega = yq / yy
+        // beta = alpha * rho / (omega * prev_rho)
+        // alpha = rho / (rr_w + beta * rr_s - beta * omega * rr_z)
+        // prev_rho = rho
+        exec->run(pipe_bicgstab::make_step_3(
+            alpha, beta, omega, prev_rho, yq.get(), yy.get(), rho.get(),
+            rr_w.get(), rr_s.get(), rr_z.get(), &stop_status));
+    }
+}
+
+
+template <typename ValueType>
+void PipeBicgstab<ValueType>::apply_impl(const LinOp* alpha, const LinOp* b,
+                                         const LinOp* beta, LinOp* x) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    experimental::precision_dispatch_real_complex_distributed<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            auto x_clone = dense_x->clone();
+            this->apply_dense_impl(dense_b, x_clone.get());
+            dense_x->scale(dense_beta);
+            dense_x->add_scaled(dense_alpha, x_clone);
+        },
+        alpha, b, beta, x);
+}
+
+
+template <typename ValueType>
+int workspace_traits<PipeBicgstab<ValueType>>::num_arrays(const Solver&)
+{
+    return 2;
+}
+
+
+template <typename ValueType>
+int workspace_traits<PipeBicgstab<ValueType>>::num_vectors(const Solver&)
+{
+    return 23;
+}
+
+
+template <typename ValueType>
+std::vector<std::string> workspace_traits<PipeBicgstab<ValueType>>::op_names(
+    const Solver&)
+{
+    return {
+        "r",
+        "rr",
+        "rh",
+        "w",
+        "wh",
+        "t",
+        "ph",
+        "s",
+        "sh",
+        "z",
+        "zh",
+        "v",
+        "q",
+        "qh",
+        "y",
+        "first_dots",
+        "second_dots",
+        "alpha",
+        "beta",
+        "omega",
+        "prev_rho",
+        "one",
+        "minus_one",
+    };
+}
+
+
+template <typename ValueType>
+std::vector<std::string> workspace_traits<PipeBicgstab<ValueType>>::array_names(
+    const Solver&)
+{
+    return {"stop", "tmp"};
+}
+
+
+template <typename ValueType>
+std::vector<int> workspace_traits<PipeBicgstab<ValueType>>::scalars(
+    const Solver&)
+{
+    return {first_dots, second_dots, alpha, beta, omega, prev_rho};
+}
+
+
+template <typename ValueType>
+std::vector<int> workspace_traits<PipeBicgstab<ValueType>>::vectors(
+    const Solver&)
+{
+    return {r, rr, rh, w, wh, t, ph, s, sh, z, zh, v, q, qh, y};
+}
+
+
+#define GKO_DECLARE_PIPE_BICGSTAB(_type) class PipeBicgstab<_type>
+#define GKO_DECLARE_PIPE_BICGSTAB_TRAITS(_type) \
+    struct workspace_traits<PipeBicgstab<_type>>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_BICGSTAB);
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_BICGSTAB_TRAITS);
+
+
+}  // namespace solver
+}  // namespace gko
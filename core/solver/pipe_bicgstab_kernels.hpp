@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_SOLVER_PIPE_BICGSTAB_KERNELS_HPP_
+#define GKO_CORE_SOLVER_PIPE_BICGSTAB_KERNELS_HPP_
+
+
+#include <memory>
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/stop/stopping_status.hpp>
+
+#include "core/base/kernel_declaration.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace pipe_bicgstab {
+
+
+#define GKO_DECLARE_PIPE_BICGSTAB_INITIALIZE_KERNEL(_type)           \
+    void initialize(                                                 \
+        std::shared_ptr<const DefaultExecutor> exec,                 \
+        const matrix::Dense<_type>* b, matrix::Dense<_type>* r,      \
+        matrix::Dense<_type>* ph, matrix::Dense<_type>* s,           \
+        matrix::Dense<_type>* sh, matrix::Dense<_type>* z,           \
+        matrix::Dense<_type>* zh, matrix::Dense<_type>* v,           \
+        matrix::Dense<_type>* alpha, matrix::Dense<_type>* beta,     \
+        matrix::Dense<_type>* omega, matrix::Dense<_type>* prev_rho, \
+        matrix::Dense<_type>* yq, matrix::Dense<_type>* yy,          \
+        array<stopping_status>* stop_status)
+
+
+#define GKO_DECLARE_PIPE_BICGSTAB_STEP_1_KERNEL(_type)                         \
+    void step_1(std::shared_ptr<const DefaultExecutor> exec,                   \
+                const matrix::Dense<_type>* r, const matrix::Dense<_type>* rh, \
+                const matrix::Dense<_type>* w, const matrix::Dense<_type>* wh, \
+                const matrix::Dense<_type>* t, matrix::Dense<_type>* ph,       \
+                matrix::Dense<_type>* s, matrix::Dense<_type>* sh,             \
+                matrix::Dense<_type>* z, const matrix::Dense<_type>* zh,       \
+                const matrix::Dense<_type>* v, matrix::Dense<_type>* q,        \
+                matrix::Dense<_type>* qh, matrix::Dense<_type>* y,             \
+                const matrix::Dense<_type>* alpha,                             \
+                const matrix::Dense<_type>* beta,                              \
+                const matrix::Dense<_type>* omega,                             \
+                const array<stopping_status>* stop_status)
+
+
+#define GKO_DECLARE_PIPE_BICGSTAB_STEP_2_KERNEL(_type)                        \
+    void step_2(                                                              \
+        std::shared_ptr<const DefaultExecutor> exec, matrix::Dense<_type>* x, \
+        matrix::Dense<_type>* r, matrix::Dense<_type>* rh,                    \
+        matrix::Dense<_type>* w, const matrix::Dense<_type>* wh,              \
+        const matrix::Dense<_type>* t, const matrix::Dense<_type>* ph,        \
+        const matrix::Dense<_type>* q, const matrix::Dense<_type>* qh,        \
+        const matrix::Dense<_type>* y, const matrix::Dense<_type>* zh,        \
+        const matrix::Dense<_type>* v, const matrix::Dense<_type>* alpha,     \
+        const matrix::Dense<_type>* yq, const matrix::Dense<_type>* yy,       \
+        const array<stopping_status>* stop_status)
+
+
+#define GKO_DECLARE_PIPE_BICGSTAB_STEP_3_KERNEL(_type)                      \
+    void step_3(                                                            \
+        std::shared_ptr<const DefaultExecutor> exec,                        \
+        matrix::Dense<_type>* alpha, matrix::Dense<_type>* beta,            \
+        matrix::Dense<_type>* omega, matrix::Dense<_type>* prev_rho,        \
+        const matrix::Dense<_type>* yq, const matrix::Dense<_type>* yy,     \
+        const matrix::Dense<_type>* rho, const matrix::Dense<_type>* rr_w,  \
+        const matrix::Dense<_type>* rr_s, const matrix::Dense<_type>* rr_z, \
+        const array<stopping_status>* stop_status)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                        \
+    template <typename ValueType>                           \
+    GKO_DECLARE_PIPE_BICGSTAB_INITIALIZE_KERNEL(ValueType); \
+    template <typename ValueType>                           \
+    GKO_DECLARE_PIPE_BICGSTAB_STEP_1_KERNEL(ValueType);     \
+    template <typename ValueType>                           \
+    GKO_DECLARE_PIPE_BICGSTAB_STEP_2_KERNEL(ValueType);     \
+    template <typename ValueType>                           \
+    GKO_DECLARE_PIPE_BICGSTAB_STEP_3_KERNEL(ValueType)
+
+
+}  // namespace pipe_bicgstab
+
+
+GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(pipe_bicgstab,
+                                        GKO_DECLARE_ALL_AS_TEMPLATES);
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_SOLVER_PIPE_BICGSTAB_KERNELS_HPP_
@@ -0,0 +1,315 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "ginkgo/core/solver/pipe_cg.hpp"
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/name_demangling.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/utils.hpp>
+
+#include "core/config/solver_config.hpp"
+#include "core/distributed/helpers.hpp"
+#include "core/solver/pipe_cg_kernels.hpp"
+#include "core/solver/solver_boilerplate.hpp"
+
+
+namespace gko {
+namespace solver {
+namespace pipe_cg {
+namespace {
+
+
+GKO_REGISTER_OPERATION(initialize, pipe_cg::initialize);
+GKO_REGISTER_OPERATION(step_1, pipe_cg::step_1);
+GKO_REGISTER_OPERATION(step_2, pipe_cg::step_2);
+
+
+}  // anonymous namespace
+}  // namespace pipe_cg
+
+
+template <typename ValueType>
+typename PipeCg<ValueType>::parameters_type PipeCg<ValueType>::parse(
+    const config::pnode& config, const config::registry& context,
+    const config::type_descriptor& td_for_child)
+{
+    auto params = solver::PipeCg<ValueType>::build();
+    common_solver_parse(params, config, context, td_for_child);
+    if (auto& obj = config.get("replacement_period")) {
+        params.with_replacement_period(gko::config::get_value<size_type>(obj));
+    }
+    return params;
+}
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> PipeCg<ValueType>::transpose() const
+{
+    return build()
+        .with_generated_preconditioner(
+            share(as<Transposable>(this->get_preconditioner())->transpose()))
+        .with_criteria(this->get_stop_criterion_factory())
+        .with_replacement_period(this->get_parameters().replacement_period)
+        .on(this->get_executor())
+        ->generate(
+            share(as<Transposable>(this->get_system_matrix())->transpose()));
+}
+
+
+template <typename ValueType>
+std::unique_ptr<LinOp> PipeCg<ValueType>::conj_transpose() const
+{
+    return build()
+        .with_generated_preconditioner(share(
+            as<Transposable>(this->get_preconditioner())->conj_transpose()))
+        .with_criteria(this->get_stop_criterion_factory())
+        .with_replacement_period(this->get_parameters().replacement_period)
+        .on(this->get_executor())
+        ->generate(share(
+            as<Transposable>(this->get_system_matrix())->conj_transpose()));
+}
+
+
+template <typename ValueType>
+void PipeCg<ValueType>::apply_impl(const LinOp* b, LinOp* x) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    experimental::precision_dispatch_real_complex_distributed<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            this->apply_dense_impl(dense_b, dense_x);
+        },
+        b, x);
+}
+
+
+template <typename ValueType>
+template <typename VectorType>
+void PipeCg<ValueType>::apply_dense_impl(const VectorType* dense_b,
+                                         VectorType* dense_x) const
+{
+    using LocalVector = matrix::Dense<ValueType>;
+
+    constexpr uint8 RelativeStoppingId{1};
+
+    auto exec = this->get_executor();
+    this->setup_workspace();
+
+    GKO_SOLVER_VECTOR(r, dense_b);
+    GKO_SOLVER_VECTOR(u, dense_b);
+    GKO_SOLVER_VECTOR(w, dense_b);
+    GKO_SOLVER_VECTOR(m, dense_b);
+    GKO_SOLVER_VECTOR(n, dense_b);
+    GKO_SOLVER_VECTOR(z, dense_b);
+    GKO_SOLVER_VECTOR(q, dense_b);
+    GKO_SOLVER_VECTOR(s, dense_b);
+    GKO_SOLVER_VECTOR(p, dense_b);
+
+    GKO_SOLVER_SCALAR(beta, dense_b);
+    GKO_SOLVER_SCALAR(alpha, dense_b);
+    GKO_SOLVER_SCALAR(prev_gamma, dense_b);
+
+    GKO_SOLVER_ONE_MINUS_ONE();
+
+    bool one_changed{};
+    GKO_SOLVER_STOP_REDUCTION_ARRAYS();
+
+    // both dot products are stored contiguously to reduce them together
+    const auto num_rhs = dense_b->get_size()[1];
+    auto dots = this->template create_workspace_op<LocalVector>(
+        GKO_SOLVER_TRAITS::dots, dim<2>{2, num_rhs});
+    auto gamma = dots->create_submatrix(span{0, 1}, span{0, num_rhs});
+    auto delta = dots->create_submatrix(span{1, 2}, span{0, num_rhs});
+
+    // r = dense_b
+    // prev_gamma = alpha = 0.0
+    // z = q = s = p = 0
+    exec->run(pipe_cg::make_initialize(
+        gko::detail::get_local(dense_b), gko::detail::get_local(r),
+        gko::detail::get_local(z), gko::detail::get_local(q),
+        gko::detail::get_local(s), gko::detail::get_local(p), prev_gamma,
+        alpha, &stop_status));
+
+    this->get_system_matrix()->apply(neg_one_op, dense_x, one_op, r);
+    auto stop_criterion = this->get_stop_criterion_factory()->generate(
+        this->get_system_matrix(),
+        std::shared_ptr<const LinOp>(dense_b, [](const LinOp*) {}), dense_x, r);
+    // u = preconditioner * r
+    this->get_preconditioner()->apply(r, u);
+    // w = A * u
+    this->get_system_matrix()->apply(u, w);
+
+    int iter = -1;
+    /* Memory movement summary:
+     * 27n * values + matrix/preconditioner storage
+     * 1x SpMV:           2n * values + storage
+     * 1x Preconditioner: 2n * values + storage
+     * 2x dot             4n
+     * 1x step 2 (axpys) 18n
+     * 1x norm2 residual   n
+     */
+    while (true) {
+        // gamma = dot(r, u)
+        // delta = dot(u, w)
+        gko::detail::get_local(r)->compute_conj_dot(
+            gko::detail::get_local(u), gamma, reduction_tmp);
+        gko::detail::get_local(u)->compute_conj_dot(
+            gko::detail::get_local(w), delta, reduction_tmp);
+        auto reduction = gko::detail::start_global_sum(dense_b, dots);
+        // the reduction is overlapped with
+        // m = preconditioner * w
+        // n = A * m
+        this->get_preconditioner()->apply(w, m);
+        this->get_system_matrix()->apply(m, n);
+        reduction.wait();
+
+        ++iter;
+        bool all_stopped =
+            stop_criterion->update()
+                .num_iterations(iter)
+                .residual(r)
+                .implicit_sq_residual_norm(gamma)
+                .solution(dense_x)
+                .check(RelativeStoppingId, true, &stop_status, &one_changed);
+        this->template log<log::Logger::iteration_complete>(
+            this, dense_b, dense_x, iter, r, nullptr, gamma.get(),
+            &stop_status, all_stopped);
+        if (all_stopped) {
+            break;
+        }
+
+        // beta = gamma / prev_gamma
+        // alpha = gamma / (delta - beta * gamma / alpha)
+        // prev_gamma = gamma
+        exec->run(pipe_cg::make_step_1(beta, alpha, prev_gamma, gamma.get(),
+                                       delta.get(), &stop_status));
+        // z = n + beta * z
+        // q = m + beta * q
+        // s = w + beta * s
+        // p = u + beta * p
+        // x = x + alpha * p
+        // r = r - alpha * s
+        // u = u - alpha * q
+        // w = w - alpha * z
+        exec->run(pipe_cg::make_step_2(
+            gko::detail::get_local(dense_x), gko::detail::get_local(r),
+            gko::detail::get_local(u), gko::detail::get_local(w),
+            gko::detail::get_local(m), gko::detail::get_local(n),
+            gko::detail::get_local(z), gko::detail::get_local(q),
+            gko::detail::get_local(s), gko::detail::get_local(p), beta, alpha,
+            &stop_status));
+        const auto period = this->get_parameters().replacement_period;
+        if (period > 0 && (iter + 1) % period == 0) {
+            // replace the recursively updated vectors by their true values to
+            // remove the rounding errors accumulated in the recurrences
+            // r = b - A * x
+            // u = preconditioner * r
+            // w = A * u
+            // s = A * p
+            // q = preconditioner * s
+            // z = A * q
+            r->copy_from(dense_b);
+            this->get_system_matrix()->apply(neg_one_op, dense_x, one_op, r);
+            this->get_preconditioner()->apply(r, u);
+            this->get_system_matrix()->apply(u, w);
+            this->get_system_matrix()->apply(p, s);
+            this->get_preconditioner()->apply(s, q);
+            this->get_system_matrix()->apply(q, z);
+        }
+    }
+}
+
+
+template <typename ValueType>
+void PipeCg<ValueType>::apply_impl(const LinOp* alpha, const LinOp* b,
+                                   const LinOp* beta, LinOp* x) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    experimental::precision_dispatch_real_complex_distributed<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            auto x_clone = dense_x->clone();
+            this->apply_dense_impl(dense_b, x_clone.get());
+            dense_x->scale(dense_beta);
+            dense_x->add_scaled(dense_alpha, x_clone);
+        },
+        alpha, b, beta, x);
+}
+
+
+template <typename ValueType>
+int workspace_traits<PipeCg<ValueType>>::num_arrays(const Solver&)
+{
+    return 2;
+}
+
+
+template <typename ValueType>
+int workspace_traits<PipeCg<ValueType>>::num_vectors(const Solver&)
+{
+    return 15;
+}
+
+
+template <typename ValueType>
+std::vector<std::string> workspace_traits<PipeCg<ValueType>>::op_names(
+    const Solver&)
+{
+    return {
+        "r",
+        "u",
+        "w",
+        "m",
+        "n",
+        "z",
+        "q",
+        "s",
+        "p",
+        "dots",
+        "beta",
+        "alpha",
+        "prev_gamma",
+        "one",
+        "minus_one",
+    };
+}
+
+
+template <typename ValueType>
+std::vector<std::string> workspace_traits<PipeCg<ValueType>>::array_names(
+    const Solver&)
+{
+    return {"stop", "tmp"};
+}
+
+
+template <typename ValueType>
+std::vector<int> workspace_traits<PipeCg<ValueType>>::scalars(const Solver&)
+{
+    return {dots, beta, alpha, prev_gamma};
+}
+
+
+template <typename ValueType>
+std::vector<int> workspace_traits<PipeCg<ValueType>>::vectors(const Solver&)
+{
+    return {r, u, w, m, n, z, q, s, p};
+}
+
+
+#define GKO_DECLARE_PIPE_CG(_type) class PipeCg<_type>
+#define GKO_DECLARE_PIPE_CG_TRAITS(_type) \
+    struct workspace_traits<PipeCg<_type>>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG);
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG_TRAITS);
+
+
+}  // namespace solver
+}  // namespace gko
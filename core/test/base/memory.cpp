@@ -0,0 +1,180 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/base/memory.hpp>
+
+#include <memory>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/log/logger.hpp>
+
+
+namespace {
+
+
+struct AllocationLogger : gko::log::Logger {
+    void on_allocation_completed(const gko::Executor*,
+                                 const gko::size_type& num_bytes,
+                                 const gko::uintptr&) const override
+    {
+        num_allocations++;
+        allocated_bytes += num_bytes;
+    }
+
+    void on_free_completed(const gko::Executor*,
+                           const gko::uintptr&) const override
+    {
+        num_frees++;
+    }
+
+    mutable int num_allocations{};
+    mutable int num_frees{};
+    mutable gko::size_type allocated_bytes{};
+};
+
+
+TEST(CachingCpuAllocator, ReusesFreedBlocks)
+{
+    gko::CachingCpuAllocator alloc;
+
+    auto ptr = alloc.allocate(100);
+    alloc.deallocate(ptr);
+    auto ptr2 = alloc.allocate(80);
+
+    ASSERT_EQ(ptr, ptr2);
+    auto stats = alloc.get_statistics();
+    ASSERT_EQ(stats.hits, 1);
+    ASSERT_EQ(stats.misses, 1);
+    alloc.deallocate(ptr2);
+}
+
+
+TEST(CachingCpuAllocator, DoesNotReuseBlocksFromOtherSizeClasses)
+{
+    gko::CachingCpuAllocator alloc;
+
+    auto ptr = alloc.allocate(100);
+    alloc.deallocate(ptr);
+    auto ptr2 = alloc.allocate(1000);
+
+    auto stats = alloc.get_statistics();
+    ASSERT_EQ(stats.hits, 0);
+    ASSERT_EQ(stats.misses, 2);
+    alloc.deallocate(ptr2);
+}
+
+
+TEST(CachingCpuAllocator, DoesNotCacheLargeAllocations)
+{
+    gko::CachingCpuAllocator alloc{1024};
+
+    alloc.deallocate(alloc.allocate(2000));
+    alloc.deallocate(alloc.allocate(2000));
+
+    auto stats = alloc.get_statistics();
+    ASSERT_EQ(stats.hits, 0);
+    ASSERT_EQ(stats.misses, 2);
+}
+
+
+TEST(CachingCpuAllocator, BoundsCachedBytes)
+{
+    // only a single 128 byte block fits into the cache
+    gko::CachingCpuAllocator alloc{1024, 200};
+    auto ptr1 = alloc.allocate(100);
+    auto ptr2 = alloc.allocate(100);
+    alloc.deallocate(ptr1);
+    alloc.deallocate(ptr2);
+
+    ptr1 = alloc.allocate(100);
+    ptr2 = alloc.allocate(100);
+
+    auto stats = alloc.get_statistics();
+    ASSERT_EQ(stats.hits, 1);
+    ASSERT_EQ(stats.misses, 3);
+    alloc.deallocate(ptr1);
+    alloc.deallocate(ptr2);
+}
+
+
+TEST(CachingCpuAllocator, TracksCurrentAndPeakBytes)
+{
+    gko::CachingCpuAllocator alloc;
+
+    auto ptr1 = alloc.allocate(100);
+    auto ptr2 = alloc.allocate(2000);
+    alloc.deallocate(ptr1);
+    auto ptr3 = alloc.allocate(10);
+
+    auto stats = alloc.get_statistics();
+    ASSERT_EQ(stats.current_bytes, 2010);
+    ASSERT_EQ(stats.peak_bytes, 2100);
+    alloc.deallocate(ptr2);
+    alloc.deallocate(ptr3);
+    ASSERT_EQ(alloc.get_statistics().current_bytes, 0);
+}
+
+
+TEST(CachingCpuAllocator, UsesSeparateCachesPerThread)
+{
+    gko::CachingCpuAllocator alloc;
+    alloc.deallocate(alloc.allocate(100));
+
+    std::thread thread{[&] { alloc.deallocate(alloc.allocate(100)); }};
+    thread.join();
+    alloc.deallocate(alloc.allocate(100));
+
+    auto stats = alloc.get_statistics();
+    ASSERT_EQ(stats.hits, 1);
+    ASSERT_EQ(stats.misses, 2);
+}
+
+
+TEST(CachingCpuAllocator, WorksWithExecutor)
+{
+    auto alloc = std::make_shared<gko::CachingCpuAllocator>();
+    auto exec = gko::ReferenceExecutor::create(alloc);
+
+    {
+        gko::array<double> array{exec, 10};
+        array.fill(1.0);
+    }
+    // 80 and 96 bytes are in the same size class
+    gko::array<double> array{exec, 12};
+
+    auto stats = alloc->get_statistics();
+    ASSERT_EQ(stats.hits, 1);
+    ASSERT_EQ(stats.misses, 1);
+    ASSERT_EQ(stats.current_bytes, 12 * sizeof(double));
+}
+
+
+TEST(CachingCpuAllocator, LogsSystemAllocations)
+{
+    auto logger = std::make_shared<AllocationLogger>();
+    auto alloc = std::make_shared<gko::CachingCpuAllocator>(1024);
+    alloc->add_logger(logger);
+
+    auto ptr1 = alloc->allocate(100);
+    alloc->deallocate(ptr1);
+    // served from the cache, no system allocation
+    ptr1 = alloc->allocate(100);
+    auto ptr2 = alloc->allocate(2000);
+    alloc->deallocate(ptr2);
+
+    ASSERT_EQ(logger->num_allocations, 2);
+    ASSERT_EQ(logger->allocated_bytes, 128 + 2000);
+    ASSERT_EQ(logger->num_frees, 1);
+    alloc->deallocate(ptr1);
+    alloc.reset();
+    // the cached block is released with the allocator
+    ASSERT_EQ(logger->num_frees, 2);
+}
+
+
+}  // namespace
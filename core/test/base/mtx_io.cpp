@@ -2,8 +2,12 @@
 //
 // SPDX-License-Identifier: BSD-3-Clause
 
+#include <clocale>
+#include <cstdio>
 #include <cstring>
+#include <fstream>
 #include <sstream>
+#include <string>
 
 #include <gtest/gtest.h>
 
@@ -11,6 +15,7 @@
 #include <ginkgo/core/base/lin_op.hpp>
 #include <ginkgo/core/base/mtx_io.hpp>
 #include <ginkgo/core/base/name_demangling.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 
 #include "core/test/utils.hpp"
@@ -433,6 +438,120 @@ TEST(MtxReader, ReadsSparseIgnoresExtraCharactersInRow)
 }
 
 
+TEST(MtxReader, ReadsLargeSparseRealMtx)
+{
+    // large enough to be split into multiple chunks parsed concurrently
+    const gko::int64 num_rows = 200000;
+    std::ostringstream oss;
+    oss << "%%MatrixMarket matrix coordinate real general\n"
+        << num_rows << ' ' << num_rows << ' ' << 2 * num_rows << '\n';
+    for (gko::int64 row = 0; row < num_rows; row++) {
+        oss << row + 1 << ' ' << row + 1 << ' ' << row << ".5\n";
+        // empty lines and trailing whitespace are ignored
+        oss << row + 1 << ' ' << num_rows - row << "\t-1.25e1 \n\n";
+    }
+    std::istringstream iss(oss.str());
+
+    auto data = gko::read_raw<double, gko::int64>(iss);
+
+    ASSERT_EQ(data.size, gko::dim<2>(num_rows, num_rows));
+    ASSERT_EQ(data.nonzeros.size(), 2 * num_rows);
+    gko::matrix_data<double, gko::int64> ref(data.size);
+    for (gko::int64 row = 0; row < num_rows; row++) {
+        ref.nonzeros.emplace_back(row, row, row + 0.5);
+        ref.nonzeros.emplace_back(row, num_rows - row - 1, -12.5);
+    }
+    ref.sum_duplicates();
+    data.sum_duplicates();
+    ASSERT_EQ(data.nonzeros, ref.nonzeros);
+}
+
+
+TEST(MtxReader, FailsWhenReadingSparseMtxWithMissingEntries)
+{
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 3 4\n"
+        "1 1 1.0\n"
+        "2 2 5.0\n"
+        "1 2 3.0\n");
+
+    ASSERT_THROW((gko::read_raw<double, gko::int32>(iss)), gko::StreamError);
+}
+
+
+TEST(MtxReader, FailsWhenReadingSparseMtxWithMissingValue)
+{
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 3 4\n"
+        "1 1 1.0\n"
+        "2 2\n"
+        "1 2 3.0\n"
+        "1 3 2.0\n");
+
+    ASSERT_THROW((gko::read_raw<double, gko::int32>(iss)), gko::StreamError);
+}
+
+
+TEST(MtxReader, FailsWhenReadingSparseMtxWithNegativeIndex)
+{
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 3 2\n"
+        "1 1 1.0\n"
+        "2 -2 5.0\n");
+
+    ASSERT_THROW((gko::read_raw<double, gko::int32>(iss)), gko::StreamError);
+}
+
+
+TEST(MtxReader, FailsWhenReadingSparseMtxWithZeroIndex)
+{
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 3 2\n"
+        "1 1 1.0\n"
+        "0 2 5.0\n");
+
+    ASSERT_THROW((gko::read_raw<double, gko::int32>(iss)), gko::StreamError);
+}
+
+
+TEST(MtxReader, FailsWhenReadingSparseMtxWithOverflowingIndex)
+{
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 3 2\n"
+        "1 1 1.0\n"
+        "4294967298 2 5.0\n");
+
+    ASSERT_THROW((gko::read_raw<double, gko::int32>(iss)), gko::StreamError);
+}
+
+
+TEST(MtxReader, ReadsSparseMtxIndependentOfLocale)
+{
+    const std::string old_locale = std::setlocale(LC_NUMERIC, nullptr);
+    if (!std::setlocale(LC_NUMERIC, "de_DE.UTF-8") &&
+        !std::setlocale(LC_NUMERIC, "de_DE")) {
+        GTEST_SKIP() << "no locale with a decimal comma available";
+    }
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 3 2\n"
+        "1 1 1.5\n"
+        "2 2 +2.25e1\n");
+
+    auto data = gko::read_raw<double, gko::int32>(iss);
+    std::setlocale(LC_NUMERIC, old_locale.c_str());
+
+    ASSERT_EQ(data.nonzeros.size(), 2);
+    ASSERT_EQ(data.nonzeros[0].value, 1.5);
+    ASSERT_EQ(data.nonzeros[1].value, 22.5);
+}
+
+
 TEST(MtxReader, ReadHeaderIgnoresExtraCharacters)
 {
     using tpl = gko::matrix_data<double, gko::int32>::nonzero_type;
@@ -917,6 +1036,224 @@ TEST(MtxReader, WritesComplexBinary)
 }
 
 
+TEST(MtxReader, ReadsBinaryFile)
+{
+    auto raw_data = build_binary_real_data();
+    const std::string filename = "mtx_io_reads_binary_file.bin";
+    {
+        std::ofstream file{filename, std::ios::binary};
+        file.write(reinterpret_cast<char*>(raw_data.data()),
+                   raw_data.size() * sizeof(gko::uint64));
+    }
+    auto exec = gko::ReferenceExecutor::create();
+    auto test_read = [&](auto mtx_data) {
+        SCOPED_TRACE(gko::name_demangling::get_static_type(mtx_data));
+        using value_type =
+            typename std::decay_t<decltype(mtx_data)>::value_type;
+        using index_type =
+            typename std::decay_t<decltype(mtx_data)>::index_type;
+
+        auto data =
+            gko::read_binary_file_raw<value_type, index_type>(exec, filename)
+                .copy_to_host();
+
+        ASSERT_EQ(data.size, gko::dim<2>(64, 32));
+        ASSERT_EQ(data.nonzeros.size(), 4);
+        ASSERT_EQ(data.nonzeros[0].row, 0);
+        ASSERT_EQ(data.nonzeros[1].row, 1);
+        ASSERT_EQ(data.nonzeros[2].row, 4);
+        ASSERT_EQ(data.nonzeros[3].row, 16);
+        ASSERT_EQ(data.nonzeros[0].column, 1);
+        ASSERT_EQ(data.nonzeros[1].column, 1);
+        ASSERT_EQ(data.nonzeros[2].column, 2);
+        ASSERT_EQ(data.nonzeros[3].column, 25);
+        ASSERT_EQ(data.nonzeros[0].value, value_type{0.0});
+        ASSERT_EQ(data.nonzeros[1].value, value_type{2.5});
+        ASSERT_EQ(data.nonzeros[2].value, value_type{-2.5});
+        ASSERT_EQ(data.nonzeros[3].value, value_type{0.0});
+    };
+
+    test_read(gko::matrix_data<float, gko::int32>{});
+    test_read(gko::matrix_data<double, gko::int32>{});
+    test_read(gko::matrix_data<std::complex<double>, gko::int32>{});
+    test_read(gko::matrix_data<float, gko::int64>{});
+    test_read(gko::matrix_data<std::complex<float>, gko::int64>{});
+    std::remove(filename.c_str());
+}
+
+
+TEST(MtxReader, FailsWhenReadingTruncatedBinaryFile)
+{
+    auto raw_data = build_binary_real_data();
+    const std::string filename = "mtx_io_truncated_binary_file.bin";
+    {
+        std::ofstream file{filename, std::ios::binary};
+        file.write(reinterpret_cast<char*>(raw_data.data()),
+                   (raw_data.size() - 1) * sizeof(gko::uint64));
+    }
+    auto exec = gko::ReferenceExecutor::create();
+
+    ASSERT_THROW(
+        (gko::read_binary_file_raw<double, gko::int32>(exec, filename)),
+        gko::StreamError);
+    std::remove(filename.c_str());
+}
+
+
+TEST(MtxReader, WritesAndReadsBinaryCsrFile)
+{
+    using Csr = gko::matrix::Csr<double, gko::int32>;
+    auto exec = gko::ReferenceExecutor::create();
+    auto mtx = gko::initialize<Csr>(
+        {{1.0, 0.0, 2.0}, {0.0, 0.0, 0.0}, {0.0, -3.0, 4.5}}, exec);
+    const std::string filename = "mtx_io_binary_csr_file.bin";
+    {
+        std::ofstream file{filename, std::ios::binary};
+        gko::write_binary_csr(file, mtx.get());
+    }
+
+    auto result = gko::read_binary_csr_file<double, gko::int32>(exec, filename);
+    auto converted =
+        gko::read_binary_csr_file<std::complex<float>, gko::int64>(exec,
+                                                                   filename);
+
+    GKO_ASSERT_MTX_NEAR(result, mtx, 0.0);
+    GKO_ASSERT_MTX_NEAR(converted, mtx, 0.0);
+    // the mapping is private, modifications don't change the file
+    result->get_values()[0] = 5.0;
+    auto result2 =
+        gko::read_binary_csr_file<double, gko::int32>(exec, filename);
+    GKO_ASSERT_MTX_NEAR(result2, mtx, 0.0);
+    std::remove(filename.c_str());
+}
+
+
+TEST(MtxReader, ReadsBinaryCsrFileFromCoordinateBinary)
+{
+    using Csr = gko::matrix::Csr<double, gko::int32>;
+    auto raw_data = build_binary_real_data();
+    const std::string filename = "mtx_io_binary_csr_from_coo.bin";
+    {
+        std::ofstream file{filename, std::ios::binary};
+        file.write(reinterpret_cast<char*>(raw_data.data()),
+                   raw_data.size() * sizeof(gko::uint64));
+    }
+    auto exec = gko::ReferenceExecutor::create();
+    std::stringstream ss{std::string{reinterpret_cast<char*>(raw_data.data()),
+                                     raw_data.size() * sizeof(gko::uint64)}};
+    auto expected = gko::read_binary<Csr>(ss, exec);
+
+    auto result = gko::read_binary_csr_file<double, gko::int32>(exec, filename);
+
+    GKO_ASSERT_MTX_NEAR(result, expected, 0.0);
+    std::remove(filename.c_str());
+}
+
+
+TEST(MtxReader, FailsWhenReadingBinaryFileWithOutOfBoundsEntry)
+{
+    auto raw_data = build_binary_real_data();
+    // the column of the first entry
+    raw_data[5] = 32;
+    const std::string filename = "mtx_io_out_of_bounds_binary_file.bin";
+    {
+        std::ofstream file{filename, std::ios::binary};
+        file.write(reinterpret_cast<char*>(raw_data.data()),
+                   raw_data.size() * sizeof(gko::uint64));
+    }
+    auto exec = gko::ReferenceExecutor::create();
+
+    ASSERT_THROW(
+        (gko::read_binary_file_raw<double, gko::int32>(exec, filename)),
+        gko::StreamError);
+    std::remove(filename.c_str());
+}
+
+
+TEST(MtxReader, ReadsLargeBinaryCsrFile)
+{
+    using Csr = gko::matrix::Csr<double, gko::int32>;
+    // large enough to be converted by multiple threads
+    const gko::int32 size = 300000;
+    gko::matrix_data<double, gko::int32> data{gko::dim<2>(size, size)};
+    for (gko::int32 row = 0; row < size; row++) {
+        data.nonzeros.emplace_back(row, row, row + 0.5);
+        data.nonzeros.emplace_back(row, (row * 7) % size, -1.0);
+    }
+    data.sum_duplicates();
+    auto exec = gko::ReferenceExecutor::create();
+    auto mtx = Csr::create(exec);
+    mtx->read(data);
+    const std::string filename = "mtx_io_large_binary_csr_file.bin";
+    {
+        std::ofstream file{filename, std::ios::binary};
+        gko::write_binary_csr(file, mtx.get());
+    }
+
+    auto result = gko::read_binary_csr_file<float, gko::int64>(exec, filename);
+
+    GKO_ASSERT_MTX_NEAR(result, mtx, 0.0);
+    std::remove(filename.c_str());
+}
+
+
+TEST(MtxReader, FailsWhenReadingBinaryCsrFileWithInvalidRowPtrs)
+{
+    using Csr = gko::matrix::Csr<double, gko::int32>;
+    auto exec = gko::ReferenceExecutor::create();
+    auto mtx = gko::initialize<Csr>(
+        {{1.0, 0.0, 2.0}, {0.0, 0.0, 0.0}, {0.0, -3.0, 4.5}}, exec);
+    const std::string filename = "mtx_io_invalid_row_ptrs_csr_file.bin";
+    {
+        std::ofstream file{filename, std::ios::binary};
+        gko::write_binary_csr(file, mtx.get());
+    }
+    {
+        // the row pointers are stored at offset 64, make them {0, 3, 2, 4}
+        std::fstream file{filename,
+                          std::ios::binary | std::ios::in | std::ios::out};
+        const gko::int32 row_ptr = 3;
+        file.seekp(64 + sizeof(gko::int32));
+        file.write(reinterpret_cast<const char*>(&row_ptr), sizeof(row_ptr));
+    }
+
+    ASSERT_THROW(
+        (gko::read_binary_csr_file<double, gko::int32>(exec, filename)),
+        gko::StreamError);
+    ASSERT_THROW(
+        (gko::read_binary_csr_file<float, gko::int64>(exec, filename)),
+        gko::StreamError);
+    std::remove(filename.c_str());
+}
+
+
+TEST(MtxReader, FailsWhenReadingBinaryCsrFileWithInvalidColumn)
+{
+    using Csr = gko::matrix::Csr<double, gko::int32>;
+    auto exec = gko::ReferenceExecutor::create();
+    auto mtx = gko::initialize<Csr>(
+        {{1.0, 0.0, 2.0}, {0.0, 0.0, 0.0}, {0.0, -3.0, 4.5}}, exec);
+    const std::string filename = "mtx_io_invalid_column_csr_file.bin";
+    {
+        std::ofstream file{filename, std::ios::binary};
+        gko::write_binary_csr(file, mtx.get());
+    }
+    {
+        // the column indices are stored at offset 128
+        std::fstream file{filename,
+                          std::ios::binary | std::ios::in | std::ios::out};
+        const gko::int32 col = 3;
+        file.seekp(128);
+        file.write(reinterpret_cast<const char*>(&col), sizeof(col));
+    }
+
+    ASSERT_THROW(
+        (gko::read_binary_csr_file<double, gko::int32>(exec, filename)),
+        gko::StreamError);
+    std::remove(filename.c_str());
+}
+
+
 template <typename ValueType, typename IndexType>
 class DummyLinOp
     : public gko::EnableLinOp<DummyLinOp<ValueType, IndexType>>,
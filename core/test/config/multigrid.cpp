@@ -10,6 +10,7 @@
 #include <ginkgo/core/config/config.hpp>
 #include <ginkgo/core/multigrid/fixed_coarsening.hpp>
 #include <ginkgo/core/multigrid/pgm.hpp>
+#include <ginkgo/core/multigrid/ruge_stuben.hpp>
 #include <ginkgo/core/solver/ir.hpp>
 #include <ginkgo/core/solver/multigrid.hpp>
 #include <ginkgo/core/stop/iteration.hpp>
@@ -54,6 +55,14 @@ struct Pgm : MultigridLevelConfigTest<gko::multigrid::Pgm<float, int>,
         param.with_deterministic(true);
         config_map["skip_sorting"] = pnode{true};
         param.with_skip_sorting(true);
+        config_map["smoothed_aggregation"] = pnode{true};
+        param.with_smoothed_aggregation(true);
+        config_map["smoothing_relaxation"] = pnode{1.0};
+        param.with_smoothing_relaxation(1.0);
+        config_map["num_estimation_iterations"] = pnode{5};
+        param.with_num_estimation_iterations(5u);
+        config_map["prolongation_filter_threshold"] = pnode{0.1};
+        param.with_prolongation_filter_threshold(0.1);
     }
 
     template <typename AnswerType>
@@ -67,6 +76,51 @@ struct Pgm : MultigridLevelConfigTest<gko::multigrid::Pgm<float, int>,
                   ans_param.max_unassigned_ratio);
         ASSERT_EQ(res_param.deterministic, ans_param.deterministic);
         ASSERT_EQ(res_param.skip_sorting, ans_param.skip_sorting);
+        ASSERT_EQ(res_param.smoothed_aggregation,
+                  ans_param.smoothed_aggregation);
+        ASSERT_EQ(res_param.smoothing_relaxation,
+                  ans_param.smoothing_relaxation);
+        ASSERT_EQ(res_param.num_estimation_iterations,
+                  ans_param.num_estimation_iterations);
+        ASSERT_EQ(res_param.prolongation_filter_threshold,
+                  ans_param.prolongation_filter_threshold);
+    }
+};
+
+
+struct RugeStuben
+    : MultigridLevelConfigTest<gko::multigrid::RugeStuben<float, int>,
+                               gko::multigrid::RugeStuben<double, int>> {
+    static pnode::map_type setup_base()
+    {
+        return {{"type", pnode{"multigrid::RugeStuben"}}};
+    }
+
+    template <typename ParamType>
+    static void set(pnode::map_type& config_map, ParamType& param, registry reg,
+                    std::shared_ptr<const gko::Executor> exec)
+    {
+        config_map["strength_threshold"] = pnode{0.5};
+        param.with_strength_threshold(0.5);
+        config_map["splitting"] = pnode{"hmis"};
+        param.with_splitting(gko::multigrid::splitting_type::hmis);
+        config_map["interpolation"] = pnode{"extended_i"};
+        param.with_interpolation(
+            gko::multigrid::interpolation_type::extended_i);
+        config_map["skip_sorting"] = pnode{true};
+        param.with_skip_sorting(true);
+    }
+
+    template <typename AnswerType>
+    static void validate(gko::LinOpFactory* result, AnswerType* answer)
+    {
+        auto res_param = gko::as<AnswerType>(result)->get_parameters();
+        auto ans_param = answer->get_parameters();
+
+        ASSERT_EQ(res_param.strength_threshold, ans_param.strength_threshold);
+        ASSERT_EQ(res_param.splitting, ans_param.splitting);
+        ASSERT_EQ(res_param.interpolation, ans_param.interpolation);
+        ASSERT_EQ(res_param.skip_sorting, ans_param.skip_sorting);
     }
 };
 
@@ -86,7 +140,7 @@ protected:
 };
 
 
-using MultigridLevelTypes = ::testing::Types<::Pgm>;
+using MultigridLevelTypes = ::testing::Types<::Pgm, ::RugeStuben>;
 
 
 TYPED_TEST_SUITE(MultigridLevel, MultigridLevelTypes, TypenameNameGenerator);
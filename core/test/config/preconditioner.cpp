@@ -334,6 +334,8 @@ struct Sor
         config_map["u_solver"] = pnode{
             {{"type", pnode{"solver::Ir"}}, {"value_type", pnode{"float32"}}}};
         param.with_u_solver(Ir::build());
+        config_map["multicolor"] = pnode{true};
+        param.with_multicolor(true);
     }
 
     template <bool from_reg, typename AnswerType>
@@ -347,6 +349,7 @@ struct Sor
         ASSERT_EQ(res_param.relaxation_factor, ans_param.relaxation_factor);
         ASSERT_EQ(typeid(res_param.l_solver), typeid(ans_param.l_solver));
         ASSERT_EQ(typeid(res_param.u_solver), typeid(ans_param.u_solver));
+        ASSERT_EQ(res_param.multicolor, ans_param.multicolor);
     }
 };
 
@@ -381,6 +384,8 @@ struct GaussSeidel
         config_map["u_solver"] = pnode{
             {{"type", pnode{"solver::Ir"}}, {"value_type", pnode{"float32"}}}};
         param.with_u_solver(Ir::build());
+        config_map["multicolor"] = pnode{true};
+        param.with_multicolor(true);
     }
 
     template <bool from_reg, typename AnswerType>
@@ -393,6 +398,7 @@ struct GaussSeidel
         ASSERT_EQ(res_param.symmetric, ans_param.symmetric);
         ASSERT_EQ(typeid(res_param.l_solver), typeid(ans_param.l_solver));
         ASSERT_EQ(typeid(res_param.u_solver), typeid(ans_param.u_solver));
+        ASSERT_EQ(res_param.multicolor, ans_param.multicolor);
     }
 };
 
@@ -434,6 +440,31 @@ struct Schwarz
         config_map["generated_local_solver"] = pnode{"linop"};
         param.with_generated_local_solver(
             detail::registry_accessor::get_data<gko::LinOp>(reg, "linop"));
+        config_map["overlap"] = pnode{2};
+        param.with_overlap(2u);
+        config_map["restricted"] = pnode{false};
+        param.with_restricted(false);
+        if (from_reg) {
+            config_map["coarse_level"] = pnode{"solver"};
+            param.with_coarse_level(
+                detail::registry_accessor::get_data<gko::LinOpFactory>(
+                    reg, "solver"));
+            config_map["coarse_solver"] = pnode{"solver"};
+            param.with_coarse_solver(
+                detail::registry_accessor::get_data<gko::LinOpFactory>(
+                    reg, "solver"));
+        } else {
+            config_map["coarse_level"] =
+                pnode{{{"type", pnode{"solver::Ir"}},
+                       {"value_type", pnode{"float32"}}}};
+            param.with_coarse_level(DummyIr::build().on(exec));
+            config_map["coarse_solver"] =
+                pnode{{{"type", pnode{"solver::Ir"}},
+                       {"value_type", pnode{"float32"}}}};
+            param.with_coarse_solver(DummyIr::build().on(exec));
+        }
+        config_map["coarse_weight"] = pnode{0.5};
+        param.with_coarse_weight(0.5);
     }
 
     template <bool from_reg, typename AnswerType>
@@ -452,6 +483,22 @@ struct Schwarz
         }
         ASSERT_EQ(res_param.generated_local_solver,
                   ans_param.generated_local_solver);
+        ASSERT_EQ(res_param.overlap, ans_param.overlap);
+        ASSERT_EQ(res_param.restricted, ans_param.restricted);
+        if (from_reg) {
+            ASSERT_EQ(res_param.coarse_level, ans_param.coarse_level);
+            ASSERT_EQ(res_param.coarse_solver, ans_param.coarse_solver);
+        } else {
+            ASSERT_NE(
+                std::dynamic_pointer_cast<const typename DummyIr::Factory>(
+                    res_param.coarse_level),
+                nullptr);
+            ASSERT_NE(
+                std::dynamic_pointer_cast<const typename DummyIr::Factory>(
+                    res_param.coarse_solver),
+                nullptr);
+        }
+        ASSERT_EQ(res_param.coarse_weight, ans_param.coarse_weight);
     }
 };
 
@@ -14,12 +14,15 @@
 #include <ginkgo/core/solver/cb_gmres.hpp>
 #include <ginkgo/core/solver/cg.hpp>
 #include <ginkgo/core/solver/cgs.hpp>
+#include <ginkgo/core/solver/chebyshev.hpp>
 #include <ginkgo/core/solver/direct.hpp>
 #include <ginkgo/core/solver/fcg.hpp>
 #include <ginkgo/core/solver/gcr.hpp>
 #include <ginkgo/core/solver/gmres.hpp>
 #include <ginkgo/core/solver/idr.hpp>
 #include <ginkgo/core/solver/ir.hpp>
+#include <ginkgo/core/solver/pipe_bicgstab.hpp>
+#include <ginkgo/core/solver/pipe_cg.hpp>
 #include <ginkgo/core/solver/triangular.hpp>
 #include <ginkgo/core/stop/iteration.hpp>
 
@@ -143,6 +146,109 @@ struct Bicgstab : SolverConfigTest<gko::solver::Bicgstab<float>,
 };
 
 
+struct PipeCg : SolverConfigTest<gko::solver::PipeCg<float>,
+                                 gko::solver::PipeCg<double>> {
+    static pnode::map_type setup_base()
+    {
+        return {{"type", pnode{"solver::PipeCg"}}};
+    }
+
+    template <bool from_reg, typename ParamType>
+    static void set(pnode::map_type& config_map, ParamType& param, registry reg,
+                    std::shared_ptr<const gko::Executor> exec)
+    {
+        solver_config_test::template set<from_reg>(config_map, param, reg,
+                                                   exec);
+        config_map["replacement_period"] = pnode{10};
+        param.with_replacement_period(10u);
+    }
+
+    template <bool from_reg, typename AnswerType>
+    static void validate(gko::LinOpFactory* result, AnswerType* answer)
+    {
+        auto res_param = gko::as<AnswerType>(result)->get_parameters();
+        auto ans_param = answer->get_parameters();
+
+        solver_config_test::template validate<from_reg>(result, answer);
+        ASSERT_EQ(res_param.replacement_period, ans_param.replacement_period);
+    }
+};
+
+
+struct PipeBicgstab : SolverConfigTest<gko::solver::PipeBicgstab<float>,
+                                       gko::solver::PipeBicgstab<double>> {
+    static pnode::map_type setup_base()
+    {
+        return {{"type", pnode{"solver::PipeBicgstab"}}};
+    }
+
+    template <bool from_reg, typename ParamType>
+    static void set(pnode::map_type& config_map, ParamType& param, registry reg,
+                    std::shared_ptr<const gko::Executor> exec)
+    {
+        solver_config_test::template set<from_reg>(config_map, param, reg,
+                                                   exec);
+        config_map["replacement_period"] = pnode{10};
+        param.with_replacement_period(10u);
+    }
+
+    template <bool from_reg, typename AnswerType>
+    static void validate(gko::LinOpFactory* result, AnswerType* answer)
+    {
+        auto res_param = gko::as<AnswerType>(result)->get_parameters();
+        auto ans_param = answer->get_parameters();
+
+        solver_config_test::template validate<from_reg>(result, answer);
+        ASSERT_EQ(res_param.replacement_period, ans_param.replacement_period);
+    }
+};
+
+
+struct Chebyshev : SolverConfigTest<gko::solver::Chebyshev<float>,
+                                    gko::solver::Chebyshev<double>> {
+    static pnode::map_type setup_base()
+    {
+        return {{"type", pnode{"solver::Chebyshev"}}};
+    }
+
+    template <bool from_reg, typename ParamType>
+    static void set(pnode::map_type& config_map, ParamType& param, registry reg,
+                    std::shared_ptr<const gko::Executor> exec)
+    {
+        solver_config_test::template set<from_reg>(config_map, param, reg,
+                                                   exec);
+        config_map["foci"] = pnode{pnode::array_type{pnode{0.5}, pnode{2.0}}};
+        param.with_foci(0.5, 2.0);
+        config_map["num_estimation_iterations"] = pnode{5};
+        param.with_num_estimation_iterations(5u);
+        config_map["max_eigenvalue_scale"] = pnode{1.2};
+        param.with_max_eigenvalue_scale(1.2);
+        config_map["min_eigenvalue_ratio"] = pnode{0.1};
+        param.with_min_eigenvalue_ratio(0.1);
+        config_map["default_initial_guess"] = pnode{"zero"};
+        param.with_default_initial_guess(gko::solver::initial_guess_mode::zero);
+    }
+
+    template <bool from_reg, typename AnswerType>
+    static void validate(gko::LinOpFactory* result, AnswerType* answer)
+    {
+        auto res_param = gko::as<AnswerType>(result)->get_parameters();
+        auto ans_param = answer->get_parameters();
+
+        solver_config_test::template validate<from_reg>(result, answer);
+        ASSERT_EQ(res_param.foci, ans_param.foci);
+        ASSERT_EQ(res_param.num_estimation_iterations,
+                  ans_param.num_estimation_iterations);
+        ASSERT_EQ(res_param.max_eigenvalue_scale,
+                  ans_param.max_eigenvalue_scale);
+        ASSERT_EQ(res_param.min_eigenvalue_ratio,
+                  ans_param.min_eigenvalue_ratio);
+        ASSERT_EQ(res_param.default_initial_guess,
+                  ans_param.default_initial_guess);
+    }
+};
+
+
 struct Ir : SolverConfigTest<gko::solver::Ir<float>, gko::solver::Ir<double>> {
     static pnode::map_type setup_base()
     {
@@ -291,6 +397,8 @@ struct Gmres
         param.with_flexible(true);
         config_map["ortho_method"] = pnode{"cgs"};
         param.with_ortho_method(gko::solver::gmres::ortho_method::cgs);
+        config_map["s_step"] = pnode{2};
+        param.with_s_step(2u);
     }
 
     template <bool from_reg, typename AnswerType>
@@ -303,6 +411,7 @@ struct Gmres
         ASSERT_EQ(res_param.krylov_dim, ans_param.krylov_dim);
         ASSERT_EQ(res_param.flexible, ans_param.flexible);
         ASSERT_EQ(res_param.ortho_method, ans_param.ortho_method);
+        ASSERT_EQ(res_param.s_step, ans_param.s_step);
     }
 };
 
@@ -467,8 +576,9 @@ protected:
 
 
 using SolverTypes =
-    ::testing::Types<::Cg, ::Fcg, ::Cgs, ::Bicg, ::Bicgstab, ::Ir, ::Idr, ::Gcr,
-                     ::Gmres, ::CbGmres, ::Direct, ::LowerTrs, ::UpperTrs>;
+    ::testing::Types<::Cg, ::Fcg, ::Cgs, ::Bicg, ::Bicgstab, ::PipeCg,
+                     ::PipeBicgstab, ::Chebyshev, ::Ir, ::Idr, ::Gcr, ::Gmres,
+                     ::CbGmres, ::Direct, ::LowerTrs, ::UpperTrs>;
 
 
 TYPED_TEST_SUITE(Solver, SolverTypes, TypenameNameGenerator);
@@ -1422,6 +1422,66 @@ TYPED_TEST(MpiBindings, NonBlockingAllToAllVWorksCorrectly)
 }
 
 
+TYPED_TEST(MpiBindings, NeighborAllToAllVWorksCorrectly)
+{
+    auto comm = gko::experimental::mpi::communicator(MPI_COMM_WORLD);
+    auto my_rank = comm.rank();
+    auto num_ranks = comm.size();
+    auto source = (my_rank + num_ranks - 1) % num_ranks;
+    auto destination = (my_rank + 1) % num_ranks;
+    auto ring = gko::experimental::mpi::communicator(
+        comm, std::vector<int>{source}, std::vector<int>{destination});
+    auto send_array = gko::array<TypeParam>{
+        this->ref, I<TypeParam>{-1, static_cast<TypeParam>(my_rank), 1}};
+    auto recv_array = gko::array<TypeParam>{this->ref, {0, 0}};
+    auto ref_array = gko::array<TypeParam>{
+        this->ref, I<TypeParam>{0, static_cast<TypeParam>(source)}};
+    int send_count = 1;
+    int send_offset = 1;
+    int recv_count = 1;
+    int recv_offset = 1;
+
+    ring.neighbor_all_to_all_v(
+        this->ref, send_array.get_data(), &send_count, &send_offset,
+        gko::experimental::mpi::type_impl<TypeParam>::get_type(),
+        recv_array.get_data(), &recv_count, &recv_offset,
+        gko::experimental::mpi::type_impl<TypeParam>::get_type());
+
+    ASSERT_EQ(ring.rank(), my_rank);
+    GKO_ASSERT_ARRAY_EQ(recv_array, ref_array);
+}
+
+
+TYPED_TEST(MpiBindings, NonBlockingNeighborAllToAllVWorksCorrectly)
+{
+    auto comm = gko::experimental::mpi::communicator(MPI_COMM_WORLD);
+    auto my_rank = comm.rank();
+    auto num_ranks = comm.size();
+    auto source = (my_rank + num_ranks - 1) % num_ranks;
+    auto destination = (my_rank + 1) % num_ranks;
+    auto ring = gko::experimental::mpi::communicator(
+        comm, std::vector<int>{source}, std::vector<int>{destination});
+    auto send_array = gko::array<TypeParam>{
+        this->ref, I<TypeParam>{-1, static_cast<TypeParam>(my_rank), 1}};
+    auto recv_array = gko::array<TypeParam>{this->ref, {0, 0}};
+    auto ref_array = gko::array<TypeParam>{
+        this->ref, I<TypeParam>{0, static_cast<TypeParam>(source)}};
+    int send_count = 1;
+    int send_offset = 1;
+    int recv_count = 1;
+    int recv_offset = 1;
+
+    auto req = ring.i_neighbor_all_to_all_v(
+        this->ref, send_array.get_data(), &send_count, &send_offset,
+        gko::experimental::mpi::type_impl<TypeParam>::get_type(),
+        recv_array.get_data(), &recv_count, &recv_offset,
+        gko::experimental::mpi::type_impl<TypeParam>::get_type());
+
+    req.wait();
+    GKO_ASSERT_ARRAY_EQ(recv_array, ref_array);
+}
+
+
 TYPED_TEST(MpiBindings, CanScanValues)
 {
     auto comm = gko::experimental::mpi::communicator(MPI_COMM_WORLD);
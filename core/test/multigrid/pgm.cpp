@@ -59,6 +59,10 @@ TYPED_TEST(PgmFactory, DefaultSetting)
     ASSERT_EQ(factory->get_parameters().max_unassigned_ratio, 0.05);
     ASSERT_EQ(factory->get_parameters().deterministic, false);
     ASSERT_EQ(factory->get_parameters().skip_sorting, false);
+    ASSERT_EQ(factory->get_parameters().smoothed_aggregation, false);
+    ASSERT_EQ(factory->get_parameters().smoothing_relaxation, 4.0 / 3.0);
+    ASSERT_EQ(factory->get_parameters().num_estimation_iterations, 10u);
+    ASSERT_EQ(factory->get_parameters().prolongation_filter_threshold, 0.0);
 }
 
 
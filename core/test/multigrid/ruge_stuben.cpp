@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/multigrid/ruge_stuben.hpp>
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class RugeStubenFactory : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using MgLevel = gko::multigrid::RugeStuben<value_type, index_type>;
+    RugeStubenFactory()
+        : exec(gko::ReferenceExecutor::create()),
+          rs_factory(
+              MgLevel::build()
+                  .with_strength_threshold(0.5)
+                  .with_splitting(gko::multigrid::splitting_type::hmis)
+                  .with_interpolation(
+                      gko::multigrid::interpolation_type::extended_i)
+                  .with_skip_sorting(true)
+                  .on(exec))
+    {}
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::unique_ptr<typename MgLevel::Factory> rs_factory;
+};
+
+TYPED_TEST_SUITE(RugeStubenFactory, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(RugeStubenFactory, FactoryKnowsItsExecutor)
+{
+    ASSERT_EQ(this->rs_factory->get_executor(), this->exec);
+}
+
+
+TYPED_TEST(RugeStubenFactory, DefaultSetting)
+{
+    using MgLevel = typename TestFixture::MgLevel;
+    auto factory = MgLevel::build().on(this->exec);
+
+    ASSERT_EQ(factory->get_parameters().strength_threshold, 0.25);
+    ASSERT_EQ(factory->get_parameters().splitting,
+              gko::multigrid::splitting_type::pmis);
+    ASSERT_EQ(factory->get_parameters().interpolation,
+              gko::multigrid::interpolation_type::direct);
+    ASSERT_EQ(factory->get_parameters().skip_sorting, false);
+}
+
+
+TYPED_TEST(RugeStubenFactory, SetStrengthThreshold)
+{
+    ASSERT_EQ(this->rs_factory->get_parameters().strength_threshold, 0.5);
+}
+
+
+TYPED_TEST(RugeStubenFactory, SetSplitting)
+{
+    ASSERT_EQ(this->rs_factory->get_parameters().splitting,
+              gko::multigrid::splitting_type::hmis);
+}
+
+
+TYPED_TEST(RugeStubenFactory, SetInterpolation)
+{
+    ASSERT_EQ(this->rs_factory->get_parameters().interpolation,
+              gko::multigrid::interpolation_type::extended_i);
+}
+
+
+TYPED_TEST(RugeStubenFactory, SetSkipSorting)
+{
+    ASSERT_EQ(this->rs_factory->get_parameters().skip_sorting, true);
+}
+
+
+}  // namespace
@@ -34,6 +34,7 @@ TEST_F(SorFactory, CanDefaultBuild)
     ASSERT_EQ(params.symmetric, false);
     ASSERT_EQ(params.l_solver, nullptr);
     ASSERT_EQ(params.u_solver, nullptr);
+    ASSERT_EQ(params.multicolor, false);
 }
 
 
@@ -45,6 +46,7 @@ TEST_F(SorFactory, CanBuildWithParameters)
                        .with_symmetric(true)
                        .with_l_solver(l_isai_type::build())
                        .with_u_solver(u_isai_type::build())
+                       .with_multicolor(true)
                        .on(exec);
 
     auto params = factory->get_parameters();
@@ -55,4 +57,5 @@ TEST_F(SorFactory, CanBuildWithParameters)
     GKO_ASSERT_DYNAMIC_TYPE(params.l_solver, l_isai_type::Factory);
     ASSERT_NE(params.u_solver, nullptr);
     GKO_ASSERT_DYNAMIC_TYPE(params.u_solver, u_isai_type::Factory);
+    ASSERT_EQ(params.multicolor, true);
 }
@@ -0,0 +1,246 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <typeinfo>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/chebyshev.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename T>
+class Chebyshev : public ::testing::Test {
+protected:
+    using value_type = T;
+    using Mtx = gko::matrix::Dense<value_type>;
+    using Solver = gko::solver::Chebyshev<value_type>;
+
+    Chebyshev()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(gko::initialize<Mtx>(
+              {{2, -1.0, 0.0}, {-1.0, 2, -1.0}, {0.0, -1.0, 2}}, exec)),
+          chebyshev_factory(
+              Solver::build()
+                  .with_criteria(
+                      gko::stop::Iteration::build().with_max_iters(3u),
+                      gko::stop::ResidualNorm<value_type>::build()
+                          .with_reduction_factor(gko::remove_complex<T>{1e-6}))
+                  .with_foci(value_type{0.5}, value_type{3.5})
+                  .on(exec)),
+          solver(chebyshev_factory->generate(mtx))
+    {}
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::shared_ptr<Mtx> mtx;
+    std::unique_ptr<typename Solver::Factory> chebyshev_factory;
+    std::unique_ptr<gko::LinOp> solver;
+};
+
+TYPED_TEST_SUITE(Chebyshev, gko::test::ValueTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(Chebyshev, ChebyshevFactoryKnowsItsExecutor)
+{
+    ASSERT_EQ(this->chebyshev_factory->get_executor(), this->exec);
+}
+
+
+TYPED_TEST(Chebyshev, ChebyshevFactoryCreatesCorrectSolver)
+{
+    using Solver = typename TestFixture::Solver;
+
+    ASSERT_EQ(this->solver->get_size(), gko::dim<2>(3, 3));
+    auto chebyshev_solver = static_cast<Solver*>(this->solver.get());
+    ASSERT_NE(chebyshev_solver->get_system_matrix(), nullptr);
+    ASSERT_EQ(chebyshev_solver->get_system_matrix(), this->mtx);
+}
+
+
+TYPED_TEST(Chebyshev, HasDefaultParameters)
+{
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    using real_type = gko::remove_complex<value_type>;
+    auto factory = Solver::build().on(this->exec);
+    auto params = factory->get_parameters();
+
+    ASSERT_EQ(params.foci, std::make_pair(value_type{0}, value_type{0}));
+    ASSERT_EQ(params.num_estimation_iterations, 10u);
+    ASSERT_EQ(params.max_eigenvalue_scale, real_type{1.1});
+    ASSERT_EQ(params.min_eigenvalue_ratio, real_type{0});
+    ASSERT_EQ(params.default_initial_guess,
+              gko::solver::initial_guess_mode::provided);
+}
+
+
+TYPED_TEST(Chebyshev, KeepsGivenFoci)
+{
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+
+    ASSERT_EQ(static_cast<Solver*>(this->solver.get())->get_foci(),
+              std::make_pair(value_type{0.5}, value_type{3.5}));
+}
+
+
+TYPED_TEST(Chebyshev, CanBeCopied)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    auto copy = this->chebyshev_factory->generate(Mtx::create(this->exec));
+
+    copy->copy_from(this->solver);
+
+    ASSERT_EQ(copy->get_size(), gko::dim<2>(3, 3));
+    auto copy_mtx = static_cast<Solver*>(copy.get())->get_system_matrix();
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(copy_mtx), this->mtx, 0.0);
+    ASSERT_EQ(static_cast<Solver*>(copy.get())->get_foci(),
+              std::make_pair(value_type{0.5}, value_type{3.5}));
+}
+
+
+TYPED_TEST(Chebyshev, CanBeMoved)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    auto copy = this->chebyshev_factory->generate(Mtx::create(this->exec));
+
+    copy->move_from(this->solver);
+
+    ASSERT_EQ(copy->get_size(), gko::dim<2>(3, 3));
+    auto copy_mtx = static_cast<Solver*>(copy.get())->get_system_matrix();
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(copy_mtx), this->mtx, 0.0);
+}
+
+
+TYPED_TEST(Chebyshev, CanBeCloned)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    auto clone = this->solver->clone();
+
+    ASSERT_EQ(clone->get_size(), gko::dim<2>(3, 3));
+    auto clone_mtx = static_cast<Solver*>(clone.get())->get_system_matrix();
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(clone_mtx), this->mtx, 0.0);
+}
+
+
+TYPED_TEST(Chebyshev, CanBeCleared)
+{
+    using Solver = typename TestFixture::Solver;
+    this->solver->clear();
+
+    ASSERT_EQ(this->solver->get_size(), gko::dim<2>(0, 0));
+    auto solver_mtx =
+        static_cast<Solver*>(this->solver.get())->get_system_matrix();
+    ASSERT_EQ(solver_mtx, nullptr);
+}
+
+
+TYPED_TEST(Chebyshev, ApplyUsesInitialGuessReturnsTrue)
+{
+    ASSERT_TRUE(this->solver->apply_uses_initial_guess());
+}
+
+
+TYPED_TEST(Chebyshev, ApplyUsesInitialGuessDependsOnDefaultInitialGuess)
+{
+    using Solver = typename TestFixture::Solver;
+    auto solver =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(3u))
+            .with_default_initial_guess(gko::solver::initial_guess_mode::zero)
+            .on(this->exec)
+            ->generate(this->mtx);
+
+    ASSERT_FALSE(solver->apply_uses_initial_guess());
+}
+
+
+TYPED_TEST(Chebyshev, CanSetPreconditionerInFactory)
+{
+    using Solver = typename TestFixture::Solver;
+    std::shared_ptr<Solver> chebyshev_precond =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(3u))
+            .on(this->exec)
+            ->generate(this->mtx);
+
+    auto chebyshev_factory =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(3u))
+            .with_generated_preconditioner(chebyshev_precond)
+            .on(this->exec);
+    auto solver = chebyshev_factory->generate(this->mtx);
+    auto precond = solver->get_preconditioner();
+
+    ASSERT_NE(precond.get(), nullptr);
+    ASSERT_EQ(precond.get(), chebyshev_precond.get());
+}
+
+
+TYPED_TEST(Chebyshev, ThrowsOnWrongPreconditionerInFactory)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    std::shared_ptr<Mtx> wrong_sized_mtx =
+        Mtx::create(this->exec, gko::dim<2>{2, 2});
+    std::shared_ptr<Solver> chebyshev_precond =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(3u))
+            .with_foci(1, 2)
+            .on(this->exec)
+            ->generate(wrong_sized_mtx);
+
+    auto chebyshev_factory =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(3u))
+            .with_generated_preconditioner(chebyshev_precond)
+            .on(this->exec);
+
+    ASSERT_THROW(chebyshev_factory->generate(this->mtx),
+                 gko::DimensionMismatch);
+}
+
+
+TYPED_TEST(Chebyshev, ThrowsOnRectangularMatrixInFactory)
+{
+    using Mtx = typename TestFixture::Mtx;
+    std::shared_ptr<Mtx> rectangular_mtx =
+        Mtx::create(this->exec, gko::dim<2>{1, 2});
+
+    ASSERT_THROW(this->chebyshev_factory->generate(rectangular_mtx),
+                 gko::DimensionMismatch);
+}
+
+
+TYPED_TEST(Chebyshev, PassExplicitFactory)
+{
+    using Solver = typename TestFixture::Solver;
+    auto stop_factory = gko::share(
+        gko::stop::Iteration::build().with_max_iters(1u).on(this->exec));
+    auto precond_factory = gko::share(Solver::build().on(this->exec));
+
+    auto factory = Solver::build()
+                       .with_criteria(stop_factory)
+                       .with_preconditioner(precond_factory)
+                       .on(this->exec);
+
+    ASSERT_EQ(factory->get_parameters().criteria.front(), stop_factory);
+    ASSERT_EQ(factory->get_parameters().preconditioner, precond_factory);
+}
+
+
+}  // namespace
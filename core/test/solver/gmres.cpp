@@ -284,6 +284,20 @@ TYPED_TEST(Gmres, ThrowsOnRectangularMatrixInFactory)
 }
 
 
+TYPED_TEST(Gmres, ThrowsOnFlexibleBlockOrthogonalization)
+{
+    using Solver = typename TestFixture::Solver;
+    auto gmres_factory =
+        Solver::build()
+            .with_flexible(true)
+            .with_ortho_method(gko::solver::gmres::ortho_method::block_cgs2)
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(3u))
+            .on(this->exec);
+
+    ASSERT_THROW(gmres_factory->generate(this->mtx), gko::InvalidStateError);
+}
+
+
 TYPED_TEST(Gmres, CanSetPreconditioner)
 {
     using Solver = typename TestFixture::Solver;
@@ -0,0 +1,263 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/pipe_bicgstab.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+#include <ginkgo/core/stop/time.hpp>
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename T>
+class PipeBicgstab : public ::testing::Test {
+protected:
+    using value_type = T;
+    using Mtx = gko::matrix::Dense<value_type>;
+    using Solver = gko::solver::PipeBicgstab<value_type>;
+
+    PipeBicgstab()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(gko::initialize<Mtx>(
+              {{2, -1.0, 0.0}, {-1.0, 2, -1.0}, {0.0, -1.0, 2}}, exec)),
+          bicgstab_factory(
+              Solver::build()
+                  .with_criteria(
+                      gko::stop::Iteration::build().with_max_iters(3u),
+                      gko::stop::ResidualNorm<value_type>::build()
+                          .with_reduction_factor(gko::remove_complex<T>{1e-6}))
+                  .on(exec)),
+          solver(bicgstab_factory->generate(mtx))
+    {}
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::shared_ptr<Mtx> mtx;
+    std::unique_ptr<typename Solver::Factory> bicgstab_factory;
+    std::unique_ptr<gko::LinOp> solver;
+};
+
+TYPED_TEST_SUITE(PipeBicgstab, gko::test::ValueTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(PipeBicgstab, PipeBicgstabFactoryKnowsItsExecutor)
+{
+    ASSERT_EQ(this->bicgstab_factory->get_executor(), this->exec);
+}
+
+
+TYPED_TEST(PipeBicgstab, PipeBicgstabFactoryCreatesCorrectSolver)
+{
+    using Solver = typename TestFixture::Solver;
+    ASSERT_EQ(this->solver->get_size(), gko::dim<2>(3, 3));
+    auto bicgstab_solver = gko::as<Solver>(this->solver.get());
+    ASSERT_NE(bicgstab_solver->get_system_matrix(), nullptr);
+    ASSERT_EQ(bicgstab_solver->get_system_matrix(), this->mtx);
+}
+
+
+TYPED_TEST(PipeBicgstab, CanBeCopied)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    auto copy = this->bicgstab_factory->generate(Mtx::create(this->exec));
+
+    copy->copy_from(this->solver);
+
+    ASSERT_EQ(copy->get_size(), gko::dim<2>(3, 3));
+    auto copy_mtx = gko::as<Solver>(copy.get())->get_system_matrix();
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(copy_mtx), this->mtx, 0.0);
+}
+
+
+TYPED_TEST(PipeBicgstab, CanBeMoved)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    auto copy = this->bicgstab_factory->generate(Mtx::create(this->exec));
+
+    copy->move_from(this->solver);
+
+    ASSERT_EQ(copy->get_size(), gko::dim<2>(3, 3));
+    auto copy_mtx = gko::as<Solver>(copy.get())->get_system_matrix();
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(copy_mtx), this->mtx, 0.0);
+}
+
+
+TYPED_TEST(PipeBicgstab, CanBeCloned)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    auto clone = this->solver->clone();
+
+    ASSERT_EQ(clone->get_size(), gko::dim<2>(3, 3));
+    auto clone_mtx = gko::as<Solver>(clone.get())->get_system_matrix();
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(clone_mtx.get()), this->mtx, 0.0);
+}
+
+
+TYPED_TEST(PipeBicgstab, CanBeCleared)
+{
+    using Solver = typename TestFixture::Solver;
+    this->solver->clear();
+
+    ASSERT_EQ(this->solver->get_size(), gko::dim<2>(0, 0));
+    auto solver_mtx = gko::as<Solver>(this->solver.get())->get_system_matrix();
+    ASSERT_EQ(solver_mtx, nullptr);
+}
+
+
+TYPED_TEST(PipeBicgstab, ApplyUsesInitialGuessReturnsTrue)
+{
+    ASSERT_TRUE(this->solver->apply_uses_initial_guess());
+}
+
+
+TYPED_TEST(PipeBicgstab, CanSetPreconditionerGenerator)
+{
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    auto bicgstab_factory =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(3u))
+            .with_preconditioner(Solver::build().with_criteria(
+                gko::stop::Iteration::build().with_max_iters(3u)))
+            .on(this->exec);
+
+    auto solver = bicgstab_factory->generate(this->mtx);
+    auto precond = gko::as<gko::solver::PipeBicgstab<value_type>>(
+        solver->get_preconditioner());
+
+    ASSERT_EQ(precond->get_size(), gko::dim<2>(3, 3));
+    ASSERT_EQ(precond->get_system_matrix(), this->mtx);
+}
+
+
+TYPED_TEST(PipeBicgstab, CanSetCriteriaAgain)
+{
+    using Solver = typename TestFixture::Solver;
+    std::shared_ptr<gko::stop::CriterionFactory> init_crit =
+        gko::stop::Iteration::build().with_max_iters(3u).on(this->exec);
+    auto bicgstab_factory =
+        Solver::build().with_criteria(init_crit).on(this->exec);
+
+    ASSERT_EQ((bicgstab_factory->get_parameters().criteria).back(), init_crit);
+
+    auto solver = bicgstab_factory->generate(this->mtx);
+    std::shared_ptr<gko::stop::CriterionFactory> new_crit =
+        gko::stop::Iteration::build().with_max_iters(5u).on(this->exec);
+
+    solver->set_stop_criterion_factory(new_crit);
+    auto new_crit_fac = solver->get_stop_criterion_factory();
+    auto niter = gko::as<gko::stop::Iteration::Factory>(new_crit_fac)
+                     ->get_parameters()
+                     .max_iters;
+
+    ASSERT_EQ(niter, 5);
+}
+
+
+TYPED_TEST(PipeBicgstab, CanSetPreconditionerInFactory)
+{
+    using Solver = typename TestFixture::Solver;
+    std::shared_ptr<Solver> bicgstab_precond =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(3u))
+            .on(this->exec)
+            ->generate(this->mtx);
+
+    auto bicgstab_factory =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(3u))
+            .with_generated_preconditioner(bicgstab_precond)
+            .on(this->exec);
+    auto solver = bicgstab_factory->generate(this->mtx);
+    auto precond = solver->get_preconditioner();
+
+    ASSERT_NE(precond.get(), nullptr);
+    ASSERT_EQ(precond.get(), bicgstab_precond.get());
+}
+
+
+TYPED_TEST(PipeBicgstab, ThrowsOnWrongPreconditionerInFactory)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    std::shared_ptr<Mtx> wrong_sized_mtx =
+        Mtx::create(this->exec, gko::dim<2>{2, 2});
+    std::shared_ptr<Solver> bicgstab_precond =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(3u))
+            .on(this->exec)
+            ->generate(wrong_sized_mtx);
+
+    auto bicgstab_factory =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(3u))
+            .with_generated_preconditioner(bicgstab_precond)
+            .on(this->exec);
+
+    ASSERT_THROW(bicgstab_factory->generate(this->mtx), gko::DimensionMismatch);
+}
+
+
+TYPED_TEST(PipeBicgstab, ThrowsOnRectangularMatrixInFactory)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    std::shared_ptr<Mtx> rectangular_mtx =
+        Mtx::create(this->exec, gko::dim<2>{1, 2});
+
+    ASSERT_THROW(this->bicgstab_factory->generate(rectangular_mtx),
+                 gko::DimensionMismatch);
+}
+
+
+TYPED_TEST(PipeBicgstab, CanSetPreconditioner)
+{
+    using Solver = typename TestFixture::Solver;
+    std::shared_ptr<Solver> bicgstab_precond =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(3u))
+            .on(this->exec)
+            ->generate(this->mtx);
+
+    auto bicgstab_factory =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(3u))
+            .on(this->exec);
+    auto solver = bicgstab_factory->generate(this->mtx);
+    solver->set_preconditioner(bicgstab_precond);
+    auto precond = solver->get_preconditioner();
+
+    ASSERT_NE(precond.get(), nullptr);
+    ASSERT_EQ(precond.get(), bicgstab_precond.get());
+}
+
+
+TYPED_TEST(PipeBicgstab, PassExplicitFactory)
+{
+    using Solver = typename TestFixture::Solver;
+    auto stop_factory = gko::share(
+        gko::stop::Iteration::build().with_max_iters(1u).on(this->exec));
+    auto precond_factory = gko::share(Solver::build().on(this->exec));
+
+    auto factory = Solver::build()
+                       .with_criteria(stop_factory)
+                       .with_preconditioner(precond_factory)
+                       .on(this->exec);
+
+    ASSERT_EQ(factory->get_parameters().criteria.front(), stop_factory);
+    ASSERT_EQ(factory->get_parameters().preconditioner, precond_factory);
+}
+
+
+}  // namespace
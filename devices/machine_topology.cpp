@@ -96,7 +96,8 @@ machine_topology::machine_topology()
 
 void machine_topology::hwloc_binding_helper(
     const std::vector<machine_topology::normal_obj_info>& obj,
-    const std::vector<int>& bind_ids, const bool singlify) const
+    const std::vector<int>& bind_ids, const bool singlify,
+    const bool thread_only) const
 {
 #if GKO_HAVE_HWLOC
     detail::topo_bitmap bitmap_toset;
@@ -113,7 +114,8 @@ void machine_topology::hwloc_binding_helper(
     if (singlify) {
         hwloc_bitmap_singlify(bitmap_toset.get());
     }
-    hwloc_set_cpubind(this->topo_.get(), bitmap_toset.get(), 0);
+    hwloc_set_cpubind(this->topo_.get(), bitmap_toset.get(),
+                      thread_only ? HWLOC_CPUBIND_THREAD : 0);
 #endif
 }
 
@@ -7,10 +7,12 @@
 #include "core/multigrid/pgm_kernels.hpp"
 
 #include <memory>
+#include <type_traits>
 
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/math.hpp>
 
+#include "common/unified/base/kernel_launch.hpp"
 #include "dpcpp/base/onedpl.hpp"
 
 
@@ -40,57 +42,114 @@ void sort_agg(std::shared_ptr<const DefaultExecutor> exec, IndexType num,
 GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_SORT_AGG_KERNEL);
 
 
-template <typename ValueType, typename IndexType>
-void sort_row_major(std::shared_ptr<const DefaultExecutor> exec, size_type nnz,
-                    IndexType* row_idxs, IndexType* col_idxs, ValueType* vals)
+template <typename IndexType>
+void galerkin_count(std::shared_ptr<const DefaultExecutor> exec,
+                    size_type num_agg, const IndexType* agg_ptrs,
+                    const IndexType* agg_rows, const IndexType* row_ptrs,
+                    const IndexType* col_idxs, const IndexType* col_agg,
+                    size_type num_coarse_cols, IndexType* coarse_row_nnz)
 {
-    auto policy = onedpl_policy(exec);
-    auto it = oneapi::dpl::make_zip_iterator(row_idxs, col_idxs, vals);
-    // Because reduce_by_segment is not deterministic, so we do not need
-    // stable_sort
-    // TODO: If we have deterministic reduce_by_segment, it should be
-    // stable_sort
-    std::sort(policy, it, it + nnz, [](auto a, auto b) {
-        return std::tie(std::get<0>(a), std::get<1>(a)) <
-               std::tie(std::get<0>(b), std::get<1>(b));
-    });
+    // one thread per coarse row, which only counts the first occurrence of
+    // each coarse column. The rows are short for aggregation-based coarsening,
+    // so the quadratic search is cheaper than sorting.
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto agg_ptrs, auto agg_rows, auto row_ptrs,
+                      auto col_idxs, auto col_agg, auto coarse_row_nnz) {
+            using index_type = std::decay_t<decltype(*agg_ptrs)>;
+            index_type count{};
+            for (auto i = agg_ptrs[row]; i < agg_ptrs[row + 1]; i++) {
+                const auto fine_row = agg_rows[i];
+                for (auto nz = row_ptrs[fine_row]; nz < row_ptrs[fine_row + 1];
+                     nz++) {
+                    const auto col = col_agg[col_idxs[nz]];
+                    bool first = true;
+                    for (auto j = agg_ptrs[row]; first && j <= i; j++) {
+                        const auto prev_row = agg_rows[j];
+                        const auto prev_end =
+                            j == i ? nz : row_ptrs[prev_row + 1];
+                        for (auto prev_nz = row_ptrs[prev_row];
+                             first && prev_nz < prev_end; prev_nz++) {
+                            first = col_agg[col_idxs[prev_nz]] != col;
+                        }
+                    }
+                    count += first ? 1 : 0;
+                }
+            }
+            coarse_row_nnz[row] = count;
+        },
+        num_agg, agg_ptrs, agg_rows, row_ptrs, col_idxs, col_agg,
+        coarse_row_nnz);
 }
 
-GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM_SORT_ROW_MAJOR);
-
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_GALERKIN_COUNT_KERNEL);
 
-template <typename ValueType, typename IndexType>
-class coarse_coo_policy {};
 
-
-template <typename ValueType, typename IndexType>
-void compute_coarse_coo(std::shared_ptr<const DefaultExecutor> exec,
-                        size_type fine_nnz, const IndexType* row_idxs,
-                        const IndexType* col_idxs, const ValueType* vals,
-                        matrix::Coo<ValueType, IndexType>* coarse_coo)
+template <typename IndexType>
+void galerkin_fill(std::shared_ptr<const DefaultExecutor> exec,
+                   size_type num_agg, const IndexType* agg_ptrs,
+                   const IndexType* agg_rows, const IndexType* row_ptrs,
+                   const IndexType* col_idxs, const IndexType* col_agg,
+                   size_type num_coarse_cols, const IndexType* coarse_row_ptrs,
+                   IndexType* coarse_col_idxs, IndexType* nz_map)
 {
-    // WORKAROUND: reduce_by_segment needs unique policy. Otherwise, dpcpp
-    // throws same mangled name error. Related:
-    // https://github.com/oneapi-src/oneDPL/issues/507
-    auto policy = oneapi::dpl::execution::make_device_policy<
-        coarse_coo_policy<ValueType, IndexType>>(*exec->get_queue());
-    auto key_it = oneapi::dpl::make_zip_iterator(row_idxs, col_idxs);
-
-    auto coarse_key_it = oneapi::dpl::make_zip_iterator(
-        coarse_coo->get_row_idxs(), coarse_coo->get_col_idxs());
-
-    oneapi::dpl::reduce_by_segment(
-        policy, key_it, key_it + fine_nnz, vals, coarse_key_it,
-        coarse_coo->get_values(),
-        [](auto a, auto b) {
-            return std::tie(std::get<0>(a), std::get<1>(a)) ==
-                   std::tie(std::get<0>(b), std::get<1>(b));
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto agg_ptrs, auto agg_rows, auto row_ptrs,
+                      auto col_idxs, auto col_agg, auto coarse_row_ptrs,
+                      auto coarse_col_idxs, auto nz_map) {
+            const auto begin = coarse_row_ptrs[row];
+            const auto end = coarse_row_ptrs[row + 1];
+            auto out = begin;
+            for (auto i = agg_ptrs[row]; i < agg_ptrs[row + 1]; i++) {
+                const auto fine_row = agg_rows[i];
+                for (auto nz = row_ptrs[fine_row]; nz < row_ptrs[fine_row + 1];
+                     nz++) {
+                    const auto col = col_agg[col_idxs[nz]];
+                    bool found = false;
+                    for (auto k = begin; !found && k < out; k++) {
+                        found = coarse_col_idxs[k] == col;
+                    }
+                    if (!found) {
+                        coarse_col_idxs[out] = col;
+                        out++;
+                    }
+                }
+            }
+            // insertion sort of the few columns of the coarse row
+            for (auto k = begin + 1; k < end; k++) {
+                const auto col = coarse_col_idxs[k];
+                auto pos = k;
+                while (pos > begin && coarse_col_idxs[pos - 1] > col) {
+                    coarse_col_idxs[pos] = coarse_col_idxs[pos - 1];
+                    pos--;
+                }
+                coarse_col_idxs[pos] = col;
+            }
+            for (auto i = agg_ptrs[row]; i < agg_ptrs[row + 1]; i++) {
+                const auto fine_row = agg_rows[i];
+                for (auto nz = row_ptrs[fine_row]; nz < row_ptrs[fine_row + 1];
+                     nz++) {
+                    const auto col = col_agg[col_idxs[nz]];
+                    auto lo = begin;
+                    auto hi = end - 1;
+                    while (lo < hi) {
+                        const auto mid = lo + (hi - lo) / 2;
+                        if (coarse_col_idxs[mid] < col) {
+                            lo = mid + 1;
+                        } else {
+                            hi = mid;
+                        }
+                    }
+                    nz_map[nz] = lo;
+                }
+            }
         },
-        [](auto a, auto b) { return a + b; });
+        num_agg, agg_ptrs, agg_rows, row_ptrs, col_idxs, col_agg,
+        coarse_row_ptrs, coarse_col_idxs, nz_map);
 }
 
-GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
-    GKO_DECLARE_PGM_COMPUTE_COARSE_COO);
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_GALERKIN_FILL_KERNEL);
 
 
 }  // namespace pgm
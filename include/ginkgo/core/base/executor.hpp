@@ -1418,6 +1418,17 @@ public:
 
     static int get_num_omp_threads();
 
+    /**
+     * Binds every thread of the OpenMP thread pool to its own core, assigned
+     * round-robin by thread number. Since OpenMP runtimes reuse their threads,
+     * the binding applies to later parallel regions with the same number of
+     * threads. Together with OmpFirstTouchAllocator, this keeps the rows that
+     * a thread processes on its own NUMA node.
+     *
+     * @note This has no effect if Ginkgo was built without hwloc.
+     */
+    void bind_threads_to_cores() const;
+
     scoped_device_id_guard get_scoped_device_id_guard() const override;
 
     std::string get_description() const override;
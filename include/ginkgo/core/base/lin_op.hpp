@@ -451,6 +451,41 @@ public:
 };
 
 
+/**
+ * Linear operators generated from a system matrix, like factorizations and
+ * preconditioners, which can be recomputed for new matrix values should
+ * implement the ValueUpdatable interface.
+ *
+ * The new matrix needs to have the same size and sparsity pattern as the
+ * matrix the operator was generated from. Only the numerical part of the
+ * generation is repeated, while symbolic information like sparsity patterns
+ * of factors, block structures or lookup tables is reused. This is useful for
+ * sequences of systems with a fixed sparsity pattern, e.g. in time-stepping
+ * or Newton methods.
+ *
+ * Example: Updating an ILU factorization:
+ * ---------------------------------------
+ *
+ * ```c++
+ * auto ilu = factorization::Ilu<>::build().on(exec)->generate(mtx);
+ * // ... change the values of mtx or create a matrix with the same pattern
+ * ilu->update_values(new_mtx);
+ * ```
+ */
+class ValueUpdatable {
+public:
+    virtual ~ValueUpdatable() = default;
+
+    /**
+     * Recomputes the operator for a system matrix with the same size and
+     * sparsity pattern as the one it was generated from.
+     *
+     * @param system_matrix  the matrix containing the new values
+     */
+    virtual void update_values(std::shared_ptr<const LinOp> system_matrix) = 0;
+};
+
+
 /**
  * Linear operators which support permutation should implement the
  * Permutable interface.
@@ -213,6 +213,19 @@ public:
         machine_topology::get_instance()->bind_to_cores(std::vector<int>{id});
     }
 
+    /**
+     * Bind only the calling thread instead of the whole process to a single
+     * core.
+     *
+     * @param id  The id of the core to be bound to the calling thread.
+     */
+    static void bind_thread_to_core(const int& id)
+    {
+        const auto topology = machine_topology::get_instance();
+        topology->hwloc_binding_helper(topology->cores_, std::vector<int>{id},
+                                       true, true);
+    }
+
     /**
      * Bind the calling process to PUs associated with
      * the ids.
@@ -316,12 +329,13 @@ public:
     /**
      * @internal
      *
-     * A helper function that binds the calling process with the ids of `obj`
-     * object .
+     * A helper function that binds the calling process (or only the calling
+     * thread, if thread_only is set) with the ids of `obj` object .
      */
     void hwloc_binding_helper(
         const std::vector<machine_topology::normal_obj_info>& obj,
-        const std::vector<int>& ids, const bool singlify = true) const;
+        const std::vector<int>& ids, const bool singlify = true,
+        const bool thread_only = false) const;
 
     /**
      * @internal
@@ -6,8 +6,11 @@
 #define GKO_PUBLIC_CORE_BASE_MEMORY_HPP_
 
 
+#include <memory>
+
 #include <ginkgo/core/base/fwd_decls.hpp>
 #include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/log/logger.hpp>
 
 
 namespace gko {
@@ -96,6 +99,99 @@ public:
 };
 
 
+/**
+ * NUMA-aware allocator for OmpExecutor based on the first-touch policy of the
+ * operating system: the memory pages of large allocations are touched in
+ * parallel, using the same static OpenMP schedule as the row-parallel OMP
+ * kernels. Each page is thus placed on the NUMA node of the thread that
+ * processes the corresponding rows later on. This is only effective if the
+ * OpenMP threads are pinned, see OmpExecutor::bind_threads_to_cores.
+ */
+class OmpFirstTouchAllocator : public CpuAllocatorBase {
+public:
+    /**
+     * Creates a first-touch allocator.
+     *
+     * @param min_first_touch_bytes  allocations smaller than this are not
+     *                               touched in parallel.
+     */
+    explicit OmpFirstTouchAllocator(size_type min_first_touch_bytes = 1 << 16)
+        : min_first_touch_bytes_{min_first_touch_bytes}
+    {}
+
+    void* allocate(size_type num_bytes) override;
+
+    void deallocate(void* ptr) override;
+
+private:
+    size_type min_first_touch_bytes_;
+};
+
+
+/**
+ * Allocator caching freed memory blocks for later reuse, which avoids the cost
+ * of the system allocator for short-lived temporary objects.
+ *
+ * Allocations are rounded up to power-of-two size classes. Every thread keeps
+ * its own free list for each size class, so a cache hit doesn't need any
+ * synchronization. Allocations larger than the maximum cached size bypass the
+ * cache, and the free blocks cached by a single thread are bounded by the
+ * maximum cached bytes; blocks beyond that are returned to the system. All
+ * cached blocks are released when the allocator is destroyed.
+ *
+ * The allocator can be used for OmpExecutor and ReferenceExecutor by passing
+ * it to their create functions.
+ *
+ * Loggers attached to the allocator receive the allocation_started/completed
+ * events only for cache misses and the free_started/completed events only for
+ * blocks that are returned to the system, while loggers attached to the
+ * executor see every allocation. Since the allocator is not bound to an
+ * executor, the executor argument of these events is `nullptr`.
+ */
+class CachingCpuAllocator : public CpuAllocatorBase,
+                            public log::EnableLogging<CachingCpuAllocator> {
+public:
+    /** Usage statistics of the allocator. */
+    struct statistics {
+        /** Number of allocations served from a free list. */
+        size_type hits;
+        /** Number of allocations served by the system allocator. */
+        size_type misses;
+        /** Number of bytes currently allocated by users of the allocator. */
+        size_type current_bytes;
+        /** Maximum of current_bytes over the lifetime of the allocator. */
+        size_type peak_bytes;
+    };
+
+    /**
+     * Creates a caching allocator.
+     *
+     * @param max_cached_size  the largest allocation size that is cached
+     * @param max_cached_bytes  the maximum number of bytes kept in the free
+     *                          lists of a single thread
+     */
+    explicit CachingCpuAllocator(size_type max_cached_size = 1 << 22,
+                                 size_type max_cached_bytes = 1 << 26);
+
+    ~CachingCpuAllocator() override;
+
+    void* allocate(size_type num_bytes) override;
+
+    void deallocate(void* ptr) override;
+
+    /** Returns the usage statistics of the allocator. */
+    statistics get_statistics() const;
+
+private:
+    void* allocate_system(size_type num_bytes);
+
+    void free_system(void* block);
+
+    struct state;
+    std::unique_ptr<state> state_;
+};
+
+
 /**
  * Allocator using cudaMalloc.
  */
@@ -9,6 +9,7 @@
 #include <memory>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <ginkgo/config.hpp>
 #include <ginkgo/core/base/exception.hpp>
@@ -454,6 +455,30 @@ public:
         this->comm_.reset(new MPI_Comm(comm_out), comm_deleter{});
     }
 
+    /**
+     * Create a distributed graph communicator from an existing communicator
+     * (MPI_Dist_graph_create_adjacent). The ranks keep their rank of the
+     * input communicator. The neighborhood collectives of the resulting
+     * communicator only exchange data with the given neighbors, in the order
+     * they are listed.
+     *
+     * @param comm  The input communicator object.
+     * @param sources  The ranks this rank receives data from.
+     * @param destinations  The ranks this rank sends data to.
+     */
+    communicator(const communicator& comm, const std::vector<int>& sources,
+                 const std::vector<int>& destinations)
+        : force_host_buffer_(comm.force_host_buffer())
+    {
+        MPI_Comm comm_out;
+        GKO_ASSERT_NO_MPI_ERRORS(MPI_Dist_graph_create_adjacent(
+            comm.get(), static_cast<int>(sources.size()), sources.data(),
+            MPI_UNWEIGHTED, static_cast<int>(destinations.size()),
+            destinations.data(), MPI_UNWEIGHTED, MPI_INFO_NULL, false,
+            &comm_out));
+        this->comm_.reset(new MPI_Comm(comm_out), comm_deleter{});
+    }
+
     /**
      * Return the underlying MPI_Comm object.
      *
@@ -1387,6 +1412,73 @@ public:
             recv_offsets, type_impl<RecvType>::get_type());
     }
 
+    /**
+     * Communicate data with the neighbors of a distributed graph communicator
+     * with offsets (MPI_Neighbor_alltoallv). See MPI documentation for more
+     * details.
+     *
+     * @param exec  The executor, on which the message buffers are located.
+     * @param send_buffer  the buffer to send
+     * @param send_counts  the number of elements to send to each destination
+     * @param send_offsets  the offsets for the send buffer
+     * @param send_type  the MPI_Datatype for the send buffer
+     * @param recv_buffer  the buffer to gather into
+     * @param recv_counts  the number of elements to receive from each source
+     * @param recv_offsets  the offsets for the recv buffer
+     * @param recv_type  the MPI_Datatype for the recv buffer
+     *
+     * @note The communicator needs to be a distributed graph communicator.
+     *       The counts and offsets are indexed by the position of the
+     *       neighbor in the sources and destinations of the communicator.
+     */
+    void neighbor_all_to_all_v(std::shared_ptr<const Executor> exec,
+                               const void* send_buffer, const int* send_counts,
+                               const int* send_offsets, MPI_Datatype send_type,
+                               void* recv_buffer, const int* recv_counts,
+                               const int* recv_offsets,
+                               MPI_Datatype recv_type) const
+    {
+        auto guard = exec->get_scoped_device_id_guard();
+        GKO_ASSERT_NO_MPI_ERRORS(MPI_Neighbor_alltoallv(
+            send_buffer, send_counts, send_offsets, send_type, recv_buffer,
+            recv_counts, recv_offsets, recv_type, this->get()));
+    }
+
+    /**
+     * Communicate data with the neighbors of a distributed graph communicator
+     * with offsets (MPI_Ineighbor_alltoallv). See MPI documentation for more
+     * details.
+     *
+     * @param exec  The executor, on which the message buffers are located.
+     * @param send_buffer  the buffer to send
+     * @param send_counts  the number of elements to send to each destination
+     * @param send_offsets  the offsets for the send buffer
+     * @param send_type  the MPI_Datatype for the send buffer
+     * @param recv_buffer  the buffer to gather into
+     * @param recv_counts  the number of elements to receive from each source
+     * @param recv_offsets  the offsets for the recv buffer
+     * @param recv_type  the MPI_Datatype for the recv buffer
+     *
+     * @return  the request handle for the call
+     *
+     * @note The communicator needs to be a distributed graph communicator.
+     *       The counts and offsets are indexed by the position of the
+     *       neighbor in the sources and destinations of the communicator.
+     */
+    request i_neighbor_all_to_all_v(
+        std::shared_ptr<const Executor> exec, const void* send_buffer,
+        const int* send_counts, const int* send_offsets,
+        MPI_Datatype send_type, void* recv_buffer, const int* recv_counts,
+        const int* recv_offsets, MPI_Datatype recv_type) const
+    {
+        auto guard = exec->get_scoped_device_id_guard();
+        request req;
+        GKO_ASSERT_NO_MPI_ERRORS(MPI_Ineighbor_alltoallv(
+            send_buffer, send_counts, send_offsets, send_type, recv_buffer,
+            recv_counts, recv_offsets, recv_type, this->get(), req.get()));
+        return req;
+    }
+
     /**
      * Does a scan operation with the given operator.
      * (MPI_Scan). See MPI documentation for more details.
@@ -7,11 +7,23 @@
 
 
 #include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
 
+#include <ginkgo/core/base/device_matrix_data.hpp>
 #include <ginkgo/core/base/matrix_data.hpp>
 
 
 namespace gko {
+namespace matrix {
+
+
+template <typename ValueType, typename IndexType>
+class Csr;
+
+
+}  // namespace matrix
 
 
 /**
@@ -141,6 +153,36 @@ void write_binary_raw(std::ostream& os,
                       const matrix_data<ValueType, IndexType>& data);
 
 
+/**
+ * Writes a Csr matrix to a stream in Ginkgo's CSR binary format, which can be
+ * memory-mapped without conversion by read_binary_csr_file.
+ * Note that this format depends on the processor's endianness,
+ * so files from a big endian processor can't be read from a little endian
+ * processor and vice-versa.
+ *
+ * The CSR binary format has the following structure (in system endianness),
+ * where every section starts at a multiple of 64 bytes from the beginning:
+ * 1. A 32 byte header consisting of 4 uint64_t values:
+ *    magic = GKOCSR__: The highest two bytes stand for value and index type
+ *                      like in the binary matrix format.
+ *    num_rows: Number of rows
+ *    num_cols: Number of columns
+ *    num_entries: Number of stored entries
+ * 2. num_rows + 1 row pointers stored as IndexType
+ * 3. num_entries column indices stored as IndexType
+ * 4. num_entries values stored as ValueType
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param os  output stream where the data is to be written
+ * @param matrix  the matrix to write
+ */
+template <typename ValueType, typename IndexType>
+void write_binary_csr(std::ostream& os,
+                      const matrix::Csr<ValueType, IndexType>* matrix);
+
+
 /**
  * Reads a matrix stored in matrix market format from an input stream.
  *
@@ -190,6 +232,51 @@ inline std::unique_ptr<MatrixType> read_binary(StreamType&& is,
 }
 
 
+/**
+ * Reads a matrix stored in Ginkgo's binary matrix format from a file directly
+ * into device_matrix_data on the given executor.
+ *
+ * Unlike read_binary_raw, the file is memory-mapped (where supported by the
+ * operating system) and decoded into the separate row index, column index and
+ * value arrays without an intermediate array of matrix_data entries. The
+ * entries are then sorted on the executor.
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param exec  the executor on which the matrix data should be stored
+ * @param filename  the file from which to read the data
+ *
+ * @return A device_matrix_data object with entries sorted in row-major order.
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+device_matrix_data<ValueType, IndexType> read_binary_file_raw(
+    std::shared_ptr<const Executor> exec, const std::string& filename);
+
+
+/**
+ * Reads a Csr matrix from a file stored either in Ginkgo's CSR binary format
+ * (see write_binary_csr) or in Ginkgo's binary matrix format.
+ *
+ * If the file is stored in the CSR binary format with the same value and index
+ * type and exec is a host executor, the arrays of the resulting matrix point
+ * directly into the memory-mapped file, so no conversion or copy takes place.
+ * The pages of the file are only loaded on first access, and modifications to
+ * the matrix are not written back to the file.
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param exec  the executor on which the matrix should be stored
+ * @param filename  the file from which to read the data
+ *
+ * @return A Csr matrix filled with the data from the file.
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary_csr_file(
+    std::shared_ptr<const Executor> exec, const std::string& filename);
+
+
 /**
  * Reads a matrix stored either in binary or matrix market format from an input
  * stream.
@@ -139,6 +139,16 @@ template <typename ValueType>
 class Vector;
 
 
+namespace preconditioner {
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+class Schwarz;
+
+
+}
+
+
 /**
  * The Matrix class defines a (MPI-)distributed matrix.
  *
@@ -255,6 +265,8 @@ class Matrix
     friend class Matrix<next_precision<ValueType>, LocalIndexType,
                         GlobalIndexType>;
     friend class multigrid::Pgm<ValueType, LocalIndexType>;
+    friend class preconditioner::Schwarz<ValueType, LocalIndexType,
+                                         GlobalIndexType>;
 
 public:
     using value_type = ValueType;
@@ -625,6 +637,13 @@ protected:
      */
     mpi::request communicate(const local_vector_type* local_b) const;
 
+    /**
+     * Creates the distributed graph communicator connecting this rank with
+     * the ranks it exchanges non-local values with, based on send_sizes_ and
+     * recv_sizes_. This is a collective operation.
+     */
+    void setup_neighborhood();
+
     void apply_impl(const LinOp* b, LinOp* x) const override;
 
     void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
@@ -636,7 +655,18 @@ private:
     std::vector<comm_index_type> recv_offsets_;
     std::vector<comm_index_type> recv_sizes_;
     array<local_index_type> gather_idxs_;
+    // sizes and offsets of the non-local values per neighbor of
+    // neighbor_comm_, instead of per rank of the whole communicator
+    std::shared_ptr<const mpi::communicator> neighbor_comm_;
+    std::vector<comm_index_type> neighbor_send_offsets_;
+    std::vector<comm_index_type> neighbor_send_sizes_;
+    std::vector<comm_index_type> neighbor_recv_offsets_;
+    std::vector<comm_index_type> neighbor_recv_sizes_;
     array<global_index_type> non_local_to_global_;
+    std::shared_ptr<const Partition<local_index_type, global_index_type>>
+        row_partition_;
+    std::shared_ptr<const Partition<local_index_type, global_index_type>>
+        col_partition_;
     gko::detail::DenseCache<value_type> one_scalar_;
     gko::detail::DenseCache<value_type> host_send_buffer_;
     gko::detail::DenseCache<value_type> host_recv_buffer_;
@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_DISTRIBUTED_MTX_IO_HPP_
+#define GKO_PUBLIC_CORE_DISTRIBUTED_MTX_IO_HPP_
+
+
+#include <ginkgo/config.hpp>
+
+
+#if GINKGO_BUILD_MPI
+
+
+#include <memory>
+#include <string>
+
+#include <ginkgo/core/base/device_matrix_data.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/mpi.hpp>
+
+
+namespace gko {
+namespace experimental {
+namespace distributed {
+
+
+template <typename LocalIndexType, typename GlobalIndexType>
+class Partition;
+
+
+/**
+ * Collectively reads the rows owned by the calling rank of a matrix stored in
+ * Ginkgo's binary matrix format or CSR binary format (see gko::read_binary_raw
+ * and gko::write_binary_csr), using MPI-IO. No rank reads the whole file.
+ *
+ * For the CSR binary format, each rank only reads the byte ranges of the row
+ * pointers, column indices and values belonging to the row ranges it owns.
+ * For the binary matrix format, where the location of the entries of a row
+ * is unknown, each rank reads an equally sized block of entries and sends
+ * them to the ranks owning their rows.
+ *
+ * The result can be passed to Matrix::read_distributed with the same row
+ * partition, which assembles the local and non-local blocks from it:
+ * ```
+ * auto data = read_binary_distributed_raw<double, int32, int64>(
+ *     exec, comm, filename, partition);
+ * matrix->read_distributed(data, partition);
+ * ```
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam LocalIndexType  local index type of the partition
+ * @tparam GlobalIndexType  type of the global matrix indices
+ *
+ * @param exec  the executor on which the matrix data should be stored
+ * @param comm  the communicator, all ranks of which need to call this function
+ * @param filename  the file from which to read the data
+ * @param row_partition  the row partition of the matrix
+ *
+ * @return A device_matrix_data object of the global matrix size containing
+ *         the entries of the rows owned by this rank in row-major order.
+ */
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+device_matrix_data<ValueType, GlobalIndexType> read_binary_distributed_raw(
+    std::shared_ptr<const Executor> exec, mpi::communicator comm,
+    const std::string& filename,
+    std::shared_ptr<const Partition<LocalIndexType, GlobalIndexType>>
+        row_partition);
+
+
+}  // namespace distributed
+}  // namespace experimental
+}  // namespace gko
+
+
+#endif  // GINKGO_BUILD_MPI
+#endif  // GKO_PUBLIC_CORE_DISTRIBUTED_MTX_IO_HPP_
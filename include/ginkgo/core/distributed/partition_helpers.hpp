@@ -12,6 +12,7 @@
 #if GINKGO_BUILD_MPI
 
 
+#include <ginkgo/core/base/device_matrix_data.hpp>
 #include <ginkgo/core/base/mpi.hpp>
 #include <ginkgo/core/base/range.hpp>
 
@@ -64,6 +65,31 @@ build_partition_from_local_size(std::shared_ptr<const Executor> exec,
                                 mpi::communicator comm, size_type local_size);
 
 
+/**
+ * Builds a partition with one part per rank from the sparsity pattern of a
+ * global matrix, such that the parts have roughly the same number of rows and
+ * few entries couple rows of different parts. This keeps the communication
+ * volume of distributed matrix-vector products low.
+ *
+ * The partition is computed on rank 0 by recursive multilevel bisection of
+ * the symmetrized graph of the matrix, using the built-in partitioner of
+ * reorder::NestedDissection, and broadcast to the other ranks. In contrast to
+ * the other partition builders, the parts are usually not contiguous.
+ *
+ * @param exec  the Executor on which the partition should be built.
+ * @param comm  the communicator used to determine the global partition.
+ * @param global_data  the entries of the global square matrix. Only the data
+ *                     on rank 0 is used, the other ranks may pass empty data.
+ *
+ * @return a Partition where every rank owns one part.
+ */
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+std::unique_ptr<Partition<LocalIndexType, GlobalIndexType>>
+build_partition_from_matrix_data(
+    std::shared_ptr<const Executor> exec, mpi::communicator comm,
+    const device_matrix_data<ValueType, GlobalIndexType>& global_data);
+
+
 }  // namespace distributed
 }  // namespace experimental
 }  // namespace gko
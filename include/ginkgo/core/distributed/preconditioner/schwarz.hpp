@@ -13,13 +13,17 @@
 
 
 #include <ginkgo/core/base/abstract_factory.hpp>
+#include <ginkgo/core/base/dense_cache.hpp>
 #include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/mpi.hpp>
 #include <ginkgo/core/config/config.hpp>
 #include <ginkgo/core/config/registry.hpp>
 #include <ginkgo/core/config/type_descriptor.hpp>
 #include <ginkgo/core/distributed/matrix.hpp>
 #include <ginkgo/core/distributed/vector.hpp>
 #include <ginkgo/core/distributed/vector_cache.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/multigrid/multigrid_level.hpp>
 
 
 namespace gko {
@@ -41,7 +45,21 @@ namespace preconditioner {
  * See Iterative Methods for Sparse Linear Systems (Y. Saad) for a general
  * treatment and variations of the method.
  *
- * @note Currently overlap and coarse grid correction are not supported (TODO).
+ * With `overlap` set to k > 0, each subdomain is extended by the k layers of
+ * rows reachable from its owned rows through the matrix graph, and the local
+ * solver is generated on the extended local matrix. The right-hand side
+ * entries of the overlap rows are gathered from their owners before the local
+ * solve. In the restricted additive mode (RAS, the default), only the owned
+ * part of the local solution is kept; otherwise the contributions of the
+ * overlap rows are sent back and added to the solution on their owners.
+ * The overlap requires the system matrix to be read with `read_distributed`
+ * using the same row and column partition.
+ *
+ * If both `coarse_level` and `coarse_solver` are set, a two-level method is
+ * used: the coarse level factory (e.g. multigrid::Pgm) generates the
+ * prolongation, restriction and Galerkin coarse operator, and the coarse
+ * correction `coarse_weight * P * coarse_solver(R * b)` is added to the
+ * result of the local solves.
  *
  * @tparam ValueType  precision of matrix element
  * @tparam LocalIndexType  local integer type of the matrix
@@ -89,6 +107,35 @@ public:
          */
         std::shared_ptr<const LinOp> GKO_FACTORY_PARAMETER_SCALAR(
             generated_local_solver, nullptr);
+
+        /**
+         * Number of layers of algebraic overlap added to each subdomain.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(overlap, 0u);
+
+        /**
+         * Whether the overlap contributions are discarded (restricted additive
+         * Schwarz) instead of being added to the solution on their owners.
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(restricted, true);
+
+        /**
+         * Multigrid level factory generating the coarse space. The generated
+         * operator needs to be a MultigridLevel.
+         */
+        std::shared_ptr<const LinOpFactory> GKO_DEFERRED_FACTORY_PARAMETER(
+            coarse_level);
+
+        /**
+         * Solver factory for the coarse operator.
+         */
+        std::shared_ptr<const LinOpFactory> GKO_DEFERRED_FACTORY_PARAMETER(
+            coarse_solver);
+
+        /**
+         * Weight of the coarse grid correction.
+         */
+        ValueType GKO_FACTORY_PARAMETER_SCALAR(coarse_weight, one<ValueType>());
     };
     GKO_ENABLE_LIN_OP_FACTORY(Schwarz, parameters, Factory);
     GKO_ENABLE_BUILD_METHOD(Factory);
@@ -160,9 +207,66 @@ private:
      */
     void set_solver(std::shared_ptr<const LinOp> new_solver);
 
+    /**
+     * Sets up the overlap communication and returns the local matrix extended
+     * by `parameters_.overlap` layers of overlap rows.
+     *
+     * @param system_matrix  the distributed system matrix
+     *
+     * @return the extended local matrix
+     */
+    std::shared_ptr<const LinOp> generate_overlap(
+        const Matrix<ValueType, LocalIndexType, GlobalIndexType>*
+            system_matrix);
+
+    /**
+     * Applies the local solver on the subdomain extended by the overlap rows.
+     *
+     * @param comm  the communicator of the vectors
+     * @param local_b  the owned part of the right-hand side
+     * @param local_x  the owned part of the solution
+     */
+    void apply_overlap(const mpi::communicator& comm,
+                       const matrix::Dense<ValueType>* local_b,
+                       matrix::Dense<ValueType>* local_x) const;
+
+    /**
+     * Exchanges the rows of send_buffer with all ranks.
+     */
+    void exchange_rows(const mpi::communicator& comm,
+                       const matrix::Dense<ValueType>* send_buffer,
+                       const std::vector<comm_index_type>& send_sizes,
+                       const std::vector<comm_index_type>& send_offsets,
+                       matrix::Dense<ValueType>* recv_buffer,
+                       const std::vector<comm_index_type>& recv_sizes,
+                       const std::vector<comm_index_type>& recv_offsets) const;
+
     std::shared_ptr<const LinOp> local_solver_;
 
     detail::VectorCache<ValueType> cache_;
+
+    // overlap communication pattern: the owned rows the other ranks need,
+    // and the overlap rows received from the other ranks, ordered by owner
+    size_type num_local_rows_{};
+    size_type num_overlap_rows_{};
+    std::vector<comm_index_type> overlap_send_sizes_;
+    std::vector<comm_index_type> overlap_send_offsets_;
+    std::vector<comm_index_type> overlap_recv_sizes_;
+    std::vector<comm_index_type> overlap_recv_offsets_;
+    array<LocalIndexType> overlap_send_idxs_;
+    // adds the received overlap contributions to their owned rows
+    std::shared_ptr<const LinOp> overlap_scatter_;
+    gko::detail::DenseCache<ValueType> ext_b_;
+    gko::detail::DenseCache<ValueType> ext_x_;
+    gko::detail::DenseCache<ValueType> send_buffer_;
+    gko::detail::DenseCache<ValueType> recv_buffer_;
+
+    std::shared_ptr<const multigrid::MultigridLevel> coarse_level_;
+    std::shared_ptr<const LinOp> coarse_solver_;
+    std::shared_ptr<const matrix::Dense<ValueType>> coarse_weight_;
+    std::shared_ptr<const matrix::Dense<ValueType>> one_;
+    detail::VectorCache<ValueType> coarse_rhs_;
+    detail::VectorCache<ValueType> coarse_sol_;
 };
 
 
@@ -14,10 +14,25 @@
 
 
 namespace gko {
+namespace factorization {
+
+
+template <typename IndexType>
+struct elimination_forest;
+
+
+}  // namespace factorization
 namespace experimental {
 namespace factorization {
 
 
+template <typename ValueType, typename IndexType>
+class Lu;
+
+template <typename ValueType, typename IndexType>
+class Cholesky;
+
+
 /**
  * Stores how a Factorization is represented internally. Depending on the
  * representation, different functionality may be available in the class.
@@ -73,8 +88,11 @@ enum class storage_type {
  * @tparam IndexType  the index type used to represent the sparsity pattern
  */
 template <typename ValueType, typename IndexType>
-class Factorization : public EnableLinOp<Factorization<ValueType, IndexType>> {
+class Factorization : public EnableLinOp<Factorization<ValueType, IndexType>>,
+                      public ValueUpdatable {
     friend class EnablePolymorphicObject<Factorization, LinOp>;
+    friend class Lu<ValueType, IndexType>;
+    friend class Cholesky<ValueType, IndexType>;
 
 public:
     using value_type = ValueType;
@@ -120,6 +138,19 @@ public:
      */
     std::shared_ptr<const matrix_type> get_combined() const;
 
+    /**
+     * Recomputes the factorization for a matrix with the same size and
+     * sparsity pattern as the one it was generated from. The sparsity pattern
+     * of the factors, the lookup structures used by the numerical
+     * factorization and, for Cholesky, the elimination forest are reused.
+     *
+     * @note This is only supported for storage_type::combined_lu and
+     *       storage_type::symm_combined_cholesky.
+     *
+     * @param system_matrix  the matrix containing the new values
+     */
+    void update_values(std::shared_ptr<const LinOp> system_matrix) override;
+
     /** Creates a deep copy of the factorization. */
     Factorization(const Factorization&);
 
@@ -190,8 +221,27 @@ protected:
                     LinOp* x) const override;
 
 private:
+    /**
+     * Computes the numerical LU or Cholesky factorization of mtx in the
+     * combined factors, which already contain the sparsity pattern. The
+     * symbolic data is set up on the first call and reused afterwards.
+     *
+     * @param mtx  the system matrix
+     * @param factors  the combined factors to store the result in
+     * @param forest  the elimination forest of a Cholesky factorization, if
+     *                available. Otherwise, it is computed from the factors.
+     */
+    void factorize_combined(
+        const matrix_type* mtx, matrix_type* factors,
+        std::unique_ptr<gko::factorization::elimination_forest<IndexType>>
+            forest);
+
+    /** The symbolic data of the combined factors reused by update_values. */
+    struct symbolic_data;
+
     storage_type storage_type_;
     std::unique_ptr<Composition<ValueType>> factors_;
+    std::shared_ptr<const symbolic_data> symbolic_;
 };
 
 
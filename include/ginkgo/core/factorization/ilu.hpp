@@ -41,7 +41,7 @@ namespace factorization {
  */
 template <typename ValueType = gko::default_precision,
           typename IndexType = gko::int32>
-class Ilu : public Composition<ValueType> {
+class Ilu : public Composition<ValueType>, public ValueUpdatable {
 public:
     using value_type = ValueType;
     using index_type = IndexType;
@@ -61,6 +61,14 @@ public:
             this->get_operators()[1]);
     }
 
+    /**
+     * Recomputes the factors for a matrix with the same size and sparsity
+     * pattern. The sparsity patterns of the factors are reused.
+     *
+     * @param system_matrix  the matrix containing the new values
+     */
+    void update_values(std::shared_ptr<const LinOp> system_matrix) override;
+
     // Remove the possibility of calling `create`, which was enabled by
     // `Composition`
     template <typename... Args>
@@ -144,12 +152,17 @@ protected:
      * @param skip_sorting  determines if the sorting of system_matrix can be
      *                      skipped (therefore, marking that it is already
      *                      sorted)
+     * @param l_pattern  if given, a lower factor with the sparsity pattern of
+     *                   L, so it does not need to be computed
+     * @param u_pattern  if given, an upper factor with the sparsity pattern of
+     *                   U, so it does not need to be computed
      * @return  A Composition, containing the incomplete LU factors for the
      *          given system_matrix (first element is L, then U)
      */
     std::unique_ptr<Composition<ValueType>> generate_l_u(
-        const std::shared_ptr<const LinOp>& system_matrix,
-        bool skip_sorting) const;
+        const std::shared_ptr<const LinOp>& system_matrix, bool skip_sorting,
+        std::shared_ptr<const matrix_type> l_pattern = nullptr,
+        std::shared_ptr<const matrix_type> u_pattern = nullptr) const;
 };
 
 
@@ -67,7 +67,7 @@ namespace factorization {
  * @ingroup LinOp
  */
 template <typename ValueType = default_precision, typename IndexType = int32>
-class ParIlu : public Composition<ValueType> {
+class ParIlu : public Composition<ValueType>, public ValueUpdatable {
 public:
     using value_type = ValueType;
     using index_type = IndexType;
@@ -89,6 +89,15 @@ public:
             this->get_operators()[1]);
     }
 
+    /**
+     * Recomputes the factors for a matrix with the same size and sparsity
+     * pattern. The sparsity patterns of the factors are reused, only the
+     * fixed-point sweeps are repeated.
+     *
+     * @param system_matrix  the matrix containing the new values
+     */
+    void update_values(std::shared_ptr<const LinOp> system_matrix) override;
+
     // Remove the possibility of calling `create`, which was enabled by
     // `Composition`
     template <typename... Args>
@@ -185,13 +194,19 @@ protected:
      *                             factorization fails.
      * @param l_strategy  Strategy, which will be used by the L matrix.
      * @param u_strategy  Strategy, which will be used by the U matrix.
+     * @param l_pattern  if given, a lower factor with the sparsity pattern of
+     *                   L, so it does not need to be computed
+     * @param u_pattern  if given, an upper factor with the sparsity pattern of
+     *                   U, so it does not need to be computed
      * @return  A Composition, containing the incomplete LU factors for the
      *          given system_matrix (first element is L, then U)
      */
     std::unique_ptr<Composition<ValueType>> generate_l_u(
         const std::shared_ptr<const LinOp>& system_matrix, bool skip_sorting,
         std::shared_ptr<typename matrix_type::strategy_type> l_strategy,
-        std::shared_ptr<typename matrix_type::strategy_type> u_strategy) const;
+        std::shared_ptr<typename matrix_type::strategy_type> u_strategy,
+        std::shared_ptr<const matrix_type> l_pattern = nullptr,
+        std::shared_ptr<const matrix_type> u_pattern = nullptr) const;
 };
 
 
@@ -41,7 +41,8 @@ namespace multigrid {
 template <typename ValueType = default_precision, typename IndexType = int32>
 class FixedCoarsening
     : public EnableLinOp<FixedCoarsening<ValueType, IndexType>>,
-      public EnableMultigridLevel<ValueType> {
+      public EnableMultigridLevel<ValueType>,
+      public ValueUpdatable {
     friend class EnableLinOp<FixedCoarsening>;
     friend class EnablePolymorphicObject<FixedCoarsening, LinOp>;
 
@@ -59,6 +60,13 @@ public:
         return system_matrix_;
     }
 
+    /**
+     * Updates the fine and coarse operator with the values of a new system
+     * matrix of the same size, keeping the selected coarse rows.
+     *
+     * @param system_matrix  the new system matrix
+     */
+    void update_values(std::shared_ptr<const LinOp> system_matrix) override;
 
     GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
     {
@@ -40,6 +40,21 @@ namespace multigrid {
  * un-aggregated elements are assigned to an aggregated group
  * or are left alone.
  *
+ * The coarse matrix R * A * P is computed by a fused kernel exploiting that
+ * every row of the prolongation P contains a single one, split into a
+ * symbolic phase computing the sparsity pattern and a numeric phase computing
+ * the values.
+ *
+ * With smoothed aggregation, the piecewise constant prolongation T is smoothed
+ * by damped Jacobi, P = (I - omega D^-1 A) T with
+ * omega = smoothing_relaxation / rho(D^-1 A), which improves the convergence
+ * for problems like elasticity considerably, at the price of a denser coarse
+ * matrix. The spectral radius rho is estimated by a few power iterations. The
+ * restriction is P^H, and the coarse matrix is computed by sparse matrix
+ * products. Optionally, small entries of P are filtered to limit the fill-in.
+ * See P. Vanek et al., "Algebraic multigrid by smoothed aggregation for second
+ * and fourth order elliptic problems".
+ *
  * @tparam ValueType  precision of matrix elements
  * @tparam IndexType  precision of matrix indexes
  *
@@ -49,7 +64,8 @@ namespace multigrid {
  */
 template <typename ValueType = default_precision, typename IndexType = int32>
 class Pgm : public EnableLinOp<Pgm<ValueType, IndexType>>,
-            public EnableMultigridLevel<ValueType> {
+            public EnableMultigridLevel<ValueType>,
+            public ValueUpdatable {
     friend class EnableLinOp<Pgm>;
     friend class EnablePolymorphicObject<Pgm, LinOp>;
 
@@ -90,6 +106,20 @@ public:
         return agg_.get_const_data();
     }
 
+    /**
+     * Updates the fine and coarse operator with the values of a new system
+     * matrix with the same sparsity pattern. The aggregates, the prolongation
+     * and the restriction are kept as computed on generation, and only the
+     * numeric phase of the coarse matrix computation is repeated. With
+     * smoothed aggregation, only the aggregates are kept, and the transfer
+     * operators are smoothed again with the new values.
+     *
+     * @param system_matrix  the new system matrix
+     *
+     * @note This is only supported for non-distributed matrices.
+     */
+    void update_values(std::shared_ptr<const LinOp> system_matrix) override;
+
     GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
     {
         /**
@@ -127,6 +157,35 @@ public:
          * incorrect.
          */
         bool GKO_FACTORY_PARAMETER_SCALAR(skip_sorting, false);
+
+        /**
+         * Use smoothed aggregation, i.e., smooth the piecewise constant
+         * prolongation of the aggregates by one step of damped Jacobi.
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(smoothed_aggregation, false);
+
+        /**
+         * The relaxation factor of the damped Jacobi step of smoothed
+         * aggregation is this value divided by the estimated spectral radius
+         * of D^-1 A.
+         */
+        double GKO_FACTORY_PARAMETER_SCALAR(smoothing_relaxation, 4.0 / 3.0);
+
+        /**
+         * The number of power iterations estimating the spectral radius of
+         * D^-1 A for smoothed aggregation.
+         */
+        unsigned GKO_FACTORY_PARAMETER_SCALAR(num_estimation_iterations, 10u);
+
+        /**
+         * The threshold of filtering the smoothed prolongation, valid in the
+         * interval 0.0 ~ 1.0. Entries smaller in magnitude than this fraction
+         * of the largest magnitude in their row are dropped, and the remaining
+         * entries are scaled to keep the row sum. Filtering reduces the
+         * fill-in of the coarse matrix. 0.0 keeps all entries.
+         */
+        double GKO_FACTORY_PARAMETER_SCALAR(prolongation_filter_threshold,
+                                            0.0);
     };
     GKO_ENABLE_LIN_OP_FACTORY(Pgm, parameters, Factory);
     GKO_ENABLE_BUILD_METHOD(Factory);
@@ -171,10 +230,13 @@ protected:
           EnableMultigridLevel<ValueType>(system_matrix),
           parameters_{factory->get_parameters()},
           system_matrix_{system_matrix},
-          agg_(factory->get_executor(), system_matrix_->get_size()[0])
+          agg_(factory->get_executor(), system_matrix_->get_size()[0]),
+          coarse_nz_map_(factory->get_executor())
     {
         GKO_ASSERT(parameters_.max_unassigned_ratio <= 1.0);
         GKO_ASSERT(parameters_.max_unassigned_ratio >= 0.0);
+        GKO_ASSERT(parameters_.prolongation_filter_threshold <= 1.0);
+        GKO_ASSERT(parameters_.prolongation_filter_threshold >= 0.0);
         if (system_matrix_->get_size()[0] != 0) {
             // generate on the existed matrix
             this->generate();
@@ -205,6 +267,8 @@ protected:
 private:
     std::shared_ptr<const LinOp> system_matrix_{};
     array<IndexType> agg_;
+    // position of the coarse entry each fine entry contributes to
+    array<IndexType> coarse_nz_map_;
 };
 
 
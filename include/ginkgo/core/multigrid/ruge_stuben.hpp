@@ -0,0 +1,221 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_MULTIGRID_RUGE_STUBEN_HPP_
+#define GKO_PUBLIC_CORE_MULTIGRID_RUGE_STUBEN_HPP_
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/composition.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/config/config.hpp>
+#include <ginkgo/core/config/registry.hpp>
+#include <ginkgo/core/config/type_descriptor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/multigrid/multigrid_level.hpp>
+
+
+namespace gko {
+namespace multigrid {
+
+
+/**
+ * splitting_type defines how RugeStuben splits the points into coarse and
+ * fine points.
+ * - PMIS selects parallel maximal independent sets of the strong connection
+ *   graph, see H. De Sterck et al., "Reducing complexity in parallel algebraic
+ *   multigrid preconditioners". It needs no second pass, but can lead to
+ *   fine points without a strong coarse neighbor.
+ * - HMIS applies the classical first pass of Ruge-Stueben coarsening to the
+ *   local points before completing the splitting by PMIS. On a single process,
+ *   the first pass decides all points, so the splitting is the one of the
+ *   sequential first pass.
+ */
+enum class splitting_type { pmis, hmis };
+
+
+/**
+ * interpolation_type defines how RugeStuben interpolates the fine points from
+ * the coarse points.
+ * - direct interpolation only uses the strong coarse neighbors, see K. Stueben,
+ *   "Algebraic multigrid (AMG): an introduction with applications".
+ * - extended+i interpolation also uses the strong coarse neighbors of the
+ *   strong fine neighbors, which makes it robust for the sparse splittings of
+ *   PMIS and HMIS, see H. De Sterck et al., "Distance-two interpolation for
+ *   parallel algebraic multigrid".
+ */
+enum class interpolation_type { direct, extended_i };
+
+
+/**
+ * RugeStuben is the coarsening of classical algebraic multigrid. It computes
+ * the strong connections of the system matrix, splits the points into coarse
+ * and fine points, and interpolates the fine points from the coarse points.
+ * The restriction is the conjugate transpose of the prolongation, and the
+ * coarse matrix is the Galerkin product R * A * P.
+ *
+ * The off-diagonal entry a_ij is a strong connection if
+ * -a_ij s_i >= theta max_k(-a_ik s_i), where s_i is the sign of the (real part
+ * of the) diagonal entry and theta is the strength threshold. The
+ * interpolation assumes nonzero diagonal entries and works best for
+ * M-matrices, e.g. from scalar elliptic problems.
+ *
+ * @note The HMIS splitting and the extended+i interpolation are only available
+ *       on the reference and OpenMP executors. Distributed matrices are not
+ *       supported.
+ *
+ * @tparam ValueType  precision of matrix elements
+ * @tparam IndexType  precision of matrix indexes
+ *
+ * @ingroup MultigridLevel
+ * @ingroup Multigrid
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class RugeStuben : public EnableLinOp<RugeStuben<ValueType, IndexType>>,
+                   public EnableMultigridLevel<ValueType>,
+                   public ValueUpdatable {
+    friend class EnableLinOp<RugeStuben>;
+    friend class EnablePolymorphicObject<RugeStuben, LinOp>;
+
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+
+    /**
+     * Returns the system operator (matrix) of the linear system.
+     *
+     * @return the system operator (matrix)
+     */
+    std::shared_ptr<const LinOp> get_system_matrix() const
+    {
+        return system_matrix_;
+    }
+
+    /**
+     * Returns the C/F splitting, whose size is same as the number of rows.
+     * cf_splitting[row_idx] is 1 if the row is a coarse point and 0 if it is
+     * a fine point.
+     *
+     * @return the C/F splitting
+     */
+    const IndexType* get_const_cf_splitting() const noexcept
+    {
+        return cf_splitting_.get_const_data();
+    }
+
+    /**
+     * Updates the fine and coarse operator with the values of a new system
+     * matrix with the same sparsity pattern. The C/F splitting is kept as
+     * computed on generation, while the strong connections, the transfer
+     * operators and the coarse matrix are recomputed with the new values.
+     *
+     * @param system_matrix  the new system matrix
+     */
+    void update_values(std::shared_ptr<const LinOp> system_matrix) override;
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * The strength threshold theta, which is valid in the interval
+         * 0.0 ~ 1.0. Larger values lead to fewer strong connections and
+         * therefore to fewer coarse points. 0.25 is the usual choice for
+         * two-dimensional problems, 0.5 for three-dimensional problems.
+         */
+        double GKO_FACTORY_PARAMETER_SCALAR(strength_threshold, 0.25);
+
+        /**
+         * The C/F splitting algorithm.
+         */
+        splitting_type GKO_FACTORY_PARAMETER_SCALAR(splitting,
+                                                    splitting_type::pmis);
+
+        /**
+         * The interpolation algorithm.
+         */
+        interpolation_type GKO_FACTORY_PARAMETER_SCALAR(
+            interpolation, interpolation_type::direct);
+
+        /**
+         * The `system_matrix`, which will be given to this factory, must be
+         * sorted (first by row, then by column) in order for the algorithm
+         * to work. If it is known that the matrix will be sorted, this
+         * parameter can be set to `true` to skip the sorting (therefore,
+         * shortening the runtime).
+         * However, if it is unknown or if the matrix is known to be not sorted,
+         * it must remain `false`, otherwise, this multigrid_level might be
+         * incorrect.
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(skip_sorting, false);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(RugeStuben, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+    /**
+     * Create the parameters from the property_tree.
+     * Because this is directly tied to the specific type, the value/index type
+     * settings within config are ignored and type_descriptor is only used
+     * for children configs.
+     *
+     * @param config  the property tree for setting
+     * @param context  the registry
+     * @param td_for_child  the type descriptor for children configs. The
+     *                      default uses the value/index type of this class.
+     *
+     * @return parameters
+     */
+    static parameters_type parse(
+        const config::pnode& config, const config::registry& context,
+        const config::type_descriptor& td_for_child =
+            config::make_type_descriptor<ValueType, IndexType>());
+
+protected:
+    void apply_impl(const LinOp* b, LinOp* x) const override
+    {
+        this->get_composition()->apply(b, x);
+    }
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override
+    {
+        this->get_composition()->apply(alpha, b, beta, x);
+    }
+
+    explicit RugeStuben(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<RugeStuben>(std::move(exec))
+    {}
+
+    explicit RugeStuben(const Factory* factory,
+                        std::shared_ptr<const LinOp> system_matrix)
+        : EnableLinOp<RugeStuben>(factory->get_executor(),
+                                  system_matrix->get_size()),
+          EnableMultigridLevel<ValueType>(system_matrix),
+          parameters_{factory->get_parameters()},
+          system_matrix_{system_matrix},
+          cf_splitting_(factory->get_executor(), system_matrix_->get_size()[0])
+    {
+        GKO_ASSERT(parameters_.strength_threshold <= 1.0);
+        GKO_ASSERT(parameters_.strength_threshold >= 0.0);
+        if (system_matrix_->get_size()[0] != 0) {
+            // generate on the existing matrix
+            this->generate();
+        }
+    }
+
+    void generate();
+
+private:
+    std::shared_ptr<const LinOp> system_matrix_{};
+    array<IndexType> cf_splitting_;
+};
+
+
+}  // namespace multigrid
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_MULTIGRID_RUGE_STUBEN_HPP_
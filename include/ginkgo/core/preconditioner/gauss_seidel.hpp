@@ -24,6 +24,8 @@ namespace preconditioner {
  *
  * This is the special case of the relaxation factor $\omega = 1$ of the (S)SOR
  * preconditioner.
+ * Like Sor, it supports a multicolor ordering that relaxes independent rows
+ * in parallel.
  *
  * @see Sor
  *
@@ -60,6 +62,10 @@ public:
         // is false, defaults to UpperTrs
         std::shared_ptr<const LinOpFactory> GKO_DEFERRED_FACTORY_PARAMETER(
             u_solver);
+
+        // use a multicolor ordering to relax independent rows in parallel,
+        // l_solver and u_solver are unused if this is set
+        bool GKO_FACTORY_PARAMETER_SCALAR(multicolor, false);
     };
 
     /**
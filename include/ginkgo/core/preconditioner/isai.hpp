@@ -77,7 +77,8 @@ enum struct isai_type { lower, upper, general, spd };
  */
 template <isai_type IsaiType, typename ValueType, typename IndexType>
 class Isai : public EnableLinOp<Isai<IsaiType, ValueType, IndexType>>,
-             public Transposable {
+             public Transposable,
+             public ValueUpdatable {
     friend class EnableLinOp<Isai>;
     friend class EnablePolymorphicObject<Isai, LinOp>;
     friend class Isai<isai_type::general, ValueType, IndexType>;
@@ -216,6 +217,15 @@ public:
 
     std::unique_ptr<LinOp> conj_transpose() const override;
 
+    /**
+     * Recomputes the approximate inverse for a matrix with the same size and
+     * sparsity pattern. The sparsity pattern of the approximate inverse, i.e.
+     * the sparsity power of the matrix, is reused.
+     *
+     * @param system_matrix  the matrix containing the new values
+     */
+    void update_values(std::shared_ptr<const LinOp> system_matrix) override;
+
 protected:
     explicit Isai(std::shared_ptr<const Executor> exec)
         : EnableLinOp<Isai>(std::move(exec))
@@ -239,10 +249,7 @@ protected:
                          static_cast<remove_complex<value_type>>(
                              parameters_.excess_solver_reduction));
         if (IsaiType == isai_type::spd) {
-            auto inv = share(as<Csr>(approximate_inverse_));
-            auto inv_transp = share(inv->conj_transpose());
-            approximate_inverse_ =
-                Composition<ValueType>::create(inv_transp, inv);
+            this->compose_spd_inverse();
         }
     }
 
@@ -267,10 +274,22 @@ private:
      *
      * @param skip_sorting  dictates if the sorting of the input matrix should
      *                      be skipped.
+     *
+     * @param inverse_pattern  if given, the sparsity pattern of the
+     *                         approximate inverse, which is used instead of
+     *                         computing it from the input matrix.
+     */
+    void generate_inverse(
+        std::shared_ptr<const LinOp> to_invert, bool skip_sorting, int power,
+        index_type excess_limit,
+        remove_complex<value_type> excess_solver_reduction,
+        std::shared_ptr<const Csr> inverse_pattern = nullptr);
+
+    /**
+     * Replaces the lower triangular approximate inverse `L` of the spd ISAI by
+     * the composition `L^H * L`.
      */
-    void generate_inverse(std::shared_ptr<const LinOp> to_invert,
-                          bool skip_sorting, int power, index_type excess_limit,
-                          remove_complex<value_type> excess_solver_reduction);
+    void compose_spd_inverse();
 
 private:
     std::shared_ptr<LinOp> approximate_inverse_;
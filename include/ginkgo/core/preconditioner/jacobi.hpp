@@ -187,7 +187,8 @@ template <typename ValueType = default_precision, typename IndexType = int32>
 class Jacobi : public EnableLinOp<Jacobi<ValueType, IndexType>>,
                public ConvertibleTo<matrix::Dense<ValueType>>,
                public WritableToMatrixData<ValueType, IndexType>,
-               public Transposable {
+               public Transposable,
+               public ValueUpdatable {
     friend class EnableLinOp<Jacobi>;
     friend class EnablePolymorphicObject<Jacobi, LinOp>;
 
@@ -275,6 +276,17 @@ public:
 
     std::unique_ptr<LinOp> conj_transpose() const override;
 
+    /**
+     * Recomputes the (block) inverses for a matrix with the same size and
+     * sparsity pattern. The block structure found on generation is reused,
+     * so the block detection is skipped. Blocks whose precision was requested
+     * as precision_reduction::autodetect() have their precision detected again
+     * from the new values.
+     *
+     * @param system_matrix  the matrix containing the new values
+     */
+    void update_values(std::shared_ptr<const LinOp> system_matrix) override;
+
     /**
      * Copy-assigns a Jacobi preconditioner. Preserves executor, copies all
      * data and parameters.
@@ -532,7 +544,8 @@ protected:
         : EnableLinOp<Jacobi>(exec),
           num_blocks_{},
           blocks_(exec),
-          conditioning_(exec)
+          conditioning_(exec),
+          requested_precisions_(exec)
     {
         parameters_.block_pointers.set_executor(exec);
         parameters_.storage_optimization.block_wise.set_executor(exec);
@@ -556,11 +569,15 @@ protected:
           blocks_(factory->get_executor(),
                   storage_scheme_.compute_storage_space(
                       parameters_.block_pointers.get_size() - 1)),
-          conditioning_(factory->get_executor())
+          conditioning_(factory->get_executor()),
+          requested_precisions_(factory->get_executor())
     {
         parameters_.block_pointers.set_executor(this->get_executor());
         parameters_.storage_optimization.block_wise.set_executor(
             this->get_executor());
+        if (parameters_.storage_optimization.is_block_wise) {
+            requested_precisions_ = parameters_.storage_optimization.block_wise;
+        }
         this->generate(system_matrix.get(), parameters_.skip_sorting);
     }
 
@@ -636,6 +653,9 @@ private:
     size_type num_blocks_;
     array<value_type> blocks_;
     array<remove_complex<value_type>> conditioning_;
+    // the block-wise precisions as given in the parameters, before generate
+    // replaces the autodetected ones by the chosen precisions
+    array<precision_reduction> requested_precisions_;
 };
 
 
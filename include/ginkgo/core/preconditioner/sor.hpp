@@ -39,6 +39,15 @@ namespace preconditioner {
  * A detailed description can be found in Iterative Methods for Sparse Linear
  * Systems (Y. Saad) ch. 4.1.
  *
+ * The triangular solves are inherently sequential. If the `multicolor`
+ * parameter is set, the rows are instead colored such that no two rows of the
+ * same color are coupled, and the matrix is reordered by color before the
+ * splitting. All rows of a color can then be relaxed in parallel. This
+ * changes the ordering of the sweep, and thus the preconditioner, but keeps
+ * the convergence properties of (S)SOR for the reordered matrix, so it can be
+ * used e.g. as a Multigrid smoother. The multicolor variant is currently only
+ * available on the ReferenceExecutor and the OmpExecutor.
+ *
  * This class is a factory, which will only generate the preconditioner. The
  * resulting LinOp will represent the application of $M^{-1}$.
  *
@@ -81,6 +90,10 @@ public:
         // is false, defaults to UpperTrs
         std::shared_ptr<const LinOpFactory> GKO_DEFERRED_FACTORY_PARAMETER(
             u_solver);
+
+        // use a multicolor ordering to relax independent rows in parallel,
+        // l_solver and u_solver are unused if this is set
+        bool GKO_FACTORY_PARAMETER_SCALAR(multicolor, false);
     };
 
     /**
@@ -6,15 +6,10 @@
 #define GKO_PUBLIC_CORE_REORDER_NESTED_DISSECTION_HPP_
 
 
-#include <ginkgo/config.hpp>
-
-
-#if GKO_HAVE_METIS
-
-
 #include <memory>
 #include <unordered_map>
 
+#include <ginkgo/config.hpp>
 #include <ginkgo/core/base/abstract_factory.hpp>
 #include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/dim.hpp>
@@ -37,7 +32,14 @@ namespace reorder {
 
 /**
  * Computes a Nested Dissection (ND) reordering of an input matrix using the
- * METIS library.
+ * METIS library or a built-in multilevel graph partitioner.
+ *
+ * The built-in partitioner bisects the graph of the matrix recursively by
+ * coarsening it with heavy-edge matchings, bisecting the coarsest graph by
+ * greedy graph growing and refining the bisection with Fiduccia-Mattheyses
+ * passes on every level. It is used on builds without METIS, and its
+ * coarsening runs in parallel on the OpenMP executor. The graph of the matrix
+ * needs to be symmetric in both cases.
  *
  * @tparam ValueType  the type used to store values of the system matrix
  * @tparam IndexType  the type used to store sparsity pattern indices of the
@@ -67,6 +69,7 @@ public:
         /**
          * The options to be passed on to METIS, stored as key-value pairs.
          * Any options that are not set here use their default value.
+         * They are ignored by the built-in partitioner.
          */
         std::unordered_map<int, int> options;
 
@@ -79,6 +82,39 @@ public:
             this->options = std::move(options);
             return *this;
         }
+
+        /**
+         * Whether to use METIS instead of the built-in multilevel
+         * partitioner. This is only supported if Ginkgo was built with METIS,
+         * which is also the default.
+         */
+        bool use_metis = GKO_HAVE_METIS;
+
+        /**
+         * @copydoc use_metis
+         * @return `*this` for chaining
+         */
+        parameters_type& with_use_metis(bool use_metis)
+        {
+            this->use_metis = use_metis;
+            return *this;
+        }
+
+        /**
+         * The built-in partitioner stops dissecting subgraphs with at most
+         * this many vertices and keeps their original order.
+         */
+        size_type max_leaf_size = 64;
+
+        /**
+         * @copydoc max_leaf_size
+         * @return `*this` for chaining
+         */
+        parameters_type& with_max_leaf_size(size_type max_leaf_size)
+        {
+            this->max_leaf_size = max_leaf_size;
+            return *this;
+        }
     };
 
     /**
@@ -118,7 +154,4 @@ private:
 }  // namespace gko
 
 
-#endif  // GKO_HAVE_METIS
-
-
 #endif  // GKO_PUBLIC_CORE_REORDER_NESTED_DISSECTION_HPP_
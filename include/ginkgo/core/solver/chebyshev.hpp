@@ -0,0 +1,246 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_SOLVER_CHEBYSHEV_HPP_
+#define GKO_PUBLIC_CORE_SOLVER_CHEBYSHEV_HPP_
+
+
+#include <utility>
+#include <vector>
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/config/config.hpp>
+#include <ginkgo/core/config/registry.hpp>
+#include <ginkgo/core/config/type_descriptor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/identity.hpp>
+#include <ginkgo/core/solver/solver_base.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/criterion.hpp>
+
+
+namespace gko {
+namespace solver {
+
+
+/**
+ * Chebyshev iteration is an iterative method for matrices whose
+ * (preconditioned) spectrum lies in a known interval `[lower, upper]` of the
+ * positive real axis, e.g. symmetric positive definite matrices. It applies
+ * the scaled and shifted Chebyshev polynomial of the iteration count to the
+ * initial error, which is the polynomial with the smallest maximum over the
+ * interval.
+ *
+ * The interval is given by its end points, the `foci` parameter. If they are
+ * not provided, they are estimated when the solver is generated, by a few
+ * steps of the (preconditioned) Lanczos method started from a fixed
+ * pseudo-random vector. The largest Ritz value is enlarged by
+ * `max_eigenvalue_scale`, since it underestimates the largest eigenvalue.
+ * The lower end is either the smallest Ritz value or, if
+ * `min_eigenvalue_ratio` is positive, the given fraction of the upper end.
+ * The latter only damps the upper part of the spectrum, which makes the
+ * method a smoother, e.g. for solver::Multigrid.
+ *
+ * Besides the application of the system matrix and the preconditioner, an
+ * iteration only consists of a single fused vector update. If the stopping
+ * criteria do not need the residual norm, e.g. stop::Iteration, the
+ * application does not compute any reductions, which makes it cheap to use
+ * as a smoother or preconditioner for distributed problems.
+ *
+ * The implementation follows the preconditioned Chebyshev iteration from
+ * "Templates for the Solution of Linear Systems: Building Blocks for
+ * Iterative Methods" by Barrett et al.
+ *
+ * @note The spectrum estimation is only available for non-distributed system
+ *       matrices, the foci need to be provided for distributed matrices.
+ *
+ * @tparam ValueType  precision of matrix elements
+ *
+ * @ingroup solvers
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision>
+class Chebyshev
+    : public EnableLinOp<Chebyshev<ValueType>>,
+      public EnablePreconditionedIterativeSolver<ValueType,
+                                                 Chebyshev<ValueType>>,
+      public EnableApplyWithInitialGuess<Chebyshev<ValueType>>,
+      public Transposable {
+    friend class EnableLinOp<Chebyshev>;
+    friend class EnablePolymorphicObject<Chebyshev, LinOp>;
+    friend class EnableApplyWithInitialGuess<Chebyshev>;
+
+public:
+    using value_type = ValueType;
+    using transposed_type = Chebyshev<ValueType>;
+
+    std::unique_ptr<LinOp> transpose() const override;
+
+    std::unique_ptr<LinOp> conj_transpose() const override;
+
+    /**
+     * Return true as iterative solvers use the data in x as an initial guess.
+     *
+     * @return true as iterative solvers use the data in x as an initial guess.
+     */
+    bool apply_uses_initial_guess() const override
+    {
+        return this->get_default_initial_guess() ==
+               initial_guess_mode::provided;
+    }
+
+    /**
+     * Returns the foci of the spectrum interval used by the iteration. They
+     * are either the ones given in the parameters or the ones estimated from
+     * the system matrix on generation.
+     *
+     * @return the lower and upper end of the spectrum interval
+     */
+    std::pair<value_type, value_type> get_foci() const { return foci_; }
+
+    class Factory;
+
+    struct parameters_type
+        : enable_preconditioned_iterative_solver_factory_parameters<
+              parameters_type, Factory> {
+        /**
+         * The lower and upper end of the interval containing the spectrum of
+         * the preconditioned system matrix. If both are zero, the interval is
+         * estimated when the solver is generated.
+         */
+        std::pair<value_type, value_type> GKO_FACTORY_PARAMETER_VECTOR(
+            foci, value_type{0}, value_type{0});
+
+        /**
+         * The maximum number of Lanczos steps used to estimate the spectrum.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(num_estimation_iterations, 10u);
+
+        /**
+         * The factor by which the estimated largest eigenvalue is enlarged.
+         */
+        remove_complex<value_type> GKO_FACTORY_PARAMETER_SCALAR(
+            max_eigenvalue_scale, remove_complex<value_type>{1.1});
+
+        /**
+         * If positive, the estimated lower end of the interval is replaced by
+         * this fraction of the upper end, so only the upper part of the
+         * spectrum is damped, which is suitable for smoothing. Otherwise, the
+         * smallest estimated eigenvalue is used.
+         */
+        remove_complex<value_type> GKO_FACTORY_PARAMETER_SCALAR(
+            min_eigenvalue_ratio, remove_complex<value_type>{0});
+
+        /**
+         * Default initial guess mode. The available options are under
+         * initial_guess_mode.
+         */
+        initial_guess_mode GKO_FACTORY_PARAMETER_SCALAR(
+            default_initial_guess, initial_guess_mode::provided);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(Chebyshev, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+    /**
+     * Create the parameters from the property_tree.
+     * Because this is directly tied to the specific type, the value/index type
+     * settings within config are ignored and type_descriptor is only used
+     * for children configs.
+     *
+     * @param config  the property tree for setting
+     * @param context  the registry
+     * @param td_for_child  the type descriptor for children configs. The
+     *                      default uses the value type of this class.
+     *
+     * @return parameters
+     */
+    static parameters_type parse(const config::pnode& config,
+                                 const config::registry& context,
+                                 const config::type_descriptor& td_for_child =
+                                     config::make_type_descriptor<ValueType>());
+
+protected:
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    template <typename VectorType>
+    void apply_dense_impl(const VectorType* b, VectorType* x,
+                          initial_guess_mode guess) const;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+    void apply_with_initial_guess_impl(const LinOp* b, LinOp* x,
+                                       initial_guess_mode guess) const override;
+
+    void apply_with_initial_guess_impl(const LinOp* alpha, const LinOp* b,
+                                       const LinOp* beta, LinOp* x,
+                                       initial_guess_mode guess) const override;
+
+    /**
+     * Estimates the foci from the extreme eigenvalues of the preconditioned
+     * system matrix if they are not given in the parameters.
+     */
+    void setup_foci();
+
+    explicit Chebyshev(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<Chebyshev>(std::move(exec))
+    {}
+
+    explicit Chebyshev(const Factory* factory,
+                       std::shared_ptr<const LinOp> system_matrix)
+        : EnableLinOp<Chebyshev>(factory->get_executor(),
+                                 gko::transpose(system_matrix->get_size())),
+          EnablePreconditionedIterativeSolver<ValueType, Chebyshev<ValueType>>{
+              std::move(system_matrix), factory->get_parameters()},
+          parameters_{factory->get_parameters()}
+    {
+        this->set_default_initial_guess(parameters_.default_initial_guess);
+        this->setup_foci();
+    }
+
+private:
+    std::pair<value_type, value_type> foci_{};
+};
+
+
+template <typename ValueType>
+struct workspace_traits<Chebyshev<ValueType>> {
+    using Solver = Chebyshev<ValueType>;
+    // number of vectors used by this workspace
+    static int num_vectors(const Solver&);
+    // number of arrays used by this workspace
+    static int num_arrays(const Solver&);
+    // array containing the num_vectors names for the workspace vectors
+    static std::vector<std::string> op_names(const Solver&);
+    // array containing the num_arrays names for the workspace vectors
+    static std::vector<std::string> array_names(const Solver&);
+    // array containing all varying scalar vectors (independent of problem size)
+    static std::vector<int> scalars(const Solver&);
+    // array containing all varying vectors (dependent on problem size)
+    static std::vector<int> vectors(const Solver&);
+
+    // residual vector
+    constexpr static int residual = 0;
+    // preconditioned residual vector
+    constexpr static int inner_solution = 1;
+    // search direction vector
+    constexpr static int update_solution = 2;
+    // constant 1.0 scalar
+    constexpr static int one = 3;
+    // constant -1.0 scalar
+    constexpr static int minus_one = 4;
+
+    // stopping status array
+    constexpr static int stop = 0;
+};
+
+
+}  // namespace solver
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_SOLVER_CHEBYSHEV_HPP_
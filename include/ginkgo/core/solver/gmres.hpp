@@ -47,7 +47,17 @@ enum class ortho_method {
     /**
      * Classical Gram-Schmidt with re-orthogonalization
      */
-    cgs2
+    cgs2,
+    /**
+     * s-step (communication-avoiding) variant: s = s_step Krylov vectors are
+     * generated from a scaled monomial basis and orthonormalized together by
+     * block classical Gram-Schmidt with re-orthogonalization and Cholesky QR.
+     * This needs two global reductions per s Krylov vectors instead of at
+     * least one per Krylov vector.
+     * It can't be combined with flexible GMRES, generating such a solver
+     * throws a gko::InvalidStateError.
+     */
+    block_cgs2
 };
 
 /** Prints an orthogonalization method. */
@@ -114,12 +124,25 @@ public:
         /** Krylov subspace dimension/restart value. */
         size_type GKO_FACTORY_PARAMETER_SCALAR(krylov_dim, 0u);
 
-        /** Flexible GMRES */
+        /**
+         * Flexible GMRES
+         *
+         * @note Flexible GMRES doesn't support gmres::ortho_method::block_cgs2,
+         *       generating the solver throws a gko::InvalidStateError if both
+         *       are selected.
+         */
         bool GKO_FACTORY_PARAMETER_SCALAR(flexible, false);
 
         /** Orthogonalization method */
         gmres::ortho_method GKO_FACTORY_PARAMETER_SCALAR(
             ortho_method, gmres::ortho_method::mgs);
+
+        /**
+         * Number of Krylov vectors generated and orthogonalized together by
+         * gmres::ortho_method::block_cgs2. It is ignored by the other
+         * orthogonalization methods.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(s_step, 4u);
     };
     GKO_ENABLE_LIN_OP_FACTORY(Gmres, parameters, Factory);
     GKO_ENABLE_BUILD_METHOD(Factory);
@@ -166,6 +189,16 @@ protected:
         if (!parameters_.krylov_dim) {
             parameters_.krylov_dim = gmres_default_krylov_dim;
         }
+        if (!parameters_.s_step) {
+            parameters_.s_step = 1u;
+        }
+        if (parameters_.flexible &&
+            parameters_.ortho_method == gmres::ortho_method::block_cgs2) {
+            // the s-step basis is built from preconditioned basis vectors
+            // that are not orthonormal, so they can't be reused for FGMRES
+            GKO_INVALID_STATE(
+                "Flexible GMRES does not support block orthogonalization");
+        }
     }
 };
 
@@ -218,6 +251,14 @@ struct workspace_traits<Gmres<ValueType>> {
     constexpr static int next_krylov_norm_tmp = 14;
     // preconditioned krylov basis multivector
     constexpr static int preconditioned_krylov_bases = 15;
+    // hessenberg matrix without the givens rotations applied (block_cgs2)
+    constexpr static int arnoldi_hessenberg = 16;
+    // projection and gram matrix coefficients of a block (block_cgs2)
+    constexpr static int block_coefficients = 17;
+    // coefficients of the re-orthogonalization of a block (block_cgs2)
+    constexpr static int block_reorth_coefficients = 18;
+    // scaling factors of the s-step monomial basis (block_cgs2)
+    constexpr static int basis_scaling = 19;
 
     // stopping status array
     constexpr static int stop = 0;
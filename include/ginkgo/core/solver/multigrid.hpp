@@ -107,7 +107,8 @@ class MultigridState;
 class Multigrid : public EnableLinOp<Multigrid>,
                   public EnableSolverBase<Multigrid>,
                   public EnableIterativeBase<Multigrid>,
-                  public EnableApplyWithInitialGuess<Multigrid> {
+                  public EnableApplyWithInitialGuess<Multigrid>,
+                  public ValueUpdatable {
     friend class EnableLinOp<Multigrid>;
     friend class EnablePolymorphicObject<Multigrid, LinOp>;
     friend class EnableApplyWithInitialGuess<Multigrid>;
@@ -125,6 +126,20 @@ public:
                initial_guess_mode::provided;
     }
 
+    /**
+     * Updates the hierarchy with the values of a new system matrix of the
+     * same size and sparsity pattern. The levels are updated in place of
+     * being regenerated, i.e., each MultigridLevel keeps its coarsening, e.g.
+     * the aggregates of multigrid::Pgm, and only recomputes its coarse
+     * operator. The smoothers and the coarsest solver are generated again
+     * from their factories on the updated operators.
+     *
+     * @param system_matrix  the new system matrix
+     *
+     * @note All MultigridLevels need to implement ValueUpdatable.
+     */
+    void update_values(std::shared_ptr<const LinOp> system_matrix) override;
+
     /**
      * Gets the list of MultigridLevel operators.
      *
@@ -423,6 +438,35 @@ protected:
      */
     void generate();
 
+    /**
+     * Generates the pre-, mid- and post-smoothers of a level on the fine
+     * operator of its MultigridLevel and appends them to the given lists.
+     *
+     * @param index  the index of the MultigridLevel factory of the level
+     * @param mg_level  the MultigridLevel of the level
+     * @param pre_smoother_list  the list to append the pre-smoother to
+     * @param mid_smoother_list  the list to append the mid-smoother to
+     * @param post_smoother_list  the list to append the post-smoother to
+     */
+    void generate_smoothers(
+        size_type index,
+        std::shared_ptr<const gko::multigrid::MultigridLevel> mg_level,
+        std::vector<std::shared_ptr<const LinOp>>& pre_smoother_list,
+        std::vector<std::shared_ptr<const LinOp>>& mid_smoother_list,
+        std::vector<std::shared_ptr<const LinOp>>& post_smoother_list);
+
+    /**
+     * Generates the coarsest solver on the coarse operator of the last level.
+     *
+     * @param level  the number of levels
+     * @param last_mg_level  the MultigridLevel of the last level
+     *
+     * @return the coarsest solver
+     */
+    std::shared_ptr<const LinOp> generate_coarsest_solver(
+        size_type level,
+        std::shared_ptr<const gko::multigrid::MultigridLevel> last_mg_level);
+
     explicit Multigrid(std::shared_ptr<const Executor> exec);
 
     explicit Multigrid(const Factory* factory,
@@ -0,0 +1,215 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_SOLVER_PIPE_BICGSTAB_HPP_
+#define GKO_PUBLIC_CORE_SOLVER_PIPE_BICGSTAB_HPP_
+
+
+#include <vector>
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/config/config.hpp>
+#include <ginkgo/core/config/registry.hpp>
+#include <ginkgo/core/log/logger.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/identity.hpp>
+#include <ginkgo/core/solver/solver_base.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/criterion.hpp>
+
+
+namespace gko {
+/**
+ * @brief The ginkgo Solve namespace.
+ *
+ * @ingroup solvers
+ */
+namespace solver {
+
+
+/**
+ * PipeBicgstab or the pipelined BiCGSTAB method is a variant of BiCGSTAB for
+ * general matrices that hides the latency of global reductions.
+ *
+ * The pipelined BiCGSTAB by Cools and Vanroose reformulates the recurrences
+ * such that all dot products of an iteration are computed in two groups,
+ * which are reduced together. For distributed vectors, each of these
+ * reductions is non-blocking and overlapped with one application of the
+ * preconditioner and the system matrix, compared to the three blocking
+ * reductions of BiCGSTAB per iteration. This comes at the cost of storing and
+ * updating additional vectors, and the recurrences lead to a lower attainable
+ * accuracy than BiCGSTAB, so the stopping criterion should not ask for a
+ * residual reduction close to the machine precision unless the residual and
+ * the auxiliary vectors are recomputed explicitly every replacement_period
+ * iterations (residual replacement). This costs five additional applications
+ * of the system matrix and three of the preconditioner. The preconditioner is
+ * applied from the right.
+ *
+ * @tparam ValueType precision of the elements of the system matrix.
+ *
+ * @ingroup pipe_bicgstab
+ * @ingroup solvers
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision>
+class PipeBicgstab
+    : public EnableLinOp<PipeBicgstab<ValueType>>,
+      public EnablePreconditionedIterativeSolver<ValueType,
+                                                 PipeBicgstab<ValueType>>,
+      public Transposable {
+    friend class EnableLinOp<PipeBicgstab>;
+    friend class EnablePolymorphicObject<PipeBicgstab, LinOp>;
+
+public:
+    using value_type = ValueType;
+    using transposed_type = PipeBicgstab<ValueType>;
+
+    std::unique_ptr<LinOp> transpose() const override;
+
+    std::unique_ptr<LinOp> conj_transpose() const override;
+
+    /**
+     * Return true as iterative solvers use the data in x as an initial guess.
+     *
+     * @return true as iterative solvers use the data in x as an initial guess.
+     */
+    bool apply_uses_initial_guess() const override { return true; }
+
+    class Factory;
+    struct parameters_type
+        : enable_preconditioned_iterative_solver_factory_parameters<
+              parameters_type, Factory> {
+        /**
+         * Number of iterations after which the recursively updated residual
+         * and auxiliary vectors are replaced by their explicitly computed
+         * values. 0 disables the residual replacement.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(replacement_period, 0u);
+    };
+
+    GKO_ENABLE_LIN_OP_FACTORY(PipeBicgstab, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+    /**
+     * Create the parameters from the property_tree.
+     * Because this is directly tied to the specific type, the value/index type
+     * settings within config are ignored and type_descriptor is only used
+     * for children configs.
+     *
+     * @param config  the property tree for setting
+     * @param context  the registry
+     * @param td_for_child  the type descriptor for children configs. The
+     *                      default uses the value type of this class.
+     *
+     * @return parameters
+     */
+    static parameters_type parse(const config::pnode& config,
+                                 const config::registry& context,
+                                 const config::type_descriptor& td_for_child =
+                                     config::make_type_descriptor<ValueType>());
+
+protected:
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    template <typename VectorType>
+    void apply_dense_impl(const VectorType* b, VectorType* x) const;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+    explicit PipeBicgstab(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<PipeBicgstab>(std::move(exec))
+    {}
+
+    explicit PipeBicgstab(const Factory* factory,
+                          std::shared_ptr<const LinOp> system_matrix)
+        : EnableLinOp<PipeBicgstab>(factory->get_executor(),
+                                    gko::transpose(system_matrix->get_size())),
+          EnablePreconditionedIterativeSolver<ValueType,
+                                              PipeBicgstab<ValueType>>{
+              std::move(system_matrix), factory->get_parameters()},
+          parameters_{factory->get_parameters()}
+    {}
+};
+
+
+template <typename ValueType>
+struct workspace_traits<PipeBicgstab<ValueType>> {
+    using Solver = PipeBicgstab<ValueType>;
+    // number of vectors used by this workspace
+    static int num_vectors(const Solver&);
+    // number of arrays used by this workspace
+    static int num_arrays(const Solver&);
+    // array containing the num_vectors names for the workspace vectors
+    static std::vector<std::string> op_names(const Solver&);
+    // array containing the num_arrays names for the workspace vectors
+    static std::vector<std::string> array_names(const Solver&);
+    // array containing all varying scalar vectors (independent of problem size)
+    static std::vector<int> scalars(const Solver&);
+    // array containing all varying vectors (dependent on problem size)
+    static std::vector<int> vectors(const Solver&);
+
+    // residual vector
+    constexpr static int r = 0;
+    // shadow residual vector
+    constexpr static int rr = 1;
+    // preconditioned residual vector
+    constexpr static int rh = 2;
+    // system matrix applied to rh
+    constexpr static int w = 3;
+    // preconditioned w vector
+    constexpr static int wh = 4;
+    // system matrix applied to wh
+    constexpr static int t = 5;
+    // preconditioned search direction
+    constexpr static int ph = 6;
+    // system matrix applied to ph
+    constexpr static int s = 7;
+    // preconditioned s vector
+    constexpr static int sh = 8;
+    // system matrix applied to sh
+    constexpr static int z = 9;
+    // preconditioned z vector
+    constexpr static int zh = 10;
+    // system matrix applied to zh
+    constexpr static int v = 11;
+    // intermediate residual vector
+    constexpr static int q = 12;
+    // preconditioned q vector
+    constexpr static int qh = 13;
+    // system matrix applied to qh
+    constexpr static int y = 14;
+    // dot products (y, q) and (y, y) as rows
+    constexpr static int first_dots = 15;
+    // dot products (rr, r), (rr, w), (rr, s), (rr, z) as rows
+    constexpr static int second_dots = 16;
+    // alpha scalar
+    constexpr static int alpha = 17;
+    // beta scalar
+    constexpr static int beta = 18;
+    // omega scalar
+    constexpr static int omega = 19;
+    // previous rho scalar
+    constexpr static int prev_rho = 20;
+    // constant 1.0 scalar
+    constexpr static int one = 21;
+    // constant -1.0 scalar
+    constexpr static int minus_one = 22;
+
+    // stopping status array
+    constexpr static int stop = 0;
+    // reduction tmp array
+    constexpr static int tmp = 1;
+};
+
+
+}  // namespace solver
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_SOLVER_PIPE_BICGSTAB_HPP_
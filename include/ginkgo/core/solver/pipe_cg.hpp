@@ -0,0 +1,193 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_SOLVER_PIPE_CG_HPP_
+#define GKO_PUBLIC_CORE_SOLVER_PIPE_CG_HPP_
+
+
+#include <vector>
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/config/config.hpp>
+#include <ginkgo/core/config/registry.hpp>
+#include <ginkgo/core/config/type_descriptor.hpp>
+#include <ginkgo/core/log/logger.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/identity.hpp>
+#include <ginkgo/core/solver/solver_base.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/criterion.hpp>
+
+
+namespace gko {
+namespace solver {
+
+
+/**
+ * PipeCg or the pipelined conjugate gradient method is a variant of CG which
+ * is suitable for symmetric positive definite matrices.
+ *
+ * In contrast to CG, which needs two separate global reductions per
+ * iteration, the pipelined CG by Ghysels and Vanroose computes both dot
+ * products of an iteration from the same vectors and reduces them together.
+ * For distributed vectors, this reduction is non-blocking and overlapped with
+ * the application of the preconditioner and the system matrix, which hides
+ * the latency of the global reduction on large process counts. This comes at
+ * the cost of storing and updating additional vectors, and the recurrences
+ * can lead to a slightly lower attainable accuracy than CG. To counter this,
+ * the residual and the auxiliary vectors can be recomputed explicitly every
+ * replacement_period iterations (residual replacement), which costs three
+ * additional applications of the system matrix and two of the preconditioner.
+ *
+ * The vector updates of an iteration are merged into a single kernel.
+ *
+ * @tparam ValueType  precision of matrix elements
+ *
+ * @ingroup solvers
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision>
+class PipeCg
+    : public EnableLinOp<PipeCg<ValueType>>,
+      public EnablePreconditionedIterativeSolver<ValueType, PipeCg<ValueType>>,
+      public Transposable {
+    friend class EnableLinOp<PipeCg>;
+    friend class EnablePolymorphicObject<PipeCg, LinOp>;
+
+public:
+    using value_type = ValueType;
+    using transposed_type = PipeCg<ValueType>;
+
+    std::unique_ptr<LinOp> transpose() const override;
+
+    std::unique_ptr<LinOp> conj_transpose() const override;
+
+    /**
+     * Return true as iterative solvers use the data in x as an initial guess.
+     *
+     * @return true as iterative solvers use the data in x as an initial guess.
+     */
+    bool apply_uses_initial_guess() const override { return true; }
+
+    class Factory;
+
+    struct parameters_type
+        : enable_preconditioned_iterative_solver_factory_parameters<
+              parameters_type, Factory> {
+        /**
+         * Number of iterations after which the recursively updated residual
+         * and auxiliary vectors are replaced by their explicitly computed
+         * values. 0 disables the residual replacement.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(replacement_period, 0u);
+    };
+
+    GKO_ENABLE_LIN_OP_FACTORY(PipeCg, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+    /**
+     * Create the parameters from the property_tree.
+     * Because this is directly tied to the specific type, the value/index type
+     * settings within config are ignored and type_descriptor is only used
+     * for children configs.
+     *
+     * @param config  the property tree for setting
+     * @param context  the registry
+     * @param td_for_child  the type descriptor for children configs. The
+     *                      default uses the value type of this class.
+     *
+     * @return parameters
+     */
+    static parameters_type parse(const config::pnode& config,
+                                 const config::registry& context,
+                                 const config::type_descriptor& td_for_child =
+                                     config::make_type_descriptor<ValueType>());
+
+protected:
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    template <typename VectorType>
+    void apply_dense_impl(const VectorType* b, VectorType* x) const;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+    explicit PipeCg(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<PipeCg>(std::move(exec))
+    {}
+
+    explicit PipeCg(const Factory* factory,
+                    std::shared_ptr<const LinOp> system_matrix)
+        : EnableLinOp<PipeCg>(factory->get_executor(),
+                              gko::transpose(system_matrix->get_size())),
+          EnablePreconditionedIterativeSolver<ValueType, PipeCg<ValueType>>{
+              std::move(system_matrix), factory->get_parameters()},
+          parameters_{factory->get_parameters()}
+    {}
+};
+
+
+template <typename ValueType>
+struct workspace_traits<PipeCg<ValueType>> {
+    using Solver = PipeCg<ValueType>;
+    // number of vectors used by this workspace
+    static int num_vectors(const Solver&);
+    // number of arrays used by this workspace
+    static int num_arrays(const Solver&);
+    // array containing the num_vectors names for the workspace vectors
+    static std::vector<std::string> op_names(const Solver&);
+    // array containing the num_arrays names for the workspace vectors
+    static std::vector<std::string> array_names(const Solver&);
+    // array containing all varying scalar vectors (independent of problem size)
+    static std::vector<int> scalars(const Solver&);
+    // array containing all varying vectors (dependent on problem size)
+    static std::vector<int> vectors(const Solver&);
+
+    // residual vector
+    constexpr static int r = 0;
+    // preconditioned residual vector
+    constexpr static int u = 1;
+    // system matrix applied to the preconditioned residual
+    constexpr static int w = 2;
+    // preconditioned w vector
+    constexpr static int m = 3;
+    // system matrix applied to the m vector
+    constexpr static int n = 4;
+    // search direction for w
+    constexpr static int z = 5;
+    // search direction for u
+    constexpr static int q = 6;
+    // search direction for r
+    constexpr static int s = 7;
+    // search direction for the solution
+    constexpr static int p = 8;
+    // both dot products gamma = (r, u) and delta = (u, w) as rows
+    constexpr static int dots = 9;
+    // beta scalar
+    constexpr static int beta = 10;
+    // alpha scalar
+    constexpr static int alpha = 11;
+    // previous gamma scalar
+    constexpr static int prev_gamma = 12;
+    // constant 1.0 scalar
+    constexpr static int one = 13;
+    // constant -1.0 scalar
+    constexpr static int minus_one = 14;
+
+    // stopping status array
+    constexpr static int stop = 0;
+    // reduction tmp array
+    constexpr static int tmp = 1;
+};
+
+
+}  // namespace solver
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_SOLVER_PIPE_CG_HPP_
@@ -0,0 +1,177 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_OMP_BASE_BLAS_BINDINGS_HPP_
+#define GKO_OMP_BASE_BLAS_BINDINGS_HPP_
+
+
+#include <complex>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include <ginkgo/config.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+namespace blas {
+
+
+/**
+ * The integer type of the BLAS library, 32 bit for LP64 and 64 bit for ILP64
+ * libraries, as selected by BLA_SIZEOF_INTEGER at configure time.
+ */
+using blas_int =
+    std::conditional_t<GKO_BLAS_INTEGER_SIZE == 8, std::int64_t, std::int32_t>;
+
+
+}  // namespace blas
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
+
+
+#if GKO_HAVE_BLAS
+
+
+extern "C" {
+
+
+// the Fortran BLAS interface, which is provided by all BLAS implementations
+using gko::kernels::omp::blas::blas_int;
+
+void sgemm_(const char* transa, const char* transb, const blas_int* m,
+            const blas_int* n, const blas_int* k, const float* alpha,
+            const float* a, const blas_int* lda, const float* b,
+            const blas_int* ldb, const float* beta, float* c,
+            const blas_int* ldc);
+void dgemm_(const char* transa, const char* transb, const blas_int* m,
+            const blas_int* n, const blas_int* k, const double* alpha,
+            const double* a, const blas_int* lda, const double* b,
+            const blas_int* ldb, const double* beta, double* c,
+            const blas_int* ldc);
+void cgemm_(const char* transa, const char* transb, const blas_int* m,
+            const blas_int* n, const blas_int* k,
+            const std::complex<float>* alpha, const std::complex<float>* a,
+            const blas_int* lda, const std::complex<float>* b,
+            const blas_int* ldb, const std::complex<float>* beta,
+            std::complex<float>* c, const blas_int* ldc);
+void zgemm_(const char* transa, const char* transb, const blas_int* m,
+            const blas_int* n, const blas_int* k,
+            const std::complex<double>* alpha, const std::complex<double>* a,
+            const blas_int* lda, const std::complex<double>* b,
+            const blas_int* ldb, const std::complex<double>* beta,
+            std::complex<double>* c, const blas_int* ldc);
+
+
+}  // extern "C"
+
+
+#endif  // GKO_HAVE_BLAS
+
+
+namespace gko {
+/**
+ * @brief The device specific kernels namespace.
+ *
+ * @ingroup kernels
+ */
+namespace kernels {
+/**
+ * @brief The OpenMP namespace.
+ *
+ * @ingroup omp
+ */
+namespace omp {
+/**
+ * @brief The BLAS namespace.
+ *
+ * @ingroup blas
+ */
+namespace blas {
+
+
+/**
+ * Whether the value type is supported by the BLAS library Ginkgo was
+ * configured with. Without BLAS, no value type is supported.
+ */
+template <typename ValueType>
+struct is_supported : std::false_type {};
+
+#if GKO_HAVE_BLAS
+
+template <>
+struct is_supported<float> : std::true_type {};
+
+template <>
+struct is_supported<double> : std::true_type {};
+
+template <>
+struct is_supported<std::complex<float>> : std::true_type {};
+
+template <>
+struct is_supported<std::complex<double>> : std::true_type {};
+
+#endif  // GKO_HAVE_BLAS
+
+
+/**
+ * Checks whether the given matrix dimensions and strides can be passed to
+ * BLAS as blas_int.
+ */
+inline bool fits_index_type(size_type value)
+{
+    return value <=
+           static_cast<size_type>(std::numeric_limits<blas_int>::max());
+}
+
+
+/**
+ * Computes C = alpha * A * B + beta * C for row-major matrices A (m x k),
+ * B (k x n) and C (m x n).
+ */
+#define GKO_BIND_BLAS_GEMM(ValueType, BlasName)                                \
+    inline void gemm_row_major(blas_int m, blas_int n, blas_int k,             \
+                               ValueType alpha, const ValueType* a,            \
+                               blas_int lda, const ValueType* b, blas_int ldb, \
+                               ValueType beta, ValueType* c, blas_int ldc)     \
+    {                                                                          \
+        /* row-major C = A * B is column-major C^T = B^T * A^T */              \
+        const char no_trans = 'N';                                             \
+        BlasName(&no_trans, &no_trans, &n, &m, &k, &alpha, b, &ldb, a, &lda,   \
+                 &beta, c, &ldc);                                              \
+    }                                                                          \
+    static_assert(true,                                                        \
+                  "This assert is used to counter the false positive extra "   \
+                  "semi-colon warnings")
+
+#if GKO_HAVE_BLAS
+
+GKO_BIND_BLAS_GEMM(float, sgemm_);
+GKO_BIND_BLAS_GEMM(double, dgemm_);
+GKO_BIND_BLAS_GEMM(std::complex<float>, cgemm_);
+GKO_BIND_BLAS_GEMM(std::complex<double>, zgemm_);
+
+#endif  // GKO_HAVE_BLAS
+
+template <typename ValueType>
+inline void gemm_row_major(blas_int, blas_int, blas_int, ValueType,
+                           const ValueType*, blas_int, const ValueType*,
+                           blas_int, ValueType, ValueType*, blas_int)
+    GKO_NOT_IMPLEMENTED;
+
+#undef GKO_BIND_BLAS_GEMM
+
+
+}  // namespace blas
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_OMP_BASE_BLAS_BINDINGS_HPP_
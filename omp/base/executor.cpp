@@ -6,6 +6,8 @@
 
 #include <omp.h>
 
+#include <ginkgo/core/base/machine_topology.hpp>
+
 
 namespace gko {
 
@@ -20,6 +22,18 @@ int OmpExecutor::get_num_omp_threads()
 }
 
 
+void OmpExecutor::bind_threads_to_cores() const
+{
+    const auto num_cores =
+        static_cast<int>(machine_topology::get_instance()->get_num_cores());
+    if (num_cores == 0) {
+        return;
+    }
+#pragma omp parallel
+    machine_topology::bind_thread_to_core(omp_get_thread_num() % num_cores);
+}
+
+
 std::string OmpExecutor::get_description() const
 {
     return "OmpExecutor (" + std::to_string(this->get_num_omp_threads()) +
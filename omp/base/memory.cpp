@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "ginkgo/core/base/memory.hpp"
+
+#include <new>
+
+#include <omp.h>
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+
+
+namespace gko {
+
+
+/**
+ * The granularity at which the operating system assigns memory to NUMA nodes.
+ * Touching a single byte per page suffices, larger pages are touched
+ * multiple times.
+ */
+constexpr size_type first_touch_page_size = 4096;
+
+
+void* OmpFirstTouchAllocator::allocate(size_type num_bytes)
+{
+    auto ptr = ::operator new (num_bytes, std::nothrow_t{});
+    GKO_ENSURE_ALLOCATED(ptr, "omp", num_bytes);
+    if (num_bytes >= min_first_touch_bytes_) {
+        const auto bytes = static_cast<char*>(ptr);
+        const auto num_pages = ceildiv(num_bytes, first_touch_page_size);
+        // the static schedule assigns the pages to threads the same way a
+        // row-parallel loop over an array spanning this allocation would
+#pragma omp parallel for schedule(static)
+        for (size_type page = 0; page < num_pages; page++) {
+            bytes[page * first_touch_page_size] = 0;
+        }
+    }
+    return ptr;
+}
+
+
+void OmpFirstTouchAllocator::deallocate(void* ptr)
+{
+    ::operator delete (ptr, std::nothrow_t{});
+}
+
+
+}  // namespace gko
@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_OMP_COMPONENTS_SYNCFREE_HPP_
+#define GKO_OMP_COMPONENTS_SYNCFREE_HPP_
+
+
+#include <algorithm>
+#include <memory>
+
+#include <omp.h>
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+
+
+/**
+ * Dynamic scheduler for work items with dependencies on work items with a
+ * smaller index, like the rows of a triangular factor. Threads inside a
+ * parallel region obtain work items in increasing order from get_work_id(),
+ * wait for the completion of their dependencies via wait(dependency) and
+ * publish their results via mark_ready(work_id). Since work items are handed
+ * out in order, every dependency has already been claimed by a running thread,
+ * so the scheduler can't deadlock.
+ *
+ * @tparam IndexType  the type used to index the work items
+ */
+template <typename IndexType>
+class syncfree_scheduler {
+public:
+    using status_word = int;
+
+    /**
+     * Initializes the scheduler for num_work_items work items.
+     *
+     * @param status_array  storage for the completion status of every work
+     *                      item, it will be resized and reset.
+     */
+    syncfree_scheduler(std::shared_ptr<const OmpExecutor> exec,
+                       array<status_word>& status_array,
+                       size_type num_work_items)
+        : counter_{}, num_work_items_{static_cast<IndexType>(num_work_items)}
+    {
+        status_array.set_executor(exec);
+        status_array.resize_and_reset(num_work_items);
+        status_ = status_array.get_data();
+        std::fill_n(status_, num_work_items, status_word{});
+    }
+
+    syncfree_scheduler(const syncfree_scheduler&) = delete;
+    syncfree_scheduler& operator=(const syncfree_scheduler&) = delete;
+
+    /**
+     * Returns the next unclaimed work item, or a value >= num_work_items if
+     * all work items were already handed out.
+     */
+    IndexType get_work_id()
+    {
+        IndexType work_id;
+#pragma omp atomic capture
+        work_id = counter_++;
+        return work_id;
+    }
+
+    IndexType get_num_work_items() const { return num_work_items_; }
+
+    /** Blocks until the given work item was marked as ready. */
+    void wait(IndexType dependency) const
+    {
+        status_word ready{};
+        do {
+#pragma omp atomic read
+            ready = status_[dependency];
+        } while (!ready);
+#pragma omp flush
+    }
+
+    /** Marks the given work item as ready, publishing all prior writes. */
+    void mark_ready(IndexType work_id)
+    {
+#pragma omp flush
+#pragma omp atomic write
+        status_[work_id] = 1;
+    }
+
+private:
+    IndexType counter_;
+    IndexType num_work_items_;
+    status_word* status_;
+};
+
+
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_OMP_COMPONENTS_SYNCFREE_HPP_
@@ -9,12 +9,14 @@
 
 #include <ginkgo/core/matrix/csr.hpp>
 
+#include "core/base/allocator.hpp"
 #include "core/base/iterator_factory.hpp"
 #include "core/components/fill_array_kernels.hpp"
 #include "core/components/format_conversion_kernels.hpp"
 #include "core/factorization/elimination_forest.hpp"
 #include "core/factorization/lu_kernels.hpp"
 #include "core/matrix/csr_lookup.hpp"
+#include "omp/components/syncfree.hpp"
 
 
 namespace gko {
@@ -204,6 +206,235 @@ void initialize(std::shared_ptr<const DefaultExecutor> exec,
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CHOLESKY_INITIALIZE);
 
 
+namespace {
+
+
+// upper bound on the number of rows in a supernode, limits the panel size
+constexpr int max_supernode_size = 128;
+// number of dependency rows that are applied to a panel at once
+constexpr int supernode_update_block_size = 32;
+
+
+/**
+ * Groups consecutive rows of the upper triangular factor into fundamental
+ * supernodes: row + 1 joins the supernode of row if it is the parent of row in
+ * the elimination forest and its sparsity pattern equals that of row without
+ * the diagonal entry. All rows of a supernode thus share the same column
+ * pattern, starting at their diagonal.
+ */
+template <typename IndexType>
+void find_supernodes(size_type num_rows, const IndexType* row_ptrs,
+                     const IndexType* diag_idxs, const IndexType* parents,
+                     vector<IndexType>& supernode_ptrs,
+                     vector<IndexType>& row_supernodes)
+{
+    supernode_ptrs.assign(1, 0);
+    row_supernodes.resize(num_rows);
+    for (IndexType row = 0; row < static_cast<IndexType>(num_rows); row++) {
+        row_supernodes[row] = supernode_ptrs.size() - 1;
+        const auto next = row + 1;
+        const auto extend =
+            next < static_cast<IndexType>(num_rows) && parents[row] == next &&
+            row_ptrs[row + 1] - diag_idxs[row] ==
+                row_ptrs[next + 1] - diag_idxs[next] + 1 &&
+            next - supernode_ptrs.back() < max_supernode_size;
+        if (!extend) {
+            supernode_ptrs.push_back(next);
+        }
+    }
+}
+
+
+/**
+ * Subtracts the outer products of the dependency rows stored densely in
+ * updates from the panel, restricted to its upper triangular part.
+ */
+template <typename ValueType>
+void apply_supernode_updates(const ValueType* updates, int num_updates,
+                             int size, int width, ValueType* panel)
+{
+    for (int row = 0; row < size; row++) {
+        const auto panel_row = panel + row * width;
+        for (int update = 0; update < num_updates; update++) {
+            const auto update_row = updates + update * width;
+            const auto scale = conj(update_row[row]);
+            if (scale == zero<ValueType>()) {
+                continue;
+            }
+            for (int col = row; col < width; col++) {
+                panel_row[col] -= scale * update_row[col];
+            }
+        }
+    }
+}
+
+
+/**
+ * Computes the upper triangular factor rows of the supernode
+ * [begin, end) in a dense panel: All external updates are gathered in blocks
+ * and applied as dense outer products, then the panel is factorized in place
+ * and written back to the factor together with its conjugate transpose.
+ *
+ * @return false if the pattern of a dependency row is not contained in the
+ *         supernode pattern, which means the factor pattern is not closed
+ *         under elimination. In this case, the factor is left unchanged.
+ */
+template <typename ValueType, typename IndexType>
+bool factorize_supernode(IndexType begin, IndexType end,
+                         const IndexType* row_ptrs, const IndexType* cols,
+                         const IndexType* diag_idxs,
+                         const IndexType* transpose_idxs,
+                         const IndexType* row_supernodes,
+                         syncfree_scheduler<IndexType>& scheduler,
+                         ValueType* vals, vector<ValueType>& panel,
+                         vector<ValueType>& updates)
+{
+    const auto size = static_cast<int>(end - begin);
+    const auto width = static_cast<int>(row_ptrs[begin + 1] - diag_idxs[begin]);
+    const auto panel_cols = cols + diag_idxs[begin];
+    panel.assign(static_cast<size_type>(size) * width, zero<ValueType>());
+    updates.resize(static_cast<size_type>(supernode_update_block_size) * width);
+    for (int row = 0; row < size; row++) {
+        const auto row_diag = diag_idxs[begin + row];
+        std::copy(vals + row_diag, vals + row_ptrs[begin + row + 1],
+                  panel.data() + row * width + row);
+    }
+    int num_updates{};
+    for (int row = 0; row < size; row++) {
+        const auto global_row = begin + row;
+        for (auto lower_nz = row_ptrs[global_row];
+             lower_nz < diag_idxs[global_row]; lower_nz++) {
+            const auto dep = cols[lower_nz];
+            if (dep >= begin) {
+                // dependencies inside the supernode are handled below
+                break;
+            }
+            const auto dep_end = row_ptrs[dep + 1];
+            const auto dep_begin = static_cast<IndexType>(
+                std::lower_bound(cols + diag_idxs[dep], cols + dep_end, begin) -
+                cols);
+            // every dependency is only applied once, at the first row of the
+            // supernode it contributes to
+            if (cols[dep_begin] != global_row) {
+                continue;
+            }
+            scheduler.wait(row_supernodes[dep]);
+            const auto update_row = updates.data() + num_updates * width;
+            std::fill_n(update_row, width, zero<ValueType>());
+            // for a symbolic Cholesky factor, the pattern of the dependency
+            // row starting at the supernode is contained in the supernode
+            // pattern
+            auto col = row;
+            for (auto dep_nz = dep_begin; dep_nz < dep_end; dep_nz++) {
+                while (col < width && panel_cols[col] != cols[dep_nz]) {
+                    col++;
+                }
+                if (col == width) {
+                    return false;
+                }
+                update_row[col] = vals[dep_nz];
+            }
+            num_updates++;
+            if (num_updates == supernode_update_block_size) {
+                apply_supernode_updates(updates.data(), num_updates, size,
+                                        width, panel.data());
+                num_updates = 0;
+            }
+        }
+    }
+    apply_supernode_updates(updates.data(), num_updates, size, width,
+                            panel.data());
+    // dense upper Cholesky factorization of the diagonal block, which at the
+    // same time solves for the off-diagonal block
+    for (int row = 0; row < size; row++) {
+        const auto panel_row = panel.data() + row * width;
+        const auto diag = sqrt(panel_row[row]);
+        panel_row[row] = diag;
+        for (int col = row + 1; col < width; col++) {
+            panel_row[col] /= diag;
+        }
+        for (int next_row = row + 1; next_row < size; next_row++) {
+            const auto scale = conj(panel_row[next_row]);
+            const auto next_panel_row = panel.data() + next_row * width;
+            for (int col = next_row; col < width; col++) {
+                next_panel_row[col] -= scale * panel_row[col];
+            }
+        }
+    }
+    for (int row = 0; row < size; row++) {
+        const auto row_diag = diag_idxs[begin + row];
+        const auto panel_row = panel.data() + row * width;
+        vals[row_diag] = panel_row[row];
+        for (int col = row + 1; col < width; col++) {
+            const auto nz = row_diag + col - row;
+            vals[nz] = panel_row[col];
+            // copy the upper triangular entries to the transpose
+            vals[transpose_idxs[nz]] = conj(panel_row[col]);
+        }
+    }
+    return true;
+}
+
+
+/**
+ * Computes the upper triangular factor row `row` from its dependency rows.
+ * Dependency rows from other supernodes are waited for, those from the same
+ * supernode need to be computed already. With check_pattern, updates to
+ * entries outside of the factor pattern are dropped instead of assuming the
+ * pattern is closed under elimination.
+ */
+template <typename ValueType, typename IndexType>
+void factorize_row(IndexType row, const IndexType* row_ptrs,
+                   const IndexType* cols, const IndexType* lookup_offsets,
+                   const int64* lookup_descs, const int32* lookup_storage,
+                   const IndexType* diag_idxs, const IndexType* transpose_idxs,
+                   const IndexType* row_supernodes, bool check_pattern,
+                   syncfree_scheduler<IndexType>& scheduler, ValueType* vals)
+{
+    const auto row_begin = row_ptrs[row];
+    const auto row_diag = diag_idxs[row];
+    const auto row_end = row_ptrs[row + 1];
+    matrix::csr::device_sparsity_lookup<IndexType> lookup{
+        row_ptrs,     cols, lookup_offsets, lookup_storage,
+        lookup_descs, static_cast<size_type>(row)};
+    // for each lower triangular entry: eliminate with corresponding column
+    for (auto lower_nz = row_begin; lower_nz < row_diag; lower_nz++) {
+        const auto dep = cols[lower_nz];
+        if (row_supernodes[dep] != row_supernodes[row]) {
+            scheduler.wait(row_supernodes[dep]);
+        }
+        // the dependency row already stored its scaled upper triangular entry
+        // into our lower triangular part
+        const auto scale = vals[lower_nz];
+        const auto dep_diag_idx = diag_idxs[dep];
+        const auto dep_end = row_ptrs[dep + 1];
+        // subtract column dep from current column
+        for (auto upper_nz = dep_diag_idx; upper_nz < dep_end; upper_nz++) {
+            const auto upper_col = cols[upper_nz];
+            if (upper_col >= row) {
+                const auto upper_val = vals[upper_nz];
+                const auto local_nz = check_pattern
+                                          ? lookup[upper_col]
+                                          : lookup.lookup_unsafe(upper_col);
+                if (local_nz != invalid_index<IndexType>()) {
+                    vals[row_begin + local_nz] -= scale * upper_val;
+                }
+            }
+        }
+    }
+    const auto diag = sqrt(vals[row_diag]);
+    for (auto upper_nz = row_diag + 1; upper_nz < row_end; upper_nz++) {
+        vals[upper_nz] /= diag;
+        // copy the upper triangular entries to the transpose
+        vals[transpose_idxs[upper_nz]] = conj(vals[upper_nz]);
+    }
+    vals[row_diag] = diag;
+}
+
+
+}  // namespace
+
+
 template <typename ValueType, typename IndexType>
 void factorize(std::shared_ptr<const DefaultExecutor> exec,
                const IndexType* lookup_offsets, const int64* lookup_descs,
@@ -217,34 +448,42 @@ void factorize(std::shared_ptr<const DefaultExecutor> exec,
     const auto row_ptrs = factors->get_const_row_ptrs();
     const auto cols = factors->get_const_col_idxs();
     const auto vals = factors->get_values();
-    for (size_type row = 0; row < num_rows; row++) {
-        const auto row_begin = row_ptrs[row];
-        const auto row_diag = diag_idxs[row];
-        matrix::csr::device_sparsity_lookup<IndexType> lookup{
-            row_ptrs, cols, lookup_offsets, lookup_storage, lookup_descs, row};
-        for (auto lower_nz = row_begin; lower_nz < row_diag; lower_nz++) {
-            const auto dep = cols[lower_nz];
-            const auto dep_diag_idx = diag_idxs[dep];
-            const auto dep_diag = vals[dep_diag_idx];
-            const auto dep_end = row_ptrs[dep + 1];
-            const auto scale = vals[lower_nz] / dep_diag;
-            vals[lower_nz] = scale;
-            for (auto dep_nz = dep_diag_idx + 1; dep_nz < dep_end; dep_nz++) {
-                const auto col = cols[dep_nz];
-                if (col < row) {
-                    const auto val = vals[dep_nz];
-                    const auto nz = row_begin + lookup.lookup_unsafe(col);
-                    vals[nz] -= scale * val;
-                }
+    vector<IndexType> supernode_ptrs{exec};
+    vector<IndexType> row_supernodes{exec};
+    find_supernodes(num_rows, row_ptrs, diag_idxs,
+                    forest.parents.get_const_data(), supernode_ptrs,
+                    row_supernodes);
+    const auto num_supernodes = supernode_ptrs.size() - 1;
+    syncfree_scheduler<IndexType> scheduler{exec, tmp_storage, num_supernodes};
+    // every supernode computes its part of the upper triangular factor, so it
+    // only reads from dependency rows that were marked as ready.
+#pragma omp parallel
+    {
+        vector<ValueType> panel{exec};
+        vector<ValueType> updates{exec};
+        for (size_type supernode = scheduler.get_work_id();
+             supernode < num_supernodes;
+             supernode = scheduler.get_work_id()) {
+            const auto begin = supernode_ptrs[supernode];
+            const auto end = supernode_ptrs[supernode + 1];
+            const auto is_supernode = end - begin > 1;
+            if (is_supernode &&
+                factorize_supernode(begin, end, row_ptrs, cols, diag_idxs,
+                                    transpose_idxs, row_supernodes.data(),
+                                    scheduler, vals, panel, updates)) {
+                scheduler.mark_ready(supernode);
+                continue;
             }
+            // single rows and supernodes whose dependencies don't fit into
+            // their pattern are computed row by row
+            for (auto row = begin; row < end; row++) {
+                factorize_row(row, row_ptrs, cols, lookup_offsets,
+                              lookup_descs, lookup_storage, diag_idxs,
+                              transpose_idxs, row_supernodes.data(),
+                              is_supernode, scheduler, vals);
+            }
+            scheduler.mark_ready(supernode);
         }
-        ValueType diag = vals[row_diag];
-        for (auto lower_nz = row_begin; lower_nz < row_diag; lower_nz++) {
-            diag -= squared_norm(vals[lower_nz]);
-            // copy the lower triangular entries to the transpose
-            vals[transpose_idxs[lower_nz]] = conj(vals[lower_nz]);
-        }
-        vals[row_diag] = sqrt(diag);
     }
 }
 
@@ -2,9 +2,14 @@
 //
 // SPDX-License-Identifier: BSD-3-Clause
 
+#include <memory>
+
+#include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
 
 #include "core/factorization/factorization_helpers.hpp"
+#include "core/matrix/csr_kernels.hpp"
+#include "core/matrix/csr_lookup.hpp"
 
 
 namespace gko {
@@ -17,6 +22,56 @@ namespace helpers {
 using namespace ::gko::factorization;
 
 
+/**
+ * Stores the sparsity lookup structures for all rows of a CSR matrix, which
+ * the factorization kernels use to find the entries they update.
+ */
+template <typename IndexType>
+class sparsity_lookups {
+public:
+    sparsity_lookups(std::shared_ptr<const DefaultExecutor> exec,
+                     size_type num_rows, const IndexType* row_ptrs,
+                     const IndexType* cols)
+        : row_ptrs_{row_ptrs},
+          cols_{cols},
+          offsets_{exec, num_rows + 1},
+          descs_{exec, num_rows},
+          storage_{exec}
+    {
+        const auto allowed_sparsity = matrix::csr::sparsity_type::bitmap |
+                                      matrix::csr::sparsity_type::full |
+                                      matrix::csr::sparsity_type::hash;
+        kernels::omp::csr::build_lookup_offsets(
+            exec, row_ptrs, cols, num_rows, allowed_sparsity,
+            offsets_.get_data());
+        storage_.resize_and_reset(
+            static_cast<size_type>(offsets_.get_const_data()[num_rows]));
+        kernels::omp::csr::build_lookup(
+            exec, row_ptrs, cols, num_rows, allowed_sparsity,
+            offsets_.get_const_data(), descs_.get_data(), storage_.get_data());
+    }
+
+    /** Returns the lookup structure for the entries of the given row. */
+    matrix::csr::device_sparsity_lookup<IndexType> operator[](
+        size_type row) const
+    {
+        return {row_ptrs_,
+                cols_,
+                offsets_.get_const_data(),
+                storage_.get_const_data(),
+                descs_.get_const_data(),
+                row};
+    }
+
+private:
+    const IndexType* row_ptrs_;
+    const IndexType* cols_;
+    array<IndexType> offsets_;
+    array<int64> descs_;
+    array<int32> storage_;
+};
+
+
 template <typename ValueType, typename IndexType, typename LClosure,
           typename UClosure>
 void initialize_l_u(const matrix::Csr<ValueType, IndexType>* system_matrix,
@@ -4,6 +4,15 @@
 
 #include "core/factorization/ic_kernels.hpp"
 
+#include <memory>
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+#include "omp/components/syncfree.hpp"
+#include "omp/factorization/factorization_helpers.hpp"
+
 
 namespace gko {
 namespace kernels {
@@ -18,7 +27,52 @@ namespace ic_factorization {
 
 template <typename ValueType, typename IndexType>
 void compute(std::shared_ptr<const DefaultExecutor> exec,
-             matrix::Csr<ValueType, IndexType>* m) GKO_NOT_IMPLEMENTED;
+             matrix::Csr<ValueType, IndexType>* m)
+{
+    const auto num_rows = m->get_size()[0];
+    const auto row_ptrs = m->get_const_row_ptrs();
+    const auto cols = m->get_const_col_idxs();
+    const auto vals = m->get_values();
+    const factorization::helpers::sparsity_lookups<IndexType> lookups{
+        exec, num_rows, row_ptrs, cols};
+    array<IndexType> diag_idx_array{exec, num_rows};
+    const auto diag_idxs = diag_idx_array.get_data();
+    array<int> tmp_storage{exec};
+    syncfree_scheduler<IndexType> scheduler{exec, tmp_storage, num_rows};
+    // only the lower triangular part is computed. The rows are sorted, so
+    // every lower triangular entry only depends on entries to its left and on
+    // rows that were marked as ready.
+#pragma omp parallel
+    for (size_type row = scheduler.get_work_id(); row < num_rows;
+         row = scheduler.get_work_id()) {
+        const auto row_begin = row_ptrs[row];
+        const auto lookup = lookups[row];
+        const auto row_diag = row_begin + lookup.lookup_unsafe(row);
+        diag_idxs[row] = row_diag;
+        for (auto nz = row_begin; nz <= row_diag; nz++) {
+            const auto col = cols[nz];
+            if (nz < row_diag) {
+                scheduler.wait(col);
+            }
+            // accumulate l(row,:) * l(col,:)^H without the entry l(col, col)
+            const auto col_lookup = lookups[col];
+            const auto col_begin = row_ptrs[col];
+            ValueType sum{};
+            for (auto l_nz = row_begin; l_nz < nz; l_nz++) {
+                const auto lh_nz = col_lookup[cols[l_nz]];
+                if (lh_nz != invalid_index<IndexType>()) {
+                    sum += vals[l_nz] * conj(vals[col_begin + lh_nz]);
+                }
+            }
+            if (nz == row_diag) {
+                vals[nz] = sqrt(vals[nz] - sum);
+            } else {
+                vals[nz] = (vals[nz] - sum) / vals[diag_idxs[col]];
+            }
+        }
+        scheduler.mark_ready(row);
+    }
+}
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_IC_COMPUTE_KERNEL);
 
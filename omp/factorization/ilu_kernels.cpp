@@ -4,6 +4,14 @@
 
 #include "core/factorization/ilu_kernels.hpp"
 
+#include <memory>
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+#include "omp/components/syncfree.hpp"
+#include "omp/factorization/factorization_helpers.hpp"
+
 
 namespace gko {
 namespace kernels {
@@ -18,7 +26,45 @@ namespace ilu_factorization {
 
 template <typename ValueType, typename IndexType>
 void compute_lu(std::shared_ptr<const DefaultExecutor> exec,
-                matrix::Csr<ValueType, IndexType>* m) GKO_NOT_IMPLEMENTED;
+                matrix::Csr<ValueType, IndexType>* m)
+{
+    const auto num_rows = m->get_size()[0];
+    const auto row_ptrs = m->get_const_row_ptrs();
+    const auto cols = m->get_const_col_idxs();
+    const auto vals = m->get_values();
+    const factorization::helpers::sparsity_lookups<IndexType> lookups{
+        exec, num_rows, row_ptrs, cols};
+    array<IndexType> diag_idx_array{exec, num_rows};
+    const auto diag_idxs = diag_idx_array.get_data();
+    array<int> tmp_storage{exec};
+    syncfree_scheduler<IndexType> scheduler{exec, tmp_storage, num_rows};
+    // the rows are sorted, so the lower triangular entries are processed in
+    // ascending order, as required by the IKJ variant of ILU(0)
+#pragma omp parallel
+    for (size_type row = scheduler.get_work_id(); row < num_rows;
+         row = scheduler.get_work_id()) {
+        const auto row_begin = row_ptrs[row];
+        const auto lookup = lookups[row];
+        const auto row_diag = row_begin + lookup.lookup_unsafe(row);
+        diag_idxs[row] = row_diag;
+        for (auto lower_nz = row_begin; lower_nz < row_diag; lower_nz++) {
+            const auto dep = cols[lower_nz];
+            scheduler.wait(dep);
+            const auto dep_diag_idx = diag_idxs[dep];
+            const auto dep_end = row_ptrs[dep + 1];
+            const auto scale = vals[lower_nz] / vals[dep_diag_idx];
+            vals[lower_nz] = scale;
+            // update all entries of the row that are present in the pattern
+            for (auto dep_nz = dep_diag_idx + 1; dep_nz < dep_end; dep_nz++) {
+                const auto local_nz = lookup[cols[dep_nz]];
+                if (local_nz != invalid_index<IndexType>()) {
+                    vals[row_begin + local_nz] -= scale * vals[dep_nz];
+                }
+            }
+        }
+        scheduler.mark_ready(row);
+    }
+}
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_ILU_COMPUTE_LU_KERNEL);
@@ -11,6 +11,7 @@
 
 #include "core/base/allocator.hpp"
 #include "core/matrix/csr_lookup.hpp"
+#include "omp/components/syncfree.hpp"
 
 
 namespace gko {
@@ -73,14 +74,19 @@ void factorize(std::shared_ptr<const DefaultExecutor> exec,
     const auto row_ptrs = factors->get_const_row_ptrs();
     const auto cols = factors->get_const_col_idxs();
     const auto vals = factors->get_values();
-    // TODO parallelize
-    for (size_type row = 0; row < num_rows; row++) {
+    syncfree_scheduler<IndexType> scheduler{exec, tmp_storage, num_rows};
+#pragma omp parallel
+    for (size_type row = scheduler.get_work_id(); row < num_rows;
+         row = scheduler.get_work_id()) {
         const auto row_begin = row_ptrs[row];
         const auto row_diag = diag_idxs[row];
         matrix::csr::device_sparsity_lookup<IndexType> lookup{
             row_ptrs, cols, lookup_offsets, lookup_storage, lookup_descs, row};
         for (auto lower_nz = row_begin; lower_nz < row_diag; lower_nz++) {
             const auto dep = cols[lower_nz];
+            // the upper triangular part of the dependency row must be
+            // finished before we can eliminate with it
+            scheduler.wait(dep);
             const auto dep_diag_idx = diag_idxs[dep];
             const auto dep_diag = vals[dep_diag_idx];
             const auto dep_end = row_ptrs[dep + 1];
@@ -93,6 +99,7 @@ void factorize(std::shared_ptr<const DefaultExecutor> exec,
                 vals[nz] -= scale * val;
             }
         }
+        scheduler.mark_ready(row);
     }
 }
 
@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <limits>
 #include <numeric>
+#include <type_traits>
 #include <utility>
 
 #include <omp.h>
@@ -42,6 +43,219 @@ namespace omp {
 namespace csr {
 
 
+namespace {
+
+
+// number of right-hand side columns that are computed together
+constexpr int spmv_rhs_block_size = 4;
+
+
+/**
+ * Computes the dot product of the nonzeros [nz_begin, nz_end) of a row with
+ * column rhs of b. For real floating point types, the reduction is vectorized
+ * explicitly, other types fall back to the sequential loop.
+ */
+template <typename ArithmeticType, typename IndexType, typename AValues,
+          typename BValues>
+ArithmeticType spmv_row_dot(IndexType nz_begin, IndexType nz_end,
+                            const IndexType* col_idxs, const AValues& a_vals,
+                            const BValues& b_vals, size_type rhs)
+{
+    auto sum = zero<ArithmeticType>();
+    if constexpr (std::is_floating_point_v<ArithmeticType>) {
+#pragma omp simd reduction(+ : sum)
+        for (auto nz = nz_begin; nz < nz_end; nz++) {
+            sum += ArithmeticType{a_vals(nz)} * b_vals(col_idxs[nz], rhs);
+        }
+    } else {
+        for (auto nz = nz_begin; nz < nz_end; nz++) {
+            sum += ArithmeticType{a_vals(nz)} * b_vals(col_idxs[nz], rhs);
+        }
+    }
+    return sum;
+}
+
+
+/**
+ * Computes the dot products of the nonzeros [nz_begin, nz_end) of a row with
+ * all columns of b and passes them to the write(rhs, sum) callback.
+ * Blocks of right-hand side columns are computed together, so every matrix
+ * entry is only loaded once per block.
+ */
+template <typename ArithmeticType, typename IndexType, typename AValues,
+          typename BValues, typename Closure>
+void spmv_row(IndexType nz_begin, IndexType nz_end, const IndexType* col_idxs,
+              const AValues& a_vals, const BValues& b_vals, size_type num_rhs,
+              Closure write)
+{
+    size_type rhs_begin{};
+    for (; rhs_begin + spmv_rhs_block_size <= num_rhs;
+         rhs_begin += spmv_rhs_block_size) {
+        ArithmeticType sums[spmv_rhs_block_size]{};
+        if constexpr (std::is_floating_point_v<ArithmeticType>) {
+#pragma omp simd reduction(+ : sums[ : spmv_rhs_block_size])
+            for (auto nz = nz_begin; nz < nz_end; nz++) {
+                const ArithmeticType val = a_vals(nz);
+                const auto col = col_idxs[nz];
+                for (int i = 0; i < spmv_rhs_block_size; i++) {
+                    sums[i] += val * b_vals(col, rhs_begin + i);
+                }
+            }
+        } else {
+            for (auto nz = nz_begin; nz < nz_end; nz++) {
+                const ArithmeticType val = a_vals(nz);
+                const auto col = col_idxs[nz];
+                for (int i = 0; i < spmv_rhs_block_size; i++) {
+                    sums[i] += val * b_vals(col, rhs_begin + i);
+                }
+            }
+        }
+        for (int i = 0; i < spmv_rhs_block_size; i++) {
+            write(rhs_begin + i, sums[i]);
+        }
+    }
+    for (auto rhs = rhs_begin; rhs < num_rhs; rhs++) {
+        write(rhs, spmv_row_dot<ArithmeticType>(nz_begin, nz_end, col_idxs,
+                                                a_vals, b_vals, rhs));
+    }
+}
+
+
+/**
+ * Finds the position on the merge path of the row end pointers and the
+ * nonzero indices with the given diagonal index, i.e. the number of completed
+ * rows and consumed nonzeros.
+ */
+template <typename IndexType>
+std::pair<IndexType, IndexType> merge_path_search(const IndexType* row_ptrs,
+                                                  IndexType num_rows,
+                                                  IndexType nnz, int64 diagonal)
+{
+    auto lo = std::max(int64{}, diagonal - nnz);
+    auto hi = std::min(diagonal, static_cast<int64>(num_rows));
+    while (lo < hi) {
+        const auto mid = lo + (hi - lo) / 2;
+        if (row_ptrs[mid + 1] <= diagonal - 1 - mid) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return {static_cast<IndexType>(lo), static_cast<IndexType>(diagonal - lo)};
+}
+
+
+/**
+ * Computes the SpMV using the row partitioning selected by the matrix
+ * strategy:
+ * - merge_path splits the merged sequence of rows and nonzeros evenly among
+ *   the threads, rows that are split between threads are completed by adding
+ *   the partial sums afterwards via add(row, rhs, sum),
+ * - load_balance and automatical assign contiguous rows with a similar number
+ *   of nonzeros to each thread,
+ * - all other strategies distribute the rows statically.
+ * Completed rows are stored via write(row, rhs, sum).
+ */
+template <typename ArithmeticType, typename MatrixValueType, typename IndexType,
+          typename BValues, typename WriteClosure, typename AddClosure>
+void spmv_dispatch(std::shared_ptr<const OmpExecutor> exec,
+                   const matrix::Csr<MatrixValueType, IndexType>* a,
+                   const BValues& b_vals, size_type num_rhs,
+                   WriteClosure write, AddClosure add)
+{
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto num_rows = static_cast<IndexType>(a->get_size()[0]);
+    const auto nnz = row_ptrs[num_rows];
+    const auto a_vals =
+        acc::helper::build_const_rrm_accessor<ArithmeticType>(a);
+    using csr = matrix::Csr<MatrixValueType, IndexType>;
+    const auto strategy = a->get_strategy();
+    if (std::dynamic_pointer_cast<const typename csr::merge_path>(strategy)) {
+        const auto max_threads = omp_get_max_threads();
+        vector<IndexType> carry_rows(max_threads, num_rows, exec);
+        vector<ArithmeticType> carries(max_threads * num_rhs, exec);
+        int num_threads{};
+#pragma omp parallel
+        {
+            const auto tid = omp_get_thread_num();
+            const auto team_size = omp_get_num_threads();
+#pragma omp single nowait
+            num_threads = team_size;
+            const auto total = static_cast<int64>(num_rows) + nnz;
+            const auto begin = merge_path_search(row_ptrs, num_rows, nnz,
+                                                 total * tid / team_size);
+            const auto end = merge_path_search(row_ptrs, num_rows, nnz,
+                                               total * (tid + 1) / team_size);
+            auto nz = begin.second;
+            for (auto row = begin.first; row < end.first; row++) {
+                spmv_row<ArithmeticType>(
+                    nz, row_ptrs[row + 1], col_idxs, a_vals, b_vals, num_rhs,
+                    [&](size_type rhs, ArithmeticType sum) {
+                        write(row, rhs, sum);
+                    });
+                nz = row_ptrs[row + 1];
+            }
+            // the last row may be incomplete, store the partial sum
+            if (end.first < num_rows) {
+                carry_rows[tid] = end.first;
+                spmv_row<ArithmeticType>(
+                    nz, end.second, col_idxs, a_vals, b_vals, num_rhs,
+                    [&](size_type rhs, ArithmeticType sum) {
+                        carries[tid * num_rhs + rhs] = sum;
+                    });
+            }
+        }
+        for (int tid = 0; tid < num_threads; tid++) {
+            if (carry_rows[tid] < num_rows) {
+                for (size_type rhs = 0; rhs < num_rhs; rhs++) {
+                    add(carry_rows[tid], rhs, carries[tid * num_rhs + rhs]);
+                }
+            }
+        }
+    } else if (std::dynamic_pointer_cast<const typename csr::load_balance>(
+                   strategy) ||
+               std::dynamic_pointer_cast<const typename csr::automatical>(
+                   strategy)) {
+#pragma omp parallel
+        {
+            const auto tid = omp_get_thread_num();
+            const auto team_size = omp_get_num_threads();
+            // the first row whose nonzeros start at or after the target
+            const auto find_row = [&](int part) {
+                const auto target = static_cast<IndexType>(
+                    static_cast<int64>(nnz) * part / team_size);
+                return static_cast<IndexType>(
+                    std::lower_bound(row_ptrs, row_ptrs + num_rows, target) -
+                    row_ptrs);
+            };
+            const auto row_begin = tid == 0 ? IndexType{} : find_row(tid);
+            const auto row_end =
+                tid == team_size - 1 ? num_rows : find_row(tid + 1);
+            for (auto row = row_begin; row < row_end; row++) {
+                spmv_row<ArithmeticType>(
+                    row_ptrs[row], row_ptrs[row + 1], col_idxs, a_vals, b_vals,
+                    num_rhs, [&](size_type rhs, ArithmeticType sum) {
+                        write(row, rhs, sum);
+                    });
+            }
+        }
+    } else {
+#pragma omp parallel for
+        for (IndexType row = 0; row < num_rows; row++) {
+            spmv_row<ArithmeticType>(
+                row_ptrs[row], row_ptrs[row + 1], col_idxs, a_vals, b_vals,
+                num_rhs, [&](size_type rhs, ArithmeticType sum) {
+                    write(row, rhs, sum);
+                });
+        }
+    }
+}
+
+
+}  // namespace
+
+
 template <typename MatrixValueType, typename InputValueType,
           typename OutputValueType, typename IndexType>
 void spmv(std::shared_ptr<const OmpExecutor> exec,
@@ -52,29 +266,18 @@ void spmv(std::shared_ptr<const OmpExecutor> exec,
     using arithmetic_type =
         highest_precision<MatrixValueType, InputValueType, OutputValueType>;
 
-    auto row_ptrs = a->get_const_row_ptrs();
-    auto col_idxs = a->get_const_col_idxs();
-
-    const auto a_vals =
-        acc::helper::build_const_rrm_accessor<arithmetic_type>(a);
     const auto b_vals =
         acc::helper::build_const_rrm_accessor<arithmetic_type>(b);
     auto c_vals = acc::helper::build_rrm_accessor<arithmetic_type>(c);
 
-#pragma omp parallel for
-    for (size_type row = 0; row < a->get_size()[0]; ++row) {
-        for (size_type j = 0; j < c->get_size()[1]; ++j) {
-            auto sum = zero<arithmetic_type>();
-            for (size_type k = row_ptrs[row];
-                 k < static_cast<size_type>(row_ptrs[row + 1]); ++k) {
-                arithmetic_type val = a_vals(k);
-                auto col = col_idxs[k];
-
-                sum += val * b_vals(col, j);
-            }
-            c_vals(row, j) = sum;
-        }
-    }
+    spmv_dispatch<arithmetic_type>(
+        exec, a, b_vals, c->get_size()[1],
+        [&](IndexType row, size_type rhs, arithmetic_type sum) {
+            c_vals(row, rhs) = sum;
+        },
+        [&](IndexType row, size_type rhs, arithmetic_type sum) {
+            c_vals(row, rhs) = c_vals(row, rhs) + sum;
+        });
 }
 
 GKO_INSTANTIATE_FOR_EACH_MIXED_VALUE_AND_INDEX_TYPE(
@@ -93,29 +296,21 @@ void advanced_spmv(std::shared_ptr<const OmpExecutor> exec,
     using arithmetic_type =
         highest_precision<MatrixValueType, InputValueType, OutputValueType>;
 
-    auto row_ptrs = a->get_const_row_ptrs();
-    auto col_idxs = a->get_const_col_idxs();
     arithmetic_type valpha = alpha->at(0, 0);
     arithmetic_type vbeta = beta->at(0, 0);
 
-    const auto a_vals =
-        acc::helper::build_const_rrm_accessor<arithmetic_type>(a);
     const auto b_vals =
         acc::helper::build_const_rrm_accessor<arithmetic_type>(b);
     auto c_vals = acc::helper::build_rrm_accessor<arithmetic_type>(c);
-#pragma omp parallel for
-    for (size_type row = 0; row < a->get_size()[0]; ++row) {
-        for (size_type j = 0; j < c->get_size()[1]; ++j) {
-            auto sum = c_vals(row, j) * vbeta;
-            for (size_type k = row_ptrs[row];
-                 k < static_cast<size_type>(row_ptrs[row + 1]); ++k) {
-                arithmetic_type val = a_vals(k);
-                auto col = col_idxs[k];
-                sum += valpha * val * b_vals(col, j);
-            }
-            c_vals(row, j) = sum;
-        }
-    }
+
+    spmv_dispatch<arithmetic_type>(
+        exec, a, b_vals, c->get_size()[1],
+        [&](IndexType row, size_type rhs, arithmetic_type sum) {
+            c_vals(row, rhs) = c_vals(row, rhs) * vbeta + valpha * sum;
+        },
+        [&](IndexType row, size_type rhs, arithmetic_type sum) {
+            c_vals(row, rhs) = c_vals(row, rhs) + valpha * sum;
+        });
 }
 
 GKO_INSTANTIATE_FOR_EACH_MIXED_VALUE_AND_INDEX_TYPE(
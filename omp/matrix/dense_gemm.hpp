@@ -0,0 +1,322 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_OMP_MATRIX_DENSE_GEMM_HPP_
+#define GKO_OMP_MATRIX_DENSE_GEMM_HPP_
+
+
+#include <algorithm>
+#include <memory>
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+#include "core/base/allocator.hpp"
+#include "omp/base/blas_bindings.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+namespace dense {
+
+
+/** Number of rows of C computed at once by the GEMM micro-kernel. */
+constexpr size_type gemm_register_rows = 4;
+
+/** Number of columns of C computed at once by the GEMM micro-kernel. */
+template <typename ValueType>
+constexpr size_type gemm_register_cols =
+    std::max<size_type>(64 / sizeof(ValueType), 2);
+
+/** Number of rows of a tile of C, a multiple of gemm_register_rows. */
+constexpr size_type gemm_block_rows = 64;
+
+/** Number of columns of a tile of C, a multiple of gemm_register_cols. */
+constexpr size_type gemm_block_cols = 128;
+
+/** Size of the inner dimension handled in one pass over a tile of C. */
+constexpr size_type gemm_block_inner = 256;
+
+/**
+ * Products with fewer multiply-adds than this don't amortize the packing and
+ * use the simple row-parallel kernel instead.
+ */
+constexpr size_type gemm_min_blocked_work = 32 * 32 * 32;
+
+
+/**
+ * Copies the rows [row_begin, row_end) of the columns
+ * [inner_begin, inner_end) of A into packed, such that every
+ * gemm_register_rows rows are stored interleaved column by column. Missing
+ * rows of the last row panel are padded with zeros.
+ */
+template <typename ValueType>
+void pack_a(const matrix::Dense<ValueType>* a, size_type row_begin,
+            size_type row_end, size_type inner_begin, size_type inner_end,
+            ValueType* packed)
+{
+    constexpr auto mr = gemm_register_rows;
+    const auto inner_size = inner_end - inner_begin;
+    for (auto panel_row = row_begin; panel_row < row_end; panel_row += mr) {
+        for (size_type inner = 0; inner < inner_size; inner++) {
+            for (size_type i = 0; i < mr; i++) {
+                const auto row = panel_row + i;
+                packed[inner * mr + i] = row < row_end
+                                             ? a->at(row, inner_begin + inner)
+                                             : zero<ValueType>();
+            }
+        }
+        packed += inner_size * mr;
+    }
+}
+
+
+/**
+ * Copies the rows [inner_begin, inner_end) of the columns
+ * [col_begin, col_end) of B into packed, such that every gemm_register_cols
+ * columns are stored contiguously row by row. Missing columns of the last
+ * column panel are padded with zeros.
+ */
+template <typename ValueType>
+void pack_b(const matrix::Dense<ValueType>* b, size_type inner_begin,
+            size_type inner_end, size_type col_begin, size_type col_end,
+            ValueType* packed)
+{
+    constexpr auto nr = gemm_register_cols<ValueType>;
+    const auto inner_size = inner_end - inner_begin;
+    for (auto panel_col = col_begin; panel_col < col_end; panel_col += nr) {
+        for (size_type inner = 0; inner < inner_size; inner++) {
+            const auto b_row = b->get_const_values() +
+                               (inner_begin + inner) * b->get_stride();
+            for (size_type j = 0; j < nr; j++) {
+                const auto col = panel_col + j;
+                packed[inner * nr + j] =
+                    col < col_end ? b_row[col] : zero<ValueType>();
+            }
+        }
+        packed += inner_size * nr;
+    }
+}
+
+
+/**
+ * Computes a gemm_register_rows x gemm_register_cols block of A * B from the
+ * packed panels of A and B. The innermost loop has unit stride and a
+ * compile-time trip count so the accumulators stay in vector registers.
+ */
+template <typename ValueType>
+void gemm_micro_kernel(size_type inner_size, const ValueType* packed_a,
+                       const ValueType* packed_b, ValueType* result)
+{
+    constexpr auto mr = gemm_register_rows;
+    constexpr auto nr = gemm_register_cols<ValueType>;
+    ValueType acc[mr][nr]{};
+    for (size_type inner = 0; inner < inner_size; inner++) {
+        const auto a_col = packed_a + inner * mr;
+        const auto b_row = packed_b + inner * nr;
+        for (size_type i = 0; i < mr; i++) {
+            const auto a_val = a_col[i];
+#pragma omp simd
+            for (size_type j = 0; j < nr; j++) {
+                acc[i][j] += a_val * b_row[j];
+            }
+        }
+    }
+    for (size_type i = 0; i < mr; i++) {
+        for (size_type j = 0; j < nr; j++) {
+            result[i * nr + j] = acc[i][j];
+        }
+    }
+}
+
+
+/**
+ * Computes C = alpha * A * B + beta * C, where C is partitioned into 2D tiles
+ * that are distributed among the threads. For every tile, the panels of A and
+ * B belonging to a block of the inner dimension are packed into thread-local
+ * buffers and multiplied using the register-blocked micro-kernel. The scaling
+ * by beta is fused into the first pass over the inner dimension, so beta = 0
+ * overwrites C.
+ */
+template <typename ValueType>
+void gemm_blocked(std::shared_ptr<const DefaultExecutor> exec,
+                  ValueType alpha, const matrix::Dense<ValueType>* a,
+                  const matrix::Dense<ValueType>* b, ValueType beta,
+                  bool overwrite, matrix::Dense<ValueType>* c)
+{
+    constexpr auto mr = gemm_register_rows;
+    constexpr auto nr = gemm_register_cols<ValueType>;
+    const auto num_rows = c->get_size()[0];
+    const auto num_cols = c->get_size()[1];
+    const auto num_inner = a->get_size()[1];
+    const auto num_row_blocks = ceildiv(num_rows, gemm_block_rows);
+    const auto num_col_blocks = ceildiv(num_cols, gemm_block_cols);
+    const auto num_tiles = num_row_blocks * num_col_blocks;
+#pragma omp parallel
+    {
+        vector<ValueType> packed_a(gemm_block_rows * gemm_block_inner, exec);
+        vector<ValueType> packed_b(gemm_block_inner * gemm_block_cols, exec);
+        ValueType block[mr * nr];
+#pragma omp for schedule(dynamic)
+        for (size_type tile = 0; tile < num_tiles; tile++) {
+            const auto row_begin = tile / num_col_blocks * gemm_block_rows;
+            const auto col_begin = tile % num_col_blocks * gemm_block_cols;
+            const auto row_end =
+                std::min(row_begin + gemm_block_rows, num_rows);
+            const auto col_end =
+                std::min(col_begin + gemm_block_cols, num_cols);
+            for (size_type inner_begin = 0;
+                 inner_begin < std::max<size_type>(num_inner, 1);
+                 inner_begin += gemm_block_inner) {
+                const auto inner_end =
+                    std::min(inner_begin + gemm_block_inner, num_inner);
+                const auto inner_size = inner_end - inner_begin;
+                const auto first_pass = inner_begin == 0;
+                pack_a(a, row_begin, row_end, inner_begin, inner_end,
+                       packed_a.data());
+                pack_b(b, inner_begin, inner_end, col_begin, col_end,
+                       packed_b.data());
+                for (auto row = row_begin; row < row_end; row += mr) {
+                    const auto panel_a =
+                        packed_a.data() + (row - row_begin) * inner_size;
+                    for (auto col = col_begin; col < col_end; col += nr) {
+                        const auto panel_b =
+                            packed_b.data() + (col - col_begin) * inner_size;
+                        gemm_micro_kernel(inner_size, panel_a, panel_b, block);
+                        const auto rows = std::min(mr, row_end - row);
+                        const auto cols = std::min(nr, col_end - col);
+                        for (size_type i = 0; i < rows; i++) {
+                            for (size_type j = 0; j < cols; j++) {
+                                auto& out = c->at(row + i, col + j);
+                                if (first_pass) {
+                                    out = overwrite ? zero<ValueType>()
+                                                    : beta * out;
+                                }
+                                out += alpha * block[i * nr + j];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+/**
+ * Computes C = alpha * A * B + beta * C using BLAS. With overwrite = true, the
+ * previous content of C is ignored.
+ *
+ * @return false if BLAS is not available for the value type or the sizes
+ *         don't fit into its integer type, in which case C is left untouched.
+ */
+template <typename ValueType>
+bool gemm_blas(std::shared_ptr<const DefaultExecutor> exec, ValueType alpha,
+               const matrix::Dense<ValueType>* a,
+               const matrix::Dense<ValueType>* b, ValueType beta,
+               bool overwrite, matrix::Dense<ValueType>* c)
+{
+    const auto num_rows = c->get_size()[0];
+    const auto num_cols = c->get_size()[1];
+    const auto num_inner = a->get_size()[1];
+    if (!blas::is_supported<ValueType>::value || num_inner == 0 ||
+        !blas::fits_index_type(num_rows) || !blas::fits_index_type(num_cols) ||
+        !blas::fits_index_type(num_inner) ||
+        !blas::fits_index_type(a->get_stride()) ||
+        !blas::fits_index_type(b->get_stride()) ||
+        !blas::fits_index_type(c->get_stride())) {
+        return false;
+    }
+    if (overwrite) {
+        beta = zero<ValueType>();
+    } else if (is_zero(beta)) {
+        // BLAS doesn't read C for beta = 0, while the other kernels compute
+        // beta * C, so NaN and Inf in C need to be propagated explicitly
+#pragma omp parallel for
+        for (size_type row = 0; row < num_rows; ++row) {
+            for (size_type col = 0; col < num_cols; ++col) {
+                c->at(row, col) *= beta;
+            }
+        }
+        beta = one<ValueType>();
+    }
+    using blas::blas_int;
+    blas::gemm_row_major(
+        static_cast<blas_int>(num_rows), static_cast<blas_int>(num_cols),
+        static_cast<blas_int>(num_inner), alpha, a->get_const_values(),
+        static_cast<blas_int>(a->get_stride()), b->get_const_values(),
+        static_cast<blas_int>(b->get_stride()), beta, c->get_values(),
+        static_cast<blas_int>(c->get_stride()));
+    return true;
+}
+
+
+/**
+ * Computes C = alpha * A * B + beta * C by distributing the rows of C among
+ * the threads, without any blocking. With overwrite = true, the previous
+ * content of C is ignored.
+ */
+template <typename ValueType>
+void gemm_simple(std::shared_ptr<const DefaultExecutor> exec, ValueType alpha,
+                 const matrix::Dense<ValueType>* a,
+                 const matrix::Dense<ValueType>* b, ValueType beta,
+                 bool overwrite, matrix::Dense<ValueType>* c)
+{
+    const auto num_rows = c->get_size()[0];
+    const auto num_cols = c->get_size()[1];
+    const auto num_inner = a->get_size()[1];
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; ++row) {
+        for (size_type col = 0; col < num_cols; ++col) {
+            c->at(row, col) =
+                overwrite ? zero<ValueType>() : beta * c->at(row, col);
+        }
+        for (size_type inner = 0; inner < num_inner; ++inner) {
+            const auto a_val = alpha * a->at(row, inner);
+            for (size_type col = 0; col < num_cols; ++col) {
+                c->at(row, col) += a_val * b->at(inner, col);
+            }
+        }
+    }
+}
+
+
+/**
+ * Computes C = alpha * A * B + beta * C using BLAS if it is available for the
+ * value type, the cache-blocked kernel for larger products and a simple
+ * row-parallel kernel otherwise. With overwrite = true, the previous content
+ * of C is ignored.
+ */
+template <typename ValueType>
+void gemm(std::shared_ptr<const DefaultExecutor> exec, ValueType alpha,
+          const matrix::Dense<ValueType>* a, const matrix::Dense<ValueType>* b,
+          ValueType beta, bool overwrite, matrix::Dense<ValueType>* c)
+{
+    const auto num_rows = c->get_size()[0];
+    const auto num_cols = c->get_size()[1];
+    const auto num_inner = a->get_size()[1];
+    if (num_rows == 0 || num_cols == 0) {
+        return;
+    }
+    if (gemm_blas(exec, alpha, a, b, beta, overwrite, c)) {
+        return;
+    }
+    if (num_cols >= gemm_register_cols<ValueType> / 2 &&
+        num_rows * num_cols * num_inner >= gemm_min_blocked_work) {
+        gemm_blocked(exec, alpha, a, b, beta, overwrite, c);
+    } else {
+        gemm_simple(exec, alpha, a, b, beta, overwrite, c);
+    }
+}
+
+
+}  // namespace dense
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_OMP_MATRIX_DENSE_GEMM_HPP_
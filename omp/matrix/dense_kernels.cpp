@@ -23,6 +23,7 @@
 #include "accessor/block_col_major.hpp"
 #include "accessor/range.hpp"
 #include "core/components/prefix_sum_kernels.hpp"
+#include "omp/matrix/dense_gemm.hpp"
 
 
 namespace gko {
@@ -83,21 +84,7 @@ void simple_apply(std::shared_ptr<const DefaultExecutor> exec,
                   const matrix::Dense<ValueType>* b,
                   matrix::Dense<ValueType>* c)
 {
-#pragma omp parallel for
-    for (size_type row = 0; row < c->get_size()[0]; ++row) {
-        for (size_type col = 0; col < c->get_size()[1]; ++col) {
-            c->at(row, col) = zero<ValueType>();
-        }
-    }
-
-#pragma omp parallel for
-    for (size_type row = 0; row < c->get_size()[0]; ++row) {
-        for (size_type inner = 0; inner < a->get_size()[1]; ++inner) {
-            for (size_type col = 0; col < c->get_size()[1]; ++col) {
-                c->at(row, col) += a->at(row, inner) * b->at(inner, col);
-            }
-        }
-    }
+    gemm(exec, one<ValueType>(), a, b, zero<ValueType>(), true, c);
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_DENSE_SIMPLE_APPLY_KERNEL);
@@ -109,31 +96,7 @@ void apply(std::shared_ptr<const DefaultExecutor> exec,
            const matrix::Dense<ValueType>* a, const matrix::Dense<ValueType>* b,
            const matrix::Dense<ValueType>* beta, matrix::Dense<ValueType>* c)
 {
-    if (is_nonzero(beta->at(0, 0))) {
-#pragma omp parallel for
-        for (size_type row = 0; row < c->get_size()[0]; ++row) {
-            for (size_type col = 0; col < c->get_size()[1]; ++col) {
-                c->at(row, col) *= beta->at(0, 0);
-            }
-        }
-    } else {
-#pragma omp parallel for
-        for (size_type row = 0; row < c->get_size()[0]; ++row) {
-            for (size_type col = 0; col < c->get_size()[1]; ++col) {
-                c->at(row, col) *= zero<ValueType>();
-            }
-        }
-    }
-
-#pragma omp parallel for
-    for (size_type row = 0; row < c->get_size()[0]; ++row) {
-        for (size_type inner = 0; inner < a->get_size()[1]; ++inner) {
-            for (size_type col = 0; col < c->get_size()[1]; ++col) {
-                c->at(row, col) +=
-                    alpha->at(0, 0) * a->at(row, inner) * b->at(inner, col);
-            }
-        }
-    }
+    gemm(exec, alpha->at(0, 0), a, b, beta->at(0, 0), false, c);
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_DENSE_APPLY_KERNEL);
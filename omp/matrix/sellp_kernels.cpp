@@ -4,12 +4,14 @@
 
 #include "core/matrix/sellp_kernels.hpp"
 
-#include <array>
+#include <algorithm>
 
 #include <omp.h>
 
 #include <ginkgo/core/base/exception_helpers.hpp>
 
+#include "core/base/allocator.hpp"
+
 
 namespace gko {
 namespace kernels {
@@ -22,6 +24,59 @@ namespace omp {
 namespace sellp {
 
 
+/**
+ * Computes block_size columns of the product of a single slice, starting at
+ * column rhs_begin. The entries of a slice are stored column-major, so the
+ * innermost loop runs over consecutive rows with unit stride, which allows the
+ * compiler to vectorize it with a width up to the slice size.
+ *
+ * @param sums  workspace of size block_size * slice_size
+ */
+template <int block_size, typename ValueType, typename IndexType,
+          typename OutFn>
+void spmv_slice(const matrix::Sellp<ValueType, IndexType>* a, size_type slice,
+                size_type rhs_begin, const matrix::Dense<ValueType>* b,
+                matrix::Dense<ValueType>* c, ValueType* sums, OutFn out)
+{
+    const auto num_rows = a->get_size()[0];
+    const auto slice_size = a->get_slice_size();
+    const auto slice_begin = slice * slice_size;
+    const auto slice_rows = std::min(slice_size, num_rows - slice_begin);
+    const auto slice_set = a->get_const_slice_sets()[slice];
+    const auto slice_length = a->get_const_slice_lengths()[slice];
+    const auto vals = a->get_const_values();
+    const auto cols = a->get_const_col_idxs();
+    const auto b_vals = b->get_const_values() + rhs_begin;
+    const auto b_stride = b->get_stride();
+    std::fill_n(sums, block_size * slice_size, zero<ValueType>());
+    for (size_type i = 0; i < slice_length; i++) {
+        const auto offset = (slice_set + i) * slice_size;
+        for (size_type row = 0; row < slice_rows; row++) {
+            const auto col = cols[offset + row];
+            if (col != invalid_index<IndexType>()) {
+                const auto val = vals[offset + row];
+#pragma unroll
+                for (int j = 0; j < block_size; j++) {
+                    sums[j * slice_size + row] +=
+                        val * b_vals[col * b_stride + j];
+                }
+            }
+        }
+    }
+    for (size_type row = 0; row < slice_rows; row++) {
+        const auto global_row = slice_begin + row;
+#pragma unroll
+        for (int j = 0; j < block_size; j++) {
+            const auto col = rhs_begin + j;
+            [&] {
+                c->at(global_row, col) =
+                    out(global_row, col, sums[j * slice_size + row]);
+            }();
+        }
+    }
+}
+
+
 template <int num_rhs, typename ValueType, typename IndexType, typename OutFn>
 void spmv_small_rhs(std::shared_ptr<const OmpExecutor> exec,
                     const matrix::Sellp<ValueType, IndexType>* a,
@@ -29,35 +84,14 @@ void spmv_small_rhs(std::shared_ptr<const OmpExecutor> exec,
                     matrix::Dense<ValueType>* c, OutFn out)
 {
     GKO_ASSERT(b->get_size()[1] == num_rhs);
-    auto slice_lengths = a->get_const_slice_lengths();
-    auto slice_sets = a->get_const_slice_sets();
-    auto slice_size = a->get_slice_size();
-    auto slice_num = ceildiv(a->get_size()[0] + slice_size - 1, slice_size);
-#pragma omp parallel for collapse(2)
-    for (size_type slice = 0; slice < slice_num; slice++) {
-        for (size_type row = 0; row < slice_size; row++) {
-            size_type global_row = slice * slice_size + row;
-            if (global_row < a->get_size()[0]) {
-                std::array<ValueType, num_rhs> partial_sum;
-                partial_sum.fill(zero<ValueType>());
-                for (size_type i = 0; i < slice_lengths[slice]; i++) {
-                    auto val = a->val_at(row, slice_sets[slice], i);
-                    auto col = a->col_at(row, slice_sets[slice], i);
-                    if (col != invalid_index<IndexType>()) {
-#pragma unroll
-                        for (size_type j = 0; j < num_rhs; j++) {
-                            partial_sum[j] += val * b->at(col, j);
-                        }
-                    }
-                }
-#pragma unroll
-                for (size_type j = 0; j < num_rhs; j++) {
-                    [&] {
-                        c->at(global_row, j) =
-                            out(global_row, j, partial_sum[j]);
-                    }();
-                }
-            }
+    const auto slice_size = a->get_slice_size();
+    const auto slice_num = ceildiv(a->get_size()[0], slice_size);
+#pragma omp parallel
+    {
+        vector<ValueType> sums(num_rhs * slice_size, exec);
+#pragma omp for
+        for (size_type slice = 0; slice < slice_num; slice++) {
+            spmv_slice<num_rhs>(a, slice, 0, b, c, sums.data(), out);
         }
     }
 }
@@ -70,56 +104,22 @@ void spmv_blocked(std::shared_ptr<const OmpExecutor> exec,
                   const matrix::Dense<ValueType>* b,
                   matrix::Dense<ValueType>* c, OutFn out)
 {
-    auto slice_lengths = a->get_const_slice_lengths();
-    auto slice_sets = a->get_const_slice_sets();
-    auto slice_size = a->get_slice_size();
-    auto slice_num = ceildiv(a->get_size()[0] + slice_size - 1, slice_size);
+    const auto slice_size = a->get_slice_size();
+    const auto slice_num = ceildiv(a->get_size()[0], slice_size);
     const auto num_rhs = b->get_size()[1];
     const auto rounded_rhs = num_rhs / block_size * block_size;
-#pragma omp parallel for collapse(2)
-    for (size_type slice = 0; slice < slice_num; slice++) {
-        for (size_type row = 0; row < slice_size; row++) {
-            size_type global_row = slice * slice_size + row;
-            if (global_row < a->get_size()[0]) {
-                std::array<ValueType, block_size> partial_sum;
-                for (size_type rhs_base = 0; rhs_base < rounded_rhs;
-                     rhs_base += block_size) {
-                    partial_sum.fill(zero<ValueType>());
-                    for (size_type i = 0; i < slice_lengths[slice]; i++) {
-                        auto val = a->val_at(row, slice_sets[slice], i);
-                        auto col = a->col_at(row, slice_sets[slice], i);
-                        if (col != invalid_index<IndexType>()) {
-#pragma unroll
-                            for (size_type j = 0; j < block_size; j++) {
-                                partial_sum[j] +=
-                                    val * b->at(col, j + rhs_base);
-                            }
-                        }
-                    }
-#pragma unroll
-                    for (size_type j = 0; j < block_size; j++) {
-                        [&] {
-                            c->at(global_row, j + rhs_base) =
-                                out(global_row, j + rhs_base, partial_sum[j]);
-                        }();
-                    }
-                }
-                partial_sum.fill(zero<ValueType>());
-                for (size_type i = 0; i < slice_lengths[slice]; i++) {
-                    auto val = a->val_at(row, slice_sets[slice], i);
-                    auto col = a->col_at(row, slice_sets[slice], i);
-                    if (col != invalid_index<IndexType>()) {
-                        for (size_type j = rounded_rhs; j < num_rhs; j++) {
-                            partial_sum[j - rounded_rhs] += val * b->at(col, j);
-                        }
-                    }
-                }
-                for (size_type j = rounded_rhs; j < num_rhs; j++) {
-                    [&] {
-                        c->at(global_row, j) =
-                            out(global_row, j, partial_sum[j - rounded_rhs]);
-                    }();
-                }
+#pragma omp parallel
+    {
+        vector<ValueType> sums(block_size * slice_size, exec);
+#pragma omp for
+        for (size_type slice = 0; slice < slice_num; slice++) {
+            for (size_type rhs_base = 0; rhs_base < rounded_rhs;
+                 rhs_base += block_size) {
+                spmv_slice<block_size>(a, slice, rhs_base, b, c, sums.data(),
+                                       out);
+            }
+            for (size_type rhs = rounded_rhs; rhs < num_rhs; rhs++) {
+                spmv_slice<1>(a, slice, rhs, b, c, sums.data(), out);
             }
         }
     }
@@ -12,6 +12,7 @@
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/math.hpp>
 
+#include "core/base/allocator.hpp"
 #include "core/base/iterator_factory.hpp"
 
 
@@ -37,54 +38,87 @@ void sort_agg(std::shared_ptr<const DefaultExecutor> exec, IndexType num,
 GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_SORT_AGG_KERNEL);
 
 
-template <typename ValueType, typename IndexType>
-void sort_row_major(std::shared_ptr<const DefaultExecutor> exec, size_type nnz,
-                    IndexType* row_idxs, IndexType* col_idxs, ValueType* vals)
+template <typename IndexType>
+void galerkin_count(std::shared_ptr<const DefaultExecutor> exec,
+                    size_type num_agg, const IndexType* agg_ptrs,
+                    const IndexType* agg_rows, const IndexType* row_ptrs,
+                    const IndexType* col_idxs, const IndexType* col_agg,
+                    size_type num_coarse_cols, IndexType* coarse_row_nnz)
 {
-    auto it = detail::make_zip_iterator(row_idxs, col_idxs, vals);
-    std::stable_sort(it, it + nnz, [](auto a, auto b) {
-        return std::tie(get<0>(a), get<1>(a)) < std::tie(get<0>(b), get<1>(b));
-    });
+#pragma omp parallel
+    {
+        // last_row[col] is the last coarse row of this thread containing the
+        // coarse column col
+        vector<IndexType> last_row(num_coarse_cols, -1, {exec});
+#pragma omp for schedule(dynamic, 64)
+        for (size_type row = 0; row < num_agg; row++) {
+            IndexType count{};
+            for (auto i = agg_ptrs[row]; i < agg_ptrs[row + 1]; i++) {
+                const auto fine_row = agg_rows[i];
+                for (auto nz = row_ptrs[fine_row]; nz < row_ptrs[fine_row + 1];
+                     nz++) {
+                    const auto col = col_agg[col_idxs[nz]];
+                    if (last_row[col] != static_cast<IndexType>(row)) {
+                        last_row[col] = row;
+                        count++;
+                    }
+                }
+            }
+            coarse_row_nnz[row] = count;
+        }
+    }
 }
 
-GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM_SORT_ROW_MAJOR);
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_GALERKIN_COUNT_KERNEL);
 
 
-template <typename ValueType, typename IndexType>
-void compute_coarse_coo(std::shared_ptr<const DefaultExecutor> exec,
-                        size_type fine_nnz, const IndexType* row_idxs,
-                        const IndexType* col_idxs, const ValueType* vals,
-                        matrix::Coo<ValueType, IndexType>* coarse_coo)
+template <typename IndexType>
+void galerkin_fill(std::shared_ptr<const DefaultExecutor> exec,
+                   size_type num_agg, const IndexType* agg_ptrs,
+                   const IndexType* agg_rows, const IndexType* row_ptrs,
+                   const IndexType* col_idxs, const IndexType* col_agg,
+                   size_type num_coarse_cols, const IndexType* coarse_row_ptrs,
+                   IndexType* coarse_col_idxs, IndexType* nz_map)
 {
-    auto coarse_row = coarse_coo->get_row_idxs();
-    auto coarse_col = coarse_coo->get_col_idxs();
-    auto coarse_val = coarse_coo->get_values();
-    size_type idxs = 0;
-    size_type coarse_idxs = 0;
-    IndexType curr_row = row_idxs[0];
-    IndexType curr_col = col_idxs[0];
-    ValueType temp_val = vals[0];
-    for (size_type idxs = 1; idxs < fine_nnz; idxs++) {
-        if (curr_row != row_idxs[idxs] || curr_col != col_idxs[idxs]) {
-            coarse_row[coarse_idxs] = curr_row;
-            coarse_col[coarse_idxs] = curr_col;
-            coarse_val[coarse_idxs] = temp_val;
-            curr_row = row_idxs[idxs];
-            curr_col = col_idxs[idxs];
-            temp_val = vals[idxs];
-            coarse_idxs++;
-            continue;
+#pragma omp parallel
+    {
+        // last_row[col] is the last coarse row of this thread containing the
+        // coarse column col, position[col] its output position in that row
+        vector<IndexType> last_row(num_coarse_cols, -1, {exec});
+        vector<IndexType> position(num_coarse_cols, {exec});
+#pragma omp for schedule(dynamic, 64)
+        for (size_type row = 0; row < num_agg; row++) {
+            const auto begin = coarse_row_ptrs[row];
+            const auto end = coarse_row_ptrs[row + 1];
+            auto out = begin;
+            for (auto i = agg_ptrs[row]; i < agg_ptrs[row + 1]; i++) {
+                const auto fine_row = agg_rows[i];
+                for (auto nz = row_ptrs[fine_row]; nz < row_ptrs[fine_row + 1];
+                     nz++) {
+                    const auto col = col_agg[col_idxs[nz]];
+                    if (last_row[col] != static_cast<IndexType>(row)) {
+                        last_row[col] = row;
+                        coarse_col_idxs[out] = col;
+                        out++;
+                    }
+                }
+            }
+            std::sort(coarse_col_idxs + begin, coarse_col_idxs + end);
+            for (auto nz = begin; nz < end; nz++) {
+                position[coarse_col_idxs[nz]] = nz;
+            }
+            for (auto i = agg_ptrs[row]; i < agg_ptrs[row + 1]; i++) {
+                const auto fine_row = agg_rows[i];
+                for (auto nz = row_ptrs[fine_row]; nz < row_ptrs[fine_row + 1];
+                     nz++) {
+                    nz_map[nz] = position[col_agg[col_idxs[nz]]];
+                }
+            }
         }
-        temp_val += vals[idxs];
     }
-    GKO_ASSERT(coarse_idxs + 1 == coarse_coo->get_num_stored_elements());
-    coarse_row[coarse_idxs] = curr_row;
-    coarse_col[coarse_idxs] = curr_col;
-    coarse_val[coarse_idxs] = temp_val;
 }
 
-GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
-    GKO_DECLARE_PGM_COMPUTE_COARSE_COO);
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_GALERKIN_FILL_KERNEL);
 
 
 }  // namespace pgm
@@ -0,0 +1,274 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/multigrid/ruge_stuben_kernels.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <queue>
+#include <utility>
+
+#include <omp.h>
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+#include "core/base/allocator.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The Ruge-Stueben namespace.
+ *
+ * @ingroup ruge_stuben
+ */
+namespace ruge_stuben {
+
+
+using kernels::ruge_stuben::cf_state;
+
+
+template <typename IndexType>
+void rs_first_pass(std::shared_ptr<const DefaultExecutor> exec,
+                   size_type num_rows, const IndexType* strong_row_ptrs,
+                   const IndexType* strong_col_idxs,
+                   const IndexType* strong_t_row_ptrs,
+                   const IndexType* strong_t_col_idxs, IndexType* state)
+{
+    // the first pass is inherently sequential, every decision changes the
+    // measure of the neighborhood. The measure is the number of undecided
+    // points strongly depending on a point plus twice the number of fine
+    // points doing so. Outdated entries of the queue are skipped, and ties are
+    // broken by the smaller index.
+    vector<IndexType> measure(num_rows, {exec});
+    std::priority_queue<std::pair<IndexType, IndexType>> queue;
+    for (IndexType row = 0; row < static_cast<IndexType>(num_rows); row++) {
+        measure[row] = strong_t_row_ptrs[row + 1] - strong_t_row_ptrs[row];
+        queue.emplace(measure[row], -row);
+    }
+    while (!queue.empty()) {
+        const auto entry = queue.top();
+        queue.pop();
+        const auto row = -entry.second;
+        if (state[row] != cf_state::undecided || entry.first != measure[row]) {
+            continue;
+        }
+        if (measure[row] == 0) {
+            state[row] = cf_state::fine;
+            continue;
+        }
+        state[row] = cf_state::coarse;
+        for (auto nz = strong_t_row_ptrs[row]; nz < strong_t_row_ptrs[row + 1];
+             nz++) {
+            const auto fine_row = strong_t_col_idxs[nz];
+            if (state[fine_row] != cf_state::undecided) {
+                continue;
+            }
+            state[fine_row] = cf_state::fine;
+            for (auto fine_nz = strong_row_ptrs[fine_row];
+                 fine_nz < strong_row_ptrs[fine_row + 1]; fine_nz++) {
+                const auto col = strong_col_idxs[fine_nz];
+                if (state[col] == cf_state::undecided) {
+                    measure[col]++;
+                    queue.emplace(measure[col], -col);
+                }
+            }
+        }
+        for (auto nz = strong_row_ptrs[row]; nz < strong_row_ptrs[row + 1];
+             nz++) {
+            const auto col = strong_col_idxs[nz];
+            if (state[col] == cf_state::undecided) {
+                measure[col]--;
+                queue.emplace(measure[col], -col);
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_RS_FIRST_PASS_KERNEL);
+
+
+template <typename IndexType>
+void extended_i_interpolation_count(
+    std::shared_ptr<const DefaultExecutor> exec, size_type num_rows,
+    const IndexType* strong_row_ptrs, const IndexType* strong_col_idxs,
+    const IndexType* state, IndexType* row_nnz)
+{
+#pragma omp parallel
+    {
+        // marker[col] == row iff col is an interpolatory point of row
+        vector<IndexType> marker(num_rows, -1, {exec});
+#pragma omp for schedule(dynamic, 64)
+        for (IndexType row = 0; row < static_cast<IndexType>(num_rows);
+             row++) {
+            if (state[row] == cf_state::coarse) {
+                row_nnz[row] = 1;
+                continue;
+            }
+            IndexType count{};
+            const auto add = [&](IndexType col) {
+                if (state[col] == cf_state::coarse && marker[col] != row) {
+                    marker[col] = row;
+                    count++;
+                }
+            };
+            for (auto nz = strong_row_ptrs[row]; nz < strong_row_ptrs[row + 1];
+                 nz++) {
+                const auto col = strong_col_idxs[nz];
+                add(col);
+                if (state[col] == cf_state::fine) {
+                    for (auto fine_nz = strong_row_ptrs[col];
+                         fine_nz < strong_row_ptrs[col + 1]; fine_nz++) {
+                        add(strong_col_idxs[fine_nz]);
+                    }
+                }
+            }
+            row_nnz[row] = count;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_EXTENDED_I_INTERPOLATION_COUNT_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void extended_i_interpolation_fill(
+    std::shared_ptr<const DefaultExecutor> exec,
+    const matrix::Csr<ValueType, IndexType>* source,
+    const IndexType* strong_row_ptrs, const IndexType* strong_col_idxs,
+    const IndexType* state, const IndexType* coarse_map,
+    matrix::Csr<ValueType, IndexType>* prolong)
+{
+    using real_type = remove_complex<ValueType>;
+    const auto num_rows = static_cast<IndexType>(source->get_size()[0]);
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+    const auto vals = source->get_const_values();
+    const auto out_row_ptrs = prolong->get_const_row_ptrs();
+    auto out_col_idxs = prolong->get_col_idxs();
+    auto out_vals = prolong->get_values();
+    const auto find_diag = [&](IndexType row) {
+        const auto begin = col_idxs + row_ptrs[row];
+        const auto end = col_idxs + row_ptrs[row + 1];
+        const auto it = std::lower_bound(begin, end, row);
+        return it != end && *it == row ? vals[it - col_idxs]
+                                       : zero<ValueType>();
+    };
+#pragma omp parallel
+    {
+        // marker[col] == row iff col is an interpolatory point of row, stored
+        // at position[col] of the prolongation, fine_marker[col] == row iff
+        // col is a strong fine neighbor of row
+        vector<IndexType> marker(num_rows, -1, {exec});
+        vector<IndexType> fine_marker(num_rows, -1, {exec});
+        vector<IndexType> position(num_rows, {exec});
+#pragma omp for schedule(dynamic, 64)
+        for (IndexType row = 0; row < num_rows; row++) {
+            const auto out_begin = out_row_ptrs[row];
+            const auto out_end = out_row_ptrs[row + 1];
+            if (state[row] == cf_state::coarse) {
+                out_col_idxs[out_begin] = coarse_map[row];
+                out_vals[out_begin] = one<ValueType>();
+                continue;
+            }
+            auto out = out_begin;
+            const auto add = [&](IndexType col) {
+                if (state[col] == cf_state::coarse && marker[col] != row) {
+                    marker[col] = row;
+                    out_col_idxs[out++] = col;
+                }
+            };
+            for (auto nz = strong_row_ptrs[row]; nz < strong_row_ptrs[row + 1];
+                 nz++) {
+                const auto col = strong_col_idxs[nz];
+                add(col);
+                if (state[col] == cf_state::fine) {
+                    fine_marker[col] = row;
+                    for (auto fine_nz = strong_row_ptrs[col];
+                         fine_nz < strong_row_ptrs[col + 1]; fine_nz++) {
+                        add(strong_col_idxs[fine_nz]);
+                    }
+                }
+            }
+            std::sort(out_col_idxs + out_begin, out_col_idxs + out_end);
+            for (auto nz = out_begin; nz < out_end; nz++) {
+                position[out_col_idxs[nz]] = nz;
+                out_vals[nz] = zero<ValueType>();
+            }
+            const auto is_interpolatory = [&](IndexType col) {
+                return state[col] == cf_state::coarse && marker[col] == row;
+            };
+            auto diag = zero<ValueType>();
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                const auto col = col_idxs[nz];
+                const auto val = vals[nz];
+                if (col == row) {
+                    diag += val;
+                } else if (is_interpolatory(col)) {
+                    out_vals[position[col]] += val;
+                } else if (fine_marker[col] != row) {
+                    diag += val;
+                }
+            }
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                const auto fine_row = col_idxs[nz];
+                if (fine_row == row || fine_marker[fine_row] != row) {
+                    continue;
+                }
+                const auto fine_diag_negative =
+                    real(find_diag(fine_row)) < zero<real_type>();
+                const auto is_opposite = [&](ValueType val) {
+                    return (real(val) < zero<real_type>()) !=
+                               fine_diag_negative &&
+                           val != zero<ValueType>();
+                };
+                auto denom = zero<ValueType>();
+                for (auto fine_nz = row_ptrs[fine_row];
+                     fine_nz < row_ptrs[fine_row + 1]; fine_nz++) {
+                    const auto col = col_idxs[fine_nz];
+                    const auto val = vals[fine_nz];
+                    if ((col == row || is_interpolatory(col)) &&
+                        is_opposite(val)) {
+                        denom += val;
+                    }
+                }
+                if (denom == zero<ValueType>()) {
+                    diag += vals[nz];
+                    continue;
+                }
+                const auto scale = vals[nz] / denom;
+                for (auto fine_nz = row_ptrs[fine_row];
+                     fine_nz < row_ptrs[fine_row + 1]; fine_nz++) {
+                    const auto col = col_idxs[fine_nz];
+                    const auto val = vals[fine_nz];
+                    if (!is_opposite(val)) {
+                        continue;
+                    }
+                    if (col == row) {
+                        diag += scale * val;
+                    } else if (is_interpolatory(col)) {
+                        out_vals[position[col]] += scale * val;
+                    }
+                }
+            }
+            for (auto nz = out_begin; nz < out_end; nz++) {
+                out_vals[nz] = -out_vals[nz] / diag;
+                out_col_idxs[nz] = coarse_map[out_col_idxs[nz]];
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_EXTENDED_I_INTERPOLATION_FILL_KERNEL);
+
+
+}  // namespace ruge_stuben
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
@@ -4,9 +4,19 @@
 
 #include "core/preconditioner/sor_kernels.hpp"
 
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <utility>
+
+#include <omp.h>
+
+#include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/math.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
 
+#include "core/base/allocator.hpp"
 #include "omp/factorization/factorization_helpers.hpp"
 
 namespace gko {
@@ -61,6 +71,155 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_SOR_INITIALIZE_WEIGHTED_L_U);
 
 
+/**
+ * Returns a pseudo-random priority that is unique for every vertex, used to
+ * break ties in the Jones-Plassmann coloring.
+ */
+template <typename IndexType>
+std::pair<uint64, IndexType> vertex_priority(IndexType vertex)
+{
+    auto hash = static_cast<uint64>(vertex) + 0x9e3779b97f4a7c15ull;
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ull;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebull;
+    return {hash ^ (hash >> 31), vertex};
+}
+
+
+template <typename IndexType>
+void compute_multicolor_ordering(std::shared_ptr<const DefaultExecutor> exec,
+                                 size_type num_rows, const IndexType* row_ptrs,
+                                 const IndexType* col_idxs,
+                                 const IndexType* trans_row_ptrs,
+                                 const IndexType* trans_col_idxs,
+                                 IndexType* permutation,
+                                 array<IndexType>& color_ptrs)
+{
+    const auto size = static_cast<IndexType>(num_rows);
+    const auto uncolored = invalid_index<IndexType>();
+    vector<IndexType> colors(num_rows, uncolored, {exec});
+    vector<uint8> selected(num_rows, false, {exec});
+    // calls fn for every neighbor in the symmetrized sparsity pattern
+    const auto for_each_neighbor = [&](IndexType row, auto fn) {
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            if (col_idxs[nz] != row) {
+                fn(col_idxs[nz]);
+            }
+        }
+        for (auto nz = trans_row_ptrs[row]; nz < trans_row_ptrs[row + 1];
+             nz++) {
+            if (trans_col_idxs[nz] != row) {
+                fn(trans_col_idxs[nz]);
+            }
+        }
+    };
+    // Jones-Plassmann: in every round, all uncolored vertices whose priority
+    // is larger than that of their uncolored neighbors form an independent
+    // set and pick the smallest color not used by their neighbors. Selecting
+    // and coloring are separate passes, so the coloring does not depend on
+    // the thread schedule.
+    IndexType num_colored{};
+    IndexType num_colors{};
+    while (num_colored < size) {
+#pragma omp parallel for schedule(dynamic, 512)
+        for (IndexType row = 0; row < size; row++) {
+            if (colors[row] != uncolored) {
+                continue;
+            }
+            bool is_max = true;
+            const auto priority = vertex_priority(row);
+            for_each_neighbor(row, [&](IndexType neighbor) {
+                is_max = is_max && (colors[neighbor] != uncolored ||
+                                    vertex_priority(neighbor) < priority);
+            });
+            selected[row] = is_max;
+        }
+#pragma omp parallel reduction(+ : num_colored) reduction(max : num_colors)
+        {
+            vector<IndexType> neighbor_colors{exec};
+#pragma omp for schedule(dynamic, 512)
+            for (IndexType row = 0; row < size; row++) {
+                if (colors[row] != uncolored || !selected[row]) {
+                    continue;
+                }
+                neighbor_colors.clear();
+                for_each_neighbor(row, [&](IndexType neighbor) {
+                    if (colors[neighbor] != uncolored) {
+                        neighbor_colors.push_back(colors[neighbor]);
+                    }
+                });
+                std::sort(neighbor_colors.begin(), neighbor_colors.end());
+                IndexType color{};
+                for (auto neighbor_color : neighbor_colors) {
+                    if (neighbor_color == color) {
+                        color++;
+                    } else if (neighbor_color > color) {
+                        break;
+                    }
+                }
+                colors[row] = color;
+                num_colors = std::max(num_colors, color + 1);
+                num_colored++;
+            }
+        }
+    }
+    // order the rows by color, keeping their relative order within a color
+    color_ptrs.resize_and_reset(num_colors + 1);
+    const auto ptrs = color_ptrs.get_data();
+    std::fill_n(ptrs, num_colors + 1, IndexType{});
+    for (IndexType row = 0; row < size; row++) {
+        ptrs[colors[row] + 1]++;
+    }
+    std::partial_sum(ptrs, ptrs + num_colors + 1, ptrs);
+    vector<IndexType> output_pos(ptrs, ptrs + num_colors, {exec});
+    for (IndexType row = 0; row < size; row++) {
+        permutation[output_pos[colors[row]]++] = row;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_SOR_COMPUTE_MULTICOLOR_ORDERING);
+
+
+template <typename ValueType, typename IndexType>
+void apply_multicolor_sweep(std::shared_ptr<const DefaultExecutor> exec,
+                            const matrix::Csr<ValueType, IndexType>* factor,
+                            const array<IndexType>& color_ptrs, bool forward,
+                            const matrix::Dense<ValueType>* b,
+                            matrix::Dense<ValueType>* x)
+{
+    const auto row_ptrs = factor->get_const_row_ptrs();
+    const auto col_idxs = factor->get_const_col_idxs();
+    const auto vals = factor->get_const_values();
+    const auto ptrs = color_ptrs.get_const_data();
+    const auto num_colors = static_cast<IndexType>(color_ptrs.get_size()) - 1;
+    const auto num_rhs = b->get_size()[1];
+    for (IndexType i = 0; i < num_colors; i++) {
+        const auto color = forward ? i : num_colors - 1 - i;
+        // rows of the same color are not coupled, so they can be relaxed in
+        // parallel using the values of the previously processed colors
+#pragma omp parallel for
+        for (auto row = ptrs[color]; row < ptrs[color + 1]; row++) {
+            for (size_type rhs = 0; rhs < num_rhs; rhs++) {
+                auto sum = b->at(row, rhs);
+                auto diag = one<ValueType>();
+                for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                    const auto col = col_idxs[nz];
+                    if (col == row) {
+                        diag = vals[nz];
+                    } else {
+                        sum -= vals[nz] * x->at(col, rhs);
+                    }
+                }
+                x->at(row, rhs) = sum / diag;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SOR_APPLY_MULTICOLOR_SWEEP);
+
+
 }  // namespace sor
 }  // namespace omp
 }  // namespace kernels
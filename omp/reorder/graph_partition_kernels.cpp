@@ -0,0 +1,219 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/reorder/graph_partition_kernels.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+#include <omp.h>
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+#include "core/base/allocator.hpp"
+#include "core/components/prefix_sum_kernels.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The graph partitioning namespace.
+ *
+ * @ingroup reorder
+ */
+namespace graph_partition {
+
+
+/**
+ * Returns a key that orders the undirected edge (u, v) first by its weight and
+ * then by a hash of its end points, which is the same for both directions.
+ */
+template <typename IndexType>
+std::tuple<IndexType, uint64, IndexType> edge_key(IndexType u, IndexType v,
+                                                  IndexType weight)
+{
+    const auto lo = std::min(u, v);
+    const auto hi = std::max(u, v);
+    auto hash = static_cast<uint64>(lo) * 0x9e3779b97f4a7c15ull ^
+                static_cast<uint64>(hi);
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ull;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebull;
+    return std::make_tuple(weight, hash ^ (hash >> 31), lo);
+}
+
+
+template <typename IndexType>
+void match_edges(std::shared_ptr<const DefaultExecutor> exec,
+                 IndexType num_vertices, const IndexType* row_ptrs,
+                 const IndexType* col_idxs, const IndexType* edge_weights,
+                 const IndexType* vertex_weights, IndexType max_vertex_weight,
+                 IndexType* match)
+{
+    constexpr int max_rounds = 8;
+    const auto invalid = invalid_index<IndexType>();
+    array<IndexType> candidate_array{exec,
+                                     static_cast<size_type>(num_vertices)};
+    const auto candidates = candidate_array.get_data();
+#pragma omp parallel for
+    for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+        match[vertex] = invalid;
+    }
+    // handshake matching: every vertex only writes its own proposal and its
+    // own match, so the result does not depend on the thread schedule
+    for (int round = 0; round < max_rounds; round++) {
+#pragma omp parallel for schedule(dynamic, 512)
+        for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+            candidates[vertex] = invalid;
+            if (match[vertex] != invalid) {
+                continue;
+            }
+            std::tuple<IndexType, uint64, IndexType> best_key{};
+            for (auto nz = row_ptrs[vertex]; nz < row_ptrs[vertex + 1]; nz++) {
+                const auto neighbor = col_idxs[nz];
+                if (neighbor == vertex || match[neighbor] != invalid ||
+                    vertex_weights[vertex] + vertex_weights[neighbor] >
+                        max_vertex_weight) {
+                    continue;
+                }
+                const auto key = edge_key(vertex, neighbor, edge_weights[nz]);
+                if (candidates[vertex] == invalid || key > best_key) {
+                    candidates[vertex] = neighbor;
+                    best_key = key;
+                }
+            }
+        }
+        bool changed = false;
+#pragma omp parallel for reduction(|| : changed)
+        for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+            const auto candidate = candidates[vertex];
+            if (candidate != invalid && candidates[candidate] == vertex) {
+                match[vertex] = candidate;
+                changed = true;
+            }
+        }
+        if (!changed) {
+            break;
+        }
+    }
+#pragma omp parallel for
+    for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+        if (match[vertex] == invalid) {
+            match[vertex] = vertex;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_GRAPH_PARTITION_MATCH_EDGES_KERNEL);
+
+
+template <typename IndexType>
+void contract_graph(std::shared_ptr<const DefaultExecutor> exec,
+                    IndexType num_vertices, const IndexType* row_ptrs,
+                    const IndexType* col_idxs, const IndexType* edge_weights,
+                    const IndexType* vertex_weights, const IndexType* match,
+                    IndexType* coarse_map, array<IndexType>& coarse_row_ptrs,
+                    array<IndexType>& coarse_col_idxs,
+                    array<IndexType>& coarse_edge_weights,
+                    array<IndexType>& coarse_vertex_weights)
+{
+    // the smaller vertex of every pair represents the coarse vertex
+    array<IndexType> rep_offset_array{exec,
+                                      static_cast<size_type>(num_vertices + 1)};
+    const auto rep_offsets = rep_offset_array.get_data();
+#pragma omp parallel for
+    for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+        rep_offsets[vertex] = vertex <= match[vertex] ? 1 : 0;
+    }
+    components::prefix_sum_nonnegative(exec, rep_offsets, num_vertices + 1);
+    const auto num_coarse = rep_offsets[num_vertices];
+#pragma omp parallel for
+    for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+        coarse_map[vertex] = rep_offsets[std::min(vertex, match[vertex])];
+    }
+    array<IndexType> representative_array{exec,
+                                          static_cast<size_type>(num_coarse)};
+    const auto representatives = representative_array.get_data();
+    coarse_vertex_weights.resize_and_reset(num_coarse);
+    coarse_row_ptrs.resize_and_reset(num_coarse + 1);
+    const auto out_vertex_weights = coarse_vertex_weights.get_data();
+    const auto out_row_ptrs = coarse_row_ptrs.get_data();
+    // the merged neighborhood size is bounded by the sum of both degrees
+    array<IndexType> bound_array{exec, static_cast<size_type>(num_coarse + 1)};
+    const auto bounds = bound_array.get_data();
+#pragma omp parallel for
+    for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+        if (vertex <= match[vertex]) {
+            const auto partner = match[vertex];
+            const auto coarse = coarse_map[vertex];
+            representatives[coarse] = vertex;
+            out_vertex_weights[coarse] = vertex_weights[vertex];
+            bounds[coarse] = row_ptrs[vertex + 1] - row_ptrs[vertex];
+            if (partner != vertex) {
+                out_vertex_weights[coarse] += vertex_weights[partner];
+                bounds[coarse] += row_ptrs[partner + 1] - row_ptrs[partner];
+            }
+        }
+    }
+    components::prefix_sum_nonnegative(exec, bounds, num_coarse + 1);
+    vector<std::pair<IndexType, IndexType>> entries(bounds[num_coarse], {exec});
+#pragma omp parallel for schedule(dynamic, 64)
+    for (IndexType coarse = 0; coarse < num_coarse; coarse++) {
+        const auto vertex = representatives[coarse];
+        const auto partner = match[vertex];
+        const auto row_begin = bounds[coarse];
+        auto row_end = row_begin;
+        for (auto fine : {vertex, partner}) {
+            for (auto nz = row_ptrs[fine]; nz < row_ptrs[fine + 1]; nz++) {
+                const auto coarse_neighbor = coarse_map[col_idxs[nz]];
+                if (coarse_neighbor != coarse) {
+                    entries[row_end++] = {coarse_neighbor, edge_weights[nz]};
+                }
+            }
+            if (partner == vertex) {
+                break;
+            }
+        }
+        std::sort(entries.begin() + row_begin, entries.begin() + row_end,
+                  [](auto a, auto b) { return a.first < b.first; });
+        auto out = row_begin;
+        for (auto in = row_begin; in < row_end; in++) {
+            if (out > row_begin &&
+                entries[out - 1].first == entries[in].first) {
+                entries[out - 1].second += entries[in].second;
+            } else {
+                entries[out++] = entries[in];
+            }
+        }
+        out_row_ptrs[coarse] = out - row_begin;
+    }
+    components::prefix_sum_nonnegative(exec, out_row_ptrs, num_coarse + 1);
+    const auto num_entries = out_row_ptrs[num_coarse];
+    coarse_col_idxs.resize_and_reset(num_entries);
+    coarse_edge_weights.resize_and_reset(num_entries);
+    const auto out_col_idxs = coarse_col_idxs.get_data();
+    const auto out_edge_weights = coarse_edge_weights.get_data();
+#pragma omp parallel for
+    for (IndexType coarse = 0; coarse < num_coarse; coarse++) {
+        const auto in_begin = bounds[coarse];
+        const auto out_begin = out_row_ptrs[coarse];
+        for (IndexType i = 0; i < out_row_ptrs[coarse + 1] - out_begin; i++) {
+            out_col_idxs[out_begin + i] = entries[in_begin + i].first;
+            out_edge_weights[out_begin + i] = entries[in_begin + i].second;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_GRAPH_PARTITION_CONTRACT_GRAPH_KERNEL);
+
+
+}  // namespace graph_partition
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
@@ -0,0 +1,198 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_OMP_SOLVER_COMMON_TRS_KERNELS_HPP_
+#define GKO_OMP_SOLVER_COMMON_TRS_KERNELS_HPP_
+
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+
+#include <omp.h>
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/triangular.hpp>
+
+
+namespace gko {
+namespace solver {
+
+
+struct SolveStruct {
+    virtual ~SolveStruct() = default;
+};
+
+
+}  // namespace solver
+
+
+namespace kernels {
+namespace omp {
+namespace {
+
+
+/**
+ * Minimum average number of rows per level for the level-scheduled
+ * triangular solve to be used. Below this, the synchronization between levels
+ * outweighs the available parallelism and the rows are processed sequentially.
+ */
+constexpr int min_rows_per_level = 32;
+
+
+/**
+ * Stores the level sets of a triangular matrix: level_rows contains the row
+ * indices grouped by level (in ascending order within each level), and
+ * level_ptrs[l] points to the first row of level l in level_rows. All rows of
+ * a level only depend on rows from previous levels, so they can be solved
+ * concurrently.
+ */
+template <typename IndexType>
+struct OmpSolveStruct : gko::solver::SolveStruct {
+    OmpSolveStruct(std::shared_ptr<const OmpExecutor> exec, size_type num_rows)
+        : level_ptrs{exec, num_rows + 1}, level_rows{exec, num_rows}
+    {}
+
+    bool use_level_sets() const
+    {
+        const auto num_levels = level_ptrs.get_size() - 1;
+        return omp_get_max_threads() > 1 &&
+               num_levels * min_rows_per_level <= level_rows.get_size();
+    }
+
+    array<IndexType> level_ptrs;
+    array<IndexType> level_rows;
+};
+
+
+/**
+ * Computes the level sets of the lower (is_upper = false) or upper
+ * (is_upper = true) triangular part of the matrix. Entries on the other side
+ * of the diagonal are ignored.
+ */
+template <bool is_upper, typename ValueType, typename IndexType>
+void generate_kernel(std::shared_ptr<const OmpExecutor> exec,
+                     const matrix::Csr<ValueType, IndexType>* matrix,
+                     std::shared_ptr<solver::SolveStruct>& solve_struct)
+{
+    const auto num_rows = static_cast<IndexType>(matrix->get_size()[0]);
+    const auto row_ptrs = matrix->get_const_row_ptrs();
+    const auto col_idxs = matrix->get_const_col_idxs();
+    auto result = std::make_shared<OmpSolveStruct<IndexType>>(exec, num_rows);
+    // level_rows is used as temporary storage for the level of each row
+    const auto row_levels = result->level_rows.get_data();
+    IndexType num_levels{};
+    for (IndexType i = 0; i < num_rows; i++) {
+        const auto row = is_upper ? num_rows - 1 - i : i;
+        IndexType level{};
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            const auto col = col_idxs[nz];
+            if (is_upper ? col > row : col < row) {
+                level = std::max(level, row_levels[col] + 1);
+            }
+        }
+        row_levels[row] = level;
+        num_levels = std::max(num_levels, level + 1);
+    }
+    // bucket the rows by level, preserving the row order within a level
+    array<IndexType> level_counts{exec, static_cast<size_type>(num_levels + 1)};
+    const auto counts = level_counts.get_data();
+    std::fill_n(counts, num_levels + 1, IndexType{});
+    for (IndexType row = 0; row < num_rows; row++) {
+        counts[row_levels[row] + 1]++;
+    }
+    std::partial_sum(counts, counts + num_levels + 1, counts);
+    array<IndexType> sorted_rows{exec, static_cast<size_type>(num_rows)};
+    const auto sorted = sorted_rows.get_data();
+    for (IndexType row = 0; row < num_rows; row++) {
+        sorted[counts[row_levels[row]]++] = row;
+    }
+    result->level_rows = std::move(sorted_rows);
+    result->level_ptrs.resize_and_reset(num_levels + 1);
+    const auto level_ptrs = result->level_ptrs.get_data();
+    level_ptrs[0] = 0;
+    std::copy_n(counts, num_levels, level_ptrs + 1);
+    solve_struct = std::move(result);
+}
+
+
+template <bool is_upper, typename ValueType, typename IndexType>
+void solve_row(const IndexType* row_ptrs, const IndexType* col_idxs,
+               const ValueType* vals, bool unit_diag, IndexType row,
+               size_type rhs, const matrix::Dense<ValueType>* b,
+               matrix::Dense<ValueType>* x)
+{
+    auto diag = one<ValueType>();
+    auto sum = b->at(row, rhs);
+    for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+        const auto col = col_idxs[nz];
+        if (is_upper ? col > row : col < row) {
+            sum -= vals[nz] * x->at(col, rhs);
+        }
+        if (col == row) {
+            diag = vals[nz];
+        }
+    }
+    x->at(row, rhs) = unit_diag ? sum : sum / diag;
+}
+
+
+template <bool is_upper, typename ValueType, typename IndexType>
+void solve_kernel(std::shared_ptr<const OmpExecutor> exec,
+                  const matrix::Csr<ValueType, IndexType>* matrix,
+                  const solver::SolveStruct* solve_struct, bool unit_diag,
+                  const matrix::Dense<ValueType>* b,
+                  matrix::Dense<ValueType>* x)
+{
+    const auto num_rows = static_cast<IndexType>(matrix->get_size()[0]);
+    const auto num_rhs = b->get_size()[1];
+    const auto row_ptrs = matrix->get_const_row_ptrs();
+    const auto col_idxs = matrix->get_const_col_idxs();
+    const auto vals = matrix->get_const_values();
+    const auto levels =
+        dynamic_cast<const OmpSolveStruct<IndexType>*>(solve_struct);
+    if (levels && levels->use_level_sets()) {
+        const auto num_levels =
+            static_cast<IndexType>(levels->level_ptrs.get_size() - 1);
+        const auto level_ptrs = levels->level_ptrs.get_const_data();
+        const auto level_rows = levels->level_rows.get_const_data();
+#pragma omp parallel
+        for (IndexType level = 0; level < num_levels; level++) {
+            const auto level_begin = level_ptrs[level];
+            const auto level_size = level_ptrs[level + 1] - level_begin;
+            // the implicit barrier at the end of the loop separates levels
+#pragma omp for
+            for (IndexType i = 0; i < level_size; i++) {
+                const auto row = level_rows[level_begin + i];
+                for (size_type rhs = 0; rhs < num_rhs; rhs++) {
+                    solve_row<is_upper>(row_ptrs, col_idxs, vals, unit_diag,
+                                        row, rhs, b, x);
+                }
+            }
+        }
+    } else {
+#pragma omp parallel for
+        for (size_type rhs = 0; rhs < num_rhs; rhs++) {
+            for (IndexType i = 0; i < num_rows; i++) {
+                const auto row = is_upper ? num_rows - 1 - i : i;
+                solve_row<is_upper>(row_ptrs, col_idxs, vals, unit_diag, row,
+                                    rhs, b, x);
+            }
+        }
+    }
+}
+
+
+}  // namespace
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_OMP_SOLVER_COMMON_TRS_KERNELS_HPP_
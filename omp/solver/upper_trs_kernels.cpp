@@ -16,6 +16,8 @@
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/solver/triangular.hpp>
 
+#include "omp/solver/common_trs_kernels.hpp"
+
 
 namespace gko {
 namespace kernels {
@@ -42,9 +44,7 @@ void generate(std::shared_ptr<const OmpExecutor> exec,
               bool unit_diag, const solver::trisolve_algorithm algorithm,
               const size_type num_rhs)
 {
-    // This generate kernel is here to allow for a more sophisticated
-    // implementation as for other executors. This kernel would perform the
-    // "analysis" phase for the triangular matrix.
+    generate_kernel<true>(exec, matrix, solve_struct);
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
@@ -63,31 +63,7 @@ void solve(std::shared_ptr<const OmpExecutor> exec,
            matrix::Dense<ValueType>* trans_b, matrix::Dense<ValueType>* trans_x,
            const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* x)
 {
-    auto row_ptrs = matrix->get_const_row_ptrs();
-    auto col_idxs = matrix->get_const_col_idxs();
-    auto vals = matrix->get_const_values();
-
-#pragma omp parallel for
-    for (size_type j = 0; j < b->get_size()[1]; ++j) {
-        for (size_type inv_row = 0; inv_row < matrix->get_size()[0];
-             ++inv_row) {
-            auto row = matrix->get_size()[0] - 1 - inv_row;
-            auto diag = one<ValueType>();
-            x->at(row, j) = b->at(row, j);
-            for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
-                auto col = col_idxs[k];
-                if (col > row) {
-                    x->at(row, j) -= vals[k] * x->at(col, j);
-                }
-                if (col == row) {
-                    diag = vals[k];
-                }
-            }
-            if (!unit_diag) {
-                x->at(row, j) /= diag;
-            }
-        }
-    }
+    solve_kernel<true>(exec, matrix, solve_struct, unit_diag, b, x);
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <algorithm>
+#include <memory>
+#include <set>
+
+#include <omp.h>
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/machine_topology.hpp>
+#include <ginkgo/core/base/memory.hpp>
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+class Memory : public ::testing::Test {
+protected:
+    Memory()
+        : exec{gko::OmpExecutor::create(
+              std::make_shared<gko::OmpFirstTouchAllocator>(1024))}
+    {}
+
+    std::shared_ptr<gko::OmpExecutor> exec;
+};
+
+
+TEST_F(Memory, SmallFirstTouchAllocationWorks)
+{
+    gko::array<int> data{exec, {1, 2}};
+
+    GKO_ASSERT_ARRAY_EQ(data, I<int>({1, 2}));
+}
+
+
+TEST_F(Memory, LargeFirstTouchAllocationWorks)
+{
+    gko::array<double> data{exec, 100000};
+    data.fill(2.0);
+
+    ASSERT_EQ(data.get_const_data()[0], 2.0);
+    ASSERT_EQ(data.get_const_data()[99999], 2.0);
+}
+
+
+TEST_F(Memory, BindsThreadsToCores)
+{
+    ASSERT_NO_THROW(exec->bind_threads_to_cores());
+
+    gko::array<int> data{exec, {1, 2}};
+    GKO_ASSERT_ARRAY_EQ(data, I<int>({1, 2}));
+}
+
+
+#if GKO_HAVE_HWLOC && defined(__linux__)
+
+
+TEST_F(Memory, BindsEveryThreadToASingleCpu)
+{
+    const auto num_cores = static_cast<int>(
+        gko::machine_topology::get_instance()->get_num_cores());
+    cpu_set_t process_set;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(process_set), &process_set), 0);
+    std::set<int> cpus;
+    int num_threads{};
+    bool all_single{true};
+
+    exec->bind_threads_to_cores();
+#pragma omp parallel
+    {
+        cpu_set_t set;
+        // on Linux, pid 0 refers to the calling thread
+        const auto result = sched_getaffinity(0, sizeof(set), &set);
+#pragma omp critical
+        {
+            num_threads = omp_get_num_threads();
+            all_single = all_single && result == 0 && CPU_COUNT(&set) == 1;
+            for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+                if (CPU_ISSET(cpu, &set)) {
+                    cpus.insert(cpu);
+                }
+            }
+        }
+        sched_setaffinity(0, sizeof(process_set), &process_set);
+    }
+
+    ASSERT_TRUE(all_single);
+    // threads are bound round-robin, so they only share cores if there are
+    // more threads than cores
+    ASSERT_EQ(cpus.size(),
+              static_cast<std::size_t>(std::min(num_threads, num_cores)));
+}
+
+
+#endif
+
+
+}  // namespace
@@ -0,0 +1,194 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "omp/matrix/dense_gemm.hpp"
+
+#include <memory>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+#include "core/test/utils.hpp"
+
+
+template <typename T>
+class DenseGemm : public ::testing::Test {
+protected:
+    using value_type = T;
+    using Mtx = gko::matrix::Dense<value_type>;
+
+    DenseGemm()
+        : ref(gko::ReferenceExecutor::create()),
+          omp(gko::OmpExecutor::create()),
+          rand_engine(42)
+    {}
+
+    std::unique_ptr<Mtx> gen_mtx(gko::size_type num_rows,
+                                 gko::size_type num_cols)
+    {
+        return gko::test::generate_random_matrix<Mtx>(
+            num_rows, num_cols,
+            std::uniform_int_distribution<>(num_cols, num_cols),
+            std::normal_distribution<>(0.0, 1.0), rand_engine, ref);
+    }
+
+    void set_up_product(gko::size_type num_rows, gko::size_type num_inner,
+                        gko::size_type num_cols)
+    {
+        a = gen_mtx(num_rows, num_inner);
+        b = gen_mtx(num_inner, num_cols);
+        c = gen_mtx(num_rows, num_cols);
+        alpha = gko::initialize<Mtx>({2.0}, ref);
+        beta = gko::initialize<Mtx>({-1.0}, ref);
+        da = gko::clone(omp, a);
+        db = gko::clone(omp, b);
+        dc = gko::clone(omp, c);
+    }
+
+    // the result of the reference kernel for C = alpha * A * B + beta * C
+    void apply_ref() { a->apply(alpha, b, beta, c); }
+
+    std::shared_ptr<gko::ReferenceExecutor> ref;
+    std::shared_ptr<gko::OmpExecutor> omp;
+    std::default_random_engine rand_engine;
+    std::unique_ptr<Mtx> a;
+    std::unique_ptr<Mtx> b;
+    std::unique_ptr<Mtx> c;
+    std::unique_ptr<Mtx> alpha;
+    std::unique_ptr<Mtx> beta;
+    std::unique_ptr<Mtx> da;
+    std::unique_ptr<Mtx> db;
+    std::unique_ptr<Mtx> dc;
+};
+
+TYPED_TEST_SUITE(DenseGemm, gko::test::ValueTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(DenseGemm, BlockedIsEquivalentToRef)
+{
+    using value_type = typename TestFixture::value_type;
+    // sizes that are no multiples of the tile and register block sizes
+    this->set_up_product(131, 300, 157);
+
+    gko::kernels::omp::dense::gemm_blocked(
+        this->omp, this->alpha->at(0, 0), this->da.get(), this->db.get(),
+        this->beta->at(0, 0), false, this->dc.get());
+    this->apply_ref();
+
+    GKO_ASSERT_MTX_NEAR(this->dc, this->c, 10 * r<value_type>::value);
+}
+
+
+TYPED_TEST(DenseGemm, BlockedOverwriteIsEquivalentToRef)
+{
+    using value_type = typename TestFixture::value_type;
+    this->set_up_product(131, 300, 157);
+    this->dc->fill(gko::nan<value_type>());
+
+    gko::kernels::omp::dense::gemm_blocked(
+        this->omp, gko::one<value_type>(), this->da.get(), this->db.get(),
+        gko::zero<value_type>(), true, this->dc.get());
+    this->a->apply(this->b, this->c);
+
+    GKO_ASSERT_MTX_NEAR(this->dc, this->c, 10 * r<value_type>::value);
+}
+
+
+TYPED_TEST(DenseGemm, BlockedPropagatesNanForZeroBeta)
+{
+    using value_type = typename TestFixture::value_type;
+    this->set_up_product(70, 40, 50);
+    this->beta->at(0, 0) = gko::zero<value_type>();
+    this->c->at(3, 4) = gko::nan<value_type>();
+    this->dc->at(3, 4) = gko::nan<value_type>();
+
+    gko::kernels::omp::dense::gemm_blocked(
+        this->omp, this->alpha->at(0, 0), this->da.get(), this->db.get(),
+        this->beta->at(0, 0), false, this->dc.get());
+    this->apply_ref();
+
+    ASSERT_TRUE(gko::is_nan(this->c->at(3, 4)));
+    ASSERT_TRUE(gko::is_nan(this->dc->at(3, 4)));
+    this->c->at(3, 4) = gko::zero<value_type>();
+    this->dc->at(3, 4) = gko::zero<value_type>();
+    GKO_ASSERT_MTX_NEAR(this->dc, this->c, 10 * r<value_type>::value);
+}
+
+
+TYPED_TEST(DenseGemm, SimpleIsEquivalentToRef)
+{
+    using value_type = typename TestFixture::value_type;
+    this->set_up_product(13, 7, 3);
+
+    gko::kernels::omp::dense::gemm_simple(
+        this->omp, this->alpha->at(0, 0), this->da.get(), this->db.get(),
+        this->beta->at(0, 0), false, this->dc.get());
+    this->apply_ref();
+
+    GKO_ASSERT_MTX_NEAR(this->dc, this->c, 10 * r<value_type>::value);
+}
+
+
+TYPED_TEST(DenseGemm, BlasIsEquivalentToRef)
+{
+    using value_type = typename TestFixture::value_type;
+    if (!gko::kernels::omp::blas::is_supported<value_type>::value) {
+        GTEST_SKIP() << "BLAS is not available for this value type";
+    }
+    this->set_up_product(131, 300, 157);
+
+    const auto used_blas = gko::kernels::omp::dense::gemm_blas(
+        this->omp, this->alpha->at(0, 0), this->da.get(), this->db.get(),
+        this->beta->at(0, 0), false, this->dc.get());
+    this->apply_ref();
+
+    ASSERT_TRUE(used_blas);
+    GKO_ASSERT_MTX_NEAR(this->dc, this->c, 10 * r<value_type>::value);
+}
+
+
+TYPED_TEST(DenseGemm, BlasOverwriteIsEquivalentToRef)
+{
+    using value_type = typename TestFixture::value_type;
+    if (!gko::kernels::omp::blas::is_supported<value_type>::value) {
+        GTEST_SKIP() << "BLAS is not available for this value type";
+    }
+    this->set_up_product(131, 300, 157);
+    this->dc->fill(gko::nan<value_type>());
+
+    gko::kernels::omp::dense::gemm_blas(
+        this->omp, gko::one<value_type>(), this->da.get(), this->db.get(),
+        gko::zero<value_type>(), true, this->dc.get());
+    this->a->apply(this->b, this->c);
+
+    GKO_ASSERT_MTX_NEAR(this->dc, this->c, 10 * r<value_type>::value);
+}
+
+
+TYPED_TEST(DenseGemm, BlasPropagatesNanForZeroBeta)
+{
+    using value_type = typename TestFixture::value_type;
+    if (!gko::kernels::omp::blas::is_supported<value_type>::value) {
+        GTEST_SKIP() << "BLAS is not available for this value type";
+    }
+    this->set_up_product(70, 40, 50);
+    this->beta->at(0, 0) = gko::zero<value_type>();
+    this->c->at(3, 4) = gko::nan<value_type>();
+    this->dc->at(3, 4) = gko::nan<value_type>();
+
+    gko::kernels::omp::dense::gemm_blas(
+        this->omp, this->alpha->at(0, 0), this->da.get(), this->db.get(),
+        this->beta->at(0, 0), false, this->dc.get());
+    this->apply_ref();
+
+    ASSERT_TRUE(gko::is_nan(this->c->at(3, 4)));
+    ASSERT_TRUE(gko::is_nan(this->dc->at(3, 4)));
+    this->c->at(3, 4) = gko::zero<value_type>();
+    this->dc->at(3, 4) = gko::zero<value_type>();
+    GKO_ASSERT_MTX_NEAR(this->dc, this->c, 10 * r<value_type>::value);
+}
@@ -105,58 +105,6 @@ void sort_agg(std::shared_ptr<const DefaultExecutor> exec, IndexType num,
 GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_SORT_AGG_KERNEL);
 
 
-template <typename IndexType>
-void map_row(std::shared_ptr<const DefaultExecutor> exec,
-             size_type num_fine_row, const IndexType* fine_row_ptrs,
-             const IndexType* agg, IndexType* row_idxs)
-{
-    for (size_type row = 0; row < num_fine_row; row++) {
-        const auto coarse_row = agg[row];
-        for (auto i = fine_row_ptrs[row]; i < fine_row_ptrs[row + 1]; i++) {
-            row_idxs[i] = coarse_row;
-        }
-    }
-}
-
-GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_MAP_ROW_KERNEL);
-
-
-template <typename IndexType>
-void map_col(std::shared_ptr<const DefaultExecutor> exec, size_type nnz,
-             const IndexType* fine_col_idxs, const IndexType* agg,
-             IndexType* col_idxs)
-{
-    for (size_type i = 0; i < nnz; i++) {
-        col_idxs[i] = agg[fine_col_idxs[i]];
-    }
-}
-
-GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_MAP_COL_KERNEL);
-
-
-template <typename IndexType>
-void count_unrepeated_nnz(std::shared_ptr<const DefaultExecutor> exec,
-                          size_type nnz, const IndexType* row_idxs,
-                          const IndexType* col_idxs, size_type* coarse_nnz)
-{
-    if (nnz > 1) {
-        size_type result = 0;
-        for (size_type i = 0; i < nnz - 1; i++) {
-            if (row_idxs[i] != row_idxs[i + 1] ||
-                col_idxs[i] != col_idxs[i + 1]) {
-                result++;
-            }
-        }
-        *coarse_nnz = result + 1;
-    } else {
-        *coarse_nnz = nnz;
-    }
-}
-
-GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
-    GKO_DECLARE_PGM_COUNT_UNREPEATED_NNZ_KERNEL);
-
-
 template <typename ValueType, typename IndexType>
 void find_strongest_neighbor(
     std::shared_ptr<const ReferenceExecutor> exec,
@@ -264,68 +212,180 @@ GKO_INSTANTIATE_FOR_EACH_NON_COMPLEX_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_PGM_ASSIGN_TO_EXIST_AGG);
 
 
-template <typename ValueType, typename IndexType>
-void sort_row_major(std::shared_ptr<const DefaultExecutor> exec, size_type nnz,
-                    IndexType* row_idxs, IndexType* col_idxs, ValueType* vals)
+template <typename IndexType>
+void gather_index(std::shared_ptr<const DefaultExecutor> exec,
+                  size_type num_res, const IndexType* orig,
+                  const IndexType* gather_map, IndexType* result)
+{
+    for (size_type i = 0; i < num_res; ++i) {
+        result[i] = orig[gather_map[i]];
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_GATHER_INDEX);
+
+template <typename IndexType>
+void galerkin_count(std::shared_ptr<const DefaultExecutor> exec,
+                    size_type num_agg, const IndexType* agg_ptrs,
+                    const IndexType* agg_rows, const IndexType* row_ptrs,
+                    const IndexType* col_idxs, const IndexType* col_agg,
+                    size_type num_coarse_cols, IndexType* coarse_row_nnz)
+{
+    // last_row[col] is the last coarse row containing the coarse column col
+    vector<IndexType> last_row(num_coarse_cols, -1, {exec});
+    for (size_type row = 0; row < num_agg; row++) {
+        IndexType count{};
+        for (auto i = agg_ptrs[row]; i < agg_ptrs[row + 1]; i++) {
+            const auto fine_row = agg_rows[i];
+            for (auto nz = row_ptrs[fine_row]; nz < row_ptrs[fine_row + 1];
+                 nz++) {
+                const auto col = col_agg[col_idxs[nz]];
+                if (last_row[col] != static_cast<IndexType>(row)) {
+                    last_row[col] = row;
+                    count++;
+                }
+            }
+        }
+        coarse_row_nnz[row] = count;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_GALERKIN_COUNT_KERNEL);
+
+
+template <typename IndexType>
+void galerkin_fill(std::shared_ptr<const DefaultExecutor> exec,
+                   size_type num_agg, const IndexType* agg_ptrs,
+                   const IndexType* agg_rows, const IndexType* row_ptrs,
+                   const IndexType* col_idxs, const IndexType* col_agg,
+                   size_type num_coarse_cols, const IndexType* coarse_row_ptrs,
+                   IndexType* coarse_col_idxs, IndexType* nz_map)
 {
-    auto it = detail::make_zip_iterator(row_idxs, col_idxs, vals);
-    std::stable_sort(it, it + nnz, [](auto a, auto b) {
-        return std::tie(get<0>(a), get<1>(a)) < std::tie(get<0>(b), get<1>(b));
-    });
+    // position[col] is the output position of the coarse column col in the
+    // last coarse row containing it
+    vector<IndexType> position(num_coarse_cols, -1, {exec});
+    for (size_type row = 0; row < num_agg; row++) {
+        const auto begin = coarse_row_ptrs[row];
+        const auto end = coarse_row_ptrs[row + 1];
+        auto out = begin;
+        for (auto i = agg_ptrs[row]; i < agg_ptrs[row + 1]; i++) {
+            const auto fine_row = agg_rows[i];
+            for (auto nz = row_ptrs[fine_row]; nz < row_ptrs[fine_row + 1];
+                 nz++) {
+                const auto col = col_agg[col_idxs[nz]];
+                if (position[col] < begin) {
+                    position[col] = out;
+                    coarse_col_idxs[out] = col;
+                    out++;
+                }
+            }
+        }
+        std::sort(coarse_col_idxs + begin, coarse_col_idxs + end);
+        for (auto nz = begin; nz < end; nz++) {
+            position[coarse_col_idxs[nz]] = nz;
+        }
+        for (auto i = agg_ptrs[row]; i < agg_ptrs[row + 1]; i++) {
+            const auto fine_row = agg_rows[i];
+            for (auto nz = row_ptrs[fine_row]; nz < row_ptrs[fine_row + 1];
+                 nz++) {
+                nz_map[nz] = position[col_agg[col_idxs[nz]]];
+            }
+        }
+    }
 }
 
-GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PGM_SORT_ROW_MAJOR);
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_GALERKIN_FILL_KERNEL);
 
 
 template <typename ValueType, typename IndexType>
-void compute_coarse_coo(std::shared_ptr<const DefaultExecutor> exec,
-                        size_type fine_nnz, const IndexType* row_idxs,
-                        const IndexType* col_idxs, const ValueType* vals,
-                        matrix::Coo<ValueType, IndexType>* coarse_coo)
+void galerkin_numeric(std::shared_ptr<const DefaultExecutor> exec,
+                      size_type num_agg, const IndexType* agg_ptrs,
+                      const IndexType* agg_rows, const IndexType* row_ptrs,
+                      const ValueType* vals, const IndexType* nz_map,
+                      const IndexType* coarse_row_ptrs, ValueType* coarse_vals)
 {
-    auto coarse_row = coarse_coo->get_row_idxs();
-    auto coarse_col = coarse_coo->get_col_idxs();
-    auto coarse_val = coarse_coo->get_values();
-    IndexType row = 0;
-    size_type idxs = 0;
-    size_type coarse_idxs = 0;
-    IndexType curr_row = row_idxs[0];
-    IndexType curr_col = col_idxs[0];
-    ValueType temp_val = vals[0];
-    for (size_type idxs = 1; idxs < fine_nnz; idxs++) {
-        if (curr_row != row_idxs[idxs] || curr_col != col_idxs[idxs]) {
-            coarse_row[coarse_idxs] = curr_row;
-            coarse_col[coarse_idxs] = curr_col;
-            coarse_val[coarse_idxs] = temp_val;
-            curr_row = row_idxs[idxs];
-            curr_col = col_idxs[idxs];
-            temp_val = vals[idxs];
-            coarse_idxs++;
-            continue;
+    for (size_type row = 0; row < num_agg; row++) {
+        std::fill(coarse_vals + coarse_row_ptrs[row],
+                  coarse_vals + coarse_row_ptrs[row + 1], zero<ValueType>());
+        for (auto i = agg_ptrs[row]; i < agg_ptrs[row + 1]; i++) {
+            const auto fine_row = agg_rows[i];
+            for (auto nz = row_ptrs[fine_row]; nz < row_ptrs[fine_row + 1];
+                 nz++) {
+                coarse_vals[nz_map[nz]] += vals[nz];
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PGM_GALERKIN_NUMERIC_KERNEL);
+
+template <typename ValueType, typename IndexType>
+void filter_prolongation_count(std::shared_ptr<const DefaultExecutor> exec,
+                               const matrix::Csr<ValueType, IndexType>* prolong,
+                               remove_complex<ValueType> threshold,
+                               IndexType* row_nnz)
+{
+    const auto row_ptrs = prolong->get_const_row_ptrs();
+    const auto vals = prolong->get_const_values();
+    for (size_type row = 0; row < prolong->get_size()[0]; row++) {
+        auto max_abs = zero<remove_complex<ValueType>>();
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            max_abs = std::max(max_abs, abs(vals[nz]));
         }
-        temp_val += vals[idxs];
+        IndexType count{};
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            count += abs(vals[nz]) >= threshold * max_abs ? 1 : 0;
+        }
+        row_nnz[row] = count;
     }
-    GKO_ASSERT(coarse_idxs + 1 == coarse_coo->get_num_stored_elements());
-    coarse_row[coarse_idxs] = curr_row;
-    coarse_col[coarse_idxs] = curr_col;
-    coarse_val[coarse_idxs] = temp_val;
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
-    GKO_DECLARE_PGM_COMPUTE_COARSE_COO);
+    GKO_DECLARE_PGM_FILTER_PROLONGATION_COUNT_KERNEL);
 
 
-template <typename IndexType>
-void gather_index(std::shared_ptr<const DefaultExecutor> exec,
-                  size_type num_res, const IndexType* orig,
-                  const IndexType* gather_map, IndexType* result)
+template <typename ValueType, typename IndexType>
+void filter_prolongation_fill(std::shared_ptr<const DefaultExecutor> exec,
+                              const matrix::Csr<ValueType, IndexType>* prolong,
+                              remove_complex<ValueType> threshold,
+                              matrix::Csr<ValueType, IndexType>* filtered)
 {
-    for (size_type i = 0; i < num_res; ++i) {
-        result[i] = orig[gather_map[i]];
+    const auto row_ptrs = prolong->get_const_row_ptrs();
+    const auto col_idxs = prolong->get_const_col_idxs();
+    const auto vals = prolong->get_const_values();
+    const auto out_row_ptrs = filtered->get_const_row_ptrs();
+    auto out_col_idxs = filtered->get_col_idxs();
+    auto out_vals = filtered->get_values();
+    for (size_type row = 0; row < prolong->get_size()[0]; row++) {
+        auto max_abs = zero<remove_complex<ValueType>>();
+        auto row_sum = zero<ValueType>();
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            max_abs = std::max(max_abs, abs(vals[nz]));
+            row_sum += vals[nz];
+        }
+        auto kept_sum = zero<ValueType>();
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            if (abs(vals[nz]) >= threshold * max_abs) {
+                kept_sum += vals[nz];
+            }
+        }
+        // rescale the kept entries to preserve the row sum
+        const auto scale = kept_sum == zero<ValueType>() ? one<ValueType>()
+                                                         : row_sum / kept_sum;
+        auto out = out_row_ptrs[row];
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            if (abs(vals[nz]) >= threshold * max_abs) {
+                out_col_idxs[out] = col_idxs[nz];
+                out_vals[out] = vals[nz] * scale;
+                out++;
+            }
+        }
     }
 }
 
-GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_PGM_GATHER_INDEX);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PGM_FILTER_PROLONGATION_FILL_KERNEL);
 
 
 }  // namespace pgm
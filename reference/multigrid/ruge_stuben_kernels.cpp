@@ -0,0 +1,560 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/multigrid/ruge_stuben_kernels.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <queue>
+#include <utility>
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+#include "core/base/allocator.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The Ruge-Stueben namespace.
+ *
+ * @ingroup ruge_stuben
+ */
+namespace ruge_stuben {
+
+
+using kernels::ruge_stuben::cf_state;
+
+
+namespace {
+
+
+// calls fn(nz) for each strong connection nz of the row
+template <typename ValueType, typename IndexType, typename Callback>
+void for_each_strong(const matrix::Csr<ValueType, IndexType>* source,
+                     remove_complex<ValueType> threshold, IndexType row,
+                     Callback fn)
+{
+    using real_type = remove_complex<ValueType>;
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+    const auto vals = source->get_const_values();
+    const auto begin = row_ptrs[row];
+    const auto end = row_ptrs[row + 1];
+    // only couplings of the opposite sign as the diagonal can be strong
+    auto sign = one<real_type>();
+    for (auto nz = begin; nz < end; nz++) {
+        if (col_idxs[nz] == row && real(vals[nz]) < zero<real_type>()) {
+            sign = -one<real_type>();
+        }
+    }
+    auto max_coupling = zero<real_type>();
+    for (auto nz = begin; nz < end; nz++) {
+        if (col_idxs[nz] != row) {
+            max_coupling = std::max(max_coupling, -sign * real(vals[nz]));
+        }
+    }
+    for (auto nz = begin; nz < end; nz++) {
+        const auto coupling = -sign * real(vals[nz]);
+        if (col_idxs[nz] != row && coupling > zero<real_type>() &&
+            coupling >= threshold * max_coupling) {
+            fn(nz);
+        }
+    }
+}
+
+
+// the measure of PMIS with ties broken by a hash of the index
+template <typename IndexType>
+std::pair<uint64, uint64> pmis_measure(const IndexType* strong_t_row_ptrs,
+                                       IndexType row)
+{
+    const auto count = static_cast<uint64>(strong_t_row_ptrs[row + 1] -
+                                           strong_t_row_ptrs[row]);
+    const auto hash = static_cast<uint32>(static_cast<uint32>(row) *
+                                          uint32{2654435761u});
+    return {(count << 32) | hash, static_cast<uint64>(row)};
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+void compute_strong_count(std::shared_ptr<const DefaultExecutor> exec,
+                          const matrix::Csr<ValueType, IndexType>* source,
+                          remove_complex<ValueType> threshold,
+                          IndexType* row_nnz)
+{
+    const auto num_rows = static_cast<IndexType>(source->get_size()[0]);
+    for (IndexType row = 0; row < num_rows; row++) {
+        IndexType count{};
+        for_each_strong(source, threshold, row, [&](auto) { count++; });
+        row_nnz[row] = count;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_COMPUTE_STRONG_COUNT_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void compute_strong_fill(std::shared_ptr<const DefaultExecutor> exec,
+                         const matrix::Csr<ValueType, IndexType>* source,
+                         remove_complex<ValueType> threshold,
+                         const IndexType* strong_row_ptrs,
+                         IndexType* strong_col_idxs)
+{
+    const auto num_rows = static_cast<IndexType>(source->get_size()[0]);
+    const auto col_idxs = source->get_const_col_idxs();
+    for (IndexType row = 0; row < num_rows; row++) {
+        auto out = strong_row_ptrs[row];
+        for_each_strong(source, threshold, row, [&](auto nz) {
+            strong_col_idxs[out] = col_idxs[nz];
+            out++;
+        });
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_COMPUTE_STRONG_FILL_KERNEL);
+
+
+template <typename IndexType>
+void pmis_select(std::shared_ptr<const DefaultExecutor> exec,
+                 size_type num_rows, const IndexType* strong_row_ptrs,
+                 const IndexType* strong_col_idxs,
+                 const IndexType* strong_t_row_ptrs,
+                 const IndexType* strong_t_col_idxs, const IndexType* state,
+                 IndexType* new_state)
+{
+    for (IndexType row = 0; row < static_cast<IndexType>(num_rows); row++) {
+        new_state[row] = state[row];
+        if (state[row] != cf_state::undecided) {
+            continue;
+        }
+        if (strong_t_row_ptrs[row] == strong_t_row_ptrs[row + 1]) {
+            // no point can interpolate from this one
+            new_state[row] = cf_state::fine;
+            continue;
+        }
+        const auto measure = pmis_measure(strong_t_row_ptrs, row);
+        bool is_max = true;
+        for (auto nz = strong_row_ptrs[row]; nz < strong_row_ptrs[row + 1];
+             nz++) {
+            const auto col = strong_col_idxs[nz];
+            is_max = is_max && (state[col] != cf_state::undecided ||
+                                pmis_measure(strong_t_row_ptrs, col) < measure);
+        }
+        for (auto nz = strong_t_row_ptrs[row]; nz < strong_t_row_ptrs[row + 1];
+             nz++) {
+            const auto col = strong_t_col_idxs[nz];
+            is_max = is_max && (state[col] != cf_state::undecided ||
+                                pmis_measure(strong_t_row_ptrs, col) < measure);
+        }
+        if (is_max) {
+            new_state[row] = cf_state::coarse;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_RUGE_STUBEN_PMIS_SELECT_KERNEL);
+
+
+template <typename IndexType>
+void pmis_update(std::shared_ptr<const DefaultExecutor> exec,
+                 size_type num_rows, const IndexType* strong_row_ptrs,
+                 const IndexType* strong_col_idxs, const IndexType* new_state,
+                 IndexType* state)
+{
+    for (IndexType row = 0; row < static_cast<IndexType>(num_rows); row++) {
+        state[row] = new_state[row];
+        if (new_state[row] != cf_state::undecided) {
+            continue;
+        }
+        for (auto nz = strong_row_ptrs[row]; nz < strong_row_ptrs[row + 1];
+             nz++) {
+            if (new_state[strong_col_idxs[nz]] == cf_state::coarse) {
+                state[row] = cf_state::fine;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_RUGE_STUBEN_PMIS_UPDATE_KERNEL);
+
+
+template <typename IndexType>
+void count_undecided(std::shared_ptr<const DefaultExecutor> exec,
+                     size_type num_rows, const IndexType* state,
+                     IndexType* num_undecided)
+{
+    *num_undecided = static_cast<IndexType>(
+        std::count(state, state + num_rows, cf_state::undecided));
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_COUNT_UNDECIDED_KERNEL);
+
+
+template <typename IndexType>
+void rs_first_pass(std::shared_ptr<const DefaultExecutor> exec,
+                   size_type num_rows, const IndexType* strong_row_ptrs,
+                   const IndexType* strong_col_idxs,
+                   const IndexType* strong_t_row_ptrs,
+                   const IndexType* strong_t_col_idxs, IndexType* state)
+{
+    // the measure is the number of undecided points strongly depending on a
+    // point plus twice the number of fine points doing so. Outdated entries
+    // of the queue are skipped, and ties are broken by the smaller index.
+    vector<IndexType> measure(num_rows, {exec});
+    std::priority_queue<std::pair<IndexType, IndexType>> queue;
+    for (IndexType row = 0; row < static_cast<IndexType>(num_rows); row++) {
+        measure[row] = strong_t_row_ptrs[row + 1] - strong_t_row_ptrs[row];
+        queue.emplace(measure[row], -row);
+    }
+    while (!queue.empty()) {
+        const auto entry = queue.top();
+        queue.pop();
+        const auto row = -entry.second;
+        if (state[row] != cf_state::undecided || entry.first != measure[row]) {
+            continue;
+        }
+        if (measure[row] == 0) {
+            state[row] = cf_state::fine;
+            continue;
+        }
+        state[row] = cf_state::coarse;
+        for (auto nz = strong_t_row_ptrs[row]; nz < strong_t_row_ptrs[row + 1];
+             nz++) {
+            const auto fine_row = strong_t_col_idxs[nz];
+            if (state[fine_row] != cf_state::undecided) {
+                continue;
+            }
+            state[fine_row] = cf_state::fine;
+            // the points the new fine point depends on become more attractive
+            for (auto fine_nz = strong_row_ptrs[fine_row];
+                 fine_nz < strong_row_ptrs[fine_row + 1]; fine_nz++) {
+                const auto col = strong_col_idxs[fine_nz];
+                if (state[col] == cf_state::undecided) {
+                    measure[col]++;
+                    queue.emplace(measure[col], -col);
+                }
+            }
+        }
+        // the points the new coarse point depends on become less attractive
+        for (auto nz = strong_row_ptrs[row]; nz < strong_row_ptrs[row + 1];
+             nz++) {
+            const auto col = strong_col_idxs[nz];
+            if (state[col] == cf_state::undecided) {
+                measure[col]--;
+                queue.emplace(measure[col], -col);
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_RS_FIRST_PASS_KERNEL);
+
+
+template <typename IndexType>
+void compute_coarse_map(std::shared_ptr<const DefaultExecutor> exec,
+                        size_type num_rows, const IndexType* state,
+                        IndexType* coarse_map)
+{
+    for (size_type row = 0; row < num_rows; row++) {
+        coarse_map[row] = state[row] == cf_state::coarse ? 1 : 0;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_COMPUTE_COARSE_MAP_KERNEL);
+
+
+template <typename IndexType>
+void direct_interpolation_count(std::shared_ptr<const DefaultExecutor> exec,
+                                size_type num_rows,
+                                const IndexType* strong_row_ptrs,
+                                const IndexType* strong_col_idxs,
+                                const IndexType* state, IndexType* row_nnz)
+{
+    for (size_type row = 0; row < num_rows; row++) {
+        if (state[row] == cf_state::coarse) {
+            row_nnz[row] = 1;
+            continue;
+        }
+        IndexType count{};
+        for (auto nz = strong_row_ptrs[row]; nz < strong_row_ptrs[row + 1];
+             nz++) {
+            count += state[strong_col_idxs[nz]] == cf_state::coarse ? 1 : 0;
+        }
+        row_nnz[row] = count;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_DIRECT_INTERPOLATION_COUNT_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void direct_interpolation_fill(std::shared_ptr<const DefaultExecutor> exec,
+                               const matrix::Csr<ValueType, IndexType>* source,
+                               const IndexType* strong_row_ptrs,
+                               const IndexType* strong_col_idxs,
+                               const IndexType* state,
+                               const IndexType* coarse_map,
+                               matrix::Csr<ValueType, IndexType>* prolong)
+{
+    using real_type = remove_complex<ValueType>;
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+    const auto vals = source->get_const_values();
+    const auto out_row_ptrs = prolong->get_const_row_ptrs();
+    auto out_col_idxs = prolong->get_col_idxs();
+    auto out_vals = prolong->get_values();
+    for (IndexType row = 0; row < static_cast<IndexType>(source->get_size()[0]);
+         row++) {
+        auto out = out_row_ptrs[row];
+        if (state[row] == cf_state::coarse) {
+            out_col_idxs[out] = coarse_map[row];
+            out_vals[out] = one<ValueType>();
+            continue;
+        }
+        // the strong connections are a sorted subset of the row
+        const auto is_interpolatory = [&](IndexType nz, IndexType& strong_nz) {
+            if (strong_nz < strong_row_ptrs[row + 1] &&
+                strong_col_idxs[strong_nz] == col_idxs[nz]) {
+                return state[strong_col_idxs[strong_nz++]] == cf_state::coarse;
+            }
+            return false;
+        };
+        auto diag = zero<ValueType>();
+        auto neg_sum = zero<ValueType>();
+        auto pos_sum = zero<ValueType>();
+        auto neg_interp_sum = zero<ValueType>();
+        auto pos_interp_sum = zero<ValueType>();
+        auto strong_nz = strong_row_ptrs[row];
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            const auto val = vals[nz];
+            const auto interp = is_interpolatory(nz, strong_nz);
+            if (col_idxs[nz] == row) {
+                diag += val;
+            } else if (real(val) < zero<real_type>()) {
+                neg_sum += val;
+                neg_interp_sum += interp ? val : zero<ValueType>();
+            } else {
+                pos_sum += val;
+                pos_interp_sum += interp ? val : zero<ValueType>();
+            }
+        }
+        // the positive couplings are lumped to the diagonal if there are no
+        // positive interpolatory couplings
+        const auto neg_scale = neg_interp_sum == zero<ValueType>()
+                                   ? zero<ValueType>()
+                                   : neg_sum / neg_interp_sum;
+        auto pos_scale = zero<ValueType>();
+        if (pos_interp_sum == zero<ValueType>()) {
+            diag += pos_sum;
+        } else {
+            pos_scale = pos_sum / pos_interp_sum;
+        }
+        strong_nz = strong_row_ptrs[row];
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            if (is_interpolatory(nz, strong_nz)) {
+                const auto val = vals[nz];
+                const auto scale =
+                    real(val) < zero<real_type>() ? neg_scale : pos_scale;
+                out_col_idxs[out] = coarse_map[col_idxs[nz]];
+                out_vals[out] = -scale * val / diag;
+                out++;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_DIRECT_INTERPOLATION_FILL_KERNEL);
+
+
+template <typename IndexType>
+void extended_i_interpolation_count(
+    std::shared_ptr<const DefaultExecutor> exec, size_type num_rows,
+    const IndexType* strong_row_ptrs, const IndexType* strong_col_idxs,
+    const IndexType* state, IndexType* row_nnz)
+{
+    // marker[col] == row iff col is an interpolatory point of row
+    vector<IndexType> marker(num_rows, -1, {exec});
+    for (IndexType row = 0; row < static_cast<IndexType>(num_rows); row++) {
+        if (state[row] == cf_state::coarse) {
+            row_nnz[row] = 1;
+            continue;
+        }
+        IndexType count{};
+        const auto add = [&](IndexType col) {
+            if (state[col] == cf_state::coarse && marker[col] != row) {
+                marker[col] = row;
+                count++;
+            }
+        };
+        for (auto nz = strong_row_ptrs[row]; nz < strong_row_ptrs[row + 1];
+             nz++) {
+            const auto col = strong_col_idxs[nz];
+            add(col);
+            if (state[col] == cf_state::fine) {
+                for (auto fine_nz = strong_row_ptrs[col];
+                     fine_nz < strong_row_ptrs[col + 1]; fine_nz++) {
+                    add(strong_col_idxs[fine_nz]);
+                }
+            }
+        }
+        row_nnz[row] = count;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_EXTENDED_I_INTERPOLATION_COUNT_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void extended_i_interpolation_fill(
+    std::shared_ptr<const DefaultExecutor> exec,
+    const matrix::Csr<ValueType, IndexType>* source,
+    const IndexType* strong_row_ptrs, const IndexType* strong_col_idxs,
+    const IndexType* state, const IndexType* coarse_map,
+    matrix::Csr<ValueType, IndexType>* prolong)
+{
+    using real_type = remove_complex<ValueType>;
+    const auto num_rows = static_cast<IndexType>(source->get_size()[0]);
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+    const auto vals = source->get_const_values();
+    const auto out_row_ptrs = prolong->get_const_row_ptrs();
+    auto out_col_idxs = prolong->get_col_idxs();
+    auto out_vals = prolong->get_values();
+    // marker[col] == row iff col is an interpolatory point of row, stored at
+    // position[col] of the prolongation, or a strong fine neighbor of row
+    vector<IndexType> marker(num_rows, -1, {exec});
+    vector<IndexType> position(num_rows, {exec});
+    vector<bool> is_strong_fine(num_rows, false, {exec});
+    const auto find_diag = [&](IndexType row) {
+        const auto begin = col_idxs + row_ptrs[row];
+        const auto end = col_idxs + row_ptrs[row + 1];
+        const auto it = std::lower_bound(begin, end, row);
+        return it != end && *it == row ? vals[it - col_idxs]
+                                       : zero<ValueType>();
+    };
+    for (IndexType row = 0; row < num_rows; row++) {
+        const auto out_begin = out_row_ptrs[row];
+        const auto out_end = out_row_ptrs[row + 1];
+        if (state[row] == cf_state::coarse) {
+            out_col_idxs[out_begin] = coarse_map[row];
+            out_vals[out_begin] = one<ValueType>();
+            continue;
+        }
+        // collect the interpolatory points in ascending order
+        auto out = out_begin;
+        const auto add = [&](IndexType col) {
+            if (state[col] == cf_state::coarse && marker[col] != row) {
+                marker[col] = row;
+                out_col_idxs[out++] = col;
+            }
+        };
+        for (auto nz = strong_row_ptrs[row]; nz < strong_row_ptrs[row + 1];
+             nz++) {
+            const auto col = strong_col_idxs[nz];
+            add(col);
+            if (state[col] == cf_state::fine) {
+                is_strong_fine[col] = true;
+                for (auto fine_nz = strong_row_ptrs[col];
+                     fine_nz < strong_row_ptrs[col + 1]; fine_nz++) {
+                    add(strong_col_idxs[fine_nz]);
+                }
+            }
+        }
+        std::sort(out_col_idxs + out_begin, out_col_idxs + out_end);
+        for (auto nz = out_begin; nz < out_end; nz++) {
+            position[out_col_idxs[nz]] = nz;
+            out_vals[nz] = zero<ValueType>();
+        }
+        const auto is_interpolatory = [&](IndexType col) {
+            return state[col] == cf_state::coarse && marker[col] == row;
+        };
+        // the couplings to weak points are lumped to the diagonal, the ones to
+        // strong fine points are distributed to the interpolatory points and
+        // the point itself by the couplings of the opposite sign as the
+        // diagonal of the strong fine point
+        auto diag = zero<ValueType>();
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            const auto col = col_idxs[nz];
+            const auto val = vals[nz];
+            if (col == row) {
+                diag += val;
+            } else if (is_interpolatory(col)) {
+                out_vals[position[col]] += val;
+            } else if (!is_strong_fine[col]) {
+                diag += val;
+            }
+        }
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            const auto fine_row = col_idxs[nz];
+            if (fine_row == row || !is_strong_fine[fine_row]) {
+                continue;
+            }
+            const auto fine_diag_negative =
+                real(find_diag(fine_row)) < zero<real_type>();
+            const auto is_opposite = [&](ValueType val) {
+                return (real(val) < zero<real_type>()) != fine_diag_negative &&
+                       val != zero<ValueType>();
+            };
+            auto denom = zero<ValueType>();
+            for (auto fine_nz = row_ptrs[fine_row];
+                 fine_nz < row_ptrs[fine_row + 1]; fine_nz++) {
+                const auto col = col_idxs[fine_nz];
+                const auto val = vals[fine_nz];
+                if ((col == row || is_interpolatory(col)) && is_opposite(val)) {
+                    denom += val;
+                }
+            }
+            if (denom == zero<ValueType>()) {
+                diag += vals[nz];
+                continue;
+            }
+            const auto scale = vals[nz] / denom;
+            for (auto fine_nz = row_ptrs[fine_row];
+                 fine_nz < row_ptrs[fine_row + 1]; fine_nz++) {
+                const auto col = col_idxs[fine_nz];
+                const auto val = vals[fine_nz];
+                if (!is_opposite(val)) {
+                    continue;
+                }
+                if (col == row) {
+                    diag += scale * val;
+                } else if (is_interpolatory(col)) {
+                    out_vals[position[col]] += scale * val;
+                }
+            }
+        }
+        for (auto nz = strong_row_ptrs[row]; nz < strong_row_ptrs[row + 1];
+             nz++) {
+            is_strong_fine[strong_col_idxs[nz]] = false;
+        }
+        for (auto nz = out_begin; nz < out_end; nz++) {
+            out_vals[nz] = -out_vals[nz] / diag;
+            out_col_idxs[nz] = coarse_map[out_col_idxs[nz]];
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_RUGE_STUBEN_EXTENDED_I_INTERPOLATION_FILL_KERNEL);
+
+
+}  // namespace ruge_stuben
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
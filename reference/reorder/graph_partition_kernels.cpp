@@ -0,0 +1,194 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/reorder/graph_partition_kernels.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+#include "core/base/allocator.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The graph partitioning namespace.
+ *
+ * @ingroup reorder
+ */
+namespace graph_partition {
+
+
+/**
+ * Returns a key that orders the undirected edge (u, v) first by its weight and
+ * then by a hash of its end points, which is the same for both directions.
+ */
+template <typename IndexType>
+std::tuple<IndexType, uint64, IndexType> edge_key(IndexType u, IndexType v,
+                                                  IndexType weight)
+{
+    const auto lo = std::min(u, v);
+    const auto hi = std::max(u, v);
+    auto hash = static_cast<uint64>(lo) * 0x9e3779b97f4a7c15ull ^
+                static_cast<uint64>(hi);
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ull;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebull;
+    return std::make_tuple(weight, hash ^ (hash >> 31), lo);
+}
+
+
+template <typename IndexType>
+void match_edges(std::shared_ptr<const DefaultExecutor> exec,
+                 IndexType num_vertices, const IndexType* row_ptrs,
+                 const IndexType* col_idxs, const IndexType* edge_weights,
+                 const IndexType* vertex_weights, IndexType max_vertex_weight,
+                 IndexType* match)
+{
+    constexpr int max_rounds = 8;
+    const auto invalid = invalid_index<IndexType>();
+    array<IndexType> candidate_array{exec,
+                                     static_cast<size_type>(num_vertices)};
+    const auto candidates = candidate_array.get_data();
+    std::fill_n(match, num_vertices, invalid);
+    // every unmatched vertex proposes to its heaviest unmatched neighbor,
+    // mutual proposals are matched. The heaviest remaining edge is always
+    // mutual, so every round makes progress.
+    for (int round = 0; round < max_rounds; round++) {
+        for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+            candidates[vertex] = invalid;
+            if (match[vertex] != invalid) {
+                continue;
+            }
+            std::tuple<IndexType, uint64, IndexType> best_key{};
+            for (auto nz = row_ptrs[vertex]; nz < row_ptrs[vertex + 1]; nz++) {
+                const auto neighbor = col_idxs[nz];
+                if (neighbor == vertex || match[neighbor] != invalid ||
+                    vertex_weights[vertex] + vertex_weights[neighbor] >
+                        max_vertex_weight) {
+                    continue;
+                }
+                const auto key = edge_key(vertex, neighbor, edge_weights[nz]);
+                if (candidates[vertex] == invalid || key > best_key) {
+                    candidates[vertex] = neighbor;
+                    best_key = key;
+                }
+            }
+        }
+        bool changed = false;
+        for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+            const auto candidate = candidates[vertex];
+            if (candidate != invalid && candidates[candidate] == vertex) {
+                match[vertex] = candidate;
+                changed = true;
+            }
+        }
+        if (!changed) {
+            break;
+        }
+    }
+    for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+        if (match[vertex] == invalid) {
+            match[vertex] = vertex;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_GRAPH_PARTITION_MATCH_EDGES_KERNEL);
+
+
+template <typename IndexType>
+void contract_graph(std::shared_ptr<const DefaultExecutor> exec,
+                    IndexType num_vertices, const IndexType* row_ptrs,
+                    const IndexType* col_idxs, const IndexType* edge_weights,
+                    const IndexType* vertex_weights, const IndexType* match,
+                    IndexType* coarse_map, array<IndexType>& coarse_row_ptrs,
+                    array<IndexType>& coarse_col_idxs,
+                    array<IndexType>& coarse_edge_weights,
+                    array<IndexType>& coarse_vertex_weights)
+{
+    // the smaller vertex of every pair represents the coarse vertex
+    IndexType num_coarse{};
+    for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+        if (vertex <= match[vertex]) {
+            coarse_map[vertex] = num_coarse++;
+        }
+    }
+    for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+        if (vertex > match[vertex]) {
+            coarse_map[vertex] = coarse_map[match[vertex]];
+        }
+    }
+    array<IndexType> representative_array{exec,
+                                          static_cast<size_type>(num_coarse)};
+    const auto representatives = representative_array.get_data();
+    coarse_vertex_weights.resize_and_reset(num_coarse);
+    coarse_row_ptrs.resize_and_reset(num_coarse + 1);
+    const auto out_vertex_weights = coarse_vertex_weights.get_data();
+    const auto out_row_ptrs = coarse_row_ptrs.get_data();
+    for (IndexType vertex = 0; vertex < num_vertices; vertex++) {
+        if (vertex <= match[vertex]) {
+            const auto partner = match[vertex];
+            const auto coarse = coarse_map[vertex];
+            representatives[coarse] = vertex;
+            out_vertex_weights[coarse] =
+                vertex_weights[vertex] +
+                (partner != vertex ? vertex_weights[partner] : 0);
+        }
+    }
+    // merge the neighborhoods of both fine vertices into the coarse row
+    vector<std::pair<IndexType, IndexType>> entries{exec};
+    out_row_ptrs[0] = 0;
+    for (IndexType coarse = 0; coarse < num_coarse; coarse++) {
+        const auto vertex = representatives[coarse];
+        const auto partner = match[vertex];
+        const auto row_begin = static_cast<IndexType>(entries.size());
+        for (auto fine : {vertex, partner}) {
+            for (auto nz = row_ptrs[fine]; nz < row_ptrs[fine + 1]; nz++) {
+                const auto coarse_neighbor = coarse_map[col_idxs[nz]];
+                if (coarse_neighbor != coarse) {
+                    entries.emplace_back(coarse_neighbor, edge_weights[nz]);
+                }
+            }
+            if (partner == vertex) {
+                break;
+            }
+        }
+        std::sort(entries.begin() + row_begin, entries.end(),
+                  [](auto a, auto b) { return a.first < b.first; });
+        auto out = row_begin;
+        for (auto in = row_begin; in < static_cast<IndexType>(entries.size());
+             in++) {
+            if (out > row_begin &&
+                entries[out - 1].first == entries[in].first) {
+                entries[out - 1].second += entries[in].second;
+            } else {
+                entries[out++] = entries[in];
+            }
+        }
+        entries.resize(out);
+        out_row_ptrs[coarse + 1] = out;
+    }
+    coarse_col_idxs.resize_and_reset(entries.size());
+    coarse_edge_weights.resize_and_reset(entries.size());
+    for (size_type i = 0; i < entries.size(); i++) {
+        coarse_col_idxs.get_data()[i] = entries[i].first;
+        coarse_edge_weights.get_data()[i] = entries[i].second;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_GRAPH_PARTITION_CONTRACT_GRAPH_KERNEL);
+
+
+}  // namespace graph_partition
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
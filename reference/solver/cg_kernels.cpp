@@ -96,6 +96,91 @@ void step_2(std::shared_ptr<const ReferenceExecutor> exec,
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CG_STEP_2_KERNEL);
 
 
+template <typename ValueType>
+void fused_step_1(std::shared_ptr<const ReferenceExecutor> exec,
+                  matrix::Dense<ValueType>* p,
+                  const matrix::Dense<ValueType>* r, const ValueType* inv_diag,
+                  const matrix::Dense<ValueType>* rho,
+                  const matrix::Dense<ValueType>* prev_rho,
+                  const array<stopping_status>* stop_status)
+{
+    for (size_type i = 0; i < p->get_size()[0]; ++i) {
+        for (size_type j = 0; j < p->get_size()[1]; ++j) {
+            if (stop_status->get_const_data()[j].has_stopped()) {
+                continue;
+            }
+            const auto z = inv_diag ? inv_diag[i] * r->at(i, j) : r->at(i, j);
+            if (is_zero(prev_rho->at(j))) {
+                p->at(i, j) = z;
+            } else {
+                auto tmp = rho->at(j) / prev_rho->at(j);
+                p->at(i, j) = z + tmp * p->at(i, j);
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CG_FUSED_STEP_1_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void spmv_dot(std::shared_ptr<const ReferenceExecutor> exec,
+              const matrix::Csr<ValueType, IndexType>* a,
+              const matrix::Dense<ValueType>* p, matrix::Dense<ValueType>* q,
+              matrix::Dense<ValueType>* beta, array<char>& tmp)
+{
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto vals = a->get_const_values();
+    for (size_type j = 0; j < q->get_size()[1]; ++j) {
+        beta->at(j) = zero<ValueType>();
+    }
+    for (size_type i = 0; i < q->get_size()[0]; ++i) {
+        for (size_type j = 0; j < q->get_size()[1]; ++j) {
+            auto sum = zero<ValueType>();
+            for (auto nz = row_ptrs[i]; nz < row_ptrs[i + 1]; ++nz) {
+                sum += vals[nz] * p->at(col_idxs[nz], j);
+            }
+            q->at(i, j) = sum;
+            beta->at(j) += conj(p->at(i, j)) * sum;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CG_SPMV_DOT_KERNEL);
+
+
+template <typename ValueType>
+void fused_step_2(std::shared_ptr<const ReferenceExecutor> exec,
+                  matrix::Dense<ValueType>* x, matrix::Dense<ValueType>* r,
+                  const matrix::Dense<ValueType>* p,
+                  const matrix::Dense<ValueType>* q, const ValueType* inv_diag,
+                  const matrix::Dense<ValueType>* beta,
+                  const matrix::Dense<ValueType>* prev_rho,
+                  matrix::Dense<ValueType>* rho, array<char>& tmp,
+                  const array<stopping_status>* stop_status)
+{
+    for (size_type j = 0; j < x->get_size()[1]; ++j) {
+        rho->at(j) = zero<ValueType>();
+    }
+    for (size_type i = 0; i < x->get_size()[0]; ++i) {
+        for (size_type j = 0; j < x->get_size()[1]; ++j) {
+            if (!stop_status->get_const_data()[j].has_stopped() &&
+                is_nonzero(beta->at(j))) {
+                auto alpha = prev_rho->at(j) / beta->at(j);
+                x->at(i, j) += alpha * p->at(i, j);
+                r->at(i, j) -= alpha * q->at(i, j);
+            }
+            const auto r_val = r->at(i, j);
+            rho->at(j) +=
+                conj(r_val) * (inv_diag ? inv_diag[i] * r_val : r_val);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CG_FUSED_STEP_2_KERNEL);
+
+
 }  // namespace cg
 }  // namespace reference
 }  // namespace kernels
@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/solver/chebyshev_kernels.hpp"
+
+#include <ginkgo/core/base/math.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The Chebyshev solver namespace.
+ *
+ * @ingroup chebyshev
+ */
+namespace chebyshev {
+
+
+template <typename ValueType>
+void init_update(std::shared_ptr<const ReferenceExecutor> exec,
+                 const ValueType alpha,
+                 const matrix::Dense<ValueType>* inner_sol,
+                 matrix::Dense<ValueType>* update_sol,
+                 matrix::Dense<ValueType>* output)
+{
+    for (size_type row = 0; row < output->get_size()[0]; row++) {
+        for (size_type col = 0; col < output->get_size()[1]; col++) {
+            const auto inner_val = inner_sol->at(row, col);
+            update_sol->at(row, col) = inner_val;
+            output->at(row, col) += alpha * inner_val;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CHEBYSHEV_INIT_UPDATE_KERNEL);
+
+
+template <typename ValueType>
+void update(std::shared_ptr<const ReferenceExecutor> exec,
+            const ValueType alpha, const ValueType beta,
+            const matrix::Dense<ValueType>* inner_sol,
+            matrix::Dense<ValueType>* update_sol,
+            matrix::Dense<ValueType>* output)
+{
+    for (size_type row = 0; row < output->get_size()[0]; row++) {
+        for (size_type col = 0; col < output->get_size()[1]; col++) {
+            const auto update_val =
+                inner_sol->at(row, col) + beta * update_sol->at(row, col);
+            update_sol->at(row, col) = update_val;
+            output->at(row, col) += alpha * update_val;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CHEBYSHEV_UPDATE_KERNEL);
+
+
+}  // namespace chebyshev
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
@@ -93,6 +93,203 @@ void multi_dot(std::shared_ptr<const ReferenceExecutor> exec,
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_MULTI_DOT_KERNEL);
 
+
+template <typename ValueType>
+void block_dot(std::shared_ptr<const ReferenceExecutor> exec,
+               const matrix::Dense<ValueType>* krylov_bases,
+               size_type num_prev_bases, size_type block_size,
+               matrix::Dense<ValueType>* block_coefficients)
+{
+    const auto num_bases = num_prev_bases + block_size;
+    const auto num_rows = krylov_bases->get_size()[0] / num_bases;
+    const auto num_rhs = krylov_bases->get_size()[1];
+    for (size_type i = 0; i < num_bases; ++i) {
+        for (size_type l = 0; l < block_size; ++l) {
+            const auto block_row = (num_prev_bases + l) * num_rows;
+            for (size_type k = 0; k < num_rhs; ++k) {
+                auto value = zero<ValueType>();
+                for (size_type row = 0; row < num_rows; ++row) {
+                    value += conj(krylov_bases->at(i * num_rows + row, k)) *
+                             krylov_bases->at(block_row + row, k);
+                }
+                block_coefficients->at(i * block_size + l, k) = value;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_BLOCK_DOT_KERNEL);
+
+
+template <typename ValueType>
+void block_cholesky(std::shared_ptr<const ReferenceExecutor> exec,
+                    matrix::Dense<ValueType>* block_coefficients,
+                    size_type num_prev_bases, size_type block_size,
+                    const stopping_status* stop_status)
+{
+    // the rows num_prev_bases * block_size and following contain the gram
+    // matrix G = W^H W of the block, the rows before contain R12 = V^H W
+    const auto r = [&](size_type row, size_type col, size_type rhs) -> auto& {
+        return block_coefficients->at((num_prev_bases + row) * block_size + col,
+                                      rhs);
+    };
+    for (size_type k = 0; k < block_coefficients->get_size()[1]; ++k) {
+        if (stop_status[k].has_stopped()) {
+            continue;
+        }
+        // G = G - R12^H R12 is the gram matrix of W - V R12
+        for (size_type m = 0; m < block_size; ++m) {
+            for (size_type l = m; l < block_size; ++l) {
+                for (size_type i = 0; i < num_prev_bases; ++i) {
+                    r(m, l, k) -=
+                        conj(block_coefficients->at(i * block_size + m, k)) *
+                        block_coefficients->at(i * block_size + l, k);
+                }
+            }
+        }
+        // G = R22^H R22, computed in-place
+        for (size_type m = 0; m < block_size; ++m) {
+            auto diag = real(r(m, m, k));
+            for (size_type i = 0; i < m; ++i) {
+                diag -= squared_norm(r(i, m, k));
+            }
+            for (size_type l = 0; l < m; ++l) {
+                r(m, l, k) = zero<ValueType>();
+            }
+            if (!(diag > zero<remove_complex<ValueType>>())) {
+                // the block is numerically rank-deficient
+                for (size_type l = m; l < block_size; ++l) {
+                    r(m, l, k) = zero<ValueType>();
+                }
+                continue;
+            }
+            r(m, m, k) = sqrt(diag);
+            for (size_type l = m + 1; l < block_size; ++l) {
+                auto value = r(m, l, k);
+                for (size_type i = 0; i < m; ++i) {
+                    value -= conj(r(i, m, k)) * r(i, l, k);
+                }
+                r(m, l, k) = value / r(m, m, k);
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_BLOCK_CHOLESKY_KERNEL);
+
+
+template <typename ValueType>
+void block_orthonormalize(std::shared_ptr<const ReferenceExecutor> exec,
+                          matrix::Dense<ValueType>* krylov_bases,
+                          const matrix::Dense<ValueType>* block_coefficients,
+                          size_type num_prev_bases, size_type block_size,
+                          const stopping_status* stop_status)
+{
+    const auto num_bases = num_prev_bases + block_size;
+    const auto num_rows = krylov_bases->get_size()[0] / num_bases;
+    for (size_type k = 0; k < krylov_bases->get_size()[1]; ++k) {
+        if (stop_status[k].has_stopped()) {
+            continue;
+        }
+        for (size_type row = 0; row < num_rows; ++row) {
+            // q_l = (w_l - V R12(:, l) - Q(:, :l) R22(:l, l)) / R22(l, l)
+            for (size_type l = 0; l < block_size; ++l) {
+                auto value =
+                    krylov_bases->at((num_prev_bases + l) * num_rows + row, k);
+                for (size_type i = 0; i < num_bases - block_size + l; ++i) {
+                    value -= krylov_bases->at(i * num_rows + row, k) *
+                             block_coefficients->at(i * block_size + l, k);
+                }
+                const auto diag = block_coefficients->at(
+                    (num_prev_bases + l) * block_size + l, k);
+                krylov_bases->at((num_prev_bases + l) * num_rows + row, k) =
+                    is_zero(diag) ? zero<ValueType>() : value / diag;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(
+    GKO_DECLARE_GMRES_BLOCK_ORTHONORMALIZE_KERNEL);
+
+
+template <typename ValueType>
+void block_hessenberg(std::shared_ptr<const ReferenceExecutor> exec,
+                      matrix::Dense<ValueType>* block_coefficients,
+                      const matrix::Dense<ValueType>* block_reorth_coefficients,
+                      matrix::Dense<ValueType>* arnoldi_hessenberg,
+                      matrix::Dense<ValueType>* hessenberg,
+                      matrix::Dense<ValueType>* basis_scaling, size_type iter,
+                      size_type block_size, const stopping_status* stop_status)
+{
+    const auto num_prev_bases = iter + 1;
+    const auto num_rhs = block_coefficients->get_size()[1];
+    const auto coef = block_coefficients;
+    const auto reorth = block_reorth_coefficients;
+    for (size_type k = 0; k < num_rhs; ++k) {
+        if (stop_status[k].has_stopped()) {
+            continue;
+        }
+        // combine both passes: W = V R12 + Q1 R22, Q1 = V R12' + Q R22'
+        // gives W = V (R12 + R12' R22) + Q R22' R22
+        for (size_type i = 0; i < num_prev_bases; ++i) {
+            for (size_type l = 0; l < block_size; ++l) {
+                for (size_type m = 0; m <= l; ++m) {
+                    coef->at(i * block_size + l, k) +=
+                        reorth->at(i * block_size + m, k) *
+                        coef->at((num_prev_bases + m) * block_size + l, k);
+                }
+            }
+        }
+        for (size_type m = 0; m < block_size; ++m) {
+            for (size_type l = m; l < block_size; ++l) {
+                auto value = zero<ValueType>();
+                for (size_type i = m; i <= l; ++i) {
+                    value +=
+                        reorth->at((num_prev_bases + m) * block_size + i, k) *
+                        coef->at((num_prev_bases + i) * block_size + l, k);
+                }
+                coef->at((num_prev_bases + m) * block_size + l, k) = value;
+            }
+        }
+        // coefficients of the s-step basis K = [v_iter, w_1, ..., w_s]
+        const auto basis_coef = [&](size_type row, size_type col) {
+            if (col == 0) {
+                return row == iter ? one<ValueType>() : zero<ValueType>();
+            }
+            return row <= iter + col ? coef->at(row * block_size + col - 1, k)
+                                     : zero<ValueType>();
+        };
+        // A M K(:, c) = scale_c K(:, c + 1) and K = V R give the columns of
+        // the Arnoldi relation A M V = V H one after another:
+        // H(:, iter + c) = (scale_c R(:, c + 1) - H(:, :iter + c)
+        //                  R(:iter + c, c)) / R(iter + c, c)
+        const auto sigma = basis_scaling->at(0, k);
+        auto new_sigma = abs(sigma);
+        for (size_type c = 0; c < block_size; ++c) {
+            const auto col = iter + c;
+            const auto scale = c == 0 ? one<ValueType>() : sigma;
+            const auto diag = basis_coef(col, c);
+            remove_complex<ValueType> col_norm{};
+            for (size_type row = 0; row <= col + 1; ++row) {
+                auto value = scale * basis_coef(row, c + 1);
+                for (size_type l = row > 0 ? row - 1 : 0; l < col; ++l) {
+                    value -= arnoldi_hessenberg->at(l, row * num_rhs + k) *
+                             basis_coef(l, c);
+                }
+                value = is_zero(diag) ? zero<ValueType>() : value / diag;
+                arnoldi_hessenberg->at(col, row * num_rhs + k) = value;
+                hessenberg->at(col, row * num_rhs + k) = value;
+                col_norm += squared_norm(value);
+            }
+            new_sigma = std::max(new_sigma, sqrt(col_norm));
+        }
+        basis_scaling->at(0, k) = new_sigma;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GMRES_BLOCK_HESSENBERG_KERNEL);
+
 }  // namespace gmres
 }  // namespace reference
 }  // namespace kernels
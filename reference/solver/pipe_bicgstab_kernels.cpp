@@ -0,0 +1,176 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/solver/pipe_bicgstab_kernels.hpp"
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The PIPE_BICGSTAB solver namespace.
+ *
+ * @ingroup pipe_bicgstab
+ */
+namespace pipe_bicgstab {
+
+
+template <typename ValueType>
+void initialize(std::shared_ptr<const ReferenceExecutor> exec,
+                const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* r,
+                matrix::Dense<ValueType>* ph, matrix::Dense<ValueType>* s,
+                matrix::Dense<ValueType>* sh, matrix::Dense<ValueType>* z,
+                matrix::Dense<ValueType>* zh, matrix::Dense<ValueType>* v,
+                matrix::Dense<ValueType>* alpha,
+                matrix::Dense<ValueType>* beta,
+                matrix::Dense<ValueType>* omega,
+                matrix::Dense<ValueType>* prev_rho,
+                matrix::Dense<ValueType>* yq, matrix::Dense<ValueType>* yy,
+                array<stopping_status>* stop_status)
+{
+    for (size_type j = 0; j < b->get_size()[1]; ++j) {
+        alpha->at(j) = zero<ValueType>();
+        beta->at(j) = zero<ValueType>();
+        omega->at(j) = zero<ValueType>();
+        prev_rho->at(j) = zero<ValueType>();
+        yq->at(j) = zero<ValueType>();
+        yy->at(j) = zero<ValueType>();
+        stop_status->get_data()[j].reset();
+    }
+    for (size_type i = 0; i < b->get_size()[0]; ++i) {
+        for (size_type j = 0; j < b->get_size()[1]; ++j) {
+            r->at(i, j) = b->at(i, j);
+            ph->at(i, j) = s->at(i, j) = sh->at(i, j) = z->at(i, j) =
+                zh->at(i, j) = v->at(i, j) = zero<ValueType>();
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(
+    GKO_DECLARE_PIPE_BICGSTAB_INITIALIZE_KERNEL);
+
+
+template <typename ValueType>
+void step_1(std::shared_ptr<const ReferenceExecutor> exec,
+            const matrix::Dense<ValueType>* r,
+            const matrix::Dense<ValueType>* rh,
+            const matrix::Dense<ValueType>* w,
+            const matrix::Dense<ValueType>* wh,
+            const matrix::Dense<ValueType>* t, matrix::Dense<ValueType>* ph,
+            matrix::Dense<ValueType>* s, matrix::Dense<ValueType>* sh,
+            matrix::Dense<ValueType>* z, const matrix::Dense<ValueType>* zh,
+            const matrix::Dense<ValueType>* v, matrix::Dense<ValueType>* q,
+            matrix::Dense<ValueType>* qh, matrix::Dense<ValueType>* y,
+            const matrix::Dense<ValueType>* alpha,
+            const matrix::Dense<ValueType>* beta,
+            const matrix::Dense<ValueType>* omega,
+            const array<stopping_status>* stop_status)
+{
+    for (size_type i = 0; i < r->get_size()[0]; ++i) {
+        for (size_type j = 0; j < r->get_size()[1]; ++j) {
+            if (stop_status->get_const_data()[j].has_stopped()) {
+                continue;
+            }
+            const auto b = beta->at(j);
+            const auto o = omega->at(j);
+            // s and sh need the previous z and zh
+            ph->at(i, j) = rh->at(i, j) + b * (ph->at(i, j) - o * sh->at(i, j));
+            s->at(i, j) = w->at(i, j) + b * (s->at(i, j) - o * z->at(i, j));
+            sh->at(i, j) = wh->at(i, j) + b * (sh->at(i, j) - o * zh->at(i, j));
+            z->at(i, j) = t->at(i, j) + b * (z->at(i, j) - o * v->at(i, j));
+            q->at(i, j) = r->at(i, j) - alpha->at(j) * s->at(i, j);
+            qh->at(i, j) = rh->at(i, j) - alpha->at(j) * sh->at(i, j);
+            y->at(i, j) = w->at(i, j) - alpha->at(j) * z->at(i, j);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_BICGSTAB_STEP_1_KERNEL);
+
+
+template <typename ValueType>
+void step_2(std::shared_ptr<const ReferenceExecutor> exec,
+            matrix::Dense<ValueType>* x, matrix::Dense<ValueType>* r,
+            matrix::Dense<ValueType>* rh, matrix::Dense<ValueType>* w,
+            const matrix::Dense<ValueType>* wh,
+            const matrix::Dense<ValueType>* t,
+            const matrix::Dense<ValueType>* ph,
+            const matrix::Dense<ValueType>* q,
+            const matrix::Dense<ValueType>* qh,
+            const matrix::Dense<ValueType>* y,
+            const matrix::Dense<ValueType>* zh,
+            const matrix::Dense<ValueType>* v,
+            const matrix::Dense<ValueType>* alpha,
+            const matrix::Dense<ValueType>* yq,
+            const matrix::Dense<ValueType>* yy,
+            const array<stopping_status>* stop_status)
+{
+    for (size_type i = 0; i < x->get_size()[0]; ++i) {
+        for (size_type j = 0; j < x->get_size()[1]; ++j) {
+            if (stop_status->get_const_data()[j].has_stopped()) {
+                continue;
+            }
+            const auto a = alpha->at(j);
+            const auto omega = is_nonzero(yy->at(j)) ? yq->at(j) / yy->at(j)
+                                                     : zero<ValueType>();
+            x->at(i, j) += a * ph->at(i, j) + omega * qh->at(i, j);
+            r->at(i, j) = q->at(i, j) - omega * y->at(i, j);
+            rh->at(i, j) =
+                qh->at(i, j) - omega * (wh->at(i, j) - a * zh->at(i, j));
+            w->at(i, j) = y->at(i, j) - omega * (t->at(i, j) - a * v->at(i, j));
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_BICGSTAB_STEP_2_KERNEL);
+
+
+template <typename ValueType>
+void step_3(std::shared_ptr<const ReferenceExecutor> exec,
+            matrix::Dense<ValueType>* alpha, matrix::Dense<ValueType>* beta,
+            matrix::Dense<ValueType>* omega,
+            matrix::Dense<ValueType>* prev_rho,
+            const matrix::Dense<ValueType>* yq,
+            const matrix::Dense<ValueType>* yy,
+            const matrix::Dense<ValueType>* rho,
+            const matrix::Dense<ValueType>* rr_w,
+            const matrix::Dense<ValueType>* rr_s,
+            const matrix::Dense<ValueType>* rr_z,
+            const array<stopping_status>* stop_status)
+{
+    for (size_type j = 0; j < alpha->get_size()[1]; ++j) {
+        if (stop_status->get_const_data()[j].has_stopped()) {
+            continue;
+        }
+        // all scalars are zero before the first iteration
+        const auto new_omega = is_nonzero(yy->at(j)) ? yq->at(j) / yy->at(j)
+                                                     : zero<ValueType>();
+        const auto beta_denominator = new_omega * prev_rho->at(j);
+        const auto new_beta =
+            is_nonzero(beta_denominator)
+                ? alpha->at(j) * rho->at(j) / beta_denominator
+                : zero<ValueType>();
+        const auto alpha_denominator = rr_w->at(j) + new_beta * rr_s->at(j) -
+                                       new_beta * new_omega * rr_z->at(j);
+        alpha->at(j) = is_nonzero(alpha_denominator)
+                           ? rho->at(j) / alpha_denominator
+                           : zero<ValueType>();
+        beta->at(j) = new_beta;
+        omega->at(j) = new_omega;
+        prev_rho->at(j) = rho->at(j);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_BICGSTAB_STEP_3_KERNEL);
+
+
+}  // namespace pipe_bicgstab
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
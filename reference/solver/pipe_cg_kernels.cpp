@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/solver/pipe_cg_kernels.hpp"
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The PIPE_CG solver namespace.
+ *
+ * @ingroup pipe_cg
+ */
+namespace pipe_cg {
+
+
+template <typename ValueType>
+void initialize(std::shared_ptr<const ReferenceExecutor> exec,
+                const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* r,
+                matrix::Dense<ValueType>* z, matrix::Dense<ValueType>* q,
+                matrix::Dense<ValueType>* s, matrix::Dense<ValueType>* p,
+                matrix::Dense<ValueType>* prev_gamma,
+                matrix::Dense<ValueType>* alpha,
+                array<stopping_status>* stop_status)
+{
+    for (size_type j = 0; j < b->get_size()[1]; ++j) {
+        prev_gamma->at(j) = zero<ValueType>();
+        alpha->at(j) = zero<ValueType>();
+        stop_status->get_data()[j].reset();
+    }
+    for (size_type i = 0; i < b->get_size()[0]; ++i) {
+        for (size_type j = 0; j < b->get_size()[1]; ++j) {
+            r->at(i, j) = b->at(i, j);
+            z->at(i, j) = q->at(i, j) = s->at(i, j) = p->at(i, j) =
+                zero<ValueType>();
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG_INITIALIZE_KERNEL);
+
+
+template <typename ValueType>
+void step_1(std::shared_ptr<const ReferenceExecutor> exec,
+            matrix::Dense<ValueType>* beta, matrix::Dense<ValueType>* alpha,
+            matrix::Dense<ValueType>* prev_gamma,
+            const matrix::Dense<ValueType>* gamma,
+            const matrix::Dense<ValueType>* delta,
+            const array<stopping_status>* stop_status)
+{
+    for (size_type j = 0; j < beta->get_size()[1]; ++j) {
+        if (stop_status->get_const_data()[j].has_stopped()) {
+            continue;
+        }
+        // prev_gamma and alpha are zero in the first iteration
+        auto new_beta = zero<ValueType>();
+        if (is_nonzero(prev_gamma->at(j))) {
+            new_beta = gamma->at(j) / prev_gamma->at(j);
+        }
+        auto denominator = delta->at(j);
+        if (is_nonzero(alpha->at(j))) {
+            denominator -= new_beta * gamma->at(j) / alpha->at(j);
+        }
+        alpha->at(j) = is_nonzero(denominator) ? gamma->at(j) / denominator
+                                               : zero<ValueType>();
+        beta->at(j) = new_beta;
+        prev_gamma->at(j) = gamma->at(j);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG_STEP_1_KERNEL);
+
+
+template <typename ValueType>
+void step_2(std::shared_ptr<const ReferenceExecutor> exec,
+            matrix::Dense<ValueType>* x, matrix::Dense<ValueType>* r,
+            matrix::Dense<ValueType>* u, matrix::Dense<ValueType>* w,
+            const matrix::Dense<ValueType>* m,
+            const matrix::Dense<ValueType>* n, matrix::Dense<ValueType>* z,
+            matrix::Dense<ValueType>* q, matrix::Dense<ValueType>* s,
+            matrix::Dense<ValueType>* p, const matrix::Dense<ValueType>* beta,
+            const matrix::Dense<ValueType>* alpha,
+            const array<stopping_status>* stop_status)
+{
+    for (size_type i = 0; i < x->get_size()[0]; ++i) {
+        for (size_type j = 0; j < x->get_size()[1]; ++j) {
+            if (stop_status->get_const_data()[j].has_stopped()) {
+                continue;
+            }
+            z->at(i, j) = n->at(i, j) + beta->at(j) * z->at(i, j);
+            q->at(i, j) = m->at(i, j) + beta->at(j) * q->at(i, j);
+            s->at(i, j) = w->at(i, j) + beta->at(j) * s->at(i, j);
+            p->at(i, j) = u->at(i, j) + beta->at(j) * p->at(i, j);
+            x->at(i, j) += alpha->at(j) * p->at(i, j);
+            r->at(i, j) -= alpha->at(j) * s->at(i, j);
+            u->at(i, j) -= alpha->at(j) * q->at(i, j);
+            w->at(i, j) -= alpha->at(j) * z->at(i, j);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PIPE_CG_STEP_2_KERNEL);
+
+
+}  // namespace pipe_cg
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
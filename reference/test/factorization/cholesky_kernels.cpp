@@ -492,4 +492,70 @@ TYPED_TEST(Cholesky, FactorizeWithKnownSparsityWorks)
 }
 
 
+TYPED_TEST(Cholesky, UpdateValuesWorks)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    this->forall_matrices(
+        [this] {
+            auto scaled_mtx = gko::clone(this->ref, this->mtx);
+            scaled_mtx->scale(gko::initialize<gko::matrix::Dense<value_type>>(
+                {2.0}, this->ref));
+            auto cholesky =
+                gko::experimental::factorization::Cholesky<value_type,
+                                                           index_type>::build()
+                    .on(this->ref)
+                    ->generate(gko::share(std::move(scaled_mtx)));
+
+            cholesky->update_values(this->mtx);
+
+            GKO_ASSERT_MTX_NEAR(cholesky->get_combined(), this->combined_ref,
+                                r<value_type>::value);
+            ASSERT_EQ(cholesky->get_storage_type(),
+                      gko::experimental::factorization::storage_type::
+                          symm_combined_cholesky);
+        },
+        false);
+}
+
+
+TYPED_TEST(Cholesky, UpdateValuesWorksWithChangedPivots)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    this->forall_matrices(
+        [this] {
+            auto new_mtx = gko::clone(this->ref, this->mtx);
+            // strengthen the diagonal by a row-dependent factor, which keeps
+            // the matrix positive definite but changes the pivots relative
+            // to each other
+            const auto row_ptrs = new_mtx->get_const_row_ptrs();
+            const auto col_idxs = new_mtx->get_const_col_idxs();
+            const auto values = new_mtx->get_values();
+            for (index_type row = 0;
+                 row < static_cast<index_type>(new_mtx->get_size()[0]);
+                 row++) {
+                for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                    if (col_idxs[nz] == row) {
+                        values[nz] *= static_cast<value_type>(2 + row % 3);
+                    }
+                }
+            }
+            auto shared_new_mtx = gko::share(std::move(new_mtx));
+            auto factory =
+                gko::experimental::factorization::Cholesky<value_type,
+                                                           index_type>::build()
+                    .on(this->ref);
+            auto cholesky = factory->generate(this->mtx);
+            auto expected = factory->generate(shared_new_mtx);
+
+            cholesky->update_values(shared_new_mtx);
+
+            GKO_ASSERT_MTX_NEAR(cholesky->get_combined(),
+                                expected->get_combined(), r<value_type>::value);
+        },
+        false);
+}
+
+
 }  // namespace
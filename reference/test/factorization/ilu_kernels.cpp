@@ -391,6 +391,48 @@ TYPED_TEST(Ilu, GenerateForDenseBig)
 }
 
 
+TYPED_TEST(Ilu, UpdateValuesForDenseBig)
+{
+    using Dense = typename TestFixture::Dense;
+    using value_type = typename TestFixture::value_type;
+    auto scaled_mtx = gko::clone(this->exec, this->mtx_big);
+    scaled_mtx->scale(gko::initialize<Dense>({2.0}, this->exec));
+    auto factors =
+        this->ilu_factory_skip->generate(gko::share(std::move(scaled_mtx)));
+
+    factors->update_values(this->mtx_big);
+    auto l_factor = factors->get_l_factor();
+    auto u_factor = factors->get_u_factor();
+
+    GKO_ASSERT_MTX_NEAR(l_factor, this->big_l_expected, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(u_factor, this->big_u_expected, r<value_type>::value);
+}
+
+
+TYPED_TEST(Ilu, UpdateValuesForDenseBigWithChangedValues)
+{
+    using Dense = typename TestFixture::Dense;
+    using value_type = typename TestFixture::value_type;
+    // same sparsity pattern as mtx_big, but with independently changed values
+    auto new_mtx = gko::share(gko::initialize<Dense>(
+        {{2., 1., 1., 0., 1., 3.},
+         {1., 4., 2., 0., 2., 0.},
+         {0., -2., 3., 3., 3., 5.},
+         {1., 0., 3., 6., 4., 4.},
+         {1., 2., 0., -4., 5., 6.},
+         {0., 2., 1., 4., 5., 9.}},
+        this->exec));
+    auto factors = this->ilu_factory_skip->generate(this->mtx_big);
+    auto expected = this->ilu_factory_skip->generate(new_mtx);
+
+    factors->update_values(new_mtx);
+
+    GKO_ASSERT_MTX_NEAR(factors->get_l_factor(), expected->get_l_factor(),
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(factors->get_u_factor(), expected->get_u_factor(),
+                        r<value_type>::value);
+}
+
 TYPED_TEST(Ilu, GenerateForDenseBigSort)
 {
     using value_type = typename TestFixture::value_type;
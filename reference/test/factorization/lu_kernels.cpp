@@ -329,3 +329,63 @@ TYPED_TEST(Lu, FactorizeWithKnownSparsityWorks)
         ASSERT_EQ(lu->get_diagonal(), nullptr);
     });
 }
+
+
+TYPED_TEST(Lu, UpdateValuesWorks)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    this->forall_matrices([this] {
+        auto scaled_mtx = gko::clone(this->ref, this->mtx);
+        scaled_mtx->scale(
+            gko::initialize<gko::matrix::Dense<value_type>>({2.0}, this->ref));
+        auto lu = gko::experimental::factorization::Lu<value_type,
+                                                       index_type>::build()
+                      .on(this->ref)
+                      ->generate(gko::share(std::move(scaled_mtx)));
+
+        lu->update_values(this->mtx);
+
+        GKO_ASSERT_MTX_EQ_SPARSITY(lu->get_combined(), this->mtx_lu);
+        GKO_ASSERT_MTX_NEAR(lu->get_combined(), this->mtx_lu,
+                            15 * r<value_type>::value);
+        ASSERT_EQ(lu->get_storage_type(),
+                  gko::experimental::factorization::storage_type::combined_lu);
+    });
+}
+
+
+TYPED_TEST(Lu, UpdateValuesWorksWithChangedPivots)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    this->forall_matrices([this] {
+        auto new_mtx = gko::clone(this->ref, this->mtx);
+        // strengthen the diagonal by a row-dependent factor, so the pivots
+        // change relative to each other
+        const auto row_ptrs = new_mtx->get_const_row_ptrs();
+        const auto col_idxs = new_mtx->get_const_col_idxs();
+        const auto values = new_mtx->get_values();
+        for (index_type row = 0;
+             row < static_cast<index_type>(new_mtx->get_size()[0]); row++) {
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                if (col_idxs[nz] == row) {
+                    values[nz] *= static_cast<value_type>(2 + row % 3);
+                }
+            }
+        }
+        auto shared_new_mtx = gko::share(std::move(new_mtx));
+        auto factory = gko::experimental::factorization::Lu<value_type,
+                                                            index_type>::build()
+                           .on(this->ref);
+        auto lu = factory->generate(this->mtx);
+        auto expected = factory->generate(shared_new_mtx);
+
+        lu->update_values(shared_new_mtx);
+
+        GKO_ASSERT_MTX_EQ_SPARSITY(lu->get_combined(),
+                                   expected->get_combined());
+        GKO_ASSERT_MTX_NEAR(lu->get_combined(), expected->get_combined(),
+                            r<value_type>::value);
+    });
+}
@@ -4,6 +4,7 @@
 
 #include "core/multigrid/pgm_kernels.hpp"
 
+#include <algorithm>
 #include <memory>
 
 #include <gtest/gtest.h>
@@ -22,6 +23,8 @@
 #include <ginkgo/core/stop/residual_norm.hpp>
 #include <ginkgo/core/stop/time.hpp>
 
+#include "core/components/prefix_sum_kernels.hpp"
+#include "core/multigrid/spectral_radius.hpp"
 #include "core/test/utils.hpp"
 
 
@@ -171,6 +174,34 @@ protected:
         }
     }
 
+    /*
+     * Returns the prolongation T - omega D^-1 A T of the aggregates of mtx,
+     * where D^-1 A T is
+     *  2/5 -3/5
+     * -4/5  3/5
+     *  1/5  0
+     *  0    2/5
+     *  3/5 -2/5
+     */
+    std::shared_ptr<Mtx> create_smoothed_prolong(double omega)
+    {
+        auto prolong = gko::share(Mtx::create(exec));
+        prolong->read({{5, 2},
+                       {{0, 0, 1.0 - omega * 2.0 / 5.0},
+                        {0, 1, omega * 3.0 / 5.0},
+                        {1, 0, omega * 4.0 / 5.0},
+                        {1, 1, 1.0 - omega * 3.0 / 5.0},
+                        {2, 0, 1.0 - omega / 5.0},
+                        {3, 1, 1.0 - omega * 2.0 / 5.0},
+                        {4, 0, 1.0 - omega * 3.0 / 5.0},
+                        {4, 1, omega * 2.0 / 5.0}}});
+        return prolong;
+    }
+
+    // spectral radius of D^-1 A for mtx, computed by a converged power
+    // iteration in extended precision
+    static constexpr double scaled_mtx_radius = 2.0080030605308967;
+
     std::shared_ptr<const gko::ReferenceExecutor> exec;
     std::shared_ptr<Mtx> mtx;
     std::shared_ptr<Mtx> coarse;
@@ -494,6 +525,74 @@ TYPED_TEST(Pgm, AssignToExistAgg)
 }
 
 
+TYPED_TEST(Pgm, ComputesGalerkinProduct)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using Mtx = typename TestFixture::Mtx;
+    // fine rows of the aggregates 0-2-4 and 1-3
+    gko::array<index_type> agg_ptrs{this->exec, {0, 3, 5}};
+    gko::array<index_type> agg_rows{this->exec, {0, 2, 4, 1, 3}};
+    gko::array<index_type> row_ptrs{this->exec, 3};
+    gko::array<index_type> nz_map{this->exec, 15};
+    auto coarse = Mtx::create(this->exec, gko::dim<2>{2, 2}, 4);
+
+    gko::kernels::reference::pgm::galerkin_count(
+        this->exec, 2, agg_ptrs.get_const_data(), agg_rows.get_const_data(),
+        this->mtx->get_const_row_ptrs(), this->mtx->get_const_col_idxs(),
+        this->agg.get_const_data(), 2, row_ptrs.get_data());
+    gko::kernels::reference::components::prefix_sum_nonnegative(
+        this->exec, row_ptrs.get_data(), 3);
+    std::copy_n(row_ptrs.get_const_data(), 3, coarse->get_row_ptrs());
+    gko::kernels::reference::pgm::galerkin_fill(
+        this->exec, 2, agg_ptrs.get_const_data(), agg_rows.get_const_data(),
+        this->mtx->get_const_row_ptrs(), this->mtx->get_const_col_idxs(),
+        this->agg.get_const_data(), 2, coarse->get_const_row_ptrs(),
+        coarse->get_col_idxs(), nz_map.get_data());
+    gko::kernels::reference::pgm::galerkin_numeric(
+        this->exec, 2, agg_ptrs.get_const_data(), agg_rows.get_const_data(),
+        this->mtx->get_const_row_ptrs(), this->mtx->get_const_values(),
+        nz_map.get_const_data(), coarse->get_const_row_ptrs(),
+        coarse->get_values());
+
+    GKO_ASSERT_ARRAY_EQ(row_ptrs, I<index_type>({0, 2, 4}));
+    GKO_ASSERT_ARRAY_EQ(nz_map, I<index_type>({0, 1, 0, 2, 3, 3, 2, 0, 0, 0,
+                                               3, 3, 1, 0, 0}));
+    GKO_ASSERT_MTX_NEAR(coarse, this->coarse, r<value_type>::value);
+}
+
+
+TYPED_TEST(Pgm, FiltersProlongation)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using real_type = typename TestFixture::real_type;
+    using Mtx = typename TestFixture::Mtx;
+    auto prolong = gko::initialize<Mtx>({{1.0, 0.1, -0.5},
+                                         {0.0, 0.5, 0.5},
+                                         {-0.05, 0.0, 0.75}},
+                                        this->exec);
+    auto expected = gko::initialize<Mtx>(
+        {{1.2, 0.0, -0.6}, {0.0, 0.5, 0.5}, {0.0, 0.0, 0.7}}, this->exec);
+    gko::array<index_type> row_ptrs{this->exec, 4};
+
+    gko::kernels::reference::pgm::filter_prolongation_count(
+        this->exec, prolong.get(), real_type{0.2}, row_ptrs.get_data());
+    gko::kernels::reference::components::prefix_sum_nonnegative(
+        this->exec, row_ptrs.get_data(), 4);
+    auto filtered = Mtx::create(this->exec, gko::dim<2>{3, 3},
+                                gko::array<value_type>{this->exec, 5},
+                                gko::array<index_type>{this->exec, 5},
+                                row_ptrs);
+    gko::kernels::reference::pgm::filter_prolongation_fill(
+        this->exec, prolong.get(), real_type{0.2}, filtered.get());
+
+    GKO_ASSERT_ARRAY_EQ(row_ptrs, I<index_type>({0, 2, 4, 5}));
+    GKO_ASSERT_MTX_EQ_SPARSITY(filtered, expected);
+    GKO_ASSERT_MTX_NEAR(filtered, expected, r<value_type>::value);
+}
+
+
 TYPED_TEST(Pgm, GenerateMgLevel)
 {
     using value_type = typename TestFixture::value_type;
@@ -572,4 +671,224 @@ TYPED_TEST(Pgm, GenerateMgLevelOnUnsortedMatrix)
 }
 
 
+TYPED_TEST(Pgm, UpdateValuesKeepsAggregation)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using Mtx = typename TestFixture::Mtx;
+    using Vec = typename TestFixture::Vec;
+    auto scale = gko::initialize<Vec>({2.0}, this->exec);
+    auto scaled_mtx = gko::share(gko::clone(this->exec, this->mtx));
+    scaled_mtx->scale(scale);
+    auto expected_coarse = gko::clone(this->exec, this->coarse);
+    expected_coarse->scale(scale);
+
+    this->mg_level->update_values(scaled_mtx);
+
+    auto agg_view = gko::array<index_type>::const_view(
+        this->exec, 5, this->mg_level->get_const_agg());
+    GKO_ASSERT_ARRAY_EQ(agg_view, this->agg);
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(this->mg_level->get_fine_op()),
+                        scaled_mtx, 0.0);
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(this->mg_level->get_coarse_op()),
+                        expected_coarse, r<value_type>::value);
+}
+
+
+TYPED_TEST(Pgm, UpdateValuesWithChangedValuesKeepsAggregation)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using Mtx = typename TestFixture::Mtx;
+    /* same sparsity pattern as mtx with independently changed values:
+     *  6 -1 -2  0  0
+     * -2  4  0 -1 -3
+     * -1  0  7  0 -2
+     *  0 -4  0  3  0
+     *  0 -1 -3  0  8
+     */
+    auto new_mtx = gko::share(Mtx::create(this->exec));
+    new_mtx->read({{5, 5},
+                   {{0, 0, 6},
+                    {0, 1, -1},
+                    {0, 2, -2},
+                    {1, 0, -2},
+                    {1, 1, 4},
+                    {1, 3, -1},
+                    {1, 4, -3},
+                    {2, 0, -1},
+                    {2, 2, 7},
+                    {2, 4, -2},
+                    {3, 1, -4},
+                    {3, 3, 3},
+                    {4, 1, -1},
+                    {4, 2, -3},
+                    {4, 4, 8}}});
+    // sums of the entries coupling the aggregates {0, 2, 4} and {1, 3}
+    auto expected_coarse = Mtx::create(this->exec);
+    expected_coarse->read(
+        {{2, 2}, {{0, 0, 13}, {0, 1, -2}, {1, 0, -5}, {1, 1, 2}}});
+
+    this->mg_level->update_values(new_mtx);
+
+    auto agg_view = gko::array<index_type>::const_view(
+        this->exec, 5, this->mg_level->get_const_agg());
+    GKO_ASSERT_ARRAY_EQ(agg_view, this->agg);
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(this->mg_level->get_fine_op()), new_mtx,
+                        0.0);
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(this->mg_level->get_coarse_op()),
+                        expected_coarse, r<value_type>::value);
+}
+
+TYPED_TEST(Pgm, UpdateValuesThrowsOnDifferentSize)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto other_mtx = gko::share(Mtx::create(this->exec, gko::dim<2>{4, 4}));
+
+    ASSERT_THROW(this->mg_level->update_values(other_mtx),
+                 gko::DimensionMismatch);
+}
+
+
+TYPED_TEST(Pgm, UpdateValuesThrowsOnDifferentNumberOfEntries)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using Mtx = typename TestFixture::Mtx;
+    auto data = gko::matrix_data<value_type, index_type>{};
+    this->mtx->write(data);
+    data.nonzeros.pop_back();
+    auto other_mtx = gko::share(Mtx::create(this->exec));
+    other_mtx->read(data);
+
+    ASSERT_THROW(this->mg_level->update_values(other_mtx),
+                 gko::ValueMismatch);
+    ASSERT_EQ(this->mg_level->get_system_matrix(), this->mtx);
+}
+
+
+TYPED_TEST(Pgm, EstimatesSpectralRadius)
+{
+    using value_type = typename TestFixture::value_type;
+    using Mtx = typename TestFixture::Mtx;
+    // the eigenvalues are 3 and 0, and the first iteration already lies in
+    // the eigenspace of 3
+    auto rank_one = gko::initialize<Mtx>(
+        {{1.0, 1.0, 1.0}, {1.0, 1.0, 1.0}, {1.0, 1.0, 1.0}}, this->exec);
+    auto diagonal = gko::initialize<Mtx>(
+        {{1.0, 0.0, 0.0}, {0.0, -4.0, 0.0}, {0.0, 0.0, 2.0}}, this->exec);
+    auto zero_mtx = Mtx::create(this->exec, gko::dim<2>{3, 3});
+
+    auto rank_one_radius =
+        gko::detail::estimate_spectral_radius<value_type>(
+            rank_one.get(), 2);
+    auto diagonal_radius =
+        gko::detail::estimate_spectral_radius<value_type>(
+            diagonal.get(), 50);
+    auto zero_radius =
+        gko::detail::estimate_spectral_radius<value_type>(
+            zero_mtx.get(), 5);
+    auto no_iteration_radius =
+        gko::detail::estimate_spectral_radius<value_type>(
+            diagonal.get(), 0);
+
+    ASSERT_NEAR(rank_one_radius, 3.0, r<value_type>::value);
+    ASSERT_NEAR(diagonal_radius, 4.0, r<value_type>::value);
+    ASSERT_EQ(zero_radius, 0.0);
+    ASSERT_EQ(no_iteration_radius, 0.0);
+}
+
+
+TYPED_TEST(Pgm, GenerateSmoothedMgLevel)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using Mtx = typename TestFixture::Mtx;
+    using MgLevel = typename TestFixture::MgLevel;
+    auto factory = MgLevel::build()
+                       .with_max_iterations(2u)
+                       .with_max_unassigned_ratio(0.1)
+                       .with_skip_sorting(true)
+                       .with_smoothed_aggregation(true)
+                       .with_num_estimation_iterations(100u)
+                       .on(this->exec);
+
+    auto coarse_fine = factory->generate(this->mtx);
+
+    auto prolong = gko::as<Mtx>(coarse_fine->get_prolong_op());
+    auto restrict_op = gko::as<Mtx>(coarse_fine->get_restrict_op());
+    auto agg_view = gko::array<index_type>::const_view(
+        this->exec, 5, coarse_fine->get_const_agg());
+    auto expected_prolong =
+        this->create_smoothed_prolong(4.0 / 3.0 / this->scaled_mtx_radius);
+    auto fine_prolong = Mtx::create(this->exec, gko::dim<2>{5, 2});
+    this->mtx->apply(expected_prolong, fine_prolong);
+    auto expected_coarse = Mtx::create(this->exec, gko::dim<2>{2, 2});
+    gko::as<Mtx>(expected_prolong->conj_transpose())
+        ->apply(fine_prolong, expected_coarse);
+    GKO_ASSERT_ARRAY_EQ(agg_view, this->agg);
+    // the pattern of (I + D^-1 A) T
+    ASSERT_EQ(prolong->get_num_stored_elements(), 8);
+    GKO_ASSERT_MTX_NEAR(prolong, expected_prolong, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(restrict_op, gko::as<Mtx>(prolong->conj_transpose()),
+                        0.0);
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(coarse_fine->get_coarse_op()),
+                        expected_coarse, r<value_type>::value);
+}
+
+
+TYPED_TEST(Pgm, GenerateSmoothedMgLevelWithRelaxation)
+{
+    using value_type = typename TestFixture::value_type;
+    using Mtx = typename TestFixture::Mtx;
+    using MgLevel = typename TestFixture::MgLevel;
+    auto factory = MgLevel::build()
+                       .with_max_iterations(2u)
+                       .with_max_unassigned_ratio(0.1)
+                       .with_skip_sorting(true)
+                       .with_smoothed_aggregation(true)
+                       .with_smoothing_relaxation(0.5)
+                       .with_num_estimation_iterations(100u)
+                       .on(this->exec);
+
+    auto coarse_fine = factory->generate(this->mtx);
+
+    GKO_ASSERT_MTX_NEAR(
+        gko::as<Mtx>(coarse_fine->get_prolong_op()),
+        this->create_smoothed_prolong(0.5 / this->scaled_mtx_radius),
+        r<value_type>::value);
+}
+
+
+TYPED_TEST(Pgm, UpdateValuesResmoothsProlongation)
+{
+    using value_type = typename TestFixture::value_type;
+    using Mtx = typename TestFixture::Mtx;
+    using Vec = typename TestFixture::Vec;
+    using MgLevel = typename TestFixture::MgLevel;
+    auto factory = MgLevel::build()
+                       .with_max_iterations(2u)
+                       .with_max_unassigned_ratio(0.1)
+                       .with_skip_sorting(true)
+                       .with_smoothed_aggregation(true)
+                       .on(this->exec);
+    auto coarse_fine = factory->generate(this->mtx);
+    auto prolong = gko::clone(gko::as<Mtx>(coarse_fine->get_prolong_op()));
+    auto expected_coarse =
+        gko::clone(gko::as<Mtx>(coarse_fine->get_coarse_op()));
+    // D^-1 A and therefore the prolongation does not change under scaling
+    auto scale = gko::initialize<Vec>({2.0}, this->exec);
+    auto scaled_mtx = gko::share(gko::clone(this->exec, this->mtx));
+    scaled_mtx->scale(scale);
+    expected_coarse->scale(scale);
+
+    coarse_fine->update_values(scaled_mtx);
+
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(coarse_fine->get_prolong_op()), prolong,
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(coarse_fine->get_coarse_op()),
+                        expected_coarse, r<value_type>::value);
+}
+
+
 }  // namespace
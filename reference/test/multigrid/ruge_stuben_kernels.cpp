@@ -0,0 +1,311 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/multigrid/ruge_stuben.hpp>
+
+#include "core/multigrid/ruge_stuben_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class RugeStuben : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::Csr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+    using MgLevel = gko::multigrid::RugeStuben<value_type, index_type>;
+    using real_type = gko::remove_complex<value_type>;
+    RugeStuben()
+        : exec(gko::ReferenceExecutor::create()),
+          // the 1D Laplacian
+          mtx(gko::initialize<Mtx>({{2.0, -1.0, 0.0, 0.0, 0.0},
+                                    {-1.0, 2.0, -1.0, 0.0, 0.0},
+                                    {0.0, -1.0, 2.0, -1.0, 0.0},
+                                    {0.0, 0.0, -1.0, 2.0, -1.0},
+                                    {0.0, 0.0, 0.0, -1.0, 2.0}},
+                                   exec)),
+          strong_row_ptrs(exec, {0, 1, 3, 5, 7, 8}),
+          strong_col_idxs(exec, {1, 0, 2, 1, 3, 2, 4, 3}),
+          splitting(exec, {0, 1, 0, 1, 0}),
+          // a splitting with neighboring fine points
+          sparse_splitting(exec, {1, 0, 0, 1, 0}),
+          sparse_coarse_map(exec, {0, 1, 1, 1, 2, 2})
+    {}
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::shared_ptr<Mtx> mtx;
+    gko::array<index_type> strong_row_ptrs;
+    gko::array<index_type> strong_col_idxs;
+    gko::array<index_type> splitting;
+    gko::array<index_type> sparse_splitting;
+    gko::array<index_type> sparse_coarse_map;
+};
+
+TYPED_TEST_SUITE(RugeStuben, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(RugeStuben, ComputesStrongConnections)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using index_type = typename TestFixture::index_type;
+    using real_type = typename TestFixture::real_type;
+    // the last row has a negative diagonal
+    auto mtx = gko::initialize<Mtx>({{4.0, -1.0, -0.1, 0.5},
+                                     {-1.0, 4.0, -1.0, 0.0},
+                                     {-0.1, -1.0, 4.0, -2.0},
+                                     {0.5, 0.0, -2.0, -4.0}},
+                                    this->exec);
+    gko::array<index_type> row_nnz(this->exec, 5);
+    gko::array<index_type> row_ptrs(this->exec, {0, 1, 3, 5, 6});
+    gko::array<index_type> col_idxs(this->exec, 6);
+
+    gko::kernels::reference::ruge_stuben::compute_strong_count(
+        this->exec, mtx.get(), real_type{0.25}, row_nnz.get_data());
+    gko::kernels::reference::ruge_stuben::compute_strong_fill(
+        this->exec, mtx.get(), real_type{0.25}, row_ptrs.get_const_data(),
+        col_idxs.get_data());
+
+    GKO_ASSERT_ARRAY_EQ(
+        gko::array<index_type>::const_view(this->exec, 4,
+                                           row_nnz.get_const_data()),
+        gko::array<index_type>(this->exec, {1, 2, 2, 1}));
+    GKO_ASSERT_ARRAY_EQ(col_idxs,
+                        gko::array<index_type>(this->exec, {1, 0, 2, 1, 3, 0}));
+}
+
+
+TYPED_TEST(RugeStuben, PmisSplitsLaplacian)
+{
+    using index_type = typename TestFixture::index_type;
+    using MgLevel = typename TestFixture::MgLevel;
+    auto factory = MgLevel::build().with_skip_sorting(true).on(this->exec);
+
+    auto coarse_fine = factory->generate(this->mtx);
+
+    auto splitting_view = gko::array<index_type>::const_view(
+        this->exec, 5, coarse_fine->get_const_cf_splitting());
+    GKO_ASSERT_ARRAY_EQ(splitting_view, this->splitting);
+}
+
+
+TYPED_TEST(RugeStuben, HmisSplitsLaplacian)
+{
+    using index_type = typename TestFixture::index_type;
+    using MgLevel = typename TestFixture::MgLevel;
+    auto factory = MgLevel::build()
+                       .with_splitting(gko::multigrid::splitting_type::hmis)
+                       .with_skip_sorting(true)
+                       .on(this->exec);
+
+    auto coarse_fine = factory->generate(this->mtx);
+
+    auto splitting_view = gko::array<index_type>::const_view(
+        this->exec, 5, coarse_fine->get_const_cf_splitting());
+    GKO_ASSERT_ARRAY_EQ(splitting_view, this->splitting);
+}
+
+
+TYPED_TEST(RugeStuben, ComputesDirectInterpolation)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    gko::array<index_type> row_nnz(this->exec, 5);
+    auto prolong = Mtx::create(
+        this->exec, gko::dim<2>{5, 2}, gko::array<value_type>(this->exec, 5),
+        gko::array<index_type>(this->exec, 5),
+        gko::array<index_type>(this->exec, {0, 1, 2, 3, 4, 5}));
+
+    gko::kernels::reference::ruge_stuben::direct_interpolation_count(
+        this->exec, 5, this->strong_row_ptrs.get_const_data(),
+        this->strong_col_idxs.get_const_data(),
+        this->sparse_splitting.get_const_data(), row_nnz.get_data());
+    gko::kernels::reference::ruge_stuben::direct_interpolation_fill(
+        this->exec, this->mtx.get(), this->strong_row_ptrs.get_const_data(),
+        this->strong_col_idxs.get_const_data(),
+        this->sparse_splitting.get_const_data(),
+        this->sparse_coarse_map.get_const_data(), prolong.get());
+
+    GKO_ASSERT_ARRAY_EQ(row_nnz,
+                        gko::array<index_type>(this->exec, {1, 1, 1, 1, 1}));
+    // the connections to fine neighbors are distributed to the only
+    // interpolatory point
+    GKO_ASSERT_MTX_NEAR(prolong,
+                        l({{1.0, 0.0},
+                           {1.0, 0.0},
+                           {0.0, 1.0},
+                           {0.0, 1.0},
+                           {0.0, 0.5}}),
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(RugeStuben, ComputesExtendedIInterpolation)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    gko::array<index_type> row_nnz(this->exec, 5);
+    auto prolong = Mtx::create(
+        this->exec, gko::dim<2>{5, 2}, gko::array<value_type>(this->exec, 7),
+        gko::array<index_type>(this->exec, 7),
+        gko::array<index_type>(this->exec, {0, 1, 3, 5, 6, 7}));
+
+    gko::kernels::reference::ruge_stuben::extended_i_interpolation_count(
+        this->exec, 5, this->strong_row_ptrs.get_const_data(),
+        this->strong_col_idxs.get_const_data(),
+        this->sparse_splitting.get_const_data(), row_nnz.get_data());
+    gko::kernels::reference::ruge_stuben::extended_i_interpolation_fill(
+        this->exec, this->mtx.get(), this->strong_row_ptrs.get_const_data(),
+        this->strong_col_idxs.get_const_data(),
+        this->sparse_splitting.get_const_data(),
+        this->sparse_coarse_map.get_const_data(), prolong.get());
+
+    GKO_ASSERT_ARRAY_EQ(row_nnz,
+                        gko::array<index_type>(this->exec, {1, 2, 2, 1, 1}));
+    // the fine points in between two coarse points are interpolated linearly
+    GKO_ASSERT_MTX_NEAR(prolong,
+                        l({{1.0, 0.0},
+                           {2.0 / 3.0, 1.0 / 3.0},
+                           {1.0 / 3.0, 2.0 / 3.0},
+                           {0.0, 1.0},
+                           {0.0, 0.5}}),
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(RugeStuben, GenerateMgLevel)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using MgLevel = typename TestFixture::MgLevel;
+    auto factory = MgLevel::build().with_skip_sorting(true).on(this->exec);
+
+    auto coarse_fine = factory->generate(this->mtx);
+
+    auto prolong = gko::as<Mtx>(coarse_fine->get_prolong_op());
+    auto restrict_op = gko::as<Mtx>(coarse_fine->get_restrict_op());
+    GKO_ASSERT_MTX_NEAR(prolong,
+                        l({{0.5, 0.0},
+                           {1.0, 0.0},
+                           {0.5, 0.5},
+                           {0.0, 1.0},
+                           {0.0, 0.5}}),
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(restrict_op, gko::as<Mtx>(prolong->conj_transpose()),
+                        0.0);
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(coarse_fine->get_coarse_op()),
+                        l({{1.0, -0.5}, {-0.5, 1.0}}), r<value_type>::value);
+}
+
+
+TYPED_TEST(RugeStuben, GenerateMgLevelWithExtendedIInterpolation)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using MgLevel = typename TestFixture::MgLevel;
+    auto factory =
+        MgLevel::build()
+            .with_interpolation(gko::multigrid::interpolation_type::extended_i)
+            .with_skip_sorting(true)
+            .on(this->exec);
+
+    auto coarse_fine = factory->generate(this->mtx);
+
+    // with strong coarse neighbors only, it reduces to direct interpolation
+    auto prolong = gko::as<Mtx>(coarse_fine->get_prolong_op());
+    GKO_ASSERT_MTX_NEAR(prolong,
+                        l({{0.5, 0.0},
+                           {1.0, 0.0},
+                           {0.5, 0.5},
+                           {0.0, 1.0},
+                           {0.0, 0.5}}),
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(coarse_fine->get_coarse_op()),
+                        l({{1.0, -0.5}, {-0.5, 1.0}}), r<value_type>::value);
+}
+
+
+TYPED_TEST(RugeStuben, UpdateValuesKeepsSplitting)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using MgLevel = typename TestFixture::MgLevel;
+    auto factory = MgLevel::build().with_skip_sorting(true).on(this->exec);
+    auto coarse_fine = factory->generate(this->mtx);
+    auto scaled = gko::share(gko::clone(this->mtx));
+    scaled->scale(gko::initialize<Vec>({2.0}, this->exec));
+
+    coarse_fine->update_values(scaled);
+
+    auto splitting_view = gko::array<index_type>::const_view(
+        this->exec, 5, coarse_fine->get_const_cf_splitting());
+    GKO_ASSERT_ARRAY_EQ(splitting_view, this->splitting);
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(coarse_fine->get_prolong_op()),
+                        l({{0.5, 0.0},
+                           {1.0, 0.0},
+                           {0.5, 0.5},
+                           {0.0, 1.0},
+                           {0.0, 0.5}}),
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(coarse_fine->get_coarse_op()),
+                        l({{2.0, -1.0}, {-1.0, 2.0}}), r<value_type>::value);
+}
+
+
+TYPED_TEST(RugeStuben, UpdateValuesWithChangedStrongConnections)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using MgLevel = typename TestFixture::MgLevel;
+    auto factory = MgLevel::build().with_skip_sorting(true).on(this->exec);
+    auto coarse_fine = factory->generate(this->mtx);
+    // the connection from 2 to 3 becomes weak, so the fine point 2 only
+    // interpolates from 1
+    auto new_mtx =
+        gko::share(gko::initialize<Mtx>({{4.0, -1.0, 0.0, 0.0, 0.0},
+                                         {-1.0, 5.0, -2.0, 0.0, 0.0},
+                                         {0.0, -2.0, 3.0, -0.25, 0.0},
+                                         {0.0, 0.0, -1.0, 4.0, -0.5},
+                                         {0.0, 0.0, 0.0, -3.0, 2.0}},
+                                        this->exec));
+
+    coarse_fine->update_values(new_mtx);
+
+    auto splitting_view = gko::array<index_type>::const_view(
+        this->exec, 5, coarse_fine->get_const_cf_splitting());
+    GKO_ASSERT_ARRAY_EQ(splitting_view, this->splitting);
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(coarse_fine->get_prolong_op()),
+                        l({{0.25, 0.0},
+                           {1.0, 0.0},
+                           {0.75, 0.0},
+                           {0.0, 1.0},
+                           {0.0, 1.5}}),
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(coarse_fine->get_coarse_op()),
+                        l({{3.4375, -0.1875}, {-0.75, 3.25}}),
+                        r<value_type>::value);
+}
+
+
+}  // namespace
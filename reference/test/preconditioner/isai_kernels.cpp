@@ -1572,6 +1572,83 @@ TYPED_TEST(Isai, ReturnsConjTransposedCorrectInverseSpd)
 }
 
 
+TYPED_TEST(Isai, UpdatesValuesOfInverseA)
+{
+    using GeneralIsai = typename TestFixture::GeneralIsai;
+    using Dense = typename TestFixture::Dense;
+    using value_type = typename TestFixture::value_type;
+    auto factory = GeneralIsai::build().with_sparsity_power(2).on(this->exec);
+    auto scaled_mtx = gko::clone(this->exec, this->a_sparse);
+    scaled_mtx->scale(gko::initialize<Dense>({2.0}, this->exec));
+    const auto expected = factory->generate(this->a_sparse);
+    auto isai = factory->generate(gko::share(std::move(scaled_mtx)));
+
+    isai->update_values(this->a_sparse);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(isai->get_approximate_inverse(),
+                               expected->get_approximate_inverse());
+    GKO_ASSERT_MTX_NEAR(isai->get_approximate_inverse(),
+                        expected->get_approximate_inverse(),
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(Isai, UpdatesValuesOfInverseALongrowWithChangedCouplings)
+{
+    using GeneralIsai = typename TestFixture::GeneralIsai;
+    using index_type = typename TestFixture::index_type;
+    using value_type = typename TestFixture::value_type;
+    auto factory = GeneralIsai::build().on(this->exec);
+    auto new_mtx = gko::clone(this->exec, this->a_csr_longrow);
+    // weaken the off-diagonal couplings by an entry-dependent factor, which
+    // also changes the excess system of the long row
+    const auto row_ptrs = new_mtx->get_const_row_ptrs();
+    const auto col_idxs = new_mtx->get_const_col_idxs();
+    const auto values = new_mtx->get_values();
+    for (index_type row = 0;
+         row < static_cast<index_type>(new_mtx->get_size()[0]); row++) {
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            const auto col = col_idxs[nz];
+            if (col != row) {
+                values[nz] /= static_cast<value_type>(1 + (row + col) % 3);
+            }
+        }
+    }
+    auto shared_new_mtx = gko::share(std::move(new_mtx));
+    auto isai = factory->generate(this->a_csr_longrow);
+    const auto expected = factory->generate(shared_new_mtx);
+
+    isai->update_values(shared_new_mtx);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(isai->get_approximate_inverse(),
+                               expected->get_approximate_inverse());
+    GKO_ASSERT_MTX_NEAR(isai->get_approximate_inverse(),
+                        expected->get_approximate_inverse(),
+                        r<value_type>::value);
+}
+
+TYPED_TEST(Isai, UpdatesValuesOfInverseSpd)
+{
+    using Csr = typename TestFixture::Csr;
+    using Dense = typename TestFixture::Dense;
+    using value_type = typename TestFixture::value_type;
+    auto scaled_mtx = gko::clone(this->exec, this->spd_sparse);
+    scaled_mtx->scale(gko::initialize<Dense>({2.0}, this->exec));
+    auto isai =
+        this->spd_isai_factory->generate(gko::share(std::move(scaled_mtx)));
+
+    isai->update_values(this->spd_sparse);
+
+    const auto expected_transpose =
+        gko::as<Csr>(this->spd_sparse_inv->transpose());
+    const auto composition = isai->get_approximate_inverse()->get_operators();
+    const auto lower_t = gko::as<Csr>(composition[0]);
+    const auto lower = gko::as<Csr>(composition[1]);
+    GKO_ASSERT_MTX_NEAR(lower, this->spd_sparse_inv, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(lower_t, expected_transpose, r<value_type>::value);
+}
+
+
 TYPED_TEST(Isai, IsExactInverseOnFullSparsitySet)
 {
     using Isai = typename TestFixture::GeneralIsai;
@@ -514,4 +514,85 @@ TYPED_TEST(Jacobi, ScalarJacobiHandleZero)
 }
 
 
+TYPED_TEST(Jacobi, UpdatesValuesWithDetectedBlocks)
+{
+    using Bj = typename TestFixture::Bj;
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    auto factory = Bj::build().with_max_block_size(3u).on(this->exec);
+    auto scaled_mtx = gko::clone(this->exec, this->mtx);
+    scaled_mtx->scale(gko::initialize<Vec>({2.0}, this->exec));
+    const auto expected = factory->generate(this->mtx);
+    auto jacobi = factory->generate(gko::share(std::move(scaled_mtx)));
+    auto expected_dense = Vec::create(this->exec);
+    auto result_dense = Vec::create(this->exec);
+
+    jacobi->update_values(this->mtx);
+
+    ASSERT_EQ(jacobi->get_num_blocks(), expected->get_num_blocks());
+    expected->convert_to(expected_dense);
+    jacobi->convert_to(result_dense);
+    GKO_ASSERT_MTX_NEAR(result_dense, expected_dense, r<value_type>::value);
+}
+
+
+TYPED_TEST(Jacobi, UpdatesValuesWithAutodetectedPrecisions)
+{
+    using Bj = typename TestFixture::Bj;
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    auto factory =
+        Bj::build()
+            .with_max_block_size(17u)
+            .with_block_pointers(this->block_pointers)
+            .with_storage_optimization(gko::array<gko::precision_reduction>(
+                this->exec, {gko::precision_reduction::autodetect()}))
+            .with_accuracy(gko::remove_complex<value_type>{1.5e-3})
+            .on(this->exec);
+    // the first diagonal block becomes nearly singular, so it needs a more
+    // accurate storage precision than before
+    auto new_mtx = gko::clone(this->exec, this->mtx);
+    new_mtx->get_values()[3] = value_type{-2.0};
+    new_mtx->get_values()[4] = value_type{1.01};
+    auto shared_new_mtx = gko::share(std::move(new_mtx));
+    auto jacobi = factory->generate(this->mtx);
+    const auto old_precision =
+        jacobi->get_parameters()
+            .storage_optimization.block_wise.get_const_data()[0];
+    const auto expected = factory->generate(shared_new_mtx);
+    auto expected_dense = Vec::create(this->exec);
+    auto result_dense = Vec::create(this->exec);
+
+    jacobi->update_values(shared_new_mtx);
+
+    ASSERT_NE(jacobi->get_parameters()
+                  .storage_optimization.block_wise.get_const_data()[0],
+              old_precision);
+    this->assert_same_precond(jacobi, expected);
+    expected->convert_to(expected_dense);
+    jacobi->convert_to(result_dense);
+    GKO_ASSERT_MTX_NEAR(result_dense, expected_dense, r<value_type>::value);
+}
+
+
+TYPED_TEST(Jacobi, ScalarJacobiUpdatesValues)
+{
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    auto scaled_mtx = gko::clone(this->exec, this->mtx);
+    scaled_mtx->scale(gko::initialize<Vec>({2.0}, this->exec));
+    const auto expected = this->scalar_j_factory->generate(this->mtx);
+    auto jacobi =
+        this->scalar_j_factory->generate(gko::share(std::move(scaled_mtx)));
+    auto expected_dense = Vec::create(this->exec);
+    auto result_dense = Vec::create(this->exec);
+
+    jacobi->update_values(this->mtx);
+
+    expected->convert_to(expected_dense);
+    jacobi->convert_to(result_dense);
+    GKO_ASSERT_MTX_NEAR(result_dense, expected_dense, r<value_type>::value);
+}
+
+
 }  // namespace
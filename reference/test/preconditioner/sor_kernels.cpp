@@ -5,6 +5,7 @@
 #include "core/preconditioner/sor_kernels.hpp"
 
 #include <memory>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -12,6 +13,7 @@
 #include <ginkgo/core/base/exception.hpp>
 #include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/permutation.hpp>
 #include <ginkgo/core/preconditioner/sor.hpp>
 #include <ginkgo/core/solver/triangular.hpp>
 
@@ -202,3 +204,108 @@ TYPED_TEST(Sor, CanGenerateSymmetric)
         {this->diag_value}, this->exec));
     GKO_ASSERT_MTX_NEAR(result_u, expected_u, r<value_type>::value);
 }
+
+
+TYPED_TEST(Sor, ComputesMulticolorOrdering)
+{
+    using index_type = typename TestFixture::index_type;
+    using csr_type = typename TestFixture::csr_type;
+    auto transposed = gko::as<csr_type>(this->mtx->transpose());
+    gko::array<index_type> permutation{this->exec, 5};
+    gko::array<index_type> color_ptrs{this->exec};
+
+    gko::kernels::reference::sor::compute_multicolor_ordering(
+        this->exec, 5, this->mtx->get_const_row_ptrs(),
+        this->mtx->get_const_col_idxs(), transposed->get_const_row_ptrs(),
+        transposed->get_const_col_idxs(), permutation.get_data(), color_ptrs);
+
+    const auto perm = permutation.get_const_data();
+    const auto ptrs = color_ptrs.get_const_data();
+    const auto num_colors = static_cast<index_type>(color_ptrs.get_size()) - 1;
+    ASSERT_EQ(ptrs[0], 0);
+    ASSERT_EQ(ptrs[num_colors], 5);
+    std::vector<index_type> colors(5, -1);
+    for (index_type color = 0; color < num_colors; color++) {
+        ASSERT_LT(ptrs[color], ptrs[color + 1]);
+        for (auto i = ptrs[color]; i < ptrs[color + 1]; i++) {
+            ASSERT_EQ(colors[perm[i]], -1);
+            colors[perm[i]] = color;
+        }
+    }
+    for (index_type row = 0; row < 5; row++) {
+        for (auto nz = this->mtx->get_const_row_ptrs()[row];
+             nz < this->mtx->get_const_row_ptrs()[row + 1]; nz++) {
+            const auto col = this->mtx->get_const_col_idxs()[nz];
+            if (col != row) {
+                ASSERT_NE(colors[row], colors[col]);
+            }
+        }
+    }
+}
+
+
+TYPED_TEST(Sor, MulticolorIsSorOfReorderedMatrix)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using sor_type = typename TestFixture::sor_type;
+    using perm_type = gko::matrix::Permutation<index_type>;
+    using Dense = gko::matrix::Dense<value_type>;
+    auto b = gko::initialize<Dense>({1.0, -2.0, 3.0, 0.5, -1.0}, this->exec);
+    auto x = Dense::create(this->exec, gko::dim<2>{5, 1});
+    auto expected = Dense::create(this->exec, gko::dim<2>{5, 1});
+    auto sor_factory = sor_type::build().with_relaxation_factor(1.2f);
+
+    auto sor_pre =
+        sor_factory.with_multicolor(true).on(this->exec)->generate(this->mtx);
+
+    const auto& ops = sor_pre->get_operators();
+    ASSERT_EQ(ops.size(), 3);
+    GKO_ASSERT_DYNAMIC_TYPE(ops[0], perm_type);
+    GKO_ASSERT_DYNAMIC_TYPE(ops[2], perm_type);
+    auto perm = gko::as<perm_type>(ops[2]);
+    auto reordered_pre =
+        sor_factory.with_multicolor(false).on(this->exec)->generate(
+            this->mtx->permute(perm));
+    auto permuted_b = b->permute(perm, gko::matrix::permute_mode::rows);
+    auto permuted_x = permuted_b->clone();
+    reordered_pre->apply(permuted_b, permuted_x);
+    permuted_x->permute(perm, expected,
+                        gko::matrix::permute_mode::inverse_rows);
+    sor_pre->apply(b, x);
+    GKO_ASSERT_MTX_NEAR(x, expected, r<value_type>::value);
+}
+
+
+TYPED_TEST(Sor, SymmetricMulticolorIsSsorOfReorderedMatrix)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using sor_type = typename TestFixture::sor_type;
+    using perm_type = gko::matrix::Permutation<index_type>;
+    using Dense = gko::matrix::Dense<value_type>;
+    auto b = gko::initialize<Dense>({1.0, -2.0, 3.0, 0.5, -1.0}, this->exec);
+    auto x = Dense::create(this->exec, gko::dim<2>{5, 1});
+    auto expected = Dense::create(this->exec, gko::dim<2>{5, 1});
+    auto sor_factory =
+        sor_type::build().with_symmetric(true).with_relaxation_factor(1.2f);
+
+    auto sor_pre =
+        sor_factory.with_multicolor(true).on(this->exec)->generate(this->mtx);
+
+    const auto& ops = sor_pre->get_operators();
+    ASSERT_EQ(ops.size(), 4);
+    GKO_ASSERT_DYNAMIC_TYPE(ops[0], perm_type);
+    GKO_ASSERT_DYNAMIC_TYPE(ops[3], perm_type);
+    auto perm = gko::as<perm_type>(ops[3]);
+    auto reordered_pre =
+        sor_factory.with_multicolor(false).on(this->exec)->generate(
+            this->mtx->permute(perm));
+    auto permuted_b = b->permute(perm, gko::matrix::permute_mode::rows);
+    auto permuted_x = permuted_b->clone();
+    reordered_pre->apply(permuted_b, permuted_x);
+    permuted_x->permute(perm, expected,
+                        gko::matrix::permute_mode::inverse_rows);
+    sor_pre->apply(b, x);
+    GKO_ASSERT_MTX_NEAR(x, expected, r<value_type>::value);
+}
@@ -0,0 +1,240 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+
+#include "core/reorder/graph_partition.hpp"
+#include "core/reorder/graph_partition_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename IndexType>
+class GraphPartition : public ::testing::Test {
+protected:
+    using index_type = IndexType;
+
+    GraphPartition()
+        : ref(gko::ReferenceExecutor::create()),
+          // a path 0 - 1 = 2 - 3 = 4 - 5 with heavy edges marked by =
+          path_row_ptrs{ref, {0, 1, 3, 5, 7, 9, 10}},
+          path_col_idxs{ref, {1, 0, 2, 1, 3, 2, 4, 3, 5, 4}},
+          path_edge_weights{ref, {1, 1, 5, 5, 1, 1, 5, 5, 1, 1}},
+          path_vertex_weights{ref, {1, 1, 1, 1, 1, 1}},
+          row_ptrs{ref},
+          col_idxs{ref}
+    {}
+
+    // builds the 5-point stencil graph of a size x size grid
+    void build_grid(index_type size)
+    {
+        std::vector<index_type> ptrs{0};
+        std::vector<index_type> cols;
+        for (index_type y = 0; y < size; y++) {
+            for (index_type x = 0; x < size; x++) {
+                if (y > 0) {
+                    cols.push_back((y - 1) * size + x);
+                }
+                if (x > 0) {
+                    cols.push_back(y * size + x - 1);
+                }
+                if (x < size - 1) {
+                    cols.push_back(y * size + x + 1);
+                }
+                if (y < size - 1) {
+                    cols.push_back((y + 1) * size + x);
+                }
+                ptrs.push_back(cols.size());
+            }
+        }
+        row_ptrs = gko::array<index_type>{ref, ptrs.begin(), ptrs.end()};
+        col_idxs = gko::array<index_type>{ref, cols.begin(), cols.end()};
+    }
+
+    // builds two cliques of the given size connected by a single edge
+    void build_two_cliques(index_type size)
+    {
+        std::vector<index_type> ptrs{0};
+        std::vector<index_type> cols;
+        for (index_type i = 0; i < 2 * size; i++) {
+            const auto clique_begin = i < size ? 0 : size;
+            for (auto j = clique_begin; j < clique_begin + size; j++) {
+                if (j != i) {
+                    cols.push_back(j);
+                }
+            }
+            if (i == size - 1) {
+                cols.push_back(size);
+            } else if (i == size) {
+                cols.insert(cols.end() - (size - 1), size - 1);
+            }
+            ptrs.push_back(cols.size());
+        }
+        row_ptrs = gko::array<index_type>{ref, ptrs.begin(), ptrs.end()};
+        col_idxs = gko::array<index_type>{ref, cols.begin(), cols.end()};
+    }
+
+    index_type get_num_vertices() const
+    {
+        return static_cast<index_type>(row_ptrs.get_size() - 1);
+    }
+
+    index_type count_cut_edges(const gko::array<index_type>& parts) const
+    {
+        index_type cut{};
+        for (index_type row = 0; row < get_num_vertices(); row++) {
+            for (auto nz = row_ptrs.get_const_data()[row];
+                 nz < row_ptrs.get_const_data()[row + 1]; nz++) {
+                const auto col = col_idxs.get_const_data()[nz];
+                cut += parts.get_const_data()[row] !=
+                       parts.get_const_data()[col];
+            }
+        }
+        return cut / 2;
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> ref;
+    gko::array<index_type> path_row_ptrs;
+    gko::array<index_type> path_col_idxs;
+    gko::array<index_type> path_edge_weights;
+    gko::array<index_type> path_vertex_weights;
+    gko::array<index_type> row_ptrs;
+    gko::array<index_type> col_idxs;
+};
+
+TYPED_TEST_SUITE(GraphPartition, gko::test::IndexTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(GraphPartition, MatchesHeavyEdges)
+{
+    using index_type = typename TestFixture::index_type;
+    gko::array<index_type> match{this->ref, 6};
+
+    gko::kernels::reference::graph_partition::match_edges(
+        this->ref, index_type{6}, this->path_row_ptrs.get_const_data(),
+        this->path_col_idxs.get_const_data(),
+        this->path_edge_weights.get_const_data(),
+        this->path_vertex_weights.get_const_data(), index_type{2},
+        match.get_data());
+
+    GKO_ASSERT_ARRAY_EQ(match, I<index_type>({0, 2, 1, 4, 3, 5}));
+}
+
+
+TYPED_TEST(GraphPartition, MatchingRespectsMaxVertexWeight)
+{
+    using index_type = typename TestFixture::index_type;
+    gko::array<index_type> match{this->ref, 6};
+
+    gko::kernels::reference::graph_partition::match_edges(
+        this->ref, index_type{6}, this->path_row_ptrs.get_const_data(),
+        this->path_col_idxs.get_const_data(),
+        this->path_edge_weights.get_const_data(),
+        this->path_vertex_weights.get_const_data(), index_type{1},
+        match.get_data());
+
+    GKO_ASSERT_ARRAY_EQ(match, I<index_type>({0, 1, 2, 3, 4, 5}));
+}
+
+
+TYPED_TEST(GraphPartition, ContractsMatchedVertices)
+{
+    using index_type = typename TestFixture::index_type;
+    gko::array<index_type> match{this->ref, {0, 2, 1, 4, 3, 5}};
+    gko::array<index_type> coarse_map{this->ref, 6};
+    gko::array<index_type> coarse_row_ptrs{this->ref};
+    gko::array<index_type> coarse_col_idxs{this->ref};
+    gko::array<index_type> coarse_edge_weights{this->ref};
+    gko::array<index_type> coarse_vertex_weights{this->ref};
+
+    gko::kernels::reference::graph_partition::contract_graph(
+        this->ref, index_type{6}, this->path_row_ptrs.get_const_data(),
+        this->path_col_idxs.get_const_data(),
+        this->path_edge_weights.get_const_data(),
+        this->path_vertex_weights.get_const_data(), match.get_const_data(),
+        coarse_map.get_data(), coarse_row_ptrs, coarse_col_idxs,
+        coarse_edge_weights, coarse_vertex_weights);
+
+    GKO_ASSERT_ARRAY_EQ(coarse_map, I<index_type>({0, 1, 1, 2, 2, 3}));
+    GKO_ASSERT_ARRAY_EQ(coarse_row_ptrs, I<index_type>({0, 1, 3, 5, 6}));
+    GKO_ASSERT_ARRAY_EQ(coarse_col_idxs, I<index_type>({1, 0, 2, 1, 3, 2}));
+    GKO_ASSERT_ARRAY_EQ(coarse_edge_weights,
+                        I<index_type>({1, 1, 1, 1, 1, 1}));
+    GKO_ASSERT_ARRAY_EQ(coarse_vertex_weights, I<index_type>({1, 2, 2, 1}));
+}
+
+
+TYPED_TEST(GraphPartition, BisectsAtBridge)
+{
+    using index_type = typename TestFixture::index_type;
+    this->build_two_cliques(5);
+    gko::array<index_type> parts{this->ref, 10};
+
+    gko::experimental::reorder::graph_partition::partition_graph(
+        this->ref, this->get_num_vertices(), this->row_ptrs.get_const_data(),
+        this->col_idxs.get_const_data(), index_type{2}, parts.get_data());
+
+    ASSERT_EQ(this->count_cut_edges(parts), 1);
+    const auto p = parts.get_const_data();
+    ASSERT_TRUE(std::all_of(p, p + 5, [&](auto part) { return part == p[0]; }));
+    ASSERT_TRUE(
+        std::all_of(p + 5, p + 10, [&](auto part) { return part == p[5]; }));
+}
+
+
+TYPED_TEST(GraphPartition, PartitionsGridIntoBalancedParts)
+{
+    using index_type = typename TestFixture::index_type;
+    this->build_grid(32);
+    gko::array<index_type> parts{this->ref, 1024};
+
+    gko::experimental::reorder::graph_partition::partition_graph(
+        this->ref, this->get_num_vertices(), this->row_ptrs.get_const_data(),
+        this->col_idxs.get_const_data(), index_type{4}, parts.get_data());
+
+    std::vector<index_type> part_sizes(4);
+    for (index_type i = 0; i < 1024; i++) {
+        ASSERT_GE(parts.get_const_data()[i], 0);
+        ASSERT_LT(parts.get_const_data()[i], 4);
+        part_sizes[parts.get_const_data()[i]]++;
+    }
+    for (auto size : part_sizes) {
+        ASSERT_GE(size, 240);
+        ASSERT_LE(size, 272);
+    }
+    // four square blocks have a cut of 64 edges, stripes have 96
+    ASSERT_LE(this->count_cut_edges(parts), 96);
+}
+
+
+TYPED_TEST(GraphPartition, ComputesNestedDissectionPermutation)
+{
+    using index_type = typename TestFixture::index_type;
+    this->build_grid(16);
+    gko::array<index_type> permutation{this->ref, 256};
+
+    gko::experimental::reorder::graph_partition::nested_dissection(
+        this->ref, this->get_num_vertices(), this->row_ptrs.get_const_data(),
+        this->col_idxs.get_const_data(), index_type{8},
+        permutation.get_data());
+
+    std::vector<index_type> sorted(permutation.get_const_data(),
+                                   permutation.get_const_data() + 256);
+    std::sort(sorted.begin(), sorted.end());
+    for (index_type i = 0; i < 256; i++) {
+        ASSERT_EQ(sorted[i], i);
+    }
+}
+
+
+}  // namespace
@@ -8,7 +8,9 @@
 
 #include <ginkgo/core/base/exception.hpp>
 #include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/preconditioner/jacobi.hpp>
 #include <ginkgo/core/solver/cg.hpp>
 #include <ginkgo/core/stop/combined.hpp>
 #include <ginkgo/core/stop/iteration.hpp>
@@ -212,6 +214,103 @@ TYPED_TEST(Cg, KernelStep2DivByZero)
 }
 
 
+TYPED_TEST(Cg, KernelFusedStep1)
+{
+    using value_type = typename TestFixture::value_type;
+    const value_type inv_diag[] = {0.5, 2.0};
+    this->small_p->fill(3);
+    this->small_r->fill(-2);
+    this->small_rho->at(0) = 2;
+    this->small_rho->at(1) = 3;
+    this->small_prev_rho->at(0) = 8;
+    this->small_prev_rho->at(1) = 3;
+    this->small_stop.get_data()[1] = this->stopped;
+
+    gko::kernels::reference::cg::fused_step_1(
+        this->exec, this->small_p.get(), this->small_r.get(), inv_diag,
+        this->small_rho.get(), this->small_prev_rho.get(), &this->small_stop);
+
+    GKO_ASSERT_MTX_NEAR(this->small_p, l({{-0.25, 3.0}, {-3.25, 3.0}}), 0);
+}
+
+
+TYPED_TEST(Cg, KernelSpmvDot)
+{
+    using T = typename TestFixture::value_type;
+    using Csr = gko::matrix::Csr<T, gko::int32>;
+    auto mtx =
+        gko::initialize<Csr>({I<T>{2.0, -1.0}, I<T>{0.0, 3.0}}, this->exec);
+    this->small_p->at(0, 0) = 1;
+    this->small_p->at(1, 0) = 2;
+    this->small_p->at(0, 1) = -1;
+    this->small_p->at(1, 1) = 1;
+    gko::array<char> tmp{this->exec};
+
+    gko::kernels::reference::cg::spmv_dot(
+        this->exec, mtx.get(), this->small_p.get(), this->small_q.get(),
+        this->small_beta.get(), tmp);
+
+    GKO_ASSERT_MTX_NEAR(this->small_q, l({{0.0, -3.0}, {6.0, 3.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(this->small_beta, l({{12.0, 6.0}}), 0);
+}
+
+
+TYPED_TEST(Cg, KernelFusedStep2)
+{
+    using value_type = typename TestFixture::value_type;
+    const value_type inv_diag[] = {0.5, 2.0};
+    this->small_x->fill(-2);
+    this->small_p->fill(3);
+    this->small_r->fill(4);
+    this->small_q->fill(-5);
+    this->small_prev_rho->at(0) = 2;
+    this->small_prev_rho->at(1) = 3;
+    this->small_beta->at(0) = 8;
+    this->small_beta->at(1) = 3;
+    this->small_stop.get_data()[1] = this->stopped;
+    gko::array<char> tmp{this->exec};
+
+    gko::kernels::reference::cg::fused_step_2(
+        this->exec, this->small_x.get(), this->small_r.get(),
+        this->small_p.get(), this->small_q.get(), inv_diag,
+        this->small_beta.get(), this->small_prev_rho.get(),
+        this->small_rho.get(), tmp, &this->small_stop);
+
+    GKO_ASSERT_MTX_NEAR(this->small_x, l({{-1.25, -2.0}, {-1.25, -2.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(this->small_r, l({{5.25, 4.0}, {5.25, 4.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(this->small_rho, l({{68.90625, 40.0}}), 0);
+}
+
+
+TYPED_TEST(Cg, SolvesBigSystemWithCsrAndJacobi)
+{
+    using Csr = gko::matrix::Csr<typename TestFixture::value_type, gko::int32>;
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto mtx = gko::share(Csr::create(this->exec));
+    this->mtx_big->convert_to(mtx);
+    auto solver =
+        gko::solver::Cg<value_type>::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(400u),
+                           gko::stop::ResidualNorm<value_type>::build()
+                               .with_reduction_factor(r<value_type>::value))
+            .with_preconditioner(
+                gko::preconditioner::Jacobi<value_type, gko::int32>::build()
+                    .with_max_block_size(1u))
+            .on(this->exec)
+            ->generate(mtx);
+    auto b = gko::initialize<Mtx>(
+        {1300083.0, 1018120.5, 906410.0, -42679.5, 846779.5, 1176858.5},
+        this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({81.0, 55.0, 45.0, 5.0, 85.0, -10.0}),
+                        r<value_type>::value * 1e3);
+}
+
+
 TYPED_TEST(Cg, SolvesStencilSystem)
 {
     using Mtx = typename TestFixture::Mtx;
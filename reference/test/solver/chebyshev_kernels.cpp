@@ -0,0 +1,351 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/solver/chebyshev_kernels.hpp"
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/log/convergence.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/multigrid/pgm.hpp>
+#include <ginkgo/core/preconditioner/jacobi.hpp>
+#include <ginkgo/core/solver/cg.hpp>
+#include <ginkgo/core/solver/chebyshev.hpp>
+#include <ginkgo/core/solver/multigrid.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename T>
+class Chebyshev : public ::testing::Test {
+protected:
+    using value_type = T;
+    using real_type = gko::remove_complex<value_type>;
+    using Mtx = gko::matrix::Dense<value_type>;
+    using Csr = gko::matrix::Csr<value_type, int>;
+    using Solver = gko::solver::Chebyshev<value_type>;
+
+    Chebyshev()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(gko::initialize<Mtx>(
+              {{2, -1.0, 0.0}, {-1.0, 2, -1.0}, {0.0, -1.0, 2}}, exec)),
+          chebyshev_factory(
+              Solver::build()
+                  .with_criteria(
+                      gko::stop::Iteration::build().with_max_iters(400u),
+                      gko::stop::ResidualNorm<value_type>::build()
+                          .with_reduction_factor(r<value_type>::value))
+                  .on(exec))
+    {}
+
+    // the matrix of the 1D Laplacian on size points
+    std::shared_ptr<Csr> generate_laplacian(int size)
+    {
+        gko::matrix_data<value_type, int> data{gko::dim<2>(size, size)};
+        for (int i = 0; i < size; i++) {
+            if (i > 0) {
+                data.nonzeros.emplace_back(i, i - 1, -1.0);
+            }
+            data.nonzeros.emplace_back(i, i, 2.0);
+            if (i < size - 1) {
+                data.nonzeros.emplace_back(i, i + 1, -1.0);
+            }
+        }
+        auto laplacian = gko::share(Csr::create(exec));
+        laplacian->read(data);
+        return laplacian;
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::shared_ptr<Mtx> mtx;
+    std::unique_ptr<typename Solver::Factory> chebyshev_factory;
+};
+
+TYPED_TEST_SUITE(Chebyshev, gko::test::ValueTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(Chebyshev, KernelInitUpdate)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using T = value_type;
+    auto inner_sol = gko::initialize<Mtx>(
+        {I<T>{1.0, 2.0}, I<T>{-1.0, 0.5}, I<T>{0.0, 4.0}}, this->exec);
+    auto update_sol = Mtx::create(this->exec, gko::dim<2>{3, 2});
+    auto output = gko::initialize<Mtx>(
+        {I<T>{1.0, 1.0}, I<T>{2.0, 0.0}, I<T>{-1.0, 3.0}}, this->exec);
+
+    gko::kernels::reference::chebyshev::init_update(
+        this->exec, value_type{0.5}, inner_sol.get(), update_sol.get(),
+        output.get());
+
+    GKO_ASSERT_MTX_NEAR(update_sol, inner_sol, 0);
+    GKO_ASSERT_MTX_NEAR(output, l({{1.5, 2.0}, {1.5, 0.25}, {-1.0, 5.0}}),
+                        0);
+}
+
+
+TYPED_TEST(Chebyshev, KernelUpdate)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using T = value_type;
+    auto inner_sol = gko::initialize<Mtx>(
+        {I<T>{1.0, 2.0}, I<T>{-1.0, 0.5}, I<T>{0.0, 4.0}}, this->exec);
+    auto update_sol = gko::initialize<Mtx>(
+        {I<T>{2.0, 0.0}, I<T>{1.0, -1.0}, I<T>{4.0, 2.0}}, this->exec);
+    auto output = gko::initialize<Mtx>(
+        {I<T>{1.0, 1.0}, I<T>{2.0, 0.0}, I<T>{-1.0, 3.0}}, this->exec);
+
+    gko::kernels::reference::chebyshev::update(
+        this->exec, value_type{2.0}, value_type{0.5}, inner_sol.get(),
+        update_sol.get(), output.get());
+
+    GKO_ASSERT_MTX_NEAR(update_sol, l({{2.0, 2.0}, {-0.5, 0.0}, {2.0, 5.0}}),
+                        0);
+    GKO_ASSERT_MTX_NEAR(output, l({{5.0, 5.0}, {1.0, 0.0}, {3.0, 13.0}}), 0);
+}
+
+
+TYPED_TEST(Chebyshev, EstimatesFoci)
+{
+    using value_type = typename TestFixture::value_type;
+    using real_type = typename TestFixture::real_type;
+    auto solver = this->chebyshev_factory->generate(this->mtx);
+
+    auto foci = solver->get_foci();
+
+    // the eigenvalues are 2 - sqrt(2), 2 and 2 + sqrt(2)
+    const auto tol = 10 * r<value_type>::value;
+    ASSERT_NEAR(gko::real(foci.first), 2 - std::sqrt(real_type{2}), tol);
+    ASSERT_NEAR(gko::real(foci.second), 1.1 * (2 + std::sqrt(real_type{2})),
+                tol);
+    ASSERT_EQ(gko::imag(foci.first), real_type{0});
+    ASSERT_EQ(gko::imag(foci.second), real_type{0});
+}
+
+
+TYPED_TEST(Chebyshev, EstimatesPreconditionedFoci)
+{
+    using value_type = typename TestFixture::value_type;
+    using real_type = typename TestFixture::real_type;
+    using Solver = typename TestFixture::Solver;
+    auto solver =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(1u))
+            .with_preconditioner(
+                gko::preconditioner::Jacobi<value_type>::build()
+                    .with_max_block_size(1u))
+            .with_max_eigenvalue_scale(real_type{1})
+            .on(this->exec)
+            ->generate(this->mtx);
+
+    auto foci = solver->get_foci();
+
+    // Jacobi halves the eigenvalues
+    const auto tol = 10 * r<value_type>::value;
+    ASSERT_NEAR(gko::real(foci.first), 1 - std::sqrt(real_type{2}) / 2, tol);
+    ASSERT_NEAR(gko::real(foci.second), 1 + std::sqrt(real_type{2}) / 2, tol);
+}
+
+
+TYPED_TEST(Chebyshev, EstimatesFociWithEigenvalueRatio)
+{
+    using value_type = typename TestFixture::value_type;
+    using real_type = typename TestFixture::real_type;
+    using Solver = typename TestFixture::Solver;
+    auto solver =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(1u))
+            .with_min_eigenvalue_ratio(real_type{0.25})
+            .with_max_eigenvalue_scale(real_type{1})
+            .on(this->exec)
+            ->generate(this->mtx);
+
+    auto foci = solver->get_foci();
+
+    const auto tol = 10 * r<value_type>::value;
+    ASSERT_NEAR(gko::real(foci.first), (2 + std::sqrt(real_type{2})) / 4, tol);
+    ASSERT_NEAR(gko::real(foci.second), 2 + std::sqrt(real_type{2}), tol);
+}
+
+
+TYPED_TEST(Chebyshev, EstimatesFociOfLargerMatrix)
+{
+    using value_type = typename TestFixture::value_type;
+    using real_type = typename TestFixture::real_type;
+    using Solver = typename TestFixture::Solver;
+    auto solver =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(1u))
+            .with_num_estimation_iterations(20u)
+            .with_max_eigenvalue_scale(real_type{1})
+            .on(this->exec)
+            ->generate(this->generate_laplacian(100));
+
+    auto foci = solver->get_foci();
+
+    // the Ritz values lie inside of the spectrum (0, 4) and the largest one
+    // converges quickly
+    ASSERT_GT(gko::real(foci.first), real_type{0});
+    ASSERT_LT(gko::real(foci.first), gko::real(foci.second));
+    ASSERT_LE(gko::real(foci.second), real_type{4});
+    ASSERT_GT(gko::real(foci.second), real_type{3.9});
+}
+
+
+TYPED_TEST(Chebyshev, SolvesStencilSystem)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->chebyshev_factory->generate(this->mtx);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}), r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Chebyshev, SolvesStencilSystemWithGivenFoci)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using Solver = typename TestFixture::Solver;
+    auto solver =
+        Solver::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(400u),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value))
+            .with_foci(value_type{0.5}, value_type{3.5})
+            .on(this->exec)
+            ->generate(this->mtx);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}), r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Chebyshev, SolvesMultipleStencilSystems)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using T = value_type;
+    auto solver = this->chebyshev_factory->generate(this->mtx);
+    auto b = gko::initialize<Mtx>(
+        {I<T>{-1.0, 1.0}, I<T>{3.0, 0.0}, I<T>{1.0, 1.0}}, this->exec);
+    auto x = gko::initialize<Mtx>(
+        {I<T>{0.0, 0.0}, I<T>{0.0, 0.0}, I<T>{0.0, 0.0}}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({{1.0, 1.0}, {3.0, 1.0}, {2.0, 1.0}}),
+                        r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Chebyshev, SolvesStencilSystemUsingAdvancedApply)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->chebyshev_factory->generate(this->mtx);
+    auto alpha = gko::initialize<Mtx>({2.0}, this->exec);
+    auto beta = gko::initialize<Mtx>({-1.0}, this->exec);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.5, 1.0, 2.0}, this->exec);
+
+    solver->apply(alpha, b, beta, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.5, 5.0, 2.0}), r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Chebyshev, ZeroGuessIgnoresInput)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using Solver = typename TestFixture::Solver;
+    auto factory =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(3u))
+            .with_foci(value_type{0.5}, value_type{3.5});
+    auto solver = factory.on(this->exec)->generate(this->mtx);
+    auto zero_guess_solver =
+        factory
+            .with_default_initial_guess(gko::solver::initial_guess_mode::zero)
+            .on(this->exec)
+            ->generate(this->mtx);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+    auto x_zero = gko::initialize<Mtx>({5.0, -2.0, 1.0}, this->exec);
+
+    solver->apply(b, x);
+    zero_guess_solver->apply(b, x_zero);
+
+    GKO_ASSERT_MTX_NEAR(x_zero, x, 0);
+}
+
+
+TYPED_TEST(Chebyshev, SmoothsInMultigrid)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using real_type = typename TestFixture::real_type;
+    using Solver = typename TestFixture::Solver;
+    auto laplacian = this->generate_laplacian(64);
+    auto smoother = gko::share(
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(2u))
+            .with_preconditioner(
+                gko::preconditioner::Jacobi<value_type>::build()
+                    .with_max_block_size(1u))
+            .with_min_eigenvalue_ratio(real_type{0.3})
+            .on(this->exec));
+    // smoothed aggregation converges with a V-cycle, and the default
+    // min_coarse_rows would not generate any level for this size
+    auto multigrid =
+        gko::solver::Multigrid::build()
+            .with_mg_level(gko::multigrid::Pgm<value_type, int>::build()
+                               .with_deterministic(true)
+                               .with_smoothed_aggregation(true))
+            .with_min_coarse_rows(8u)
+            .with_pre_smoother(smoother)
+            .with_coarsest_solver(
+                gko::solver::Cg<value_type>::build().with_criteria(
+                    gko::stop::Iteration::build().with_max_iters(64u)))
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(100u),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(real_type{1e-4}))
+            .on(this->exec)
+            ->generate(laplacian);
+    auto b = Mtx::create(this->exec, gko::dim<2>{64, 1});
+    b->fill(gko::one<value_type>());
+    auto x = Mtx::create(this->exec, gko::dim<2>{64, 1});
+    x->fill(gko::zero<value_type>());
+    auto logger = gko::share(gko::log::Convergence<value_type>::create());
+    multigrid->add_logger(logger);
+
+    multigrid->apply(b, x);
+
+    ASSERT_TRUE(logger->has_converged());
+    ASSERT_LT(logger->get_num_iterations(), 20);
+}
+
+
+}  // namespace
@@ -510,6 +510,64 @@ TYPED_TEST(Gmres, SolvesMultipleStencilSystems)
 }
 
 
+TYPED_TEST(Gmres, SolvesMultipleStencilSystemsWithBlockOrthogonalization)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    using T = value_type;
+    for (gko::size_type s_step : {1u, 2u, 4u}) {
+        SCOPED_TRACE(s_step);
+        auto solver =
+            Solver::build()
+                .with_ortho_method(gko::solver::gmres::ortho_method::block_cgs2)
+                .with_s_step(s_step)
+                .with_criteria(
+                    gko::stop::Iteration::build().with_max_iters(30u),
+                    gko::stop::ResidualNorm<value_type>::build()
+                        .with_reduction_factor(r<value_type>::value))
+                .on(this->exec)
+                ->generate(this->mtx);
+        auto b = gko::initialize<Mtx>(
+            {I<T>{13.0, 6.0}, I<T>{7.0, 4.0}, I<T>{1.0, 1.0}}, this->exec);
+        auto x = gko::initialize<Mtx>(
+            {I<T>{0.0, 0.0}, I<T>{0.0, 0.0}, I<T>{0.0, 0.0}}, this->exec);
+
+        solver->apply(b, x);
+
+        GKO_ASSERT_MTX_NEAR(x, l({{1.0, 1.0}, {3.0, 1.0}, {2.0, 1.0}}),
+                            r<value_type>::value * 1e1);
+    }
+}
+
+
+TYPED_TEST(Gmres, SolvesBigDenseSystemWithBlockOrthogonalizationAndRestart)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    auto half_tol = std::sqrt(r<value_type>::value);
+    auto solver =
+        Solver::build()
+            .with_krylov_dim(4u)
+            .with_ortho_method(gko::solver::gmres::ortho_method::block_cgs2)
+            .with_s_step(3u)
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(200u),
+                           gko::stop::ResidualNorm<value_type>::build()
+                               .with_reduction_factor(r<value_type>::value))
+            .on(this->exec)
+            ->generate(this->mtx_medium);
+    auto b = gko::initialize<Mtx>(
+        {-13945.16, 11205.66, 16132.96, 24342.18, -10910.98}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({-140.20, -142.20, 48.80, -17.70, -19.60}),
+                        half_tol * 1e2);
+}
+
+
 TYPED_TEST(Gmres, SolvesStencilSystemUsingAdvancedApply)
 {
     using Mtx = typename TestFixture::Mtx;
@@ -759,8 +817,8 @@ TYPED_TEST(Gmres, SolvesWithPreconditioner)
     using Mtx = typename TestFixture::Mtx;
     using Solver = typename TestFixture::Solver;
     using value_type = typename TestFixture::value_type;
-    for (auto ortho :
-         {ortho_method::mgs, ortho_method::cgs, ortho_method::cgs2}) {
+    for (auto ortho : {ortho_method::mgs, ortho_method::cgs, ortho_method::cgs2,
+                       ortho_method::block_cgs2}) {
         SCOPED_TRACE(ortho);
         auto gmres_factory_preconditioner =
             Solver::build()
@@ -1302,4 +1302,117 @@ TYPED_TEST(Multigrid, SolvesStencilSystemByFCycle)
 }
 
 
+TYPED_TEST(Multigrid, UpdateValuesIsEquivalentToGenerate)
+{
+    using Csr = typename TestFixture::Csr;
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto multigrid_factory =
+        this->get_multigrid_factory(gko::solver::multigrid::cycle::v);
+    auto scaled_mtx = gko::share(gko::clone(this->exec, this->mtx));
+    scaled_mtx->scale(gko::initialize<Mtx>({2.0}, this->exec));
+    auto solver = multigrid_factory->generate(this->mtx);
+    auto expected_solver = multigrid_factory->generate(scaled_mtx);
+    auto b = gko::initialize<Mtx>({-2.0, 6.0, 2.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+    auto expected_x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->update_values(scaled_mtx);
+    solver->apply(b, x);
+    expected_solver->apply(b, expected_x);
+
+    ASSERT_EQ(solver->get_system_matrix(), scaled_mtx);
+    GKO_ASSERT_MTX_NEAR(
+        gko::as<Csr>(solver->get_mg_level_list().at(0)->get_coarse_op()),
+        gko::as<Csr>(
+            expected_solver->get_mg_level_list().at(0)->get_coarse_op()),
+        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(x, expected_x, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}), r<value_type>::value);
+}
+
+
+TYPED_TEST(Multigrid, UpdateValuesWithChangedValuesIsEquivalentToGenerate)
+{
+    using Coarse = typename TestFixture::Coarse;
+    using Csr = typename TestFixture::Csr;
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto multigrid_factory =
+        this->get_multigrid_factory(gko::solver::multigrid::cycle::v);
+    // same sparsity pattern and aggregation as mtx, but neither symmetric
+    // nor a scalar multiple of it
+    auto new_mtx = gko::share(gko::initialize<Csr>(
+        {{3.0, -1.0, 0.0}, {-0.5, 2.0, -1.0}, {0.0, -2.0, 4.0}}, this->exec));
+    auto solver = multigrid_factory->generate(this->mtx);
+    auto expected_solver = multigrid_factory->generate(new_mtx);
+    auto b = gko::initialize<Mtx>({1.0, 4.5, 2.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+    auto expected_x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->update_values(new_mtx);
+    solver->apply(b, x);
+    expected_solver->apply(b, expected_x);
+
+    const auto level = gko::as<Coarse>(solver->get_mg_level_list().at(0));
+    const auto expected_level =
+        gko::as<Coarse>(expected_solver->get_mg_level_list().at(0));
+    for (int i = 0; i < 3; i++) {
+        ASSERT_EQ(level->get_const_agg()[i],
+                  expected_level->get_const_agg()[i]);
+    }
+    GKO_ASSERT_MTX_NEAR(gko::as<Csr>(level->get_coarse_op()),
+                        gko::as<Csr>(expected_level->get_coarse_op()),
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(x, expected_x, r<value_type>::value);
+}
+
+TYPED_TEST(Multigrid, UpdateValuesThrowsOnDifferentSize)
+{
+    auto multigrid_factory =
+        this->get_multigrid_factory(gko::solver::multigrid::cycle::v);
+    auto solver = multigrid_factory->generate(this->mtx);
+
+    ASSERT_THROW(solver->update_values(this->mtx2), gko::DimensionMismatch);
+}
+
+
+TYPED_TEST(Multigrid, UpdatesValuesOfEmptyMatrix)
+{
+    using Csr = typename TestFixture::Csr;
+    auto multigrid_factory =
+        this->get_multigrid_factory(gko::solver::multigrid::cycle::v);
+    auto empty = gko::share(Csr::create(this->exec));
+    auto other_empty = gko::share(Csr::create(this->exec));
+    auto solver = multigrid_factory->generate(empty);
+
+    solver->update_values(other_empty);
+
+    ASSERT_EQ(solver->get_system_matrix(), other_empty);
+    ASSERT_TRUE(solver->get_mg_level_list().empty());
+}
+
+
+TYPED_TEST(Multigrid, FailedUpdateValuesKeepsHierarchy)
+{
+    using Csr = typename TestFixture::Csr;
+    auto multigrid_factory =
+        this->get_multigrid_factory(gko::solver::multigrid::cycle::v);
+    auto solver = multigrid_factory->generate(this->mtx);
+    auto mg_level = solver->get_mg_level_list().at(0);
+    auto pre_smoother = solver->get_pre_smoother_list().at(0);
+    auto coarsest_solver = solver->get_coarsest_solver();
+    // Pgm cannot update its coarse matrix for a different sparsity pattern
+    auto other_mtx = gko::share(gko::initialize<Csr>(
+        {{2, 0.0, 0.0}, {-1.0, 2, -1.0}, {0.0, -1.0, 2}}, this->exec));
+
+    ASSERT_THROW(solver->update_values(other_mtx), gko::ValueMismatch);
+    ASSERT_EQ(solver->get_system_matrix(), this->mtx);
+    ASSERT_EQ(solver->get_mg_level_list().size(), 1);
+    ASSERT_EQ(solver->get_mg_level_list().at(0), mg_level);
+    ASSERT_EQ(solver->get_pre_smoother_list().at(0), pre_smoother);
+    ASSERT_EQ(solver->get_coarsest_solver(), coarsest_solver);
+}
+
+
 }  // namespace
@@ -0,0 +1,291 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/solver/pipe_bicgstab_kernels.hpp"
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/preconditioner/jacobi.hpp>
+#include <ginkgo/core/solver/pipe_bicgstab.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename T>
+class PipeBicgstab : public ::testing::Test {
+protected:
+    using value_type = T;
+    using Mtx = gko::matrix::Dense<value_type>;
+    using Solver = gko::solver::PipeBicgstab<value_type>;
+
+    PipeBicgstab()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(gko::initialize<Mtx>(
+              {{1.0, -3.0, 0.0}, {-4.0, 1.0, -3.0}, {2.0, -1.0, 2.0}}, exec)),
+          stopped{},
+          non_stopped{},
+          // the residual replacement keeps the recursive residual close to
+          // the true residual, which otherwise stagnates above r
+          pipe_bicgstab_factory(
+              Solver::build()
+                  .with_criteria(
+                      gko::stop::Iteration::build().with_max_iters(8u),
+                      gko::stop::ResidualNorm<value_type>::build()
+                          .with_reduction_factor(r<value_type>::value))
+                  .with_replacement_period(2u)
+                  .on(exec)),
+          pipe_bicgstab_factory_precision(
+              Solver::build()
+                  .with_criteria(
+                      gko::stop::Iteration::build().with_max_iters(50u),
+                      gko::stop::ResidualNorm<value_type>::build()
+                          .with_reduction_factor(r<value_type>::value))
+                  .with_replacement_period(2u)
+                  .on(exec))
+    {
+        auto small_scalar_size = gko::dim<2>{1, 2};
+        small_alpha = Mtx::create(exec, small_scalar_size);
+        small_beta = Mtx::create(exec, small_scalar_size);
+        small_omega = Mtx::create(exec, small_scalar_size);
+        small_prev_rho = Mtx::create(exec, small_scalar_size);
+        small_yq = Mtx::create(exec, small_scalar_size);
+        small_yy = Mtx::create(exec, small_scalar_size);
+        small_rho = Mtx::create(exec, small_scalar_size);
+        small_rr_w = Mtx::create(exec, small_scalar_size);
+        small_rr_s = Mtx::create(exec, small_scalar_size);
+        small_rr_z = Mtx::create(exec, small_scalar_size);
+        small_stop = gko::array<gko::stopping_status>(exec, 2);
+        stopped.stop(1);
+        non_stopped.reset();
+        std::fill_n(small_stop.get_data(), small_stop.get_size(), non_stopped);
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::shared_ptr<Mtx> mtx;
+    std::unique_ptr<Mtx> small_alpha;
+    std::unique_ptr<Mtx> small_beta;
+    std::unique_ptr<Mtx> small_omega;
+    std::unique_ptr<Mtx> small_prev_rho;
+    std::unique_ptr<Mtx> small_yq;
+    std::unique_ptr<Mtx> small_yy;
+    std::unique_ptr<Mtx> small_rho;
+    std::unique_ptr<Mtx> small_rr_w;
+    std::unique_ptr<Mtx> small_rr_s;
+    std::unique_ptr<Mtx> small_rr_z;
+    gko::array<gko::stopping_status> small_stop;
+    gko::stopping_status stopped;
+    gko::stopping_status non_stopped;
+    std::unique_ptr<typename Solver::Factory> pipe_bicgstab_factory;
+    std::unique_ptr<typename Solver::Factory> pipe_bicgstab_factory_precision;
+};
+
+TYPED_TEST_SUITE(PipeBicgstab, gko::test::ValueTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(PipeBicgstab, KernelStep3)
+{
+    using value_type = typename TestFixture::value_type;
+    this->small_alpha->fill(1);
+    this->small_beta->fill(0);
+    this->small_omega->fill(0);
+    this->small_prev_rho->fill(2);
+    this->small_yq->fill(2);
+    this->small_yy->fill(4);
+    this->small_rho->fill(4);
+    this->small_rr_w->fill(2);
+    this->small_rr_s->fill(1);
+    this->small_rr_z->fill(2);
+    this->small_stop.get_data()[1] = this->stopped;
+
+    gko::kernels::reference::pipe_bicgstab::step_3(
+        this->exec, this->small_alpha.get(), this->small_beta.get(),
+        this->small_omega.get(), this->small_prev_rho.get(),
+        this->small_yq.get(), this->small_yy.get(), this->small_rho.get(),
+        this->small_rr_w.get(), this->small_rr_s.get(), this->small_rr_z.get(),
+        &this->small_stop);
+
+    GKO_ASSERT_MTX_NEAR(this->small_omega, l({{0.5, 0.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(this->small_beta, l({{4.0, 0.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(this->small_alpha, l({{2.0, 1.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(this->small_prev_rho, l({{4.0, 2.0}}), 0);
+}
+
+
+TYPED_TEST(PipeBicgstab, KernelStep3FirstIteration)
+{
+    using value_type = typename TestFixture::value_type;
+    this->small_alpha->fill(0);
+    this->small_beta->fill(0);
+    this->small_omega->fill(0);
+    this->small_prev_rho->fill(0);
+    this->small_yq->fill(0);
+    this->small_yy->fill(0);
+    this->small_rho->fill(4);
+    this->small_rr_w->fill(2);
+    this->small_rr_s->fill(1);
+    this->small_rr_z->fill(2);
+
+    gko::kernels::reference::pipe_bicgstab::step_3(
+        this->exec, this->small_alpha.get(), this->small_beta.get(),
+        this->small_omega.get(), this->small_prev_rho.get(),
+        this->small_yq.get(), this->small_yy.get(), this->small_rho.get(),
+        this->small_rr_w.get(), this->small_rr_s.get(), this->small_rr_z.get(),
+        &this->small_stop);
+
+    GKO_ASSERT_MTX_NEAR(this->small_omega, l({{0.0, 0.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(this->small_beta, l({{0.0, 0.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(this->small_alpha, l({{2.0, 2.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(this->small_prev_rho, l({{4.0, 4.0}}), 0);
+}
+
+
+TYPED_TEST(PipeBicgstab, SolvesDenseSystem)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->pipe_bicgstab_factory->generate(this->mtx);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({-4.0, -1.0, 4.0}), r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(PipeBicgstab, SolvesDenseSystemMixed)
+{
+    using value_type = gko::next_precision<typename TestFixture::value_type>;
+    using Mtx = gko::matrix::Dense<value_type>;
+    auto solver = this->pipe_bicgstab_factory->generate(this->mtx);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({-4.0, -1.0, 4.0}),
+                        (r_mixed<value_type, TypeParam>()) * 1e1);
+}
+
+
+TYPED_TEST(PipeBicgstab, SolvesDenseSystemComplex)
+{
+    using Mtx = gko::to_complex<typename TestFixture::Mtx>;
+    using value_type = typename Mtx::value_type;
+    auto solver = this->pipe_bicgstab_factory->generate(this->mtx);
+    auto b = gko::initialize<Mtx>(
+        {value_type{-1.0, 2.0}, value_type{3.0, -6.0}, value_type{1.0, -2.0}},
+        this->exec);
+    auto x = gko::initialize<Mtx>(
+        {value_type{0.0, 0.0}, value_type{0.0, 0.0}, value_type{0.0, 0.0}},
+        this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x,
+                        l({value_type{-4.0, 8.0}, value_type{-1.0, 2.0},
+                           value_type{4.0, -8.0}}),
+                        r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(PipeBicgstab, SolvesMultipleDenseSystems)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using T = value_type;
+    auto half_tol = std::sqrt(r<value_type>::value);
+    auto solver = this->pipe_bicgstab_factory->generate(this->mtx);
+    auto b = gko::initialize<Mtx>(
+        {I<T>{-1.0, -5.0}, I<T>{3.0, 1.0}, I<T>{1.0, -2.0}}, this->exec);
+    auto x = gko::initialize<Mtx>(
+        {I<T>{0.0, 0.0}, I<T>{0.0, 0.0}, I<T>{0.0, 0.0}}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({{-4.0, 1.0}, {-1.0, 2.0}, {4.0, -1.0}}),
+                        half_tol);
+}
+
+
+TYPED_TEST(PipeBicgstab, SolvesDenseSystemUsingAdvancedApply)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->pipe_bicgstab_factory->generate(this->mtx);
+    auto alpha = gko::initialize<Mtx>({2.0}, this->exec);
+    auto beta = gko::initialize<Mtx>({-1.0}, this->exec);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.5, 1.0, 2.0}, this->exec);
+
+    solver->apply(alpha, b, beta, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({-8.5, -3.0, 6.0}), r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(PipeBicgstab, SolvesBigDenseSystemWithPreconditioner)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    auto half_tol = std::sqrt(r<value_type>::value);
+    std::shared_ptr<Mtx> locmtx =
+        gko::initialize<Mtx>({{-19.0, 47.0, -41.0, 35.0, -21.0, 71.0},
+                              {-8.0, -66.0, 29.0, -96.0, -95.0, -14.0},
+                              {-93.0, -58.0, -9.0, -87.0, 15.0, 35.0},
+                              {60.0, -86.0, 54.0, -40.0, -93.0, 56.0},
+                              {53.0, 94.0, -54.0, 86.0, -61.0, 4.0},
+                              {-42.0, 57.0, 32.0, 89.0, 89.0, -39.0}},
+                             this->exec);
+    auto solver =
+        Solver::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(50u),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value))
+            .with_preconditioner(
+                gko::preconditioner::Jacobi<value_type>::build()
+                    .with_max_block_size(1u))
+            .with_replacement_period(2u)
+            .on(this->exec)
+            ->generate(locmtx);
+    auto b =
+        gko::initialize<Mtx>({0.0, -9.0, -2.0, 8.0, -5.0, -6.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(
+        x,
+        l({0.13853406350816114, -0.08147485210505287, -0.0450299311807042,
+           -0.0051264177562865719, 0.11609654300797841, 0.1018688746740561}),
+        half_tol * 5e-1);
+}
+
+
+TYPED_TEST(PipeBicgstab, SolvesTransposedDenseSystem)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->pipe_bicgstab_factory->generate(this->mtx->transpose());
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->transpose()->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({-4.0, -1.0, 4.0}), r<value_type>::value * 1e1);
+}
+
+
+}  // namespace
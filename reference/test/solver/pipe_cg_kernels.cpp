@@ -0,0 +1,296 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/solver/pipe_cg_kernels.hpp"
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/preconditioner/jacobi.hpp>
+#include <ginkgo/core/solver/pipe_cg.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename T>
+class PipeCg : public ::testing::Test {
+protected:
+    using value_type = T;
+    using Mtx = gko::matrix::Dense<value_type>;
+    using Solver = gko::solver::PipeCg<value_type>;
+    PipeCg()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(gko::initialize<Mtx>(
+              {{2, -1.0, 0.0}, {-1.0, 2, -1.0}, {0.0, -1.0, 2}}, exec)),
+          stopped{},
+          non_stopped{},
+          pipe_cg_factory(
+              Solver::build()
+                  .with_criteria(
+                      gko::stop::Iteration::build().with_max_iters(400u),
+                      gko::stop::ResidualNorm<value_type>::build()
+                          .with_reduction_factor(r<value_type>::value))
+                  .on(exec)),
+          mtx_big(gko::initialize<Mtx>(
+              {{8828.0, 2673.0, 4150.0, -3139.5, 3829.5, 5856.0},
+               {2673.0, 10765.5, 1805.0, 73.0, 1966.0, 3919.5},
+               {4150.0, 1805.0, 6472.5, 2656.0, 2409.5, 3836.5},
+               {-3139.5, 73.0, 2656.0, 6048.0, 665.0, -132.0},
+               {3829.5, 1966.0, 2409.5, 665.0, 4240.5, 4373.5},
+               {5856.0, 3919.5, 3836.5, -132.0, 4373.5, 5678.0}},
+              exec)),
+          pipe_cg_factory_big(
+              Solver::build()
+                  .with_criteria(
+                      gko::stop::Iteration::build().with_max_iters(100u),
+                      gko::stop::ResidualNorm<value_type>::build()
+                          .with_reduction_factor(r<value_type>::value))
+                  .with_replacement_period(5u)
+                  .on(exec))
+    {
+        auto small_scalar_size = gko::dim<2>{1, 2};
+        small_beta = Mtx::create(exec, small_scalar_size);
+        small_alpha = Mtx::create(exec, small_scalar_size);
+        small_prev_gamma = Mtx::create(exec, small_scalar_size);
+        small_gamma = Mtx::create(exec, small_scalar_size);
+        small_delta = Mtx::create(exec, small_scalar_size);
+        small_stop = gko::array<gko::stopping_status>(exec, 2);
+        stopped.stop(1);
+        non_stopped.reset();
+        std::fill_n(small_stop.get_data(), small_stop.get_size(), non_stopped);
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::shared_ptr<Mtx> mtx;
+    std::shared_ptr<Mtx> mtx_big;
+    std::unique_ptr<Mtx> small_beta;
+    std::unique_ptr<Mtx> small_alpha;
+    std::unique_ptr<Mtx> small_prev_gamma;
+    std::unique_ptr<Mtx> small_gamma;
+    std::unique_ptr<Mtx> small_delta;
+    gko::array<gko::stopping_status> small_stop;
+    gko::stopping_status stopped;
+    gko::stopping_status non_stopped;
+    std::unique_ptr<typename Solver::Factory> pipe_cg_factory;
+    std::unique_ptr<typename Solver::Factory> pipe_cg_factory_big;
+};
+
+TYPED_TEST_SUITE(PipeCg, gko::test::ValueTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(PipeCg, KernelStep1)
+{
+    using value_type = typename TestFixture::value_type;
+    this->small_prev_gamma->fill(2);
+    this->small_alpha->fill(2);
+    this->small_gamma->fill(4);
+    this->small_delta->fill(5);
+    this->small_beta->fill(0);
+    this->small_stop.get_data()[1] = this->stopped;
+
+    gko::kernels::reference::pipe_cg::step_1(
+        this->exec, this->small_beta.get(), this->small_alpha.get(),
+        this->small_prev_gamma.get(), this->small_gamma.get(),
+        this->small_delta.get(), &this->small_stop);
+
+    GKO_ASSERT_MTX_NEAR(this->small_beta, l({{2.0, 0.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(this->small_alpha, l({{4.0, 2.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(this->small_prev_gamma, l({{4.0, 2.0}}), 0);
+}
+
+
+TYPED_TEST(PipeCg, KernelStep1FirstIteration)
+{
+    using value_type = typename TestFixture::value_type;
+    this->small_prev_gamma->fill(0);
+    this->small_alpha->fill(0);
+    this->small_gamma->fill(4);
+    this->small_delta->fill(2);
+
+    gko::kernels::reference::pipe_cg::step_1(
+        this->exec, this->small_beta.get(), this->small_alpha.get(),
+        this->small_prev_gamma.get(), this->small_gamma.get(),
+        this->small_delta.get(), &this->small_stop);
+
+    GKO_ASSERT_MTX_NEAR(this->small_beta, l({{0.0, 0.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(this->small_alpha, l({{2.0, 2.0}}), 0);
+    GKO_ASSERT_MTX_NEAR(this->small_prev_gamma, l({{4.0, 4.0}}), 0);
+}
+
+
+TYPED_TEST(PipeCg, KernelStep1DivByZero)
+{
+    using value_type = typename TestFixture::value_type;
+    this->small_prev_gamma->fill(2);
+    this->small_alpha->fill(1);
+    this->small_gamma->fill(1);
+    this->small_delta->fill(0.5);
+
+    gko::kernels::reference::pipe_cg::step_1(
+        this->exec, this->small_beta.get(), this->small_alpha.get(),
+        this->small_prev_gamma.get(), this->small_gamma.get(),
+        this->small_delta.get(), &this->small_stop);
+
+    GKO_ASSERT_MTX_NEAR(this->small_beta, l({{0.5, 0.5}}), 0);
+    GKO_ASSERT_MTX_NEAR(this->small_alpha, l({{0.0, 0.0}}), 0);
+}
+
+
+TYPED_TEST(PipeCg, SolvesStencilSystem)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->pipe_cg_factory->generate(this->mtx);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}), r<value_type>::value);
+}
+
+
+TYPED_TEST(PipeCg, SolvesStencilSystemMixed)
+{
+    using value_type = gko::next_precision<typename TestFixture::value_type>;
+    using Mtx = gko::matrix::Dense<value_type>;
+    auto solver = this->pipe_cg_factory->generate(this->mtx);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}),
+                        (r_mixed<value_type, TypeParam>()));
+}
+
+
+TYPED_TEST(PipeCg, SolvesStencilSystemComplex)
+{
+    using Mtx = gko::to_complex<typename TestFixture::Mtx>;
+    using value_type = typename Mtx::value_type;
+    auto solver = this->pipe_cg_factory->generate(this->mtx);
+    auto b = gko::initialize<Mtx>(
+        {value_type{-1.0, 2.0}, value_type{3.0, -6.0}, value_type{1.0, -2.0}},
+        this->exec);
+    auto x = gko::initialize<Mtx>(
+        {value_type{0.0, 0.0}, value_type{0.0, 0.0}, value_type{0.0, 0.0}},
+        this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x,
+                        l({value_type{1.0, -2.0}, value_type{3.0, -6.0},
+                           value_type{2.0, -4.0}}),
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(PipeCg, SolvesMultipleStencilSystems)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using T = value_type;
+    auto solver = this->pipe_cg_factory->generate(this->mtx);
+    auto b = gko::initialize<Mtx>(
+        {I<T>{-1.0, 1.0}, I<T>{3.0, 0.0}, I<T>{1.0, 1.0}}, this->exec);
+    auto x = gko::initialize<Mtx>(
+        {I<T>{0.0, 0.0}, I<T>{0.0, 0.0}, I<T>{0.0, 0.0}}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({{1.0, 1.0}, {3.0, 1.0}, {2.0, 1.0}}),
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(PipeCg, SolvesStencilSystemUsingAdvancedApply)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->pipe_cg_factory->generate(this->mtx);
+    auto alpha = gko::initialize<Mtx>({2.0}, this->exec);
+    auto beta = gko::initialize<Mtx>({-1.0}, this->exec);
+    auto b = gko::initialize<Mtx>({-1.0, 3.0, 1.0}, this->exec);
+    auto x = gko::initialize<Mtx>({0.5, 1.0, 2.0}, this->exec);
+
+    solver->apply(alpha, b, beta, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.5, 5.0, 2.0}), r<value_type>::value);
+}
+
+
+TYPED_TEST(PipeCg, SolvesBigDenseSystem)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->pipe_cg_factory_big->generate(this->mtx_big);
+    auto b = gko::initialize<Mtx>(
+        {1300083.0, 1018120.5, 906410.0, -42679.5, 846779.5, 1176858.5},
+        this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+
+    // the residual replacement removes the rounding errors accumulated in
+    // the auxiliary recurrences, so the accuracy matches the one of CG
+    GKO_ASSERT_MTX_NEAR(x, l({81.0, 55.0, 45.0, 5.0, 85.0, -10.0}),
+                        r<value_type>::value * 1e2);
+}
+
+
+TYPED_TEST(PipeCg, SolvesBigDenseSystemWithPreconditioner)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+    using value_type = typename TestFixture::value_type;
+    auto solver =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(100u),
+                           gko::stop::ResidualNorm<value_type>::build()
+                               .with_reduction_factor(r<value_type>::value))
+            .with_preconditioner(
+                gko::preconditioner::Jacobi<value_type>::build()
+                    .with_max_block_size(1u))
+            .with_replacement_period(5u)
+            .on(this->exec)
+            ->generate(this->mtx_big);
+    auto b = gko::initialize<Mtx>(
+        {886630.5, -172578.0, 684522.0, -65310.5, 455487.5, 607436.0},
+        this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({33.0, -56.0, 81.0, -30.0, 21.0, 40.0}),
+                        r<value_type>::value * 1e2);
+}
+
+
+TYPED_TEST(PipeCg, SolvesTransposedBigDenseSystem)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto solver = this->pipe_cg_factory_big->generate(this->mtx_big);
+    auto b = gko::initialize<Mtx>(
+        {1300083.0, 1018120.5, 906410.0, -42679.5, 846779.5, 1176858.5},
+        this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, this->exec);
+
+    solver->transpose()->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({81.0, 55.0, 45.0, 5.0, 85.0, -10.0}),
+                        r<value_type>::value * 1e2);
+}
+
+
+}  // namespace
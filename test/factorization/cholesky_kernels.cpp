@@ -268,12 +268,18 @@ protected:
                          const char* mtx_chol_filename)
     {
         std::ifstream s_mtx{mtx_filename};
-        mtx = gko::read<matrix_type>(s_mtx, ref);
+        std::ifstream s_mtx_chol{mtx_chol_filename};
+        initialize_data(gko::read<matrix_type>(s_mtx, ref),
+                        gko::read_raw<value_type, index_type>(s_mtx_chol));
+    }
+
+    void initialize_data(
+        std::shared_ptr<matrix_type> input_mtx,
+        gko::matrix_data<value_type, index_type> mtx_chol_data)
+    {
+        mtx = std::move(input_mtx);
         dmtx = gko::clone(exec, mtx);
         num_rows = mtx->get_size()[0];
-        std::ifstream s_mtx_chol{mtx_chol_filename};
-        auto mtx_chol_data = gko::read_raw<value_type, index_type>(s_mtx_chol);
-        auto nnz = mtx_chol_data.nonzeros.size();
         // add missing upper diagonal entries
         // (values not important, only pattern important)
         gko::utils::make_symmetric(mtx_chol_data);
@@ -306,6 +312,37 @@ protected:
         gko::factorization::compute_elim_forest(dmtx_chol.get(), dforest);
     }
 
+    void assert_factorize_is_equivalent_to_ref()
+    {
+        const auto nnz = mtx_chol->get_num_stored_elements();
+        gko::array<index_type> diag_idxs{ref, num_rows};
+        gko::array<index_type> ddiag_idxs{exec, num_rows};
+        gko::array<index_type> transpose_idxs{ref, nnz};
+        gko::array<index_type> dtranspose_idxs{exec, nnz};
+        gko::array<int> tmp{ref};
+        gko::array<int> dtmp{exec};
+        gko::kernels::reference::cholesky::initialize(
+            ref, mtx.get(), storage_offsets.get_const_data(),
+            row_descs.get_const_data(), storage.get_const_data(),
+            diag_idxs.get_data(), transpose_idxs.get_data(), mtx_chol.get());
+        gko::kernels::GKO_DEVICE_NAMESPACE::cholesky::initialize(
+            exec, dmtx.get(), dstorage_offsets.get_const_data(),
+            drow_descs.get_const_data(), dstorage.get_const_data(),
+            ddiag_idxs.get_data(), dtranspose_idxs.get_data(), dmtx_chol.get());
+
+        gko::kernels::reference::cholesky::factorize(
+            ref, storage_offsets.get_const_data(), row_descs.get_const_data(),
+            storage.get_const_data(), diag_idxs.get_const_data(),
+            transpose_idxs.get_const_data(), *forest, mtx_chol.get(), tmp);
+        gko::kernels::GKO_DEVICE_NAMESPACE::cholesky::factorize(
+            exec, dstorage_offsets.get_const_data(),
+            drow_descs.get_const_data(), dstorage.get_const_data(),
+            ddiag_idxs.get_const_data(), dtranspose_idxs.get_const_data(),
+            *dforest, dmtx_chol.get(), dtmp);
+
+        GKO_ASSERT_MTX_NEAR(mtx_chol, dmtx_chol, r<value_type>::value);
+    }
+
     void forall_matrices(std::function<void()> fn)
     {
         {
@@ -389,42 +426,49 @@ TYPED_TEST(Cholesky, KernelInitializeIsEquivalentToRef)
 
 TYPED_TEST(Cholesky, KernelFactorizeIsEquivalentToRef)
 {
-    using value_type = typename TestFixture::value_type;
-    using index_type = typename TestFixture::index_type;
     this->forall_matrices([this] {
-        const auto nnz = this->mtx_chol->get_num_stored_elements();
-        gko::array<index_type> diag_idxs{this->ref, this->num_rows};
-        gko::array<index_type> ddiag_idxs{this->exec, this->num_rows};
-        gko::array<index_type> transpose_idxs{this->ref, nnz};
-        gko::array<index_type> dtranspose_idxs{this->exec, nnz};
-        gko::array<int> tmp{this->ref};
-        gko::array<int> dtmp{this->exec};
-        gko::kernels::reference::cholesky::initialize(
-            this->ref, this->mtx.get(), this->storage_offsets.get_const_data(),
-            this->row_descs.get_const_data(), this->storage.get_const_data(),
-            diag_idxs.get_data(), transpose_idxs.get_data(),
-            this->mtx_chol.get());
-        gko::kernels::GKO_DEVICE_NAMESPACE::cholesky::initialize(
-            this->exec, this->dmtx.get(),
-            this->dstorage_offsets.get_const_data(),
-            this->drow_descs.get_const_data(), this->dstorage.get_const_data(),
-            ddiag_idxs.get_data(), dtranspose_idxs.get_data(),
-            this->dmtx_chol.get());
+        this->assert_factorize_is_equivalent_to_ref();
+    });
+}
 
-        gko::kernels::reference::cholesky::factorize(
-            this->ref, this->storage_offsets.get_const_data(),
-            this->row_descs.get_const_data(), this->storage.get_const_data(),
-            diag_idxs.get_const_data(), transpose_idxs.get_const_data(),
-            *this->forest, this->mtx_chol.get(), tmp);
-        gko::kernels::GKO_DEVICE_NAMESPACE::cholesky::factorize(
-            this->exec, this->dstorage_offsets.get_const_data(),
-            this->drow_descs.get_const_data(), this->dstorage.get_const_data(),
-            ddiag_idxs.get_const_data(), dtranspose_idxs.get_const_data(),
-            *this->dforest, this->dmtx_chol.get(), dtmp);
 
-        GKO_ASSERT_MTX_NEAR(this->mtx_chol, this->dmtx_chol,
-                            r<value_type>::value);
-    });
+TYPED_TEST(Cholesky, KernelFactorizeWithLargeSupernodesIsEquivalentToRef)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using matrix_type = typename TestFixture::matrix_type;
+    // the dense trailing block turns into supernodes larger than the panel
+    // size limit, which get updates from many rows of the sparse leading block
+    const index_type num_sparse = 100;
+    const index_type num_dense = 200;
+    const index_type size = num_sparse + num_dense;
+    gko::matrix_data<value_type, index_type> data{gko::dim<2>(size, size)};
+    for (index_type row = 0; row < num_sparse; row++) {
+        data.nonzeros.emplace_back(row, row, 4.0);
+        if (row > 0) {
+            data.nonzeros.emplace_back(row, row - 1, -1.0);
+            data.nonzeros.emplace_back(row - 1, row, -1.0);
+        }
+        const auto col = num_sparse + row * 7 % num_dense;
+        data.nonzeros.emplace_back(row, col, -1.0);
+        data.nonzeros.emplace_back(col, row, -1.0);
+    }
+    for (index_type row = num_sparse; row < size; row++) {
+        for (index_type col = num_sparse; col < size; col++) {
+            data.nonzeros.emplace_back(row, col, row == col ? size : -0.5);
+        }
+    }
+    data.sort_row_major();
+    auto mtx = matrix_type::create(this->ref);
+    mtx->read(data);
+    std::unique_ptr<matrix_type> mtx_chol;
+    std::unique_ptr<typename TestFixture::elimination_forest> forest;
+    gko::factorization::symbolic_cholesky(mtx.get(), true, mtx_chol, forest);
+    gko::matrix_data<value_type, index_type> mtx_chol_data;
+    mtx_chol->write(mtx_chol_data);
+    this->initialize_data(std::move(mtx), std::move(mtx_chol_data));
+
+    this->assert_factorize_is_equivalent_to_ref();
 }
 
 
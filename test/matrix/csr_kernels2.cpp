@@ -95,7 +95,8 @@ protected:
     void set_up_strategy(std::shared_ptr<typename Mtx::load_balance>& strategy)
     {
 #ifdef GKO_COMPILING_OMP
-        throw std::runtime_error{"We shouldn't be testing this"};
+        strategy =
+            std::make_shared<typename Mtx::load_balance>(exec->get_num_cores());
 #else
         strategy = std::make_shared<typename Mtx::load_balance>(exec);
 #endif
@@ -290,10 +291,6 @@ TEST_F(Csr, AdvancedApplyToDenseMatrixIsEquivalentToRefWithClassical)
 }
 
 
-// OpenMP doesn't have strategies
-#ifndef GKO_COMPILING_OMP
-
-
 TEST_F(Csr, SimpleApplyIsEquivalentToRefWithLoadBalance)
 {
     set_up_apply_data<Mtx::load_balance>();
@@ -396,6 +393,10 @@ TEST_F(Csr, AdvancedApplyIsEquivalentToRefWithMergePath)
 }
 
 
+// OpenMP doesn't have an automatical strategy
+#ifndef GKO_COMPILING_OMP
+
+
 TEST_F(Csr, SimpleApplyIsEquivalentToRefWithAutomatical)
 {
     set_up_apply_data<Mtx::automatical>();
@@ -419,6 +420,9 @@ TEST_F(Csr, SimpleApplyIsEquivalentToRefWithAutomaticalUnsorted)
 }
 
 
+#endif
+
+
 TEST_F(Csr, SimpleApplyToDenseMatrixIsEquivalentToRefWithLoadBalance)
 {
     set_up_apply_data<Mtx::load_balance>(3);
@@ -463,6 +467,40 @@ TEST_F(Csr, AdvancedApplyToDenseMatrixIsEquivalentToRefWithMergePath)
 }
 
 
+TEST_F(Csr, AdvancedApplyToDenseMatrixIsEquivalentToRefWithMergePathBlocked)
+{
+    // the first four columns are computed as a block, the rest separately
+    set_up_apply_data<Mtx::merge_path>(6);
+
+    mtx->apply(alpha, y, beta, expected);
+    dmtx->apply(dalpha, dy, dbeta, dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+TEST_F(Csr, SimpleApplyWithLongRowsIsEquivalentToRefWithMergePath)
+{
+    // rows that are longer than the work of a single thread
+    set_up_apply_data<Mtx::merge_path>(2);
+    mtx = gen_mtx<Mtx>(20, 2000, 100);
+    dmtx = Mtx::create(exec, std::make_shared<Mtx::merge_path>());
+    dmtx->copy_from(mtx);
+    y = gen_mtx<Vec>(2000, 2, 1);
+    dy = gko::clone(exec, y);
+    expected = gen_mtx<Vec>(20, 2, 1);
+    dresult = gko::clone(exec, expected);
+
+    mtx->apply(y, expected);
+    dmtx->apply(dy, dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
+#ifndef GKO_COMPILING_OMP
+
+
 TEST_F(Csr, OneAutomaticalWorksWithDifferentMatrices)
 {
     auto automatical = std::make_shared<Mtx::automatical>(exec);
@@ -294,6 +294,24 @@ TEST_F(Dense, AdvancedApplyIsEquivalentToRef)
 }
 
 
+TEST_F(Dense, AdvancedApplyLargeIsEquivalentToRef)
+{
+    set_up_apply_data();
+    // large and unaligned enough to use the blocked kernels with partial tiles
+    auto a = gen_mtx<Mtx>(131, 300);
+    auto b = gen_mtx<Mtx>(300, 277);
+    auto c = gen_mtx<Mtx>(131, 277);
+    auto da = gko::clone(exec, a);
+    auto db = gko::clone(exec, b);
+    auto dc = gko::clone(exec, c);
+
+    a->apply(alpha, b, beta, c);
+    da->apply(dalpha, db, dbeta, dc);
+
+    GKO_ASSERT_MTX_NEAR(dc, c, 10 * r<value_type>::value);
+}
+
+
 TEST_F(Dense, AdvancedApplyMixedIsEquivalentToRef)
 {
     set_up_apply_data();
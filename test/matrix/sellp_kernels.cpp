@@ -161,6 +161,20 @@ TEST_F(Sellp,
 }
 
 
+TEST_F(Sellp, SimpleApplyMultipleRHSWithSmallSliceSizeIsEquivalentToRef)
+{
+    set_up_apply_matrix(5);
+    mtx = Mtx::create(ref, gko::dim<2>{}, 8, 1, 0);
+    mtx->move_from(gen_mtx(532, 231));
+    dmtx = gko::clone(exec, mtx);
+
+    mtx->apply(y, expected);
+    dmtx->apply(dy, dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, expected, r<value_type>::value);
+}
+
+
 TEST_F(Sellp, ApplyToComplexIsEquivalentToRef)
 {
     set_up_apply_matrix(64);
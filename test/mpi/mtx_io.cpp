@@ -0,0 +1,241 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/matrix_data.hpp>
+#include <ginkgo/core/base/mtx_io.hpp>
+#include <ginkgo/core/distributed/mtx_io.hpp>
+#include <ginkgo/core/distributed/partition.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+#include "core/base/mtx_io.hpp"
+#include "core/test/utils.hpp"
+#include "test/utils/mpi/common_fixture.hpp"
+
+
+template <typename ValueLocalGlobalIndexType>
+class MtxIo : public CommonMpiTestFixture {
+protected:
+    using value_type = typename std::tuple_element<
+        0, decltype(ValueLocalGlobalIndexType())>::type;
+    using local_index_type = typename std::tuple_element<
+        1, decltype(ValueLocalGlobalIndexType())>::type;
+    using global_index_type = typename std::tuple_element<
+        2, decltype(ValueLocalGlobalIndexType())>::type;
+    using part_type =
+        gko::experimental::distributed::Partition<local_index_type,
+                                                  global_index_type>;
+    using md_type = gko::matrix_data<value_type, global_index_type>;
+    using csr_type = gko::matrix::Csr<value_type, global_index_type>;
+    using comm_index_type = gko::experimental::distributed::comm_index_type;
+
+    MtxIo()
+        : filename{"distributed_mtx_io_test.bin"},
+          mapping{1, 0, 2, 2, 0, 1, 1},
+          data{gko::dim<2>{7, 6},
+               {{0, 0, 1},
+                {0, 3, 2},
+                {1, 1, 3},
+                {2, 0, 4},
+                {2, 5, 5},
+                {3, 2, 6},
+                {5, 1, 8},
+                {5, 3, 9},
+                {6, 0, 10},
+                {6, 4, 11},
+                {6, 5, 12}}},
+          part{gko::share(part_type::build_from_mapping(
+              exec,
+              gko::array<comm_index_type>{exec, mapping.begin(),
+                                          mapping.end()},
+              3))}
+    {}
+
+    void SetUp() override { ASSERT_EQ(comm.size(), 3); }
+
+    ~MtxIo()
+    {
+        comm.synchronize();
+        if (comm.rank() == 0) {
+            std::remove(filename.c_str());
+        }
+    }
+
+    template <typename ValueType, typename IndexType>
+    void write_coo(const gko::matrix_data<ValueType, IndexType>& file_data)
+    {
+        if (comm.rank() == 0) {
+            std::ofstream os{filename, std::ios::binary};
+            gko::write_binary_raw(os, file_data);
+        }
+        comm.synchronize();
+    }
+
+    void write_csr()
+    {
+        if (comm.rank() == 0) {
+            auto csr = csr_type::create(ref);
+            csr->read(data);
+            std::ofstream os{filename, std::ios::binary};
+            gko::write_binary_csr(os, csr.get());
+        }
+        comm.synchronize();
+    }
+
+    void assert_owned_rows(
+        const gko::device_matrix_data<value_type, global_index_type>& result)
+    {
+        md_type expected{data.size};
+        for (auto entry : data.nonzeros) {
+            if (mapping[entry.row] == comm.rank()) {
+                expected.nonzeros.push_back(entry);
+            }
+        }
+
+        auto host_result = result.copy_to_host();
+
+        ASSERT_EQ(result.get_executor(), exec);
+        ASSERT_EQ(host_result.size, expected.size);
+        ASSERT_EQ(host_result.nonzeros, expected.nonzeros);
+    }
+
+    std::string filename;
+    std::vector<comm_index_type> mapping;
+    md_type data;
+    std::shared_ptr<part_type> part;
+};
+
+TYPED_TEST_SUITE(MtxIo, gko::test::ValueLocalGlobalIndexTypes,
+                 TupleTypenameNameGenerator);
+
+
+TYPED_TEST(MtxIo, ReadsBinaryFormat)
+{
+    using value_type = typename TestFixture::value_type;
+    using local_index_type = typename TestFixture::local_index_type;
+    using global_index_type = typename TestFixture::global_index_type;
+    this->write_coo(this->data);
+
+    auto result = gko::experimental::distributed::read_binary_distributed_raw<
+        value_type, local_index_type, global_index_type>(
+        this->exec, this->comm, this->filename, this->part);
+
+    this->assert_owned_rows(result);
+}
+
+
+TYPED_TEST(MtxIo, ReadsCsrBinaryFormat)
+{
+    using value_type = typename TestFixture::value_type;
+    using local_index_type = typename TestFixture::local_index_type;
+    using global_index_type = typename TestFixture::global_index_type;
+    this->write_csr();
+
+    auto result = gko::experimental::distributed::read_binary_distributed_raw<
+        value_type, local_index_type, global_index_type>(
+        this->exec, this->comm, this->filename, this->part);
+
+    this->assert_owned_rows(result);
+}
+
+
+TYPED_TEST(MtxIo, ReadsBinaryFormatWithOtherTypes)
+{
+    using value_type = typename TestFixture::value_type;
+    using local_index_type = typename TestFixture::local_index_type;
+    using global_index_type = typename TestFixture::global_index_type;
+    gko::matrix_data<float, gko::int32> file_data{this->data.size};
+    for (auto entry : this->data.nonzeros) {
+        file_data.nonzeros.emplace_back(
+            static_cast<gko::int32>(entry.row),
+            static_cast<gko::int32>(entry.column),
+            static_cast<float>(gko::real(entry.value)));
+    }
+    this->write_coo(file_data);
+
+    auto result = gko::experimental::distributed::read_binary_distributed_raw<
+        value_type, local_index_type, global_index_type>(
+        this->exec, this->comm, this->filename, this->part);
+
+    this->assert_owned_rows(result);
+}
+
+
+TYPED_TEST(MtxIo, ThrowsOnPartitionSizeMismatch)
+{
+    using value_type = typename TestFixture::value_type;
+    using local_index_type = typename TestFixture::local_index_type;
+    using global_index_type = typename TestFixture::global_index_type;
+    using part_type = typename TestFixture::part_type;
+    this->write_csr();
+    auto part = gko::share(part_type::build_from_global_size_uniform(
+        this->exec, this->comm.size(), 9));
+
+    ASSERT_THROW(
+        (gko::experimental::distributed::read_binary_distributed_raw<
+            value_type, local_index_type, global_index_type>(
+            this->exec, this->comm, this->filename, part)),
+        gko::StreamError);
+}
+
+
+TYPED_TEST(MtxIo, ThrowsOnAllRanksOnOutOfBoundsEntry)
+{
+    using value_type = typename TestFixture::value_type;
+    using local_index_type = typename TestFixture::local_index_type;
+    using global_index_type = typename TestFixture::global_index_type;
+    auto file_data = this->data;
+    // only the rank reading the last block of entries sees this one
+    file_data.nonzeros.back().column = 6;
+    this->write_coo(file_data);
+
+    ASSERT_THROW(
+        (gko::experimental::distributed::read_binary_distributed_raw<
+            value_type, local_index_type, global_index_type>(
+            this->exec, this->comm, this->filename, this->part)),
+        gko::StreamError);
+}
+
+
+TYPED_TEST(MtxIo, ThrowsOnAllRanksOnOutOfBoundsCsrColumn)
+{
+    using value_type = typename TestFixture::value_type;
+    using local_index_type = typename TestFixture::local_index_type;
+    using global_index_type = typename TestFixture::global_index_type;
+    using csr_type = typename TestFixture::csr_type;
+    // only the owner of row 6 reads its column 6, which is out of bounds
+    // after the number of columns in the header is reduced to 6
+    if (this->comm.rank() == 0) {
+        auto file_data = this->data;
+        file_data.size = gko::dim<2>{7, 7};
+        file_data.nonzeros.back().column = 6;
+        auto csr = csr_type::create(this->ref);
+        csr->read(file_data);
+        std::fstream fs{this->filename,
+                        std::ios::binary | std::ios::in | std::ios::out |
+                            std::ios::trunc};
+        gko::write_binary_csr(fs, csr.get());
+        gko::binary_header header{};
+        fs.seekg(0);
+        fs.read(reinterpret_cast<char*>(&header), sizeof(header));
+        header.num_cols = 6;
+        fs.seekp(0);
+        fs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+    this->comm.synchronize();
+
+    ASSERT_THROW(
+        (gko::experimental::distributed::read_binary_distributed_raw<
+            value_type, local_index_type, global_index_type>(
+            this->exec, this->comm, this->filename, this->part)),
+        gko::StreamError);
+}
@@ -2,6 +2,8 @@
 //
 // SPDX-License-Identifier: BSD-3-Clause
 
+#include <ginkgo/core/base/device_matrix_data.hpp>
+#include <ginkgo/core/base/matrix_data.hpp>
 #include <ginkgo/core/distributed/partition.hpp>
 #include <ginkgo/core/distributed/partition_helpers.hpp>
 
@@ -101,3 +103,45 @@ TYPED_TEST(PartitionHelpers, CanBuildFromLocalSize)
                                          this->exec, expects_pid.get_size(),
                                          part->get_part_ids()));
 }
+
+
+TYPED_TEST(PartitionHelpers, CanBuildFromMatrixData)
+{
+    using itype = typename TestFixture::index_type;
+    const itype size = 12;
+    gko::matrix_data<double, itype> data{gko::dim<2>(size * size)};
+    for (itype y = 0; y < size; y++) {
+        for (itype x = 0; x < size; x++) {
+            const auto row = y * size + x;
+            data.nonzeros.emplace_back(row, row, 4.0);
+            if (x > 0) {
+                data.nonzeros.emplace_back(row, row - 1, -1.0);
+            }
+            if (x < size - 1) {
+                data.nonzeros.emplace_back(row, row + 1, -1.0);
+            }
+            if (y > 0) {
+                data.nonzeros.emplace_back(row, row - size, -1.0);
+            }
+            if (y < size - 1) {
+                data.nonzeros.emplace_back(row, row + size, -1.0);
+            }
+        }
+    }
+    auto device_data =
+        gko::device_matrix_data<double, itype>::create_from_host(this->exec,
+                                                                 data);
+
+    auto part =
+        gko::experimental::distributed::build_partition_from_matrix_data<
+            double, gko::int32, itype>(this->exec, this->comm, device_data);
+
+    ASSERT_EQ(part->get_size(), size * size);
+    ASSERT_EQ(part->get_num_parts(), this->comm.size());
+    // the parts are balanced up to the imbalance of the recursive bisection
+    for (comm_index_type pid = 0; pid < part->get_num_parts(); pid++) {
+        const auto part_size = part->get_part_size(pid);
+        ASSERT_GE(part_size, 40);
+        ASSERT_LE(part_size, 56);
+    }
+}
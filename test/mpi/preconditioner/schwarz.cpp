@@ -20,6 +20,7 @@
 #include <ginkgo/core/log/logger.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/multigrid/pgm.hpp>
 #include <ginkgo/core/preconditioner/jacobi.hpp>
 #include <ginkgo/core/solver/bicgstab.hpp>
 #include <ginkgo/core/solver/cg.hpp>
@@ -126,9 +127,51 @@ protected:
     std::shared_ptr<gko::LinOpFactory> dist_solver_factory;
     std::shared_ptr<gko::LinOpFactory> local_solver_factory;
 
+    std::shared_ptr<gko::LinOpFactory> create_exact_solver_factory()
+    {
+        return gko::solver::Cg<value_type>::build()
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(100u),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(
+                        static_cast<gko::remove_complex<value_type>>(
+                            r<value_type>::value * 1e-2)))
+            .on(exec);
+    }
+
+    void assert_preconditioned_solve_converges(
+        std::shared_ptr<gko::LinOpFactory> precond_factory)
+    {
+        auto iter_stop = gko::share(
+            gko::stop::Iteration::build().with_max_iters(200u).on(exec));
+        auto tol_stop = gko::share(
+            gko::stop::ResidualNorm<value_type>::build()
+                .with_reduction_factor(
+                    static_cast<gko::remove_complex<value_type>>(
+                        r<value_type>::value * 1e-2))
+                .on(exec));
+        auto dist_solver = solver_type::build()
+                               .with_preconditioner(precond_factory)
+                               .with_criteria(iter_stop, tol_stop)
+                               .on(exec)
+                               ->generate(dist_mat);
+        auto non_dist_solver = solver_type::build()
+                                   .with_preconditioner(local_solver_factory)
+                                   .with_criteria(iter_stop, tol_stop)
+                                   .on(exec)
+                                   ->generate(non_dist_mat);
+
+        dist_solver->apply(dist_b, dist_x);
+        non_dist_solver->apply(non_dist_b, non_dist_x);
+
+        assert_equal_to_non_distributed_vector(dist_x, non_dist_x,
+                                               100 * r<value_type>::value);
+    }
+
     void assert_equal_to_non_distributed_vector(
         std::shared_ptr<dist_vec_type> dist_vec,
-        std::shared_ptr<local_vec_type> local_vec)
+        std::shared_ptr<local_vec_type> local_vec,
+        gko::remove_complex<value_type> tolerance = r<value_type>::value)
     {
         auto host_row_part = row_part->clone(ref);
         auto l_dist_vec = dist_vec->get_local_vector();
@@ -139,7 +182,7 @@ protected:
                 local_vec->get_const_values() +
                     host_row_part->get_range_bounds()[comm.rank()]),
             l_dist_vec->get_size()[1]);
-        GKO_ASSERT_MTX_NEAR(l_dist_vec, vec_view.get(), r<value_type>::value);
+        GKO_ASSERT_MTX_NEAR(l_dist_vec, vec_view.get(), tolerance);
     }
 };
 
@@ -296,3 +339,125 @@ TYPED_TEST(SchwarzPreconditioner, CanAdvancedApplyPreconditioner)
     this->assert_equal_to_non_distributed_vector(this->dist_x,
                                                  this->non_dist_x);
 }
+
+
+TYPED_TEST(SchwarzPreconditioner, GenerateFailsWithOverlapAndPregenSolver)
+{
+    using prec = typename TestFixture::dist_prec_type;
+    auto local_solver = gko::share(
+        this->local_solver_factory->generate(this->non_dist_mat));
+    auto schwarz = prec::build()
+                       .with_generated_local_solver(local_solver)
+                       .with_overlap(1u)
+                       .on(this->exec);
+
+    ASSERT_THROW(schwarz->generate(this->dist_mat), gko::InvalidStateError);
+}
+
+
+TYPED_TEST(SchwarzPreconditioner, GenerateFailsIfNoCoarseSolverProvided)
+{
+    using value_type = typename TestFixture::value_type;
+    using local_index_type = typename TestFixture::local_index_type;
+    using prec = typename TestFixture::dist_prec_type;
+    auto schwarz =
+        prec::build()
+            .with_local_solver(this->local_solver_factory)
+            .with_coarse_level(
+                gko::multigrid::Pgm<value_type, local_index_type>::build())
+            .on(this->exec);
+
+    ASSERT_THROW(schwarz->generate(this->dist_mat), gko::InvalidStateError);
+}
+
+
+TYPED_TEST(SchwarzPreconditioner, RestrictedOverlapCoveringDomainIsExact)
+{
+    using value_type = typename TestFixture::value_type;
+    using prec = typename TestFixture::dist_prec_type;
+    auto exact_solver_factory = this->create_exact_solver_factory();
+    // the path graph needs six layers to reach row 7 from the rows 0 and 1
+    // of the first subdomain
+    auto precond = prec::build()
+                       .with_local_solver(exact_solver_factory)
+                       .with_overlap(6u)
+                       .on(this->exec)
+                       ->generate(this->dist_mat);
+    auto exact_solver = exact_solver_factory->generate(this->non_dist_mat);
+
+    precond->apply(this->dist_b, this->dist_x);
+    exact_solver->apply(this->non_dist_b, this->non_dist_x);
+
+    this->assert_equal_to_non_distributed_vector(
+        this->dist_x, this->non_dist_x, 100 * r<value_type>::value);
+}
+
+
+TYPED_TEST(SchwarzPreconditioner, AdditiveOverlapCoveringDomainAddsUpSolves)
+{
+    using value_type = typename TestFixture::value_type;
+    using prec = typename TestFixture::dist_prec_type;
+    auto exact_solver_factory = this->create_exact_solver_factory();
+    auto precond = prec::build()
+                       .with_local_solver(exact_solver_factory)
+                       .with_overlap(6u)
+                       .with_restricted(false)
+                       .on(this->exec)
+                       ->generate(this->dist_mat);
+    auto exact_solver = exact_solver_factory->generate(this->non_dist_mat);
+
+    precond->apply(this->dist_b, this->dist_x);
+    exact_solver->apply(this->non_dist_b, this->non_dist_x);
+
+    // each of the three subdomains contributes the exact solution
+    this->non_dist_x->scale(
+        gko::initialize<typename TestFixture::local_vec_type>({3.0},
+                                                              this->exec));
+    this->assert_equal_to_non_distributed_vector(
+        this->dist_x, this->non_dist_x, 100 * r<value_type>::value);
+}
+
+
+TYPED_TEST(SchwarzPreconditioner, CanApplyPreconditionedSolverWithOverlap)
+{
+    using prec = typename TestFixture::dist_prec_type;
+
+    this->assert_preconditioned_solve_converges(
+        prec::build()
+            .with_local_solver(this->create_exact_solver_factory())
+            .with_overlap(1u)
+            .on(this->exec));
+}
+
+
+TYPED_TEST(SchwarzPreconditioner,
+           CanApplyPreconditionedSolverWithAdditiveOverlap)
+{
+    using prec = typename TestFixture::dist_prec_type;
+
+    this->assert_preconditioned_solve_converges(
+        prec::build()
+            .with_local_solver(this->create_exact_solver_factory())
+            .with_overlap(2u)
+            .with_restricted(false)
+            .on(this->exec));
+}
+
+
+TYPED_TEST(SchwarzPreconditioner, CanApplyPreconditionedSolverWithCoarseLevel)
+{
+    using value_type = typename TestFixture::value_type;
+    using local_index_type = typename TestFixture::local_index_type;
+    using prec = typename TestFixture::dist_prec_type;
+
+    this->assert_preconditioned_solve_converges(
+        prec::build()
+            .with_local_solver(this->local_solver_factory)
+            .with_overlap(1u)
+            .with_coarse_level(
+                gko::multigrid::Pgm<value_type, local_index_type>::build()
+                    .with_deterministic(true))
+            .with_coarse_solver(this->create_exact_solver_factory())
+            .with_coarse_weight(value_type{0.5})
+            .on(this->exec));
+}
@@ -26,6 +26,8 @@
 #include <ginkgo/core/solver/gmres.hpp>
 #include <ginkgo/core/solver/ir.hpp>
 #include <ginkgo/core/solver/multigrid.hpp>
+#include <ginkgo/core/solver/pipe_bicgstab.hpp>
+#include <ginkgo/core/solver/pipe_cg.hpp>
 #include <ginkgo/core/stop/residual_norm.hpp>
 
 #include "core/test/utils.hpp"
@@ -174,6 +176,22 @@ struct Bicgstab : SimpleSolverTest<gko::solver::Bicgstab<solver_value_type>> {
 };
 
 
+struct PipeCg : SimpleSolverTest<gko::solver::PipeCg<solver_value_type>> {
+    static void preprocess(
+        gko::matrix_data<value_type, global_index_type>& data)
+    {
+        // make sure the matrix is well-conditioned
+        gko::utils::make_hpd(data, 1.5);
+    }
+};
+
+
+struct PipeBicgstab
+    : SimpleSolverTest<gko::solver::PipeBicgstab<solver_value_type>> {
+    static constexpr double tolerance() { return 300 * reduction_factor(); }
+};
+
+
 struct Ir : SimpleSolverTest<gko::solver::Ir<solver_value_type>> {
     static void preprocess(
         gko::matrix_data<value_type, global_index_type>& data)
@@ -531,10 +549,12 @@ protected:
 };
 
 using SolverTypes =
-    ::testing::Types<Cg, CgWithMg, Cgs, Fcg, Bicgstab, Ir, Gcr<10u>, Gcr<100u>,
+    ::testing::Types<Cg, CgWithMg, Cgs, Fcg, Bicgstab, PipeCg, PipeBicgstab, Ir,
+                     Gcr<10u>, Gcr<100u>,
                      Gmres<10u, gko::solver::gmres::ortho_method::mgs>,
                      Gmres<10u, gko::solver::gmres::ortho_method::cgs>,
                      Gmres<10u, gko::solver::gmres::ortho_method::cgs2>,
+                     Gmres<10u, gko::solver::gmres::ortho_method::block_cgs2>,
                      Gmres<100u, gko::solver::gmres::ortho_method::mgs>>;
 
 TYPED_TEST_SUITE(Solver, SolverTypes, TypenameNameGenerator);
@@ -21,6 +21,7 @@
 #include <ginkgo/core/stop/iteration.hpp>
 #include <ginkgo/core/stop/residual_norm.hpp>
 
+#include "core/components/prefix_sum_kernels.hpp"
 #include "core/test/utils.hpp"
 #include "core/test/utils/matrix_generator.hpp"
 #include "core/test/utils/unsort_matrix.hpp"
@@ -295,6 +296,102 @@ TEST_F(Pgm, GenerateMgLevelIsEquivalentToRef)
 }
 
 
+TEST_F(Pgm, UpdateValuesIsEquivalentToRef)
+{
+    initialize_data();
+    auto mg_level_factory = gko::multigrid::Pgm<value_type, int>::build()
+                                .with_deterministic(true)
+                                .with_skip_sorting(true)
+                                .on(ref);
+    auto d_mg_level_factory = gko::multigrid::Pgm<value_type, int>::build()
+                                  .with_deterministic(true)
+                                  .with_skip_sorting(true)
+                                  .on(exec);
+    auto mg_level = mg_level_factory->generate(system_mtx);
+    auto d_mg_level = d_mg_level_factory->generate(d_system_mtx);
+    // same sparsity pattern with different values
+    auto new_mtx = gko::share(gko::clone(ref, system_mtx));
+    std::uniform_real_distribution<> dist(0.5, 2.0);
+    for (gko::size_type i = 0; i < new_mtx->get_num_stored_elements(); i++) {
+        new_mtx->get_values()[i] *=
+            static_cast<gko::remove_complex<value_type>>(dist(rand_engine));
+    }
+    auto d_new_mtx = gko::share(gko::clone(exec, new_mtx));
+
+    mg_level->update_values(new_mtx);
+    d_mg_level->update_values(d_new_mtx);
+
+    GKO_ASSERT_MTX_NEAR(gko::as<Csr>(d_mg_level->get_coarse_op()),
+                        gko::as<Csr>(mg_level->get_coarse_op()),
+                        r<value_type>::value);
+}
+
+
+TEST_F(Pgm, FilterProlongationIsEquivalentToRef)
+{
+    initialize_data();
+    const gko::remove_complex<value_type> threshold{0.3};
+    const auto num_rows = system_mtx->get_size()[0];
+    gko::array<index_type> row_ptrs{ref, num_rows + 1};
+    gko::array<index_type> d_row_ptrs{exec, num_rows + 1};
+
+    gko::kernels::reference::pgm::filter_prolongation_count(
+        ref, system_mtx.get(), threshold, row_ptrs.get_data());
+    gko::kernels::GKO_DEVICE_NAMESPACE::pgm::filter_prolongation_count(
+        exec, d_system_mtx.get(), threshold, d_row_ptrs.get_data());
+    gko::kernels::reference::components::prefix_sum_nonnegative(
+        ref, row_ptrs.get_data(), num_rows + 1);
+    gko::kernels::GKO_DEVICE_NAMESPACE::components::prefix_sum_nonnegative(
+        exec, d_row_ptrs.get_data(), num_rows + 1);
+    const auto nnz = row_ptrs.get_const_data()[num_rows];
+    auto filtered = Csr::create(ref, system_mtx->get_size(),
+                                gko::array<value_type>{ref, nnz},
+                                gko::array<index_type>{ref, nnz}, row_ptrs);
+    auto d_filtered = Csr::create(exec, system_mtx->get_size(),
+                                  gko::array<value_type>{exec, nnz},
+                                  gko::array<index_type>{exec, nnz},
+                                  d_row_ptrs);
+    gko::kernels::reference::pgm::filter_prolongation_fill(
+        ref, system_mtx.get(), threshold, filtered.get());
+    gko::kernels::GKO_DEVICE_NAMESPACE::pgm::filter_prolongation_fill(
+        exec, d_system_mtx.get(), threshold, d_filtered.get());
+
+    GKO_ASSERT_ARRAY_EQ(d_row_ptrs, row_ptrs);
+    GKO_ASSERT_MTX_NEAR(d_filtered, filtered, r<value_type>::value);
+}
+
+
+TEST_F(Pgm, GenerateSmoothedMgLevelIsEquivalentToRef)
+{
+    initialize_data();
+    auto mg_level_factory = gko::multigrid::Pgm<value_type, int>::build()
+                                .with_deterministic(true)
+                                .with_skip_sorting(true)
+                                .with_smoothed_aggregation(true)
+                                .with_prolongation_filter_threshold(0.1)
+                                .on(ref);
+    auto d_mg_level_factory = gko::multigrid::Pgm<value_type, int>::build()
+                                  .with_deterministic(true)
+                                  .with_skip_sorting(true)
+                                  .with_smoothed_aggregation(true)
+                                  .with_prolongation_filter_threshold(0.1)
+                                  .on(exec);
+
+    auto mg_level = mg_level_factory->generate(system_mtx);
+    auto d_mg_level = d_mg_level_factory->generate(d_system_mtx);
+
+    GKO_ASSERT_MTX_NEAR(gko::as<Csr>(d_mg_level->get_prolong_op()),
+                        gko::as<Csr>(mg_level->get_prolong_op()),
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(gko::as<Csr>(d_mg_level->get_restrict_op()),
+                        gko::as<Csr>(mg_level->get_restrict_op()),
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(gko::as<Csr>(d_mg_level->get_coarse_op()),
+                        gko::as<Csr>(mg_level->get_coarse_op()),
+                        r<value_type>::value);
+}
+
+
 TEST_F(Pgm, GenerateMgLevelIsEquivalentToRefOnUnsortedMatrix)
 {
     initialize_data();
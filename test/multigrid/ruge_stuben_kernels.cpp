@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/multigrid/ruge_stuben_kernels.hpp"
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/multigrid/ruge_stuben.hpp>
+
+#include "core/test/utils.hpp"
+#include "core/test/utils/matrix_generator.hpp"
+#include "core/utils/matrix_utils.hpp"
+#include "test/utils/common_fixture.hpp"
+
+
+class RugeStuben : public CommonTestFixture {
+protected:
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using MgLevel = gko::multigrid::RugeStuben<value_type, index_type>;
+
+    RugeStuben() : rand_engine(30)
+    {
+        auto system_data =
+            gko::test::generate_random_matrix_data<value_type, index_type>(
+                m, m, std::uniform_int_distribution<>(5, 20),
+                std::normal_distribution<value_type>(-1.0, 1.0), rand_engine);
+        gko::utils::make_symmetric(system_data);
+        gko::utils::make_diag_dominant(system_data);
+        system_mtx = Csr::create(ref);
+        system_mtx->read(system_data);
+        d_system_mtx = gko::clone(exec, system_mtx);
+    }
+
+    void assert_same_level(const MgLevel* mg_level, const MgLevel* d_mg_level)
+    {
+        auto splitting = gko::array<index_type>::const_view(
+            ref, m, mg_level->get_const_cf_splitting());
+        auto d_splitting = gko::array<index_type>::const_view(
+            exec, m, d_mg_level->get_const_cf_splitting());
+        GKO_ASSERT_ARRAY_EQ(d_splitting, splitting);
+        GKO_ASSERT_MTX_NEAR(gko::as<Csr>(d_mg_level->get_prolong_op()),
+                            gko::as<Csr>(mg_level->get_prolong_op()),
+                            r<value_type>::value);
+        GKO_ASSERT_MTX_NEAR(gko::as<Csr>(d_mg_level->get_restrict_op()),
+                            gko::as<Csr>(mg_level->get_restrict_op()),
+                            r<value_type>::value);
+        GKO_ASSERT_MTX_NEAR(gko::as<Csr>(d_mg_level->get_coarse_op()),
+                            gko::as<Csr>(mg_level->get_coarse_op()),
+                            r<value_type>::value);
+    }
+
+    const gko::size_type m = 597;
+    std::default_random_engine rand_engine;
+    std::shared_ptr<Csr> system_mtx;
+    std::shared_ptr<Csr> d_system_mtx;
+};
+
+
+TEST_F(RugeStuben, ComputeStrongCountIsEquivalentToRef)
+{
+    gko::array<index_type> row_nnz(ref, m);
+    gko::array<index_type> d_row_nnz(exec, m);
+
+    gko::kernels::reference::ruge_stuben::compute_strong_count(
+        ref, system_mtx.get(), gko::remove_complex<value_type>{0.25},
+        row_nnz.get_data());
+    gko::kernels::GKO_DEVICE_NAMESPACE::ruge_stuben::compute_strong_count(
+        exec, d_system_mtx.get(), gko::remove_complex<value_type>{0.25},
+        d_row_nnz.get_data());
+
+    GKO_ASSERT_ARRAY_EQ(d_row_nnz, row_nnz);
+}
+
+
+TEST_F(RugeStuben, GeneratePmisDirectMgLevelIsEquivalentToRef)
+{
+    auto factory = MgLevel::build().with_strength_threshold(0.5);
+
+    auto mg_level = factory.on(ref)->generate(system_mtx);
+    auto d_mg_level = factory.on(exec)->generate(d_system_mtx);
+
+    assert_same_level(mg_level.get(), d_mg_level.get());
+}
+
+
+TEST_F(RugeStuben, GenerateHmisExtendedIMgLevelIsEquivalentToRef)
+{
+    auto factory =
+        MgLevel::build()
+            .with_strength_threshold(0.5)
+            .with_splitting(gko::multigrid::splitting_type::hmis)
+            .with_interpolation(gko::multigrid::interpolation_type::extended_i);
+
+    auto mg_level = factory.on(ref)->generate(system_mtx);
+    auto d_mg_level = factory.on(exec)->generate(d_system_mtx);
+
+    assert_same_level(mg_level.get(), d_mg_level.get());
+}
+
+
+TEST_F(RugeStuben, UpdateValuesIsEquivalentToRef)
+{
+    auto factory = MgLevel::build().with_interpolation(
+        gko::multigrid::interpolation_type::extended_i);
+    auto mg_level = factory.on(ref)->generate(system_mtx);
+    auto d_mg_level = factory.on(exec)->generate(d_system_mtx);
+    auto scaled = gko::share(gko::clone(system_mtx));
+    scaled->scale(gko::initialize<gko::matrix::Dense<value_type>>({2.0}, ref));
+    auto d_scaled = gko::share(gko::clone(exec, scaled));
+
+    mg_level->update_values(scaled);
+    d_mg_level->update_values(d_scaled);
+
+    assert_same_level(mg_level.get(), d_mg_level.get());
+}
@@ -12,6 +12,7 @@
 #include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/preconditioner/sor.hpp>
 
 #include "core/test/utils.hpp"
 #include "core/utils/matrix_utils.hpp"
@@ -96,3 +97,60 @@ TEST_F(Sor, InitializeWeightedLAndUFactorIsSameAsReference)
     GKO_ASSERT_MTX_NEAR(result_l, d_result_l, r<value_type>::value);
     GKO_ASSERT_MTX_NEAR(result_u, d_result_u, r<value_type>::value);
 }
+
+
+#ifdef GKO_COMPILING_OMP
+// the multicolor kernels are only implemented for OpenMP
+
+
+TEST_F(Sor, ComputeMulticolorOrderingIsSameAsReference)
+{
+    const auto n = mtx->get_size()[0];
+    auto trans = gko::as<Csr>(mtx->transpose());
+    auto d_trans = gko::as<Csr>(d_mtx->transpose());
+    gko::array<index_type> perm{ref, n};
+    gko::array<index_type> d_perm{exec, n};
+    gko::array<index_type> color_ptrs{ref};
+    gko::array<index_type> d_color_ptrs{exec};
+
+    gko::kernels::reference::sor::compute_multicolor_ordering(
+        ref, n, mtx->get_const_row_ptrs(), mtx->get_const_col_idxs(),
+        trans->get_const_row_ptrs(), trans->get_const_col_idxs(),
+        perm.get_data(), color_ptrs);
+    gko::kernels::GKO_DEVICE_NAMESPACE::sor::compute_multicolor_ordering(
+        exec, n, d_mtx->get_const_row_ptrs(), d_mtx->get_const_col_idxs(),
+        d_trans->get_const_row_ptrs(), d_trans->get_const_col_idxs(),
+        d_perm.get_data(), d_color_ptrs);
+
+    GKO_ASSERT_ARRAY_EQ(perm, d_perm);
+    GKO_ASSERT_ARRAY_EQ(color_ptrs, d_color_ptrs);
+}
+
+
+TEST_F(Sor, ApplyMulticolorSymmetricSorIsSameAsReference)
+{
+    auto md = gko::test::generate_random_matrix_data<value_type, index_type>(
+        133, 133, std::uniform_int_distribution<index_type>(1, 15),
+        std::uniform_real_distribution<value_type>(-1., 1.), rand_engine);
+    gko::utils::make_diag_dominant(md);
+    std::shared_ptr<Csr> diag_dominant = Csr::create(ref);
+    diag_dominant->read(md);
+    std::shared_ptr<Csr> d_diag_dominant = gko::clone(exec, diag_dominant);
+    auto b = gko::test::generate_random_matrix<Dense>(
+        133, 3, std::uniform_int_distribution<>(3, 3),
+        std::normal_distribution<value_type>(), rand_engine, ref);
+    auto d_b = gko::clone(exec, b);
+    auto x = Dense::create(ref, b->get_size());
+    auto d_x = Dense::create(exec, b->get_size());
+    auto factory = gko::preconditioner::Sor<value_type, index_type>::build()
+                       .with_symmetric(true)
+                       .with_multicolor(true);
+
+    factory.on(ref)->generate(diag_dominant)->apply(b, x);
+    factory.on(exec)->generate(d_diag_dominant)->apply(d_b, d_x);
+
+    GKO_ASSERT_MTX_NEAR(x, d_x, r<value_type>::value);
+}
+
+
+#endif  // GKO_COMPILING_OMP
@@ -0,0 +1,168 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/reorder/graph_partition_kernels.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+#include "core/reorder/graph_partition.hpp"
+#include "core/test/utils.hpp"
+#include "matrices/config.hpp"
+#include "test/utils/common_fixture.hpp"
+
+
+template <typename IndexType>
+class GraphPartition : public CommonTestFixture {
+protected:
+    using index_type = IndexType;
+    using matrix_type = gko::matrix::Csr<value_type, index_type>;
+
+    GraphPartition()
+        : rng{8249},
+          row_ptrs{ref},
+          col_idxs{ref},
+          edge_weights{ref},
+          vertex_weights{ref}
+    {
+        std::ifstream stream{gko::matrices::location_ani4_mtx};
+        auto mtx = gko::read<matrix_type>(stream, ref);
+        num_vertices = static_cast<index_type>(mtx->get_size()[0]);
+        // drop the diagonal, use symmetric edge and random vertex weights
+        std::uniform_int_distribution<index_type> dist{1, 10};
+        std::vector<index_type> ptrs{0};
+        std::vector<index_type> cols;
+        std::vector<index_type> weights;
+        for (index_type row = 0; row < num_vertices; row++) {
+            for (auto nz = mtx->get_const_row_ptrs()[row];
+                 nz < mtx->get_const_row_ptrs()[row + 1]; nz++) {
+                const auto col = mtx->get_const_col_idxs()[nz];
+                if (col != row) {
+                    cols.push_back(col);
+                    weights.push_back(std::min(row, col) % 7 +
+                                      std::max(row, col) % 3 + 1);
+                }
+            }
+            ptrs.push_back(cols.size());
+        }
+        std::vector<index_type> vweights(num_vertices);
+        for (auto& weight : vweights) {
+            weight = dist(rng);
+        }
+        row_ptrs = gko::array<index_type>{ref, ptrs.begin(), ptrs.end()};
+        col_idxs = gko::array<index_type>{ref, cols.begin(), cols.end()};
+        edge_weights =
+            gko::array<index_type>{ref, weights.begin(), weights.end()};
+        vertex_weights =
+            gko::array<index_type>{ref, vweights.begin(), vweights.end()};
+        drow_ptrs = gko::array<index_type>{exec, row_ptrs};
+        dcol_idxs = gko::array<index_type>{exec, col_idxs};
+        dedge_weights = gko::array<index_type>{exec, edge_weights};
+        dvertex_weights = gko::array<index_type>{exec, vertex_weights};
+    }
+
+    std::default_random_engine rng;
+    index_type num_vertices;
+    gko::array<index_type> row_ptrs;
+    gko::array<index_type> col_idxs;
+    gko::array<index_type> edge_weights;
+    gko::array<index_type> vertex_weights;
+    gko::array<index_type> drow_ptrs;
+    gko::array<index_type> dcol_idxs;
+    gko::array<index_type> dedge_weights;
+    gko::array<index_type> dvertex_weights;
+};
+
+TYPED_TEST_SUITE(GraphPartition, gko::test::IndexTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(GraphPartition, MatchEdgesIsEquivalentToRef)
+{
+    using index_type = typename TestFixture::index_type;
+    const auto size = static_cast<gko::size_type>(this->num_vertices);
+    gko::array<index_type> match{this->ref, size};
+    gko::array<index_type> dmatch{this->exec, size};
+
+    gko::kernels::reference::graph_partition::match_edges(
+        this->ref, this->num_vertices, this->row_ptrs.get_const_data(),
+        this->col_idxs.get_const_data(), this->edge_weights.get_const_data(),
+        this->vertex_weights.get_const_data(), index_type{15},
+        match.get_data());
+    gko::kernels::GKO_DEVICE_NAMESPACE::graph_partition::match_edges(
+        this->exec, this->num_vertices, this->drow_ptrs.get_const_data(),
+        this->dcol_idxs.get_const_data(), this->dedge_weights.get_const_data(),
+        this->dvertex_weights.get_const_data(), index_type{15},
+        dmatch.get_data());
+
+    GKO_ASSERT_ARRAY_EQ(match, dmatch);
+}
+
+
+TYPED_TEST(GraphPartition, ContractGraphIsEquivalentToRef)
+{
+    using index_type = typename TestFixture::index_type;
+    const auto size = static_cast<gko::size_type>(this->num_vertices);
+    gko::array<index_type> match{this->ref, size};
+    gko::kernels::reference::graph_partition::match_edges(
+        this->ref, this->num_vertices, this->row_ptrs.get_const_data(),
+        this->col_idxs.get_const_data(), this->edge_weights.get_const_data(),
+        this->vertex_weights.get_const_data(), index_type{15},
+        match.get_data());
+    gko::array<index_type> dmatch{this->exec, match};
+    gko::array<index_type> coarse_map{this->ref, size};
+    gko::array<index_type> coarse_row_ptrs{this->ref};
+    gko::array<index_type> coarse_col_idxs{this->ref};
+    gko::array<index_type> coarse_edge_weights{this->ref};
+    gko::array<index_type> coarse_vertex_weights{this->ref};
+    gko::array<index_type> dcoarse_map{this->exec, size};
+    gko::array<index_type> dcoarse_row_ptrs{this->exec};
+    gko::array<index_type> dcoarse_col_idxs{this->exec};
+    gko::array<index_type> dcoarse_edge_weights{this->exec};
+    gko::array<index_type> dcoarse_vertex_weights{this->exec};
+
+    gko::kernels::reference::graph_partition::contract_graph(
+        this->ref, this->num_vertices, this->row_ptrs.get_const_data(),
+        this->col_idxs.get_const_data(), this->edge_weights.get_const_data(),
+        this->vertex_weights.get_const_data(), match.get_const_data(),
+        coarse_map.get_data(), coarse_row_ptrs, coarse_col_idxs,
+        coarse_edge_weights, coarse_vertex_weights);
+    gko::kernels::GKO_DEVICE_NAMESPACE::graph_partition::contract_graph(
+        this->exec, this->num_vertices, this->drow_ptrs.get_const_data(),
+        this->dcol_idxs.get_const_data(), this->dedge_weights.get_const_data(),
+        this->dvertex_weights.get_const_data(), dmatch.get_const_data(),
+        dcoarse_map.get_data(), dcoarse_row_ptrs, dcoarse_col_idxs,
+        dcoarse_edge_weights, dcoarse_vertex_weights);
+
+    GKO_ASSERT_ARRAY_EQ(coarse_map, dcoarse_map);
+    GKO_ASSERT_ARRAY_EQ(coarse_row_ptrs, dcoarse_row_ptrs);
+    GKO_ASSERT_ARRAY_EQ(coarse_col_idxs, dcoarse_col_idxs);
+    GKO_ASSERT_ARRAY_EQ(coarse_edge_weights, dcoarse_edge_weights);
+    GKO_ASSERT_ARRAY_EQ(coarse_vertex_weights, dcoarse_vertex_weights);
+}
+
+
+TYPED_TEST(GraphPartition, PartitionGraphIsEquivalentToRef)
+{
+    using index_type = typename TestFixture::index_type;
+    const auto size = static_cast<gko::size_type>(this->num_vertices);
+    gko::array<index_type> parts{this->ref, size};
+    gko::array<index_type> dparts{this->exec, size};
+
+    gko::experimental::reorder::graph_partition::partition_graph(
+        this->ref, this->num_vertices, this->row_ptrs.get_const_data(),
+        this->col_idxs.get_const_data(), index_type{6}, parts.get_data());
+    gko::experimental::reorder::graph_partition::partition_graph(
+        this->exec, this->num_vertices, this->drow_ptrs.get_const_data(),
+        this->dcol_idxs.get_const_data(), index_type{6}, dparts.get_data());
+
+    GKO_ASSERT_ARRAY_EQ(parts, dparts);
+}
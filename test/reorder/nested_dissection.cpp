@@ -54,3 +54,26 @@ TYPED_TEST(NestedDissection, ResultIsEquivalentToRef)
         this->exec, this->mtx->get_size()[0], dperm->get_permutation());
     GKO_ASSERT_ARRAY_EQ(perm_array, dperm_array);
 }
+
+
+TYPED_TEST(NestedDissection, NativeResultIsEquivalentToRef)
+{
+    using reorder_type = typename TestFixture::reorder_type;
+    auto nd_factory = reorder_type::build()
+                          .with_use_metis(false)
+                          .with_max_leaf_size(8u)
+                          .on(this->ref);
+    auto dnd_factory = reorder_type::build()
+                           .with_use_metis(false)
+                           .with_max_leaf_size(8u)
+                           .on(this->exec);
+
+    auto perm = nd_factory->generate(this->mtx);
+    auto dperm = dnd_factory->generate(this->dmtx);
+
+    auto perm_array = gko::make_array_view(this->ref, this->mtx->get_size()[0],
+                                           perm->get_permutation());
+    auto dperm_array = gko::make_array_view(
+        this->exec, this->mtx->get_size()[0], dperm->get_permutation());
+    GKO_ASSERT_ARRAY_EQ(perm_array, dperm_array);
+}
@@ -10,7 +10,9 @@
 
 #include <ginkgo/core/base/exception.hpp>
 #include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/preconditioner/jacobi.hpp>
 #include <ginkgo/core/solver/cg.hpp>
 #include <ginkgo/core/stop/combined.hpp>
 #include <ginkgo/core/stop/iteration.hpp>
@@ -156,6 +158,67 @@ TEST_F(Cg, CgStep2IsEquivalentToRef)
 }
 
 
+TEST_F(Cg, CgFusedStep1IsEquivalentToRef)
+{
+    initialize_data();
+    auto inv_diag = gen_mtx(p->get_size()[0], 1, 1);
+    auto d_inv_diag = gko::clone(exec, inv_diag);
+
+    gko::kernels::reference::cg::fused_step_1(
+        ref, p.get(), r.get(), inv_diag->get_const_values(), rho.get(),
+        prev_rho.get(), stop_status.get());
+    gko::kernels::GKO_DEVICE_NAMESPACE::cg::fused_step_1(
+        exec, d_p.get(), d_r.get(), d_inv_diag->get_const_values(),
+        d_rho.get(), d_prev_rho.get(), d_stop_status.get());
+
+    GKO_ASSERT_MTX_NEAR(d_p, p, ::r<value_type>::value);
+}
+
+
+TEST_F(Cg, CgSpmvDotIsEquivalentToRef)
+{
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    initialize_data();
+    auto mtx = gko::test::generate_random_matrix<Csr>(
+        p->get_size()[0], p->get_size()[0],
+        std::uniform_int_distribution<>(1, 20),
+        std::normal_distribution<value_type>(-1.0, 1.0), rand_engine, ref);
+    auto d_mtx = gko::clone(exec, mtx);
+    gko::array<char> tmp{ref};
+    gko::array<char> d_tmp{exec};
+
+    gko::kernels::reference::cg::spmv_dot(ref, mtx.get(), p.get(), q.get(),
+                                          beta.get(), tmp);
+    gko::kernels::GKO_DEVICE_NAMESPACE::cg::spmv_dot(
+        exec, d_mtx.get(), d_p.get(), d_q.get(), d_beta.get(), d_tmp);
+
+    GKO_ASSERT_MTX_NEAR(d_q, q, ::r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_beta, beta, ::r<value_type>::value * 100);
+}
+
+
+TEST_F(Cg, CgFusedStep2IsEquivalentToRef)
+{
+    initialize_data();
+    auto inv_diag = gen_mtx(p->get_size()[0], 1, 1);
+    auto d_inv_diag = gko::clone(exec, inv_diag);
+    gko::array<char> tmp{ref};
+    gko::array<char> d_tmp{exec};
+
+    gko::kernels::reference::cg::fused_step_2(
+        ref, x.get(), r.get(), p.get(), q.get(), inv_diag->get_const_values(),
+        beta.get(), prev_rho.get(), rho.get(), tmp, stop_status.get());
+    gko::kernels::GKO_DEVICE_NAMESPACE::cg::fused_step_2(
+        exec, d_x.get(), d_r.get(), d_p.get(), d_q.get(),
+        d_inv_diag->get_const_values(), d_beta.get(), d_prev_rho.get(),
+        d_rho.get(), d_tmp, d_stop_status.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, ::r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_r, r, ::r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_rho, rho, ::r<value_type>::value * 100);
+}
+
+
 TEST_F(Cg, ApplyIsEquivalentToRef)
 {
     auto data = gko::matrix_data<value_type, index_type>(
@@ -189,3 +252,45 @@ TEST_F(Cg, ApplyIsEquivalentToRef)
 
     GKO_ASSERT_MTX_NEAR(d_x, x, ::r<value_type>::value * 1000);
 }
+
+
+TEST_F(Cg, ApplyWithCsrAndJacobiIsEquivalentToRef)
+{
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    auto data = gko::matrix_data<value_type, index_type>(
+        gko::dim<2>{50, 50}, std::normal_distribution<value_type>(-1.0, 1.0),
+        rand_engine);
+    gko::utils::make_hpd(data);
+    auto mtx = Csr::create(ref);
+    mtx->read(data);
+    auto x = gen_mtx(50, 3, 5);
+    auto b = gen_mtx(50, 3, 4);
+    auto d_mtx = gko::clone(exec, mtx);
+    auto d_x = gko::clone(exec, x);
+    auto d_b = gko::clone(exec, b);
+    auto cg_factory =
+        gko::solver::Cg<value_type>::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(50u),
+                           gko::stop::ResidualNorm<value_type>::build()
+                               .with_reduction_factor(::r<value_type>::value))
+            .with_preconditioner(
+                gko::preconditioner::Jacobi<value_type, index_type>::build()
+                    .with_max_block_size(1u))
+            .on(ref);
+    auto d_cg_factory =
+        gko::solver::Cg<value_type>::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(50u),
+                           gko::stop::ResidualNorm<value_type>::build()
+                               .with_reduction_factor(::r<value_type>::value))
+            .with_preconditioner(
+                gko::preconditioner::Jacobi<value_type, index_type>::build()
+                    .with_max_block_size(1u))
+            .on(exec);
+    auto solver = cg_factory->generate(std::move(mtx));
+    auto d_solver = d_cg_factory->generate(std::move(d_mtx));
+
+    solver->apply(b, x);
+    d_solver->apply(d_b, d_x);
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, ::r<value_type>::value * 1000);
+}
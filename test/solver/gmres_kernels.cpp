@@ -306,6 +306,120 @@ TEST_F(Gmres, GmresKernelMultiDotIsEquivalentToRef)
 }
 
 
+TEST_F(Gmres, GmresKernelBlockDotIsEquivalentToRef)
+{
+    initialize_data();
+    const gko::size_type num_prev_bases = 5;
+    const gko::size_type block_size = 4;
+    const auto num_bases = num_prev_bases + block_size;
+    auto bases = gen_mtx(x->get_size()[0] * num_bases, x->get_size()[1]);
+    auto d_bases = gko::clone(exec, bases);
+    auto coefficients = gen_mtx(num_bases * block_size, x->get_size()[1]);
+    auto d_coefficients = gko::clone(exec, coefficients);
+
+    gko::kernels::reference::gmres::block_dot(
+        ref, bases.get(), num_prev_bases, block_size, coefficients.get());
+    gko::kernels::GKO_DEVICE_NAMESPACE::gmres::block_dot(
+        exec, d_bases.get(), num_prev_bases, block_size, d_coefficients.get());
+
+    GKO_ASSERT_MTX_NEAR(d_coefficients, coefficients,
+                        r<value_type>::value * 10);
+}
+
+
+TEST_F(Gmres, GmresKernelBlockCholeskyIsEquivalentToRef)
+{
+    initialize_data();
+    const gko::size_type num_prev_bases = 5;
+    const gko::size_type block_size = 4;
+    const auto num_bases = num_prev_bases + block_size;
+    auto bases = gen_mtx(x->get_size()[0] * num_bases, x->get_size()[1]);
+    auto coefficients = gen_mtx(num_bases * block_size, x->get_size()[1]);
+    // the coefficients of a random basis contain a positive definite gram
+    // matrix
+    gko::kernels::reference::gmres::block_dot(
+        ref, bases.get(), num_prev_bases, block_size, coefficients.get());
+    stop_status.get_data()[2].stop(0, false);
+    d_stop_status = stop_status;
+    auto d_coefficients = gko::clone(exec, coefficients);
+
+    gko::kernels::reference::gmres::block_cholesky(
+        ref, coefficients.get(), num_prev_bases, block_size,
+        stop_status.get_const_data());
+    gko::kernels::GKO_DEVICE_NAMESPACE::gmres::block_cholesky(
+        exec, d_coefficients.get(), num_prev_bases, block_size,
+        d_stop_status.get_const_data());
+
+    GKO_ASSERT_MTX_NEAR(d_coefficients, coefficients,
+                        r<value_type>::value * 100);
+}
+
+
+TEST_F(Gmres, GmresKernelBlockOrthonormalizeIsEquivalentToRef)
+{
+    initialize_data();
+    const gko::size_type num_prev_bases = 5;
+    const gko::size_type block_size = 4;
+    const auto num_bases = num_prev_bases + block_size;
+    auto bases = gen_mtx(x->get_size()[0] * num_bases, x->get_size()[1]);
+    auto coefficients = gen_mtx(num_bases * block_size, x->get_size()[1]);
+    gko::kernels::reference::gmres::block_dot(
+        ref, bases.get(), num_prev_bases, block_size, coefficients.get());
+    gko::kernels::reference::gmres::block_cholesky(
+        ref, coefficients.get(), num_prev_bases, block_size,
+        stop_status.get_const_data());
+    stop_status.get_data()[2].stop(0, false);
+    d_stop_status = stop_status;
+    auto d_bases = gko::clone(exec, bases);
+    auto d_coefficients = gko::clone(exec, coefficients);
+
+    gko::kernels::reference::gmres::block_orthonormalize(
+        ref, bases.get(), coefficients.get(), num_prev_bases, block_size,
+        stop_status.get_const_data());
+    gko::kernels::GKO_DEVICE_NAMESPACE::gmres::block_orthonormalize(
+        exec, d_bases.get(), d_coefficients.get(), num_prev_bases, block_size,
+        d_stop_status.get_const_data());
+
+    GKO_ASSERT_MTX_NEAR(d_bases, bases, r<value_type>::value * 100);
+}
+
+
+TEST_F(Gmres, GmresKernelBlockHessenbergIsEquivalentToRef)
+{
+    initialize_data();
+    const gko::size_type iter = 3;
+    const gko::size_type block_size = 4;
+    const auto num_coefficients = (iter + 1 + block_size) * block_size;
+    auto coefficients = gen_mtx(num_coefficients, x->get_size()[1]);
+    auto reorth_coefficients = gen_mtx(num_coefficients, x->get_size()[1]);
+    auto arnoldi_hessenberg = gko::clone(ref, hessenberg);
+    auto basis_scaling = gen_mtx(1, x->get_size()[1]);
+    stop_status.get_data()[2].stop(0, false);
+    d_stop_status = stop_status;
+    auto d_coefficients = gko::clone(exec, coefficients);
+    auto d_reorth_coefficients = gko::clone(exec, reorth_coefficients);
+    auto d_arnoldi_hessenberg = gko::clone(exec, arnoldi_hessenberg);
+    auto d_basis_scaling = gko::clone(exec, basis_scaling);
+
+    gko::kernels::reference::gmres::block_hessenberg(
+        ref, coefficients.get(), reorth_coefficients.get(),
+        arnoldi_hessenberg.get(), hessenberg.get(), basis_scaling.get(), iter,
+        block_size, stop_status.get_const_data());
+    gko::kernels::GKO_DEVICE_NAMESPACE::gmres::block_hessenberg(
+        exec, d_coefficients.get(), d_reorth_coefficients.get(),
+        d_arnoldi_hessenberg.get(), d_hessenberg.get(), d_basis_scaling.get(),
+        iter, block_size, d_stop_status.get_const_data());
+
+    GKO_ASSERT_MTX_NEAR(d_coefficients, coefficients,
+                        r<value_type>::value * 100);
+    GKO_ASSERT_MTX_NEAR(d_arnoldi_hessenberg, arnoldi_hessenberg,
+                        r<value_type>::value * 100);
+    GKO_ASSERT_MTX_NEAR(d_hessenberg, hessenberg, r<value_type>::value * 100);
+    GKO_ASSERT_MTX_NEAR(d_basis_scaling, basis_scaling,
+                        r<value_type>::value * 100);
+}
+
+
 TEST_F(Gmres, GmresApplyOneRHSIsEquivalentToRef)
 {
     int m = 123;
@@ -25,6 +25,8 @@
 #include <ginkgo/core/solver/gmres.hpp>
 #include <ginkgo/core/solver/idr.hpp>
 #include <ginkgo/core/solver/ir.hpp>
+#include <ginkgo/core/solver/pipe_bicgstab.hpp>
+#include <ginkgo/core/solver/pipe_cg.hpp>
 #include <ginkgo/core/solver/triangular.hpp>
 #include <ginkgo/core/stop/iteration.hpp>
 #include <ginkgo/core/stop/residual_norm.hpp>
@@ -134,6 +136,22 @@ struct Bicgstab : SimpleSolverTest<gko::solver::Bicgstab<solver_value_type>> {
 };
 
 
+struct PipeCg : SimpleSolverTest<gko::solver::PipeCg<solver_value_type>> {
+    // reference and device only differ in the summation order of the dot
+    // products. Unlike Cg, which recomputes the residual from A * p, the
+    // recurrences for s = A * p, w = A * u and z = A * q carry these
+    // differences over from one iteration to the next (differences up to
+    // 1e6 * r were observed), like the flexible beta of Fcg.
+    static double tolerance() { return 1e7 * r<value_type>::value; }
+};
+
+
+struct PipeBicgstab
+    : SimpleSolverTest<gko::solver::PipeBicgstab<solver_value_type>> {
+    static double tolerance() { return 1e12 * r<value_type>::value; }
+};
+
+
 template <unsigned dimension>
 struct Idr : SimpleSolverTest<gko::solver::Idr<solver_value_type>> {
     static typename solver_type::parameters_type build(
@@ -884,7 +902,7 @@ protected:
 };
 
 using SolverTypes =
-    ::testing::Types<Cg, Cgs, Fcg, Bicg, Bicgstab,
+    ::testing::Types<Cg, Cgs, Fcg, Bicg, Bicgstab, PipeCg, PipeBicgstab,
                      /* "IDR uses different initialization approaches even when
                         deterministic", Idr<1>, Idr<4>,*/
                      Ir, CbGmres<2>, CbGmres<10>, Gmres<2>, Gmres<10>,
@@ -2,9 +2,14 @@
 //
 // SPDX-License-Identifier: BSD-3-Clause
 
+#include <algorithm>
 #include <memory>
 #include <random>
 
+#ifdef GKO_COMPILING_OMP
+#include <omp.h>
+#endif
+
 #include <gtest/gtest.h>
 
 #include <ginkgo/core/base/exception.hpp>
@@ -334,6 +339,48 @@ TEST_F(UpperTrs, ApplyTriangularSparseMtxUnitDiagMultipleRhsIsEquivalentToRef)
 }
 
 
+TEST_F(UpperTrs, ApplyTriangularMtxWithWideLevelsIsEquivalentToRef)
+{
+    // every row only depends on rows with the same remainder modulo stride,
+    // so the level sets contain stride rows each
+    const int size = 2000;
+    const int stride = 100;
+    std::normal_distribution<> value_dist(-1.0, 1.0);
+    gko::matrix_data<value_type, index_type> data{gko::dim<2>(size, size)};
+    for (int row = 0; row < size; row++) {
+        data.nonzeros.emplace_back(row, row, 4.0 + value_dist(rand_engine));
+        for (int col = row + stride; col < size; col += stride) {
+            data.nonzeros.emplace_back(row, col, value_dist(rand_engine));
+        }
+    }
+    data.sort_row_major();
+    mtx_u = mtx_type::create(ref);
+    mtx_u->read(data);
+    dmtx_u = gko::clone(exec, mtx_u);
+    b = gen_vec(size, 3);
+    x = gen_vec(size, 3);
+    db = gko::clone(exec, b);
+    dx = gko::clone(exec, x);
+    auto upper_trs_factory = solver_type::build().with_num_rhs(3u).on(ref);
+    auto d_upper_trs_factory = solver_type::build().with_num_rhs(3u).on(exec);
+    auto solver = upper_trs_factory->generate(mtx_u);
+    auto d_solver = d_upper_trs_factory->generate(dmtx_u);
+#ifdef GKO_COMPILING_OMP
+    // the level-scheduled solve is only used with multiple threads
+    const auto num_threads = omp_get_max_threads();
+    omp_set_num_threads(std::max(num_threads, 4));
+#endif
+
+    solver->apply(b, x);
+    d_solver->apply(db, dx);
+
+#ifdef GKO_COMPILING_OMP
+    omp_set_num_threads(num_threads);
+#endif
+    GKO_ASSERT_MTX_NEAR(dx, x, 1e-14);
+}
+
+
 #ifdef GKO_COMPILING_CUDA
 
 